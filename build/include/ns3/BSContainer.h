@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/BSContainer.h
\ No newline at end of file
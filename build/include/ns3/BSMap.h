@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/BSMap.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1cpp/BitString.hpp
\ No newline at end of file
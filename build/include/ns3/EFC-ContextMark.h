@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1-v2/EFC-ContextMark.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1cpp/Getter.hpp
\ No newline at end of file
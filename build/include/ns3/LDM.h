@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/LDM.h
\ No newline at end of file
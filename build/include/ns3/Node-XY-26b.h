@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1-v2/Node-XY-26b.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Measurements/PRRSupervisor.h
\ No newline at end of file
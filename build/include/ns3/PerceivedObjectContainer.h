@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1-v2/PerceivedObjectContainer.h
\ No newline at end of file
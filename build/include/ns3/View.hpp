@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1cpp/View.hpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1-v2/aper_support.h
\ No newline at end of file
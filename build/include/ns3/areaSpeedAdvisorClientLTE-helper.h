@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/areaSpeedAdvisorClientLTE-helper.h
\ No newline at end of file
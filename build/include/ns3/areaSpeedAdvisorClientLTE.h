@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/areaSpeedAdvisorClientLTE.h
\ No newline at end of file
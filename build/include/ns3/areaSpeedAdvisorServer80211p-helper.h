@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/areaSpeedAdvisorServer80211p-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/areaSpeedAdvisorServer80211p.h
\ No newline at end of file
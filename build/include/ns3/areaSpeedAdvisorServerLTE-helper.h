@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/areaSpeedAdvisorServerLTE-helper.h
\ No newline at end of file
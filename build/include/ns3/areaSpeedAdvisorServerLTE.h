@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/areaSpeedAdvisorServerLTE.h
\ No newline at end of file
@@ -0,0 +1,1200 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_AUTOMOTIVE
+    // Module headers: 
+    #include <ns3/areaSpeedAdvisorClientLTE-helper.h>
+    #include <ns3/areaSpeedAdvisorServerLTE-helper.h>
+    #include <ns3/areaSpeedAdvisorClient80211p-helper.h>
+    #include <ns3/areaSpeedAdvisorServer80211p-helper.h>
+    #include <ns3/emergencyVehicleAlert-helper.h>
+    #include <ns3/v2xEmulator-helper.h>
+    #include <ns3/simpleCAMSender-helper.h>
+    #include <ns3/areaSpeedAdvisorClient80211p.h>
+    #include <ns3/areaSpeedAdvisorServer80211p.h>
+    #include <ns3/areaSpeedAdvisorClientLTE.h>
+    #include <ns3/areaSpeedAdvisorServerLTE.h>
+    #include <ns3/emergencyVehicleAlert.h>
+    #include <ns3/simpleCAMSender-gps-tc.h>
+    #include <ns3/denBasicService.h>
+    #include <ns3/denData.h>
+    #include <ns3/asn_utils.h>
+    #include <ns3/ITSSOriginatingTableEntry.h>
+    #include <ns3/ITSSReceivingTableEntry.h>
+    #include <ns3/vdpTraci.h>
+    #include <ns3/vdpGPSTraceClient.h>
+    #include <ns3/vdp.h>
+    #include <ns3/caBasicService.h>
+    #include <ns3/sumo_xml_parser.h>
+    #include <ns3/cpBasicService.h>
+    #include <ns3/specializedEncoders.h>
+    #include <ns3/LDM.h>
+    #include <ns3/phPoints.h>
+    #include <ns3/ldm-utils.h>
+    #include <ns3/sumo-sensor.h>
+    #include <ns3/timing-wheel.h>
+    #include <ns3/hdr-histogram.h>
+    #include <ns3/v2xEmulator.h>
+    #include <ns3/PRRSupervisor.h>
+    #include <ns3/emergencyVehicleWarningServer80211p-helper.h>
+    #include <ns3/emergencyVehicleWarningClient80211p-helper.h>
+    #include <ns3/trafficManagerClient80211p-helper.h>
+    #include <ns3/trafficManagerServer80211p-helper.h>
+    #include <ns3/trafficManagerClientLTE-helper.h>
+    #include <ns3/trafficManagerServerLTE-helper.h>
+    #include <ns3/trafficManagerClient80211p.h>
+    #include <ns3/trafficManagerServer80211p.h>
+    #include <ns3/trafficManagerClientLTE.h>
+    #include <ns3/trafficManagerServerLTE.h>
+    #include <ns3/emergencyVehicleWarningServer.h>
+    #include <ns3/emergencyVehicleWarningClient.h>
+    #include <ns3/ividata.h>
+    #include <ns3/iviService.h>
+    #include <ns3/BSMap.h>
+    #include <ns3/BSContainer.h>
+    #include <ns3/caBasicService_v1.h>
+    #include <ns3/denBasicService_v1.h>
+    #include <ns3/btp.h>
+    #include <ns3/btpHeader.h>
+    #include <ns3/simple-btp-application.h>
+    #include <ns3/btpdatarequest.h>
+    #include <ns3/geonet.h>
+    #include <ns3/gn-address.h>
+    #include <ns3/tsb-header.h>
+    #include <ns3/shb-header.h>
+    #include <ns3/gbc-header.h>
+    #include <ns3/basic-header.h>
+    #include <ns3/common-header.h>
+    #include <ns3/longpositionvector.h>
+    #include <ns3/shortpositionvector.h>
+    #include <ns3/beacon-header.h>
+    #include <ns3/gn-utils.h>
+    #include <ns3/gn-location-table.h>
+    #include <ns3/dcc.h>
+    #include <ns3/v2x-spectrum-channel.h>
+    #include <ns3/BitString.hpp>
+    #include <ns3/Encoding.hpp>
+    #include <ns3/Getter.hpp>
+    #include <ns3/Seq.hpp>
+    #include <ns3/SequenceOf.hpp>
+    #include <ns3/SetOf.hpp>
+    #include <ns3/Setter.hpp>
+    #include <ns3/Utils.hpp>
+    #include <ns3/View.hpp>
+    #include <ns3/AbsolutePosition.h>
+    #include <ns3/AbsolutePositions.h>
+    #include <ns3/AbsolutePositionsWAltitude.h>
+    #include <ns3/AbsolutePositionWAltitude.h>
+    #include <ns3/Acceleration3dWithConfidence.h>
+    #include <ns3/AccelerationCartesian.h>
+    #include <ns3/AccelerationChange.h>
+    #include <ns3/AccelerationChangeIndication.h>
+    #include <ns3/AccelerationComponent.h>
+    #include <ns3/AccelerationConfidence.h>
+    #include <ns3/AccelerationControl.h>
+    #include <ns3/AccelerationMagnitude.h>
+    #include <ns3/AccelerationMagnitudeValue.h>
+    #include <ns3/AccelerationPolarWithZ.h>
+    #include <ns3/AccelerationValue.h>
+    #include <ns3/AccessTechnologyClass.h>
+    #include <ns3/AccidentSubCauseCode.h>
+    #include <ns3/ActionId.h>
+    #include <ns3/ActionID.h>
+    #include <ns3/ActionIdList.h>
+    #include <ns3/ActualNumberOfPassengers.h>
+    #include <ns3/AddRq.h>
+    #include <ns3/AdverseWeatherCondition-AdhesionSubCauseCode.h>
+    #include <ns3/AdverseWeatherCondition-ExtremeWeatherConditionSubCauseCode.h>
+    #include <ns3/AdverseWeatherCondition-PrecipitationSubCauseCode.h>
+    #include <ns3/AdverseWeatherCondition-VisibilitySubCauseCode.h>
+    #include <ns3/AdvisorySpeed.h>
+    #include <ns3/AdvisorySpeedList.h>
+    #include <ns3/AdvisorySpeedType.h>
+    #include <ns3/AirHumidity.h>
+    #include <ns3/AlacarteContainer.h>
+    #include <ns3/AllowedManeuvers.h>
+    #include <ns3/AlphabetIndicator.h>
+    #include <ns3/AltitudeConfidence.h>
+    #include <ns3/Altitude.h>
+    #include <ns3/AltitudeValue.h>
+    #include <ns3/AngleConfidence.h>
+    #include <ns3/Angle.h>
+    #include <ns3/AngularAccelerationConfidence.h>
+    #include <ns3/AngularSpeedConfidence.h>
+    #include <ns3/AnimalSubclass.h>
+    #include <ns3/AnimalSubclassType.h>
+    #include <ns3/AntennaOffsetSet.h>
+    #include <ns3/AnyCatalogue.h>
+    #include <ns3/ANY.h>
+    #include <ns3/aper_decoder.h>
+    #include <ns3/aper_encoder.h>
+    #include <ns3/aper_opentype.h>
+    #include <ns3/aper_support.h>
+    #include <ns3/ApproachID.h>
+    #include <ns3/AreaCircular.h>
+    #include <ns3/AreaEllipse.h>
+    #include <ns3/AreaPolygon.h>
+    #include <ns3/AreaRadial.h>
+    #include <ns3/AreaRectangle.h>
+    #include <ns3/asn_application.h>
+    #include <ns3/asn_bit_data.h>
+    #include <ns3/asn_codecs.h>
+    #include <ns3/asn_codecs_prim.h>
+    #include <ns3/asn_config.h>
+    #include <ns3/asn_constant.h>
+    #include <ns3/asn_internal.h>
+    #include <ns3/asn_ioc.h>
+    #include <ns3/asn_random_fill.h>
+    #include <ns3/asn_SEQUENCE_OF.h>
+    #include <ns3/asn_SET_OF.h>
+    #include <ns3/asn_system.h>
+    #include <ns3/AttributeIdList.h>
+    #include <ns3/AttributeList.h>
+    #include <ns3/Attributes.h>
+    #include <ns3/AutomatedVehicleContainer.h>
+    #include <ns3/AutomatedVehicleRule.h>
+    #include <ns3/AutomatedVehicleRules.h>
+    #include <ns3/AvailableCPU.h>
+    #include <ns3/AvcPart.h>
+    #include <ns3/AVIAEIIssuerIdentifier.h>
+    #include <ns3/AviEriDateTime.h>
+    #include <ns3/AxlesCount.h>
+    #include <ns3/AxleWeightLimits.h>
+    #include <ns3/BankingAngle.h>
+    #include <ns3/BarometricPressure.h>
+    #include <ns3/BasicContainer.h>
+    #include <ns3/BasicVehicleContainerHighFrequency.h>
+    #include <ns3/BasicVehicleContainerLowFrequency.h>
+    #include <ns3/BasicVehicleRole.h>
+    #include <ns3/BatteryStatus.h>
+    #include <ns3/ber_decoder.h>
+    #include <ns3/ber_tlv_length.h>
+    #include <ns3/ber_tlv_tag.h>
+    #include <ns3/BIT_STRING.h>
+    #include <ns3/BMPString.h>
+    #include <ns3/BogiesCount.h>
+    #include <ns3/BOOLEAN.h>
+    #include <ns3/CAM.h>
+    #include <ns3/CamParameters.h>
+    #include <ns3/CardinalNumber1B.h>
+    #include <ns3/CardinalNumber3b.h>
+    #include <ns3/CartesianAngle.h>
+    #include <ns3/CartesianAngleValue.h>
+    #include <ns3/CartesianAngularAccelerationComponent.h>
+    #include <ns3/CartesianAngularAccelerationComponentValue.h>
+    #include <ns3/CartesianAngularVelocityComponent.h>
+    #include <ns3/CartesianAngularVelocityComponentValue.h>
+    #include <ns3/CartesianCoordinate.h>
+    #include <ns3/CartesianCoordinateLarge.h>
+    #include <ns3/CartesianCoordinateSmall.h>
+    #include <ns3/CartesianCoordinateWithConfidence.h>
+    #include <ns3/CartesianPosition3d.h>
+    #include <ns3/CartesianPosition3dWithConfidence.h>
+    #include <ns3/CauseCodeChoice.h>
+    #include <ns3/CauseCode.h>
+    #include <ns3/CauseCodeType.h>
+    #include <ns3/CauseCodeV2.h>
+    #include <ns3/CenDsrcTollingZone.h>
+    #include <ns3/CenDsrcTollingZoneID.h>
+    #include <ns3/ChannelId.h>
+    #include <ns3/ChannelRq.h>
+    #include <ns3/ChannelRs.h>
+    #include <ns3/CircularShape.h>
+    #include <ns3/ClassConfidence.h>
+    #include <ns3/ClosedLanes.h>
+    #include <ns3/ClusterBreakupInfo.h>
+    #include <ns3/ClusterBreakupReason.h>
+    #include <ns3/ClusterJoinInfo.h>
+    #include <ns3/ClusterLeaveInfo.h>
+    #include <ns3/ClusterLeaveReason.h>
+    #include <ns3/CO2EmissionValue.h>
+    #include <ns3/Code-Units.h>
+    #include <ns3/CollectivePerceptionMessage.h>
+    #include <ns3/CollisionRiskSubCauseCode.h>
+    #include <ns3/ComparisonOperator.h>
+    #include <ns3/CompleteVehicleCharacteristics.h>
+    #include <ns3/ComputedLane.h>
+    #include <ns3/ComputedSegment.h>
+    #include <ns3/Condition.h>
+    #include <ns3/ConfidenceLevel.h>
+    #include <ns3/ConnectedDenms.h>
+    #include <ns3/ConnectedVehiclesIDs.h>
+    #include <ns3/ConnectingLane.h>
+    #include <ns3/Connection.h>
+    #include <ns3/ConnectionManeuverAssist-addGrpC.h>
+    #include <ns3/ConnectionManeuverAssist.h>
+    #include <ns3/ConnectionTrajectory-addGrpC.h>
+    #include <ns3/ConnectsToList.h>
+    #include <ns3/constraints.h>
+    #include <ns3/ConstraintTextLines1.h>
+    #include <ns3/ConstraintTextLines2.h>
+    #include <ns3/constr_CHOICE.h>
+    #include <ns3/constr_SEQUENCE.h>
+    #include <ns3/constr_SEQUENCE_OF.h>
+    #include <ns3/constr_SET.h>
+    #include <ns3/constr_SET_OF.h>
+    #include <ns3/constr_TYPE.h>
+    #include <ns3/ContractAuthenticator.h>
+    #include <ns3/ContractSerialNumber.h>
+    #include <ns3/ContractValidity.h>
+    #include <ns3/ContractVehicle.h>
+    #include <ns3/CoopAwareness.h>
+    #include <ns3/CoordinateConfidence.h>
+    #include <ns3/CopValue.h>
+    #include <ns3/CopyRq.h>
+    #include <ns3/CorrelationCellValue.h>
+    #include <ns3/CorrelationColumn.h>
+    #include <ns3/CountryCode.h>
+    #include <ns3/CPM.h>
+    #include <ns3/CpmManagementContainer.h>
+    #include <ns3/CpmParameters.h>
+    #include <ns3/CreditRq.h>
+    #include <ns3/CreditRs.h>
+    #include <ns3/CS1.h>
+    #include <ns3/CS2.h>
+    #include <ns3/CS3.h>
+    #include <ns3/CS4.h>
+    #include <ns3/CS5.h>
+    #include <ns3/CS7.h>
+    #include <ns3/CS8.h>
+    #include <ns3/CurvatureCalculationMode.h>
+    #include <ns3/CurvatureConfidence.h>
+    #include <ns3/Curvature.h>
+    #include <ns3/CurvatureValue.h>
+    #include <ns3/DangerousEndOfQueueSubCauseCode.h>
+    #include <ns3/DangerousGoodsBasic.h>
+    #include <ns3/DangerousGoodsContainer.h>
+    #include <ns3/DangerousGoodsExtended.h>
+    #include <ns3/DangerousSituationSubCauseCode.h>
+    #include <ns3/DataParameters.h>
+    #include <ns3/DateAndTime.h>
+    #include <ns3/DateCompact.h>
+    #include <ns3/DayOfWeek.h>
+    #include <ns3/DBV.h>
+    #include <ns3/DDateTime.h>
+    #include <ns3/DDay.h>
+    #include <ns3/DDD-DEP.h>
+    #include <ns3/DDD-DER.h>
+    #include <ns3/DDD.h>
+    #include <ns3/DDD-IO.h>
+    #include <ns3/DDD-IO-LIST.h>
+    #include <ns3/DebitRq.h>
+    #include <ns3/DebitRs.h>
+    #include <ns3/DecentralizedEnvironmentalNotificationMessage.h>
+    #include <ns3/DefinitionAccuracy.h>
+    #include <ns3/DeltaAltitude.h>
+    #include <ns3/DeltaAngle.h>
+    #include <ns3/DeltaLatitude.h>
+    #include <ns3/DeltaLongitude.h>
+    #include <ns3/DeltaPosition.h>
+    #include <ns3/DeltaPositions.h>
+    #include <ns3/DeltaReferencePosition.h>
+    #include <ns3/DeltaReferencePositions.h>
+    #include <ns3/DeltaTime.h>
+    #include <ns3/DeltaTimeMilliSecondPositive.h>
+    #include <ns3/DeltaTimeMilliSecondSigned.h>
+    #include <ns3/DeltaTimeQuarterSecond.h>
+    #include <ns3/DeltaTimeSecond.h>
+    #include <ns3/DeltaTimeTenthOfSecond.h>
+    #include <ns3/DENM.h>
+    #include <ns3/Depth.h>
+    #include <ns3/der_encoder.h>
+    #include <ns3/DescriptiveCharacteristics.h>
+    #include <ns3/DescriptiveName.h>
+    #include <ns3/DestinationPlace.h>
+    #include <ns3/DestinationPlaces.h>
+    #include <ns3/DestinationRoad.h>
+    #include <ns3/DestinationRoads.h>
+    #include <ns3/DestinationRoadType.h>
+    #include <ns3/DestinationType.h>
+    #include <ns3/DetectionArea.h>
+    #include <ns3/DFL.h>
+    #include <ns3/DHour.h>
+    #include <ns3/DieselEmissionValues.h>
+    #include <ns3/DigitalMap.h>
+    #include <ns3/Direction.h>
+    #include <ns3/DistanceConfidence.h>
+    #include <ns3/Distance.h>
+    #include <ns3/DistanceOrDuration.h>
+    #include <ns3/DistanceValue.h>
+    #include <ns3/DMinute.h>
+    #include <ns3/DMonth.h>
+    #include <ns3/DOffset.h>
+    #include <ns3/DriveDirection.h>
+    #include <ns3/DrivenLineOffsetLg.h>
+    #include <ns3/DrivenLineOffsetSm.h>
+    #include <ns3/DriverCharacteristics.h>
+    #include <ns3/DrivingLaneStatus.h>
+    #include <ns3/DSecond.h>
+    #include <ns3/DSRCmsgID.h>
+    #include <ns3/DTM.h>
+    #include <ns3/DYear.h>
+    #include <ns3/DynamicStatus.h>
+    #include <ns3/EDT.h>
+    #include <ns3/EFC-ContextMark.h>
+    #include <ns3/EfcDsrcApplication_DriverCharacteristics.h>
+    #include <ns3/EfcDsrcApplication_TrailerCharacteristics.h>
+    #include <ns3/EFC-StationType.h>
+    #include <ns3/ElevationConfidence.h>
+    #include <ns3/Elevation.h>
+    #include <ns3/EllipticalShape.h>
+    #include <ns3/EmbarkationStatus.h>
+    #include <ns3/EmergencyContainer.h>
+    #include <ns3/EmergencyPriority.h>
+    #include <ns3/EmergencyVehicleApproachingSubCauseCode.h>
+    #include <ns3/EmissionType.h>
+    #include <ns3/EnabledLaneList.h>
+    #include <ns3/EnergyStorageType.h>
+    #include <ns3/EngineCharacteristics.h>
+    #include <ns3/Engine.h>
+    #include <ns3/ENUMERATED.h>
+    #include <ns3/EnvironmentalCharacteristics.h>
+    #include <ns3/EquipmentOBUId.h>
+    #include <ns3/EquipmentStatus.h>
+    #include <ns3/EulerAnglesWithConfidence.h>
+    #include <ns3/EuroValue.h>
+    #include <ns3/EuVehicleCategoryCode.h>
+    #include <ns3/EuVehicleCategoryL.h>
+    #include <ns3/EuVehicleCategoryM.h>
+    #include <ns3/EuVehicleCategoryN.h>
+    #include <ns3/EuVehicleCategoryO.h>
+    #include <ns3/EventHistory.h>
+    #include <ns3/EventPoint.h>
+    #include <ns3/EventZone.h>
+    #include <ns3/ExceptionalCondition.h>
+    #include <ns3/ExhaustEmissionValues.h>
+    #include <ns3/Ext1.h>
+    #include <ns3/Ext2.h>
+    #include <ns3/Ext3.h>
+    #include <ns3/ExteriorLights.h>
+    #include <ns3/EXTERNAL.h>
+    #include <ns3/FreeSpaceAddendumContainer.h>
+    #include <ns3/FreeSpaceAddendum.h>
+    #include <ns3/FreeSpaceArea.h>
+    #include <ns3/FreeSpaceConfidence.h>
+    #include <ns3/FreightContainerData.h>
+    #include <ns3/FrictionCoefficient.h>
+    #include <ns3/FrontOverhang.h>
+    #include <ns3/FuelType.h>
+    #include <ns3/FullPositionVector.h>
+    #include <ns3/FutureCharacteristics.h>
+    #include <ns3/GapBetweenVehicles.h>
+    #include <ns3/GddAttribute.h>
+    #include <ns3/GddAttributes.h>
+    #include <ns3/GddStructure.h>
+    #include <ns3/GeneralIviContainer.h>
+    #include <ns3/GeneralizedLanePosition.h>
+    #include <ns3/GeneralizedTime.h>
+    #include <ns3/GeneralString.h>
+    #include <ns3/GenerationDeltaTime.h>
+    #include <ns3/GenericLane.h>
+    #include <ns3/GeoGraphicalLimit.h>
+    #include <ns3/GeographicLocationContainer.h>
+    #include <ns3/GetInstanceRq.h>
+    #include <ns3/GetInstanceRs.h>
+    #include <ns3/GetStampedRq.h>
+    #include <ns3/GetStampedRs.h>
+    #include <ns3/GicPart.h>
+    #include <ns3/GlcPart.h>
+    #include <ns3/GlcParts.h>
+    #include <ns3/GNSSstatus.h>
+    #include <ns3/GoodsType.h>
+    #include <ns3/GraphicString.h>
+    #include <ns3/HardShoulderStatus.h>
+    #include <ns3/HazardousLocation-AnimalOnTheRoadSubCauseCode.h>
+    #include <ns3/HazardousLocation-DangerousCurveSubCauseCode.h>
+    #include <ns3/HazardousLocation-ObstacleOnTheRoadSubCauseCode.h>
+    #include <ns3/HazardousLocation-SurfaceConditionSubCauseCode.h>
+    #include <ns3/HeadingChangeIndication.h>
+    #include <ns3/HeadingConfidence.h>
+    #include <ns3/Heading.h>
+    #include <ns3/HeadingIsoConfidenceIso.h>
+    #include <ns3/HeadingIso.h>
+    #include <ns3/HeadingValue.h>
+    #include <ns3/HeightLonCarr.h>
+    #include <ns3/HighFrequencyContainer.h>
+    #include <ns3/HitchPointOffset.h>
+    #include <ns3/HoursMinutes.h>
+    #include <ns3/HumanPresenceOnTheRoadSubCauseCode.h>
+    #include <ns3/HumanProblemSubCauseCode.h>
+    #include <ns3/IA5String.h>
+    #include <ns3/ICC-Id.h>
+    #include <ns3/Identifier1B.h>
+    #include <ns3/Identifier2B.h>
+    #include <ns3/Identifier.h>
+    #include <ns3/ImpactReductionContainer.h>
+    #include <ns3/InformationQuality.h>
+    #include <ns3/Int1.h>
+    #include <ns3/Int2.h>
+    #include <ns3/Int3.h>
+    #include <ns3/Int4.h>
+    #include <ns3/INTEGER.h>
+    #include <ns3/InterferenceManagementChannel.h>
+    #include <ns3/InterferenceManagementInfo.h>
+    #include <ns3/InterferenceManagementInfoPerChannel.h>
+    #include <ns3/InterferenceManagementZoneDefinition.h>
+    #include <ns3/InterferenceManagementZone.h>
+    #include <ns3/InterferenceManagementZones.h>
+    #include <ns3/InterferenceManagementZoneType.h>
+    #include <ns3/InternationalSign-applicablePeriod.h>
+    #include <ns3/InternationalSign-applicableVehicleDimensions.h>
+    #include <ns3/InternationalSign-destinationInformation.h>
+    #include <ns3/InternationalSign-directionalFlowOfLane.h>
+    #include <ns3/InternationalSign-distanceBetweenVehicles.h>
+    #include <ns3/InternationalSign-exemptedApplicablePeriod.h>
+    #include <ns3/InternationalSign-numberOfLane.h>
+    #include <ns3/InternationalSign-rateOfIncline.h>
+    #include <ns3/InternationalSign-section.h>
+    #include <ns3/InternationalSign-speedLimits.h>
+    #include <ns3/IntersectionAccessPoint.h>
+    #include <ns3/IntersectionGeometry.h>
+    #include <ns3/IntersectionGeometryList.h>
+    #include <ns3/IntersectionID.h>
+    #include <ns3/IntersectionReferenceId.h>
+    #include <ns3/IntersectionReferenceID.h>
+    #include <ns3/IntersectionState-addGrpC.h>
+    #include <ns3/IntersectionState.h>
+    #include <ns3/IntersectionStateList.h>
+    #include <ns3/IntersectionStatusObject.h>
+    #include <ns3/ISO14823Attribute.h>
+    #include <ns3/ISO14823Attributes.h>
+    #include <ns3/ISO14823AttributesMember.h>
+    #include <ns3/ISO14823Code.h>
+    #include <ns3/Iso3833VehicleType.h>
+    #include <ns3/ISO646String.h>
+    #include <ns3/IssuerIdentifierIso.h>
+    #include <ns3/ItineraryPath.h>
+    #include <ns3/ITS-Container_Temperature.h>
+    #include <ns3/ItsPduHeader.h>
+    #include <ns3/ItsPduHeaderVam.h>
+    #include <ns3/ItsStationPosition.h>
+    #include <ns3/ItsStationPositionList.h>
+    #include <ns3/IviContainer.h>
+    #include <ns3/IviContainers.h>
+    #include <ns3/IVI_DriverCharacteristics.h>
+    #include <ns3/IVI.h>
+    #include <ns3/IviIdentificationNumber.h>
+    #include <ns3/IviIdentificationNumbers.h>
+    #include <ns3/IviLaneWidth.h>
+    #include <ns3/IVILaneWidth.h>
+    #include <ns3/IviManagementContainer.h>
+    #include <ns3/IVIManagementContainer.h>
+    #include <ns3/IVIM.h>
+    #include <ns3/IviPurpose.h>
+    #include <ns3/IviStatus.h>
+    #include <ns3/IviStructure.h>
+    #include <ns3/IVI_Temperature.h>
+    #include <ns3/IVI_TrailerCharacteristics.h>
+    #include <ns3/IviType.h>
+    #include <ns3/jer_encoder.h>
+    #include <ns3/LaneAttributes-addGrpC.h>
+    #include <ns3/LaneAttributes-Barrier.h>
+    #include <ns3/LaneAttributes-Bike.h>
+    #include <ns3/LaneAttributes-Crosswalk.h>
+    #include <ns3/LaneAttributes.h>
+    #include <ns3/LaneAttributes-Parking.h>
+    #include <ns3/LaneAttributes-Sidewalk.h>
+    #include <ns3/LaneAttributes-Striping.h>
+    #include <ns3/LaneAttributes-TrackedVehicle.h>
+    #include <ns3/LaneAttributes-Vehicle.h>
+    #include <ns3/LaneCharacteristics.h>
+    #include <ns3/LaneConfiguration.h>
+    #include <ns3/LaneConnectionID.h>
+    #include <ns3/LaneDataAttribute.h>
+    #include <ns3/LaneDataAttributeList.h>
+    #include <ns3/LaneDelimitation.h>
+    #include <ns3/LaneDirection.h>
+    #include <ns3/LaneID.h>
+    #include <ns3/LaneIds.h>
+    #include <ns3/LaneInformation.h>
+    #include <ns3/LaneList.h>
+    #include <ns3/LaneMarkingStatus.h>
+    #include <ns3/LanePositionAndType.h>
+    #include <ns3/LanePosition.h>
+    #include <ns3/LanePositions.h>
+    #include <ns3/LaneSharing.h>
+    #include <ns3/LaneStatus.h>
+    #include <ns3/LaneTypeAttributes.h>
+    #include <ns3/LaneType.h>
+    #include <ns3/LaneWidth.h>
+    #include <ns3/LateralAcceleration.h>
+    #include <ns3/LateralAccelerationValue.h>
+    #include <ns3/Latitude.h>
+    #include <ns3/LayerID.h>
+    #include <ns3/LayerType.h>
+    #include <ns3/LayoutComponent.h>
+    #include <ns3/LayoutComponents.h>
+    #include <ns3/LayoutContainer.h>
+    #include <ns3/LicPlateNumber.h>
+    #include <ns3/LightBarSirenInUse.h>
+    #include <ns3/LoadType.h>
+    #include <ns3/LocationContainer.h>
+    #include <ns3/Longitude.h>
+    #include <ns3/LongitudinalAcceleration.h>
+    #include <ns3/LongitudinalAccelerationValue.h>
+    #include <ns3/LongitudinalLanePositionConfidence.h>
+    #include <ns3/LongitudinalLanePosition.h>
+    #include <ns3/LongitudinalLanePositionValue.h>
+    #include <ns3/LowerTriangularPositiveSemidefiniteMatrices.h>
+    #include <ns3/LowerTriangularPositiveSemidefiniteMatrixColumns.h>
+    #include <ns3/LowerTriangularPositiveSemidefiniteMatrix.h>
+    #include <ns3/LowFrequencyContainer.h>
+    #include <ns3/LPN.h>
+    #include <ns3/ManagementContainer.h>
+    #include <ns3/ManeuverAssistList.h>
+    #include <ns3/ManufacturerIdentifier.h>
+    #include <ns3/MapData-addGrpC.h>
+    #include <ns3/MapData.h>
+    #include <ns3/MAPEM.h>
+    #include <ns3/MapLocationContainer.h>
+    #include <ns3/MapPosition.h>
+    #include <ns3/MapReference.h>
+    #include <ns3/MarkingColour.h>
+    #include <ns3/MatchedPosition.h>
+    #include <ns3/MaterialType.h>
+    #include <ns3/MatrixIncludedComponents.h>
+    #include <ns3/MaxLenghtOfPlatoon.h>
+    #include <ns3/MaxNoOfVehicles.h>
+    #include <ns3/MergeDivergeNodeAngle.h>
+    #include <ns3/MessageId.h>
+    #include <ns3/MessageRateHz.h>
+    #include <ns3/MessageSegmentationInfo.h>
+    #include <ns3/MinuteOfTheYear.h>
+    #include <ns3/MitigationForTechnologies.h>
+    #include <ns3/MitigationPerTechnologyClass.h>
+    #include <ns3/MlcPart.h>
+    #include <ns3/MlcParts.h>
+    #include <ns3/MonthDay.h>
+    #include <ns3/MovementEvent-addGrpC.h>
+    #include <ns3/MovementEvent.h>
+    #include <ns3/MovementEventList.h>
+    #include <ns3/MovementList.h>
+    #include <ns3/MovementPhaseState.h>
+    #include <ns3/MovementState.h>
+    #include <ns3/MsgCount.h>
+    #include <ns3/NativeEnumerated.h>
+    #include <ns3/NativeInteger.h>
+    #include <ns3/NativeReal.h>
+    #include <ns3/NodeAttributeSet-addGrpC.h>
+    #include <ns3/NodeAttributeSetXY.h>
+    #include <ns3/NodeAttributeXY.h>
+    #include <ns3/NodeAttributeXYList.h>
+    #include <ns3/NodeITS.h>
+    #include <ns3/NodeLink.h>
+    #include <ns3/NodeListXY.h>
+    #include <ns3/Node-LLmD-64b.h>
+    #include <ns3/NodeOffsetPointXY.h>
+    #include <ns3/NodeOffsetPointZ.h>
+    #include <ns3/NodeSetXY.h>
+    #include <ns3/Node-XY-20b.h>
+    #include <ns3/Node-XY-22b.h>
+    #include <ns3/Node-XY-24b.h>
+    #include <ns3/Node-XY-26b.h>
+    #include <ns3/Node-XY-28b.h>
+    #include <ns3/Node-XY-32b.h>
+    #include <ns3/NodeXY.h>
+    #include <ns3/NonPlatoonMember.h>
+    #include <ns3/NonPlatoonMembers.h>
+    #include <ns3/NULL.h>
+    #include <ns3/NumberOfOccupants.h>
+    #include <ns3/NumberOfPerceivedObjects.h>
+    #include <ns3/NumericString.h>
+    #include <ns3/ObjectAge.h>
+    #include <ns3/ObjectClassDescription.h>
+    #include <ns3/ObjectClass.h>
+    #include <ns3/ObjectClassWithConfidence.h>
+    #include <ns3/ObjectConfidence.h>
+    #include <ns3/ObjectDescriptor.h>
+    #include <ns3/ObjectDimensionConfidence.h>
+    #include <ns3/ObjectDimension.h>
+    #include <ns3/ObjectDimensionValue.h>
+    #include <ns3/ObjectDistanceWithConfidence.h>
+    #include <ns3/ObjectFace.h>
+    #include <ns3/OBJECT_IDENTIFIER.h>
+    #include <ns3/ObjectPerceptionQuality.h>
+    #include <ns3/ObjectRefPoint.h>
+    #include <ns3/OCTET_STRING.h>
+    #include <ns3/oer_decoder.h>
+    #include <ns3/oer_encoder.h>
+    #include <ns3/oer_support.h>
+    #include <ns3/Offset-B09.h>
+    #include <ns3/Offset-B10.h>
+    #include <ns3/Offset-B11.h>
+    #include <ns3/Offset-B12.h>
+    #include <ns3/Offset-B13.h>
+    #include <ns3/Offset-B14.h>
+    #include <ns3/Offset-B16.h>
+    #include <ns3/OffsetPoint.h>
+    #include <ns3/OpeningDaysHours.h>
+    #include <ns3/OPEN_TYPE.h>
+    #include <ns3/OrdinalNumber1B.h>
+    #include <ns3/OrdinalNumber3b.h>
+    #include <ns3/OriginatingRSUContainer.h>
+    #include <ns3/OriginatingVehicleContainer.h>
+    #include <ns3/OtherSubclass.h>
+    #include <ns3/OtherSubClass.h>
+    #include <ns3/OtherSublassType.h>
+    #include <ns3/OverlayLaneList.h>
+    #include <ns3/PassengerCapacity.h>
+    #include <ns3/PathDeltaTime.h>
+    #include <ns3/Path.h>
+    #include <ns3/PathHistory.h>
+    #include <ns3/PathPoint.h>
+    #include <ns3/PathPointPredicted.h>
+    #include <ns3/PathPredicted.h>
+    #include <ns3/PaymentFee.h>
+    #include <ns3/PaymentMeansBalance.h>
+    #include <ns3/PaymentMeans.h>
+    #include <ns3/PaymentMeansUnit.h>
+    #include <ns3/PaymentSecurityData.h>
+    #include <ns3/PayUnit.h>
+    #include <ns3/PedestrianBicycleDetect.h>
+    #include <ns3/PerceivedObjectContainer.h>
+    #include <ns3/PerceivedObjectContainerSegmentInfo.h>
+    #include <ns3/PerceivedObject.h>
+    #include <ns3/PerceivedPPOIDs.h>
+    #include <ns3/per_decoder.h>
+    #include <ns3/per_encoder.h>
+    #include <ns3/PerformanceClass.h>
+    #include <ns3/per_opentype.h>
+    #include <ns3/PersonalAccountNumber.h>
+    #include <ns3/PersonSubclass.h>
+    #include <ns3/PersonSubclassType.h>
+    #include <ns3/per_support.h>
+    #include <ns3/PhoneNumber.h>
+    #include <ns3/PlatooningRule.h>
+    #include <ns3/PlatooningRules.h>
+    #include <ns3/PMD.h>
+    #include <ns3/PolygonalLine.h>
+    #include <ns3/PolygonalShape.h>
+    #include <ns3/PolyPointList.h>
+    #include <ns3/PosCentMass.h>
+    #include <ns3/PosConfidenceEllipse.h>
+    #include <ns3/PosFrontAx.h>
+    #include <ns3/Position3D-addGrpC.h>
+    #include <ns3/Position3D.h>
+    #include <ns3/PositionalAccuracy.h>
+    #include <ns3/PositionConfidenceEllipse.h>
+    #include <ns3/PositionConfidence.h>
+    #include <ns3/PositionConfidenceSet.h>
+    #include <ns3/PositioningSolutionType.h>
+    #include <ns3/PositionOfOccupants.h>
+    #include <ns3/PositionOfPillars.h>
+    #include <ns3/PosLonCarr.h>
+    #include <ns3/PosPillar.h>
+    #include <ns3/PostCrashSubCauseCode.h>
+    #include <ns3/PrecipitationIntensity.h>
+    #include <ns3/PreemptPriorityList.h>
+    #include <ns3/PrintableString.h>
+    #include <ns3/PrioritizationResponse.h>
+    #include <ns3/PrioritizationResponseList.h>
+    #include <ns3/PrioritizationResponseStatus.h>
+    #include <ns3/PriorityLevel.h>
+    #include <ns3/PriorityRequestType.h>
+    #include <ns3/ProtectedCommunicationZone.h>
+    #include <ns3/ProtectedCommunicationZonesRSU.h>
+    #include <ns3/ProtectedZoneID.h>
+    #include <ns3/ProtectedZoneId.h>
+    #include <ns3/ProtectedZoneRadius.h>
+    #include <ns3/ProtectedZoneType.h>
+    #include <ns3/Provider.h>
+    #include <ns3/PtActivationData.h>
+    #include <ns3/PtActivation.h>
+    #include <ns3/PtActivationType.h>
+    #include <ns3/PtvRequestType.h>
+    #include <ns3/PublicTransportContainer.h>
+    #include <ns3/PurseBalance.h>
+    #include <ns3/RadialShapeDetails.h>
+    #include <ns3/RadialShape.h>
+    #include <ns3/RadialShapes.h>
+    #include <ns3/RadialShapesList.h>
+    #include <ns3/Radius.h>
+    #include <ns3/RailwayLevelCrossingSubCauseCode.h>
+    #include <ns3/Range.h>
+    #include <ns3/RccPart.h>
+    #include <ns3/REAL.h>
+    #include <ns3/RearOverhang.h>
+    #include <ns3/ReceiptAuthenticator.h>
+    #include <ns3/ReceiptContract.h>
+    #include <ns3/ReceiptData1.h>
+    #include <ns3/ReceiptData2.h>
+    #include <ns3/ReceiptData.h>
+    #include <ns3/ReceiptDistance.h>
+    #include <ns3/ReceiptFinancialPart.h>
+    #include <ns3/ReceiptICC-Id.h>
+    #include <ns3/ReceiptOBUId.h>
+    #include <ns3/ReceiptServicePart.h>
+    #include <ns3/ReceiptServiceSerialNumber.h>
+    #include <ns3/ReceiptText.h>
+    #include <ns3/RectangularShape.h>
+    #include <ns3/ReferenceDenms.h>
+    #include <ns3/ReferencePosition.h>
+    #include <ns3/ReferencePositionWithConfidence.h>
+    #include <ns3/RefPointId.h>
+    #include <ns3/RegionalExtension.h>
+    #include <ns3/RegionId.h>
+    #include <ns3/RegulatorySpeedLimit.h>
+    #include <ns3/RejectedReason.h>
+    #include <ns3/RELATIVE-OID.h>
+    #include <ns3/RelevanceDistance.h>
+    #include <ns3/RelevanceTrafficDirection.h>
+    #include <ns3/RepeatingPeriodDayTypes.h>
+    #include <ns3/RequestID.h>
+    #include <ns3/RequestImportanceLevel.h>
+    #include <ns3/RequestorDescription-addGrpC.h>
+    #include <ns3/RequestorDescription.h>
+    #include <ns3/RequestorPositionVector.h>
+    #include <ns3/RequestorType.h>
+    #include <ns3/RequestResponseIndication.h>
+    #include <ns3/RequestSubRole.h>
+    #include <ns3/RescueAndRecoveryWorkInProgressSubCauseCode.h>
+    #include <ns3/RescueContainer.h>
+    #include <ns3/RestrictedTypes.h>
+    #include <ns3/RestrictionAppliesTo.h>
+    #include <ns3/RestrictionClassAssignment.h>
+    #include <ns3/RestrictionClassID.h>
+    #include <ns3/RestrictionClassList.h>
+    #include <ns3/RestrictionUserType-addGrpC.h>
+    #include <ns3/RestrictionUserType.h>
+    #include <ns3/RestrictionUserTypeList.h>
+    #include <ns3/ResultFin.h>
+    #include <ns3/ResultOp.h>
+    #include <ns3/RoadConfigurationContainer.h>
+    #include <ns3/RoadLaneSetList.h>
+    #include <ns3/RoadRegulatorID.h>
+    #include <ns3/RoadSegment.h>
+    #include <ns3/RoadSegmentID.h>
+    #include <ns3/RoadSegmentList.h>
+    #include <ns3/RoadSegmentReferenceID.h>
+    #include <ns3/RoadSignCodes.h>
+    #include <ns3/RoadSurfaceContainer.h>
+    #include <ns3/RoadSurfaceDynamicCharacteristics.h>
+    #include <ns3/RoadSurfaceStaticCharacteristics.h>
+    #include <ns3/RoadType.h>
+    #include <ns3/RoadwayCrownAngle.h>
+    #include <ns3/RoadWorksContainerBasic.h>
+    #include <ns3/RoadWorksContainerExtended.h>
+    #include <ns3/RoadworksSubCauseCode.h>
+    #include <ns3/ROI.h>
+    #include <ns3/RSCode.h>
+    #include <ns3/RscPart.h>
+    #include <ns3/RSCUnit.h>
+    #include <ns3/RSUContainerHighFrequency.h>
+    #include <ns3/RTCMcorrections.h>
+    #include <ns3/RTCMEM.h>
+    #include <ns3/RTCMheader.h>
+    #include <ns3/RTCMmessage.h>
+    #include <ns3/RTCMmessageList.h>
+    #include <ns3/RTCM-Revision.h>
+    #include <ns3/SaeAutomationLevel.h>
+    #include <ns3/SaeAutomationLevels.h>
+    #include <ns3/SafeDistanceIndication.h>
+    #include <ns3/SafeDistanceIndicator.h>
+    #include <ns3/SafetyCarContainer.h>
+    #include <ns3/Scale-B12.h>
+    #include <ns3/SegmentAttributeXY.h>
+    #include <ns3/SegmentAttributeXYList.h>
+    #include <ns3/SegmentCount.h>
+    #include <ns3/Segment.h>
+    #include <ns3/SemiAxisLength.h>
+    #include <ns3/SemiMajorAxisAccuracy.h>
+    #include <ns3/SemiMajorAxisOrientation.h>
+    #include <ns3/SemiMinorAxisAccuracy.h>
+    #include <ns3/SemiRangeLength.h>
+    #include <ns3/SensorHeight.h>
+    #include <ns3/SensorIdList.h>
+    #include <ns3/SensorInformationContainer.h>
+    #include <ns3/SensorInformation.h>
+    #include <ns3/SensorType.h>
+    #include <ns3/SequenceNumber.h>
+    #include <ns3/SequenceOfCartesianPosition3d.h>
+    #include <ns3/SequenceOfIdentifier1B.h>
+    #include <ns3/SequenceOfSafeDistanceIndication.h>
+    #include <ns3/SequenceOfTrajectoryInterceptionIndication.h>
+    #include <ns3/ServiceApplicationLimit.h>
+    #include <ns3/ServiceNumber.h>
+    #include <ns3/SessionClass.h>
+    #include <ns3/SessionLocation.h>
+    #include <ns3/SetInstanceRq.h>
+    #include <ns3/SetMMIRq.h>
+    #include <ns3/SetStampedRq.h>
+    #include <ns3/ShadowingApplies.h>
+    #include <ns3/Shape.h>
+    #include <ns3/SignalControlZone.h>
+    #include <ns3/SignalGroupID.h>
+    #include <ns3/SignalHeadLocation.h>
+    #include <ns3/SignalHeadLocationList.h>
+    #include <ns3/SignalRequesterInfo.h>
+    #include <ns3/SignalRequest.h>
+    #include <ns3/SignalRequestList.h>
+    #include <ns3/SignalRequestMessage.h>
+    #include <ns3/SignalRequestPackage.h>
+    #include <ns3/SignalStatus.h>
+    #include <ns3/SignalStatusList.h>
+    #include <ns3/SignalStatusMessage.h>
+    #include <ns3/SignalStatusPackage-addGrpC.h>
+    #include <ns3/SignalStatusPackage.h>
+    #include <ns3/SignalStatusPackageList.h>
+    #include <ns3/SignalViolationSubCauseCode.h>
+    #include <ns3/SignedValue.h>
+    #include <ns3/SituationContainer.h>
+    #include <ns3/SlowVehicleSubCauseCode.h>
+    #include <ns3/SoundLevel.h>
+    #include <ns3/SPATEM.h>
+    #include <ns3/SPAT.h>
+    #include <ns3/SpecialTransportContainer.h>
+    #include <ns3/SpecialTransportType.h>
+    #include <ns3/SpecialVehicleContainer.h>
+    #include <ns3/SpeedAdvice.h>
+    #include <ns3/SpeedandHeadingandThrottleConfidence.h>
+    #include <ns3/SpeedandHeadingIsoandThrottleConfidence.h>
+    #include <ns3/SpeedConfidence.h>
+    #include <ns3/SpeedConfidenceIso.h>
+    #include <ns3/SpeedExtended.h>
+    #include <ns3/Speed.h>
+    #include <ns3/SpeedLimit.h>
+    #include <ns3/SpeedLimitList.h>
+    #include <ns3/SpeedLimitType.h>
+    #include <ns3/SpeedValueExtended.h>
+    #include <ns3/SpeedValue.h>
+    #include <ns3/SPE.h>
+    #include <ns3/SREM.h>
+    #include <ns3/SSEM.h>
+    #include <ns3/StabilityChangeIndication.h>
+    #include <ns3/StabilityLossProbability.h>
+    #include <ns3/StandardLength12b.h>
+    #include <ns3/StandardLength1B.h>
+    #include <ns3/StandardLength2B.h>
+    #include <ns3/StandardLength3b.h>
+    #include <ns3/StandardLength9b.h>
+    #include <ns3/StartTime.h>
+    #include <ns3/StationarySince.h>
+    #include <ns3/StationaryVehicleContainer.h>
+    #include <ns3/StationaryVehicleSubCauseCode.h>
+    #include <ns3/StationDataContainer.h>
+    #include <ns3/StationID.h>
+    #include <ns3/StationId.h>
+    #include <ns3/StationType.h>
+    #include <ns3/StationTypeIso.h>
+    #include <ns3/SteeringWheelAngleConfidence.h>
+    #include <ns3/SteeringWheelAngle.h>
+    #include <ns3/SteeringWheelAngleValue.h>
+    #include <ns3/StopTime.h>
+    #include <ns3/SubCauseCodeType.h>
+    #include <ns3/SubRq.h>
+    #include <ns3/SubscribedPMs.h>
+    #include <ns3/T61String.h>
+    #include <ns3/TaxCode.h>
+    #include <ns3/TcPart.h>
+    #include <ns3/TeletexString.h>
+    #include <ns3/Temperature.h>
+    #include <ns3/TemporaryID.h>
+    #include <ns3/Termination.h>
+    #include <ns3/TextContainer.h>
+    #include <ns3/Text.h>
+    #include <ns3/TextLines.h>
+    #include <ns3/ThrottleConfidence.h>
+    #include <ns3/TimeChangeDetails.h>
+    #include <ns3/TimeConfidence.h>
+    #include <ns3/TimeIntervalConfidence.h>
+    #include <ns3/TimeMark.h>
+    #include <ns3/TimeOfMeasurement.h>
+    #include <ns3/TimeReference.h>
+    #include <ns3/TimestampIts.h>
+    #include <ns3/Traces.h>
+    #include <ns3/TractorAxles.h>
+    #include <ns3/TractorCharacteristics.h>
+    #include <ns3/TrafficConditionSubCauseCode.h>
+    #include <ns3/TrafficDirection.h>
+    #include <ns3/TrafficIslandPosition.h>
+    #include <ns3/TrafficParticipantType.h>
+    #include <ns3/TrafficRule.h>
+    #include <ns3/TrailerAxles.h>
+    #include <ns3/TrailerCharacteristicsFixValuesList.h>
+    #include <ns3/TrailerCharacteristics.h>
+    #include <ns3/TrailerCharacteristicsList.h>
+    #include <ns3/TrailerCharacteristicsRangesList.h>
+    #include <ns3/TrailerDataContainer.h>
+    #include <ns3/TrailerData.h>
+    #include <ns3/TrailerDetails.h>
+    #include <ns3/TrailerLicencePlateNumber.h>
+    #include <ns3/TrailerPresenceInformation.h>
+    #include <ns3/TrainCharacteristics.h>
+    #include <ns3/TrajectoryInterceptionConfidence.h>
+    #include <ns3/TrajectoryInterceptionIndication.h>
+    #include <ns3/TrajectoryInterceptionProbability.h>
+    #include <ns3/TransitVehicleOccupancy.h>
+    #include <ns3/TransitVehicleStatus.h>
+    #include <ns3/TransmissionAndSpeed.h>
+    #include <ns3/TransmissionInterval.h>
+    #include <ns3/TransmissionState.h>
+    #include <ns3/TreatmentType.h>
+    #include <ns3/TurningDirection.h>
+    #include <ns3/TurningRadius.h>
+    #include <ns3/UnitType.h>
+    #include <ns3/UniversalString.h>
+    #include <ns3/uper_decoder.h>
+    #include <ns3/uper_encoder.h>
+    #include <ns3/uper_opentype.h>
+    #include <ns3/uper_support.h>
+    #include <ns3/UTCTime.h>
+    #include <ns3/UTF8String.h>
+    #include <ns3/ValidityDuration.h>
+    #include <ns3/ValidityOfContract.h>
+    #include <ns3/ValidityPeriods.h>
+    #include <ns3/VAM.h>
+    #include <ns3/VamParameters.h>
+    #include <ns3/VarLengthNumber.h>
+    #include <ns3/VcClass.h>
+    #include <ns3/VcCode.h>
+    #include <ns3/VcOption.h>
+    #include <ns3/VDS.h>
+    #include <ns3/VED.h>
+    #include <ns3/VehicleAuthenticator.h>
+    #include <ns3/VehicleAxles.h>
+    #include <ns3/VehicleBreakdownSubCauseCode.h>
+    #include <ns3/VehicleCharacteristicsFixValues.h>
+    #include <ns3/VehicleCharacteristicsFixValuesList.h>
+    #include <ns3/VehicleCharacteristicsList.h>
+    #include <ns3/VehicleCharacteristicsRanges.h>
+    #include <ns3/VehicleCharacteristicsRangesList.h>
+    #include <ns3/VehicleClass.h>
+    #include <ns3/VehicleCurrentMaxTrainWeight.h>
+    #include <ns3/VehicleDimensions.h>
+    #include <ns3/VehicleHeight.h>
+    #include <ns3/VehicleIdentification.h>
+    #include <ns3/VehicleIdentificationNumber.h>
+    #include <ns3/VehicleID.h>
+    #include <ns3/VehicleLengthConfidenceIndication.h>
+    #include <ns3/VehicleLength.h>
+    #include <ns3/VehicleLengthV2.h>
+    #include <ns3/VehicleLengthValue.h>
+    #include <ns3/VehicleLicencePlateNumber.h>
+    #include <ns3/VehicleMass.h>
+    #include <ns3/VehicleRole.h>
+    #include <ns3/VehicleSensor.h>
+    #include <ns3/VehicleSensorProperties.h>
+    #include <ns3/VehicleSensorPropertyList.h>
+    #include <ns3/VehicleSpecificCharacteristics.h>
+    #include <ns3/VehicleSubclass.h>
+    #include <ns3/VehicleSubclassType.h>
+    #include <ns3/VehicleTotalDistance.h>
+    #include <ns3/VehicleType.h>
+    #include <ns3/VehicleWeightLaden.h>
+    #include <ns3/VehicleWeightLimits.h>
+    #include <ns3/VehicleWidth.h>
+    #include <ns3/Velocity3dWithConfidence.h>
+    #include <ns3/VelocityCartesian.h>
+    #include <ns3/VelocityComponent.h>
+    #include <ns3/VelocityComponentValue.h>
+    #include <ns3/Velocity.h>
+    #include <ns3/VelocityPolarWithZ.h>
+    #include <ns3/VerticalAcceleration.h>
+    #include <ns3/VerticalAccelerationValue.h>
+    #include <ns3/VideotexString.h>
+    #include <ns3/VisibleString.h>
+    #include <ns3/VruAwareness.h>
+    #include <ns3/VruClusterInformationContainer.h>
+    #include <ns3/VruClusterInformation.h>
+    #include <ns3/VruClusterOperationContainer.h>
+    #include <ns3/VruClusterProfiles.h>
+    #include <ns3/VruDeviceUsage.h>
+    #include <ns3/VruEnvironment.h>
+    #include <ns3/VruExteriorLights.h>
+    #include <ns3/VruHighFrequencyContainer.h>
+    #include <ns3/VruLowFrequencyContainer.h>
+    #include <ns3/VruMotionPredictionContainer.h>
+    #include <ns3/VruMovementControl.h>
+    #include <ns3/VruProfileAndSubprofile.h>
+    #include <ns3/VruSizeClass.h>
+    #include <ns3/VruSpecificExteriorLights.h>
+    #include <ns3/VruSubProfileAnimal.h>
+    #include <ns3/VruSubProfileBicyclist.h>
+    #include <ns3/VruSubProfileMotorcyclist.h>
+    #include <ns3/VruSubProfilePedestrian.h>
+    #include <ns3/WaitOnStopline.h>
+    #include <ns3/WearLevel.h>
+    #include <ns3/Weight.h>
+    #include <ns3/Wgs84AngleConfidence.h>
+    #include <ns3/Wgs84Angle.h>
+    #include <ns3/WGS84Angle.h>
+    #include <ns3/Wgs84AngleValue.h>
+    #include <ns3/WGS84AngleValue.h>
+    #include <ns3/WheelBaseVehicle.h>
+    #include <ns3/WMInumber.h>
+    #include <ns3/WrongWayDrivingSubCauseCode.h>
+    #include <ns3/xer_decoder.h>
+    #include <ns3/xer_encoder.h>
+    #include <ns3/xer_support.h>
+    #include <ns3/XSensorOffset.h>
+    #include <ns3/YawRateConfidence.h>
+    #include <ns3/YawRate.h>
+    #include <ns3/YawRateValue.h>
+    #include <ns3/YSensorOffset.h>
+    #include <ns3/Zid.h>
+    #include <ns3/Zone.h>
+    #include <ns3/ZoneIds.h>
+    #include <ns3/ZoneLength.h>
+    #include <ns3/ZSensorOffset.h>
+    #include <ns3/AccelerationConfidenceV1.h>
+    #include <ns3/AccelerationControlV1.h>
+    #include <ns3/AccidentSubCauseCodeV1.h>
+    #include <ns3/ActionIDV1.h>
+    #include <ns3/AdverseWeatherCondition-AdhesionSubCauseCodeV1.h>
+    #include <ns3/AdverseWeatherCondition-ExtremeWeatherConditionSubCauseCodeV1.h>
+    #include <ns3/AdverseWeatherCondition-PrecipitationSubCauseCodeV1.h>
+    #include <ns3/AdverseWeatherCondition-VisibilitySubCauseCodeV1.h>
+    #include <ns3/AlacarteContainerV1.h>
+    #include <ns3/AltitudeConfidenceV1.h>
+    #include <ns3/AltitudeV1.h>
+    #include <ns3/AltitudeValueV1.h>
+    #include <ns3/BasicContainerV1.h>
+    #include <ns3/BasicVehicleContainerHighFrequencyV1.h>
+    #include <ns3/BasicVehicleContainerLowFrequencyV1.h>
+    #include <ns3/CamParametersV1.h>
+    #include <ns3/CAMV1.h>
+    #include <ns3/CauseCodeTypeV1.h>
+    #include <ns3/CauseCodeV1.h>
+    #include <ns3/CenDsrcTollingZoneIDV1.h>
+    #include <ns3/CenDsrcTollingZoneV1.h>
+    #include <ns3/ClosedLanesV1.h>
+    #include <ns3/CollisionRiskSubCauseCodeV1.h>
+    #include <ns3/CoopAwarenessV1.h>
+    #include <ns3/CurvatureCalculationModeV1.h>
+    #include <ns3/CurvatureConfidenceV1.h>
+    #include <ns3/CurvatureV1.h>
+    #include <ns3/CurvatureValueV1.h>
+    #include <ns3/DangerousEndOfQueueSubCauseCodeV1.h>
+    #include <ns3/DangerousGoodsBasicV1.h>
+    #include <ns3/DangerousGoodsContainerV1.h>
+    #include <ns3/DangerousGoodsExtendedV1.h>
+    #include <ns3/DangerousSituationSubCauseCodeV1.h>
+    #include <ns3/DecentralizedEnvironmentalNotificationMessageV1.h>
+    #include <ns3/DeltaAltitudeV1.h>
+    #include <ns3/DeltaLatitudeV1.h>
+    #include <ns3/DeltaLongitudeV1.h>
+    #include <ns3/DeltaReferencePositionV1.h>
+    #include <ns3/DENMV1.h>
+    #include <ns3/DriveDirectionV1.h>
+    #include <ns3/DrivingLaneStatusV1.h>
+    #include <ns3/EmbarkationStatusV1.h>
+    #include <ns3/EmergencyContainerV1.h>
+    #include <ns3/EmergencyPriorityV1.h>
+    #include <ns3/EmergencyVehicleApproachingSubCauseCodeV1.h>
+    #include <ns3/EnergyStorageTypeV1.h>
+    #include <ns3/EventHistoryV1.h>
+    #include <ns3/EventPointV1.h>
+    #include <ns3/ExteriorLightsV1.h>
+    #include <ns3/GenerationDeltaTimeV1.h>
+    #include <ns3/HardShoulderStatusV1.h>
+    #include <ns3/HazardousLocation-AnimalOnTheRoadSubCauseCodeV1.h>
+    #include <ns3/HazardousLocation-DangerousCurveSubCauseCodeV1.h>
+    #include <ns3/HazardousLocation-ObstacleOnTheRoadSubCauseCodeV1.h>
+    #include <ns3/HazardousLocation-SurfaceConditionSubCauseCodeV1.h>
+    #include <ns3/HeadingConfidenceV1.h>
+    #include <ns3/HeadingV1.h>
+    #include <ns3/HeadingValueV1.h>
+    #include <ns3/HeightLonCarrV1.h>
+    #include <ns3/HighFrequencyContainerV1.h>
+    #include <ns3/HumanPresenceOnTheRoadSubCauseCodeV1.h>
+    #include <ns3/HumanProblemSubCauseCodeV1.h>
+    #include <ns3/ImpactReductionContainerV1.h>
+    #include <ns3/InformationQualityV1.h>
+    #include <ns3/ItineraryPathV1.h>
+    #include <ns3/ItsPduHeaderV1.h>
+    #include <ns3/LanePositionV1.h>
+    #include <ns3/LateralAccelerationV1.h>
+    #include <ns3/LateralAccelerationValueV1.h>
+    #include <ns3/LatitudeV1.h>
+    #include <ns3/LightBarSirenInUseV1.h>
+    #include <ns3/LocationContainerV1.h>
+    #include <ns3/LongitudeV1.h>
+    #include <ns3/LongitudinalAccelerationV1.h>
+    #include <ns3/LongitudinalAccelerationValueV1.h>
+    #include <ns3/LowFrequencyContainerV1.h>
+    #include <ns3/ManagementContainerV1.h>
+    #include <ns3/NumberOfOccupantsV1.h>
+    #include <ns3/PathDeltaTimeV1.h>
+    #include <ns3/PathHistoryV1.h>
+    #include <ns3/PathPointV1.h>
+    #include <ns3/PerformanceClassV1.h>
+    #include <ns3/PosCentMassV1.h>
+    #include <ns3/PosConfidenceEllipseV1.h>
+    #include <ns3/PosFrontAxV1.h>
+    #include <ns3/PositioningSolutionTypeV1.h>
+    #include <ns3/PositionOfOccupantsV1.h>
+    #include <ns3/PositionOfPillarsV1.h>
+    #include <ns3/PosLonCarrV1.h>
+    #include <ns3/PosPillarV1.h>
+    #include <ns3/PostCrashSubCauseCodeV1.h>
+    #include <ns3/ProtectedCommunicationZonesRSUV1.h>
+    #include <ns3/ProtectedCommunicationZoneV1.h>
+    #include <ns3/ProtectedZoneIDV1.h>
+    #include <ns3/ProtectedZoneRadiusV1.h>
+    #include <ns3/ProtectedZoneTypeV1.h>
+    #include <ns3/PtActivationDataV1.h>
+    #include <ns3/PtActivationTypeV1.h>
+    #include <ns3/PtActivationV1.h>
+    #include <ns3/PublicTransportContainerV1.h>
+    #include <ns3/ReferenceDenmsV1.h>
+    #include <ns3/ReferencePositionV1.h>
+    #include <ns3/RelevanceDistanceV1.h>
+    #include <ns3/RelevanceTrafficDirectionV1.h>
+    #include <ns3/RequestResponseIndicationV1.h>
+    #include <ns3/RescueAndRecoveryWorkInProgressSubCauseCodeV1.h>
+    #include <ns3/RescueContainerV1.h>
+    #include <ns3/RestrictedTypesV1.h>
+    #include <ns3/RoadTypeV1.h>
+    #include <ns3/RoadWorksContainerBasicV1.h>
+    #include <ns3/RoadWorksContainerExtendedV1.h>
+    #include <ns3/RoadworksSubCauseCodeV1.h>
+    #include <ns3/RSUContainerHighFrequencyV1.h>
+    #include <ns3/SafetyCarContainerV1.h>
+    #include <ns3/SemiAxisLengthV1.h>
+    #include <ns3/SequenceNumberV1.h>
+    #include <ns3/SignalViolationSubCauseCodeV1.h>
+    #include <ns3/SituationContainerV1.h>
+    #include <ns3/SlowVehicleSubCauseCodeV1.h>
+    #include <ns3/SpecialTransportContainerV1.h>
+    #include <ns3/SpecialTransportTypeV1.h>
+    #include <ns3/SpecialVehicleContainerV1.h>
+    #include <ns3/SpeedConfidenceV1.h>
+    #include <ns3/SpeedLimitV1.h>
+    #include <ns3/SpeedV1.h>
+    #include <ns3/SpeedValueV1.h>
+    #include <ns3/StationarySinceV1.h>
+    #include <ns3/StationaryVehicleContainerV1.h>
+    #include <ns3/StationaryVehicleSubCauseCodeV1.h>
+    #include <ns3/StationIDV1.h>
+    #include <ns3/StationTypeV1.h>
+    #include <ns3/SteeringWheelAngleConfidenceV1.h>
+    #include <ns3/SteeringWheelAngleV1.h>
+    #include <ns3/SteeringWheelAngleValueV1.h>
+    #include <ns3/SubCauseCodeTypeV1.h>
+    #include <ns3/TemperatureV1.h>
+    #include <ns3/TerminationV1.h>
+    #include <ns3/TimestampItsV1.h>
+    #include <ns3/TracesV1.h>
+    #include <ns3/TrafficConditionSubCauseCodeV1.h>
+    #include <ns3/TrafficRuleV1.h>
+    #include <ns3/TransmissionIntervalV1.h>
+    #include <ns3/TurningRadiusV1.h>
+    #include <ns3/ValidityDurationV1.h>
+    #include <ns3/VDSV1.h>
+    #include <ns3/VehicleBreakdownSubCauseCodeV1.h>
+    #include <ns3/VehicleIdentificationV1.h>
+    #include <ns3/VehicleLengthConfidenceIndicationV1.h>
+    #include <ns3/VehicleLengthV1.h>
+    #include <ns3/VehicleLengthValueV1.h>
+    #include <ns3/VehicleMassV1.h>
+    #include <ns3/VehicleRoleV1.h>
+    #include <ns3/VehicleWidthV1.h>
+    #include <ns3/VerticalAccelerationV1.h>
+    #include <ns3/VerticalAccelerationValueV1.h>
+    #include <ns3/WheelBaseVehicleV1.h>
+    #include <ns3/WMInumberV1.h>
+    #include <ns3/WrongWayDrivingSubCauseCodeV1.h>
+    #include <ns3/YawRateConfidenceV1.h>
+    #include <ns3/YawRateV1.h>
+    #include <ns3/YawRateValueV1.h>
+#endif 
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/bandwidth-part-gnb.h
\ No newline at end of file
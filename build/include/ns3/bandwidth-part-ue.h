@@ -0,0 +1 @@
+/root/repo/src/nr/model/bandwidth-part-ue.h
\ No newline at end of file
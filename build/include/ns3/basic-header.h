@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/basic-header.h
\ No newline at end of file
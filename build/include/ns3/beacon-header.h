@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/beacon-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/beam-conf-id.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/beam-manager.h
\ No newline at end of file
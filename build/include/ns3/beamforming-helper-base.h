@@ -0,0 +1 @@
+/root/repo/src/nr/helper/beamforming-helper-base.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/beamforming-vector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/BTP/btp.h
\ No newline at end of file
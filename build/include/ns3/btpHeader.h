@@ -0,0 +1 @@
+/root/repo/src/automotive/model/BTP/btpHeader.h
\ No newline at end of file
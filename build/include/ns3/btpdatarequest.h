@@ -0,0 +1 @@
+/root/repo/src/automotive/model/BTP/btpdatarequest.h
\ No newline at end of file
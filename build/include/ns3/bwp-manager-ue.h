@@ -0,0 +1 @@
+/root/repo/src/nr/model/bwp-manager-ue.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/caBasicService.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/custom/model/Facilities/caBasicService_custom.h
\ No newline at end of file
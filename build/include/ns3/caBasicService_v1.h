@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/caBasicService_v1.h
\ No newline at end of file
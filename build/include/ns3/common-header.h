@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/common-header.h
\ No newline at end of file
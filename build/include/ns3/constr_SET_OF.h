@@ -0,0 +1 @@
+/root/repo/src/automotive/model/ASN1/asn1-v2/constr_SET_OF.h
\ No newline at end of file
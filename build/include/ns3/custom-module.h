@@ -0,0 +1,20 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_CUSTOM
+    // Module headers: 
+    #include <ns3/sumo_xml_parser_custom.h>
+    #include <ns3/stopWarningClient.h>
+    #include <ns3/stopWarningServer.h>
+    #include <ns3/stopWarningClient-helper.h>
+    #include <ns3/stopWarningServer-helper.h>
+    #include <ns3/caBasicService_custom.h>
+    #include <ns3/denBasicService_custom.h>
+    #include <ns3/asn_utils.h>
+    #include <ns3/denData.h>
+    #include <ns3/ITSSOriginatingTableEntry.h>
+    #include <ns3/ITSSReceivingTableEntry.h>
+    #include <ns3/utils.h>
+    #include <ns3/plexe.h>
+    #include <ns3/plexe_utils.h>
+#endif 
\ No newline at end of file
@@ -0,0 +1,155 @@
+#ifdef NS3_MODULE_COMPILATION 
+    error "Do not include ns3 module aggregator headers from other modules these are meant only for end user scripts." 
+#endif 
+#ifndef NS3_MODULE_CV2X
+    // Module headers: 
+    #include <ns3/cv2x_lte-common.h>
+    #include <ns3/cv2x_lte-spectrum-phy.h>
+    #include <ns3/cv2x_lte-spectrum-signal-parameters.h>
+    #include <ns3/cv2x_lte-phy.h>
+    #include <ns3/cv2x_lte-enb-phy.h>
+    #include <ns3/cv2x_lte-ue-phy.h>
+    #include <ns3/cv2x_lte-spectrum-value-helper.h>
+    #include <ns3/cv2x_lte-amc.h>
+    #include <ns3/cv2x_lte-enb-rrc.h>
+    #include <ns3/cv2x_lte-ue-rrc.h>
+    #include <ns3/cv2x_lte-rrc-sap.h>
+    #include <ns3/cv2x_lte-rrc-protocol-ideal.h>
+    #include <ns3/cv2x_lte-rrc-protocol-real.h>
+    #include <ns3/cv2x_lte-rlc-sap.h>
+    #include <ns3/cv2x_lte-rlc.h>
+    #include <ns3/cv2x_lte-rlc-header.h>
+    #include <ns3/cv2x_lte-rlc-sequence-number.h>
+    #include <ns3/cv2x_lte-rlc-am-header.h>
+    #include <ns3/cv2x_lte-rlc-tm.h>
+    #include <ns3/cv2x_lte-rlc-um.h>
+    #include <ns3/cv2x_lte-rlc-am.h>
+    #include <ns3/cv2x_lte-rlc-tag.h>
+    #include <ns3/cv2x_lte-rlc-sdu-status-tag.h>
+    #include <ns3/cv2x_lte-pdcp-sap.h>
+    #include <ns3/cv2x_lte-pdcp.h>
+    #include <ns3/cv2x_lte-pdcp-header.h>
+    #include <ns3/cv2x_lte-pdcp-tag.h>
+    #include <ns3/cv2x_eps-bearer.h>
+    #include <ns3/cv2x_lte-radio-bearer-info.h>
+    #include <ns3/cv2x_lte-net-device.h>
+    #include <ns3/cv2x_lte-enb-net-device.h>
+    #include <ns3/cv2x_lte-ue-net-device.h>
+    #include <ns3/cv2x_lte-control-messages.h>
+    #include <ns3/cv2x_lte-helper.h>
+    #include <ns3/cv2x_lte-stats-calculator.h>
+    #include <ns3/cv2x_stats-output-file.h>
+    #include <ns3/cv2x_epc-helper.h>
+    #include <ns3/cv2x_point-to-point-epc-helper.h>
+    #include <ns3/cv2x_phy-stats-calculator.h>
+    #include <ns3/cv2x_mac-stats-calculator.h>
+    #include <ns3/cv2x_phy-tx-stats-calculator.h>
+    #include <ns3/cv2x_phy-rx-stats-calculator.h>
+    #include <ns3/cv2x_radio-bearer-stats-calculator.h>
+    #include <ns3/cv2x_radio-bearer-stats-connector.h>
+    #include <ns3/cv2x_radio-environment-map-helper.h>
+    #include <ns3/cv2x_lte-hex-grid-enb-topology-helper.h>
+    #include <ns3/cv2x_lte-global-pathloss-database.h>
+    #include <ns3/cv2x_lte-prose-helper.h>
+    #include <ns3/cv2x_lte-v2x-helper.h>
+    #include <ns3/cv2x_rem-spectrum-phy.h>
+    #include <ns3/cv2x_ff-mac-common.h>
+    #include <ns3/cv2x_ff-mac-csched-sap.h>
+    #include <ns3/cv2x_ff-mac-sched-sap.h>
+    #include <ns3/cv2x_lte-enb-cmac-sap.h>
+    #include <ns3/cv2x_lte-ue-cmac-sap.h>
+    #include <ns3/cv2x_lte-mac-sap.h>
+    #include <ns3/cv2x_ff-mac-scheduler.h>
+    #include <ns3/cv2x_rr-ff-mac-scheduler.h>
+    #include <ns3/cv2x_lte-enb-mac.h>
+    #include <ns3/cv2x_lte-ue-mac.h>
+    #include <ns3/cv2x_lte-radio-bearer-tag.h>
+    #include <ns3/cv2x_eps-bearer-tag.h>
+    #include <ns3/cv2x_lte-phy-tag.h>
+    #include <ns3/cv2x_lte-enb-phy-sap.h>
+    #include <ns3/cv2x_lte-enb-cphy-sap.h>
+    #include <ns3/cv2x_lte-ue-phy-sap.h>
+    #include <ns3/cv2x_lte-ue-cphy-sap.h>
+    #include <ns3/cv2x_lte-interference.h>
+    #include <ns3/cv2x_lte-chunk-processor.h>
+    #include <ns3/cv2x_pf-ff-mac-scheduler.h>
+    #include <ns3/cv2x_fdmt-ff-mac-scheduler.h>
+    #include <ns3/cv2x_tdmt-ff-mac-scheduler.h>
+    #include <ns3/cv2x_tta-ff-mac-scheduler.h>
+    #include <ns3/cv2x_fdbet-ff-mac-scheduler.h>
+    #include <ns3/cv2x_tdbet-ff-mac-scheduler.h>
+    #include <ns3/cv2x_fdtbfq-ff-mac-scheduler.h>
+    #include <ns3/cv2x_tdtbfq-ff-mac-scheduler.h>
+    #include <ns3/cv2x_pss-ff-mac-scheduler.h>
+    #include <ns3/cv2x_cqa-ff-mac-scheduler.h>
+    #include <ns3/cv2x_trace-fading-loss-model.h>
+    #include <ns3/cv2x_epc-gtpu-header.h>
+    #include <ns3/cv2x_epc-enb-application.h>
+    #include <ns3/cv2x_epc-sgw-pgw-application.h>
+    #include <ns3/cv2x_lte-vendor-specific-parameters.h>
+    #include <ns3/cv2x_epc-x2-sap.h>
+    #include <ns3/cv2x_epc-x2-header.h>
+    #include <ns3/cv2x_epc-x2.h>
+    #include <ns3/cv2x_epc-tft.h>
+    #include <ns3/cv2x_epc-tft-classifier.h>
+    #include <ns3/cv2x_lte-mi-error-model.h>
+    #include <ns3/cv2x_epc-enb-s1-sap.h>
+    #include <ns3/cv2x_epc-s1ap-sap.h>
+    #include <ns3/cv2x_epc-s11-sap.h>
+    #include <ns3/cv2x_lte-as-sap.h>
+    #include <ns3/cv2x_epc-ue-nas.h>
+    #include <ns3/cv2x_lte-harq-phy.h>
+    #include <ns3/cv2x_epc-mme.h>
+    #include <ns3/cv2x_lte-asn1-header.h>
+    #include <ns3/cv2x_lte-rrc-header.h>
+    #include <ns3/cv2x_lte-handover-management-sap.h>
+    #include <ns3/cv2x_lte-handover-algorithm.h>
+    #include <ns3/cv2x_a2-a4-rsrq-handover-algorithm.h>
+    #include <ns3/cv2x_a3-rsrp-handover-algorithm.h>
+    #include <ns3/cv2x_no-op-handover-algorithm.h>
+    #include <ns3/cv2x_lte-anr-sap.h>
+    #include <ns3/cv2x_lte-anr.h>
+    #include <ns3/cv2x_lte-ffr-algorithm.h>
+    #include <ns3/cv2x_lte-ffr-sap.h>
+    #include <ns3/cv2x_lte-ffr-rrc-sap.h>
+    #include <ns3/cv2x_lte-fr-no-op-algorithm.h>
+    #include <ns3/cv2x_lte-fr-hard-algorithm.h>
+    #include <ns3/cv2x_lte-fr-strict-algorithm.h>
+    #include <ns3/cv2x_lte-fr-soft-algorithm.h>
+    #include <ns3/cv2x_lte-ffr-soft-algorithm.h>
+    #include <ns3/cv2x_lte-ffr-enhanced-algorithm.h>
+    #include <ns3/cv2x_lte-ffr-distributed-algorithm.h>
+    #include <ns3/cv2x_lte-ue-power-control.h>
+    #include <ns3/cv2x_lte-ccm-rrc-sap.h>
+    #include <ns3/cv2x_lte-ue-ccm-rrc-sap.h>
+    #include <ns3/cv2x_lte-ccm-mac-sap.h>
+    #include <ns3/cv2x_lte-enb-component-carrier-manager.h>
+    #include <ns3/cv2x_lte-ue-component-carrier-manager.h>
+    #include <ns3/cv2x_no-op-component-carrier-manager.h>
+    #include <ns3/cv2x_simple-ue-component-carrier-manager.h>
+    #include <ns3/cv2x_cc-helper.h>
+    #include <ns3/cv2x_component-carrier.h>
+    #include <ns3/cv2x_component-carrier-ue.h>
+    #include <ns3/cv2x_component-carrier-enb.h>
+    #include <ns3/cv2x_lte-sl-tft.h>
+    #include <ns3/cv2x_sl-pool.h>
+    #include <ns3/cv2x_sl-pool-factory.h>
+    #include <ns3/cv2x_sl-resource-pool-factory.h>
+    #include <ns3/cv2x_sl-v2x-resource-pool-factory.h>
+    #include <ns3/cv2x_sl-preconfig-pool-factory.h>
+    #include <ns3/cv2x_sl-v2x-preconfig-pool-factory.h>
+    #include <ns3/cv2x_lte-sl-chunk-processor.h>
+    #include <ns3/cv2x_lte-sl-interference.h>
+    #include <ns3/cv2x_spectrum-value-kernels.h>
+    #include <ns3/cv2x_rr-sl-ff-mac-scheduler.h>
+    #include <ns3/cv2x_lte-phy-error-model.h>
+    #include <ns3/cv2x_3gpp-cal-mac-scheduler.h>
+    #include <ns3/cv2x_3gpp-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-parabolic-3d-antenna-model.h>
+    #include <ns3/cv2x_cni-urbanmicrocell-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-urbanmacrocell-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-scm-urbanmacrocell-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-indoor-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-outdoor-propagation-loss-model.h>
+    #include <ns3/cv2x_nist-hybrid-propagation-loss-model.h>
+#endif 
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_a2-a4-rsrq-handover-algorithm.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_eps-bearer-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_lte-fr-no-op-algorithm.h
\ No newline at end of file
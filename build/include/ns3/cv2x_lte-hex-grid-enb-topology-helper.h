@@ -0,0 +1 @@
+/root/repo/src/cv2x/helper/cv2x_lte-hex-grid-enb-topology-helper.h
\ No newline at end of file
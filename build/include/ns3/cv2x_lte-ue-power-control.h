@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_lte-ue-power-control.h
\ No newline at end of file
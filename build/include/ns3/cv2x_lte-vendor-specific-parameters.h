@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_lte-vendor-specific-parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_nist-parabolic-3d-antenna-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_no-op-component-carrier-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/helper/cv2x_phy-stats-calculator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/helper/cv2x_radio-bearer-stats-connector.h
\ No newline at end of file
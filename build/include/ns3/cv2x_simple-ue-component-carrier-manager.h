@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_simple-ue-component-carrier-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/cv2x/model/cv2x_tdmt-ff-mac-scheduler.h
\ No newline at end of file
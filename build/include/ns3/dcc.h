@@ -0,0 +1 @@
+/root/repo/src/automotive/model/DCC/dcc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/custom/model/Facilities/denBasicService_custom.h
\ No newline at end of file
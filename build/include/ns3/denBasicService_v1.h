@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/denBasicService_v1.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/denData.h
\ No newline at end of file
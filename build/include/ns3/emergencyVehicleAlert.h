@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/emergencyVehicleAlert.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/emergencyVehicleWarningServer80211p-helper.h
\ No newline at end of file
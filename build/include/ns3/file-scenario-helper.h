@@ -0,0 +1 @@
+/root/repo/src/nr/helper/file-scenario-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/utils/file-transfer-application.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/gbc-header.h
\ No newline at end of file
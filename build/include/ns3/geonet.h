@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/geonet.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/gn-location-table.h
\ No newline at end of file
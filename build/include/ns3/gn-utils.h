@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/gn-utils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/gps-tc/helper/gps-tc-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/gps-tc/model/gps-tc.h
\ No newline at end of file
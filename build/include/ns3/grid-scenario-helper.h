@@ -0,0 +1 @@
+/root/repo/src/nr/helper/grid-scenario-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/utilities/hdr-histogram.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/hexagonal-grid-scenario-helper.h
\ No newline at end of file
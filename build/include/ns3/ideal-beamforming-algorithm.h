@@ -0,0 +1 @@
+/root/repo/src/nr/model/ideal-beamforming-algorithm.h
\ No newline at end of file
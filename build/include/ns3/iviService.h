@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/iviService.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/ldm-utils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/lena-error-model.h
\ No newline at end of file
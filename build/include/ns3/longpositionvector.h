@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/longpositionvector.h
\ No newline at end of file
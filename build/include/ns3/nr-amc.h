@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-amc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-bearer-stats-connector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-bearer-stats-simple.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-ch-access-manager.h
\ No newline at end of file
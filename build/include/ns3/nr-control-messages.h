@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-control-messages.h
\ No newline at end of file
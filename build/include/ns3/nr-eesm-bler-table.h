@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-eesm-bler-table.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-eesm-cc-t1.h
\ No newline at end of file
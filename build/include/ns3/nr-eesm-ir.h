@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-eesm-ir.h
\ No newline at end of file
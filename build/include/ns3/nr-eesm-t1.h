@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-eesm-t1.h
\ No newline at end of file
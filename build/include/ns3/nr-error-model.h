@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-error-model.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-gnb-mac.h
\ No newline at end of file
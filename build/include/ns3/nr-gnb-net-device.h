@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-gnb-net-device.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-gnb-phy.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-harq-phy.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-interference.h
\ No newline at end of file
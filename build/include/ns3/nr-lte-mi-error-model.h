@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-lte-mi-error-model.h
\ No newline at end of file
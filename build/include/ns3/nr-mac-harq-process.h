@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-harq-process.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-header-fs-ul.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-header-fs.h
\ No newline at end of file
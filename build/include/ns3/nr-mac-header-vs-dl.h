@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-header-vs-dl.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-header-vs-ul.h
\ No newline at end of file
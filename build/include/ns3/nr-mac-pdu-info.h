@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-pdu-info.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-mac-rx-trace.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-sched-sap.h
\ No newline at end of file
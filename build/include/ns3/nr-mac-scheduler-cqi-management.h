@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler-cqi-management.h
\ No newline at end of file
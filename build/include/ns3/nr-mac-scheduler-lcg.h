@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler-lcg.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler-ofdma.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler-srs.h
\ No newline at end of file
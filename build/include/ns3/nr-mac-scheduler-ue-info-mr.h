@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler-ue-info-mr.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-scheduler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-mac-scheduling-stats.h
\ No newline at end of file
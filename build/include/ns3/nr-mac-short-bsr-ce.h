@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-mac-short-bsr-ce.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-phy-mac-common.h
\ No newline at end of file
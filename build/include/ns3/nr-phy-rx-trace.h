@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-phy-rx-trace.h
\ No newline at end of file
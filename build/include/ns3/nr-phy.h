@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-phy.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-point-to-point-epc-helper.h
\ No newline at end of file
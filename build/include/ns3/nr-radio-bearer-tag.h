@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-radio-bearer-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-radio-environment-map-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-rrc-protocol-ideal.h
\ No newline at end of file
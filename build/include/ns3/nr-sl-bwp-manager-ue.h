@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-bwp-manager-ue.h
\ No newline at end of file
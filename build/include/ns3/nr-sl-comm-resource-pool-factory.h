@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-comm-resource-pool-factory.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-sl-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-interference.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-mac-pdu-tag.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-phy-mac-common.h
\ No newline at end of file
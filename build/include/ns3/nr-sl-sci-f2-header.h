@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-sci-f2-header.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-ue-mac-harq.h
\ No newline at end of file
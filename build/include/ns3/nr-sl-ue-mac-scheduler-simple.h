@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-ue-mac-scheduler-simple.h
\ No newline at end of file
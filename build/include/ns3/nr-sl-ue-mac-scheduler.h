@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-ue-mac-scheduler.h
\ No newline at end of file
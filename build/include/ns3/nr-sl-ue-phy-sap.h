@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-sl-ue-phy-sap.h
\ No newline at end of file
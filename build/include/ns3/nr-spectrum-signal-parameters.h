@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-spectrum-signal-parameters.h
\ No newline at end of file
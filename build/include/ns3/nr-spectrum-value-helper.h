@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-spectrum-value-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-spectrum-value-kernels.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/nr-stats-calculator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/nr-ue-net-device.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/phPoints.h
\ No newline at end of file
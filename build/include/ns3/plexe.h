@@ -0,0 +1 @@
+/root/repo/src/custom/model/plexe/plexe.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/realistic-beamforming-algorithm.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/realistic-beamforming-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/realistic-bf-manager.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/scenario-parameters.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/model/sfnsf.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/GeoNet/shortpositionvector.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/BTP/simple-btp-application.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/simpleCAMSender-gps-tc.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/simpleCAMSender-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/custom/model/helper/stopWarningClient-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/custom/model/application/stopWarningClient.h
\ No newline at end of file
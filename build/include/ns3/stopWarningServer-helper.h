@@ -0,0 +1 @@
+/root/repo/src/custom/model/helper/stopWarningServer-helper.h
\ No newline at end of file
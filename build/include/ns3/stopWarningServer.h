@@ -0,0 +1 @@
+/root/repo/src/custom/model/application/stopWarningServer.h
\ No newline at end of file
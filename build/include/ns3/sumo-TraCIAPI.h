@@ -0,0 +1 @@
+/root/repo/src/traci/model/sumo-TraCIAPI.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/traci/model/sumo-TraCIConstants.h
\ No newline at end of file
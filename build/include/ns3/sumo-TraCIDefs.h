@@ -0,0 +1 @@
+/root/repo/src/traci/model/sumo-TraCIDefs.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/utilities/sumo-sensor.h
\ No newline at end of file
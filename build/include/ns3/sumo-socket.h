@@ -0,0 +1 @@
+/root/repo/src/traci/model/sumo-socket.h
\ No newline at end of file
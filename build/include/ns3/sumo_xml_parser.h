@@ -0,0 +1 @@
+/root/repo/src/automotive/model/utilities/sumo_xml_parser.h
\ No newline at end of file
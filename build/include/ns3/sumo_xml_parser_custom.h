@@ -0,0 +1 @@
+/root/repo/src/custom/model/utilities/sumo_xml_parser_custom.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/utils/three-gpp-channel-model-param.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/nr/helper/three-gpp-ftp-m1-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/utilities/timing-wheel.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/traci/model/traci-client.h
\ No newline at end of file
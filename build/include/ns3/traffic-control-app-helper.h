@@ -0,0 +1 @@
+/root/repo/src/traci-applications/helper/traffic-control-app-helper.h
\ No newline at end of file
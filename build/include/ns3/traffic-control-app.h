@@ -0,0 +1 @@
+/root/repo/src/traci-applications/model/traffic-control-app.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/trafficManagerClient80211p.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/trafficManagerClientLTE.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/trafficManagerServerLTE-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/trafficManagerServerLTE.h
\ No newline at end of file
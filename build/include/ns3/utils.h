@@ -0,0 +1 @@
+/root/repo/src/custom/model/utilities/utils.h
\ No newline at end of file
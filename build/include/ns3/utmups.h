@@ -0,0 +1 @@
+/root/repo/src/gps-tc/model/GeographicLib/utmups.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/gps-tc/model/GeographicLib/utmups_math.h
\ No newline at end of file
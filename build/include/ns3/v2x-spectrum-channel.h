@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Channel/v2x-spectrum-channel.h
\ No newline at end of file
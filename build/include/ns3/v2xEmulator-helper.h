@@ -0,0 +1 @@
+/root/repo/src/automotive/helper/v2xEmulator-helper.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Applications/v2xEmulator.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/src/automotive/model/Facilities/vdpGPSTraceClient.h
\ No newline at end of file
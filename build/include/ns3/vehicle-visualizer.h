@@ -0,0 +1 @@
+/root/repo/src/vehicle-visualizer/model/vehicle-visualizer.h
\ No newline at end of file
@@ -0,0 +1,964 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Micro-benchmark of the asn1-v2/asn1cpp codec layer used by all the facilities services.
+ *
+ * For each ETSI message a representative fixture is built and three phases are measured separately:
+ *  - fill:   construction of the message with asn1cpp::makeSeq()/setField(), as done by the services
+ *  - encode: UPER encoding of the already filled message
+ *  - decode: UPER decoding (and release) of the encoded message
+ * For each phase the benchmark reports the time per message, the number of heap allocations per message and the
+ * number of allocated bytes per message, together with the size of the UPER encoding.
+ * The specialized CAM/CPM encoders are benchmarked as well, on the same fixtures.
+ *
+ * The results are printed (or saved with --output) in CSV or JSON format (--format), so that codec regressions and
+ * the effect of allocator/encoder changes can be tracked over time.
+ * Heap allocations are counted by interposing malloc(), calloc() and realloc(), which is only supported with glibc:
+ * on other platforms, the allocation columns are reported as -1.
+ *
+ * Example: ./ns3 run "asn1-codec-benchmark --iterations=20000 --format=json --output=asn1-bench.json"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/specializedEncoders.h"
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+extern "C" {
+  #include "ns3/CAM.h"
+  #include "ns3/CAMV1.h"
+  #include "ns3/DENM.h"
+  #include "ns3/CPM.h"
+  #include "ns3/IVIM.h"
+  #include "ns3/MAPEM.h"
+  #include "ns3/SPATEM.h"
+  #include "ns3/SREM.h"
+  #include "ns3/VAM.h"
+  #include "ns3/NodeXY.h"
+}
+
+#include "ns3/Seq.hpp"
+#include "ns3/Setter.hpp"
+#include "ns3/Encoding.hpp"
+#include "ns3/SequenceOf.hpp"
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("Asn1CodecBenchmark");
+
+/* Heap allocation counters */
+static uint64_t g_allocations = 0;
+static uint64_t g_allocated_bytes = 0;
+
+#if defined(__GLIBC__)
+#define ALLOCATION_COUNTING_AVAILABLE true
+
+extern "C" {
+  void *__libc_malloc (size_t size);
+  void *__libc_calloc (size_t nmemb, size_t size);
+  void *__libc_realloc (void *ptr, size_t size);
+
+  // These definitions interpose the glibc ones for the whole process (including asn1c and libstdc++)
+  void *
+  malloc (size_t size) noexcept
+  {
+    g_allocations++;
+    g_allocated_bytes += size;
+    return __libc_malloc (size);
+  }
+
+  void *
+  calloc (size_t nmemb, size_t size) noexcept
+  {
+    g_allocations++;
+    g_allocated_bytes += nmemb * size;
+    return __libc_calloc (nmemb, size);
+  }
+
+  void *
+  realloc (void *ptr, size_t size) noexcept
+  {
+    g_allocations++;
+    g_allocated_bytes += size;
+    return __libc_realloc (ptr, size);
+  }
+}
+#else
+#define ALLOCATION_COUNTING_AVAILABLE false
+#endif
+
+namespace
+{
+  typedef struct benchmark_result {
+    std::string message;
+    uint64_t iterations;
+    size_t encodedBytes;
+    bool ok;
+    double fillNs;
+    double encodeNs;
+    double decodeNs;
+    double fillAllocs;
+    double encodeAllocs;
+    double decodeAllocs;
+    double fillAllocBytes;
+    double encodeAllocBytes;
+    double decodeAllocBytes;
+  } benchmark_result_t;
+
+  /* Measure the average time (ns), allocations and allocated bytes of a single execution of 'phase' */
+  class PhaseMeter
+  {
+    public:
+      PhaseMeter (uint64_t iterations) : m_iterations (iterations) {}
+
+      void
+      run (const std::function<void ()> &phase, double &ns, double &allocs, double &allocBytes)
+      {
+        // Warm-up, not included in the statistics
+        for (uint64_t i = 0; i < m_iterations / 10 + 1; i++)
+          {
+            phase ();
+          }
+
+        uint64_t allocations_start = g_allocations;
+        uint64_t bytes_start = g_allocated_bytes;
+        auto start = std::chrono::steady_clock::now ();
+
+        for (uint64_t i = 0; i < m_iterations; i++)
+          {
+            phase ();
+          }
+
+        auto end = std::chrono::steady_clock::now ();
+
+        ns = std::chrono::duration<double, std::nano> (end - start).count () / m_iterations;
+        allocs = ALLOCATION_COUNTING_AVAILABLE ? (double)(g_allocations - allocations_start) / m_iterations : -1;
+        allocBytes = ALLOCATION_COUNTING_AVAILABLE ? (double)(g_allocated_bytes - bytes_start) / m_iterations : -1;
+      }
+
+    private:
+      uint64_t m_iterations;
+  };
+
+  // Prevent the compiler from optimizing away the benchmarked operations
+  volatile size_t g_sink = 0;
+
+  template <typename T>
+  benchmark_result_t
+  benchmarkMessage (const std::string &name, asn_TYPE_descriptor_t *def, std::function<asn1cpp::Seq<T> ()> fill, uint64_t iterations)
+  {
+    benchmark_result_t res = {};
+    PhaseMeter meter (iterations);
+
+    res.message = name;
+    res.iterations = iterations;
+
+    asn1cpp::Seq<T> msg = fill ();
+    std::string encoded = asn1cpp::uper::encode (msg);
+    res.ok = encoded.size () > 0 && bool(asn1cpp::uper::decode<T> (def, encoded));
+    res.encodedBytes = encoded.size ();
+
+    if (!res.ok)
+      {
+        NS_LOG_ERROR ("Cannot encode/decode the " << name << " fixture. Skipping it.");
+        return res;
+      }
+
+    meter.run ([&] () { g_sink += bool(fill ()); }, res.fillNs, res.fillAllocs, res.fillAllocBytes);
+    meter.run ([&] () { g_sink += asn1cpp::uper::encode (msg).size (); }, res.encodeNs, res.encodeAllocs, res.encodeAllocBytes);
+    meter.run ([&] () { g_sink += bool(asn1cpp::uper::decode<T> (def, encoded)); }, res.decodeNs, res.decodeAllocs, res.decodeAllocBytes);
+
+    return res;
+  }
+
+  /* Benchmark of a specialized encoder: the 'fill' phase is the preparation of its input data, which is negligible */
+  template <typename T>
+  benchmark_result_t
+  benchmarkSpecializedEncoder (const std::string &name, asn_TYPE_descriptor_t *def, std::function<bool (std::string &)> encode, const std::string &reference, uint64_t iterations)
+  {
+    benchmark_result_t res = {};
+    PhaseMeter meter (iterations);
+    std::string encoded;
+
+    res.message = name;
+    res.iterations = iterations;
+    res.ok = encode (encoded) && encoded == reference;
+    res.encodedBytes = encoded.size ();
+
+    if (!res.ok)
+      {
+        NS_LOG_ERROR ("The specialized encoder does not match the generic one for " << name << ". Skipping it.");
+        return res;
+      }
+
+    meter.run ([&] () { g_sink += encode (encoded); }, res.encodeNs, res.encodeAllocs, res.encodeAllocBytes);
+    meter.run ([&] () { g_sink += bool(asn1cpp::uper::decode<T> (def, encoded)); }, res.decodeNs, res.decodeAllocs, res.decodeAllocBytes);
+
+    return res;
+  }
+
+  /* Set a fixed-size BIT STRING from the nbits least significant bits of 'value' (first bit = MSB) */
+  void
+  setBitString (BIT_STRING_t &bs, uint32_t value, unsigned int nbits)
+  {
+    size_t bytes = (nbits + 7) / 8;
+
+    free (bs.buf);
+    bs.buf = (uint8_t *) calloc (bytes, 1);
+    bs.size = bytes;
+    bs.bits_unused = bytes * 8 - nbits;
+
+    for (unsigned int i = 0; i < nbits; i++)
+      {
+        if ((value >> (nbits - 1 - i)) & 0x01)
+          {
+            bs.buf[i / 8] |= 1 << (7 - i % 8);
+          }
+      }
+  }
+
+  /*
+   * Representative fixtures
+   * The values are the ones typically generated by the services for a vehicle driving in an urban scenario
+   */
+  const unsigned long fixture_stationID = 1234567;
+  const long fixture_latitude = 450625530;
+  const long fixture_longitude = 76598790;
+  const long fixture_timestamp = 568473600123; // TimestampIts, in ms since 2004-01-01
+
+  asn1cpp::Seq<CAMV1>
+  fillCamV1 ()
+  {
+    auto cam = asn1cpp::makeSeq (CAMV1);
+
+    asn1cpp::setField (cam->header.messageID, ItsPduHeader__messageID_cam);
+    asn1cpp::setField (cam->header.protocolVersion, 1);
+    asn1cpp::setField (cam->header.stationID, fixture_stationID);
+    asn1cpp::setField (cam->cam.generationDeltaTime, 41235);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.stationType, StationType_passengerCar);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeValue, 23500);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeConfidence, AltitudeConfidence_unavailable);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.latitude, fixture_latitude);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.longitude, fixture_longitude);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, 350);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, 200);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, 1200);
+    asn1cpp::setField (cam->cam.camParameters.highFrequencyContainer.present, HighFrequencyContainerV1_PR_basicVehicleContainerHighFrequency);
+    auto &hf = cam->cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    asn1cpp::setField (hf.heading.headingValue, 1795);
+    asn1cpp::setField (hf.heading.headingConfidence, 10);
+    asn1cpp::setField (hf.speed.speedValue, 1389);
+    asn1cpp::setField (hf.speed.speedConfidence, 5);
+    asn1cpp::setField (hf.driveDirection, DriveDirection_forward);
+    asn1cpp::setField (hf.vehicleLength.vehicleLengthValue, 45);
+    asn1cpp::setField (hf.vehicleLength.vehicleLengthConfidenceIndication, VehicleLengthConfidenceIndication_noTrailerPresent);
+    asn1cpp::setField (hf.vehicleWidth, 18);
+    asn1cpp::setField (hf.longitudinalAcceleration.longitudinalAccelerationValue, 12);
+    asn1cpp::setField (hf.longitudinalAcceleration.longitudinalAccelerationConfidence, 10);
+    asn1cpp::setField (hf.curvature.curvatureValue, CurvatureValue_straight);
+    asn1cpp::setField (hf.curvature.curvatureConfidence, CurvatureConfidence_unavailable);
+    asn1cpp::setField (hf.curvatureCalculationMode, CurvatureCalculationMode_yawRateUsed);
+    asn1cpp::setField (hf.yawRate.yawRateValue, 35);
+    asn1cpp::setField (hf.yawRate.yawRateConfidence, YawRateConfidence_unavailable);
+    asn1cpp::setField (hf.lanePosition, 1);
+
+    return cam;
+  }
+
+  void
+  fillCamV2HighFrequency (asn1cpp::Seq<CAM> &cam)
+  {
+    asn1cpp::setField (cam->header.messageID, ItsPduHeader__messageID_cam);
+    asn1cpp::setField (cam->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (cam->header.stationID, fixture_stationID);
+    asn1cpp::setField (cam->cam.generationDeltaTime, 41235);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.stationType, StationType_passengerCar);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeValue, 23500);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeConfidence, AltitudeConfidence_unavailable);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.latitude, fixture_latitude);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.longitude, fixture_longitude);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, 350);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, 200);
+    asn1cpp::setField (cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, 1200);
+    asn1cpp::setField (cam->cam.camParameters.highFrequencyContainer.present, HighFrequencyContainer_PR_basicVehicleContainerHighFrequency);
+    auto &hf = cam->cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    asn1cpp::setField (hf.heading.headingValue, 1795);
+    asn1cpp::setField (hf.heading.headingConfidence, 10);
+    asn1cpp::setField (hf.speed.speedValue, 1389);
+    asn1cpp::setField (hf.speed.speedConfidence, 5);
+    asn1cpp::setField (hf.driveDirection, DriveDirection_forward);
+    asn1cpp::setField (hf.vehicleLength.vehicleLengthValue, 45);
+    asn1cpp::setField (hf.vehicleLength.vehicleLengthConfidenceIndication, VehicleLengthConfidenceIndication_noTrailerPresent);
+    asn1cpp::setField (hf.vehicleWidth, 18);
+    asn1cpp::setField (hf.longitudinalAcceleration.longitudinalAccelerationValue, 12);
+    asn1cpp::setField (hf.longitudinalAcceleration.longitudinalAccelerationConfidence, 10);
+    asn1cpp::setField (hf.curvature.curvatureValue, CurvatureValue_straight);
+    asn1cpp::setField (hf.curvature.curvatureConfidence, CurvatureConfidence_unavailable);
+    asn1cpp::setField (hf.curvatureCalculationMode, CurvatureCalculationMode_yawRateUsed);
+    asn1cpp::setField (hf.yawRate.yawRateValue, 35);
+    asn1cpp::setField (hf.yawRate.yawRateConfidence, YawRateConfidence_unavailable);
+    asn1cpp::setField (hf.lanePosition, 1);
+  }
+
+  asn1cpp::Seq<CAM>
+  fillCamV2 ()
+  {
+    auto cam = asn1cpp::makeSeq (CAM);
+    fillCamV2HighFrequency (cam);
+    return cam;
+  }
+
+  /* CAM with a low frequency container including a full (23 points) path history */
+  asn1cpp::Seq<CAM>
+  fillCamV2LowFrequency ()
+  {
+    auto cam = asn1cpp::makeSeq (CAM);
+    fillCamV2HighFrequency (cam);
+
+    auto lowFreqContainer = asn1cpp::makeSeq (LowFrequencyContainer);
+    asn1cpp::setField (lowFreqContainer->present, LowFrequencyContainer_PR_basicVehicleContainerLowFrequency);
+    asn1cpp::setField (lowFreqContainer->choice.basicVehicleContainerLowFrequency.vehicleRole, VehicleRole_default);
+    setBitString (lowFreqContainer->choice.basicVehicleContainerLowFrequency.exteriorLights, 0x30, 8);
+
+    for (int i = 0; i < 23; i++)
+      {
+        auto pathPoint = asn1cpp::makeSeq (PathPoint);
+        asn1cpp::setField (pathPoint->pathPosition.deltaLatitude, -120 - 3 * i);
+        asn1cpp::setField (pathPoint->pathPosition.deltaLongitude, 85 + 2 * i);
+        asn1cpp::setField (pathPoint->pathPosition.deltaAltitude, 0);
+        asn1cpp::setField (pathPoint->pathDeltaTime, 10);
+        asn1cpp::sequenceof::pushList (lowFreqContainer->choice.basicVehicleContainerLowFrequency.pathHistory, pathPoint);
+      }
+
+    asn1cpp::setField (cam->cam.camParameters.lowFrequencyContainer, lowFreqContainer);
+
+    return cam;
+  }
+
+  /* DENM with situation and location containers (one trace of 10 points) */
+  asn1cpp::Seq<DENM>
+  fillDenm ()
+  {
+    auto denm = asn1cpp::makeSeq (DENM);
+
+    asn1cpp::setField (denm->header.messageID, ItsPduHeader__messageID_denm);
+    asn1cpp::setField (denm->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (denm->header.stationID, fixture_stationID);
+    asn1cpp::setField (denm->denm.management.actionID.originatingStationID, fixture_stationID);
+    asn1cpp::setField (denm->denm.management.actionID.sequenceNumber, 42);
+    asn1cpp::setField (denm->denm.management.detectionTime, fixture_timestamp);
+    asn1cpp::setField (denm->denm.management.referenceTime, fixture_timestamp);
+    asn1cpp::setField (denm->denm.management.eventPosition.latitude, fixture_latitude);
+    asn1cpp::setField (denm->denm.management.eventPosition.longitude, fixture_longitude);
+    asn1cpp::setField (denm->denm.management.eventPosition.positionConfidenceEllipse.semiMajorConfidence, 350);
+    asn1cpp::setField (denm->denm.management.eventPosition.positionConfidenceEllipse.semiMinorConfidence, 200);
+    asn1cpp::setField (denm->denm.management.eventPosition.positionConfidenceEllipse.semiMajorOrientation, 1200);
+    asn1cpp::setField (denm->denm.management.eventPosition.altitude.altitudeValue, 23500);
+    asn1cpp::setField (denm->denm.management.eventPosition.altitude.altitudeConfidence, AltitudeConfidence_unavailable);
+    asn1cpp::setField (denm->denm.management.relevanceDistance, RelevanceDistance_lessThan500m);
+    asn1cpp::setField (denm->denm.management.relevanceTrafficDirection, RelevanceTrafficDirection_allTrafficDirections);
+    asn1cpp::setField (denm->denm.management.validityDuration, 20);
+    asn1cpp::setField (denm->denm.management.stationType, StationType_passengerCar);
+
+    auto situation = asn1cpp::makeSeq (SituationContainer);
+    asn1cpp::setField (situation->informationQuality, 3);
+    asn1cpp::setField (situation->eventType.causeCode, CauseCodeType_emergencyVehicleApproaching);
+    asn1cpp::setField (situation->eventType.subCauseCode, 1);
+    asn1cpp::setField (denm->denm.situation, situation);
+
+    auto location = asn1cpp::makeSeq (LocationContainer);
+    auto eventSpeed = asn1cpp::makeSeq (Speed);
+    asn1cpp::setField (eventSpeed->speedValue, 1389);
+    asn1cpp::setField (eventSpeed->speedConfidence, 5);
+    asn1cpp::setField (location->eventSpeed, eventSpeed);
+    auto eventHeading = asn1cpp::makeSeq (Heading);
+    asn1cpp::setField (eventHeading->headingValue, 1795);
+    asn1cpp::setField (eventHeading->headingConfidence, 10);
+    asn1cpp::setField (location->eventPositionHeading, eventHeading);
+
+    auto pathHistory = asn1cpp::makeSeq (PathHistory);
+    for (int i = 0; i < 10; i++)
+      {
+        auto pathPoint = asn1cpp::makeSeq (PathPoint);
+        asn1cpp::setField (pathPoint->pathPosition.deltaLatitude, -120 - 3 * i);
+        asn1cpp::setField (pathPoint->pathPosition.deltaLongitude, 85 + 2 * i);
+        asn1cpp::setField (pathPoint->pathPosition.deltaAltitude, 0);
+        asn1cpp::setField (pathPoint->pathDeltaTime, 10);
+        asn1cpp::sequenceof::pushList (*pathHistory, pathPoint);
+      }
+    asn1cpp::sequenceof::pushList (location->traces, pathHistory);
+    asn1cpp::setField (location->roadType, RoadType_urban_NoStructuralSeparationToOppositeLanes);
+    asn1cpp::setField (denm->denm.location, location);
+
+    return denm;
+  }
+
+  /* Same layout as the CPMs generated by the CP Basic Service */
+  void
+  cpmFixtureData (long numberOfPOs, CPMSkeletonEncoder::CPM_static_data_t &s, CPMSkeletonEncoder::CPM_dynamic_data_t &d)
+  {
+    CPMSkeletonEncoder::CPM_vehicle_sensor_t sensor = {2, SensorType_radar, 0, 0, 0, 50, 0, 3600};
+
+    s.stationID = fixture_stationID;
+    s.stationType = StationType_passengerCar;
+    s.vehicleLengthValue = 45;
+    s.vehicleLengthConfidence = VehicleLengthConfidenceIndication_noTrailerPresent;
+    s.vehicleWidth = 18;
+    s.sensors.assign (1, sensor);
+
+    d.generationDeltaTime = 41235;
+    d.latitude = fixture_latitude;
+    d.longitude = fixture_longitude;
+    d.semiMajorConfidence = 350;
+    d.semiMinorConfidence = 200;
+    d.semiMajorOrientation = 1200;
+    d.altitudeValue = 23500;
+    d.altitudeConfidence = AltitudeConfidence_unavailable;
+    d.headingValue = 1795;
+    d.headingConfidence = 10;
+    d.speedValue = 1389;
+    d.speedConfidence = 5;
+    d.driveDirection = DriveDirection_forward;
+    d.longAccelerationValue = 12;
+    d.longAccelerationConfidence = 10;
+    d.yawRateValue = 35;
+    d.yawRateConfidence = YawRateConfidence_unavailable;
+    d.sensorInformationContainer = true;
+    d.numberOfPerceivedObjects = numberOfPOs;
+    d.perceivedObjects.clear ();
+
+    for (long i = 0; i < numberOfPOs; i++)
+      {
+        CPMSkeletonEncoder::CPM_perceived_object_t po;
+        po.objectID = i;
+        po.timeOfMeasurement = 50 + i;
+        po.objectConfidence = ObjectConfidence_unavailable;
+        po.xDistanceValue = -2500 + 97 * i;
+        po.xDistanceConfidence = DistanceConfidence_unavailable;
+        po.yDistanceValue = 1200 - 43 * i;
+        po.yDistanceConfidence = DistanceConfidence_unavailable;
+        po.xSpeedValue = 1389 - 11 * i;
+        po.xSpeedConfidence = SpeedConfidence_unavailable;
+        po.ySpeedValue = 7 * i;
+        po.ySpeedConfidence = SpeedConfidence_unavailable;
+        po.yawAngleValue = (1795 + 31 * i) % 3600;
+        po.yawAngleConfidence = AngleConfidence_unavailable;
+        po.planarObjectDimension1Value = 50;
+        po.planarObjectDimension1Confidence = ObjectDimensionConfidence_unavailable;
+        po.planarObjectDimension2Value = 18;
+        po.planarObjectDimension2Confidence = ObjectDimensionConfidence_unavailable;
+        po.objectRefPoint = ObjectRefPoint_topMid;
+        d.perceivedObjects.push_back (po);
+      }
+  }
+
+  asn1cpp::Seq<CPM>
+  fillCpm (long numberOfPOs)
+  {
+    CPMSkeletonEncoder::CPM_static_data_t s;
+    CPMSkeletonEncoder::CPM_dynamic_data_t d;
+    cpmFixtureData (numberOfPOs, s, d);
+
+    auto cpm = asn1cpp::makeSeq (CPM);
+
+    if (numberOfPOs > 0)
+      {
+        auto POsContainer = asn1cpp::makeSeq (PerceivedObjectContainer);
+        for (const auto &po_data : d.perceivedObjects)
+          {
+            auto PO = asn1cpp::makeSeq (PerceivedObject);
+            asn1cpp::setField (PO->objectID, po_data.objectID);
+            asn1cpp::setField (PO->timeOfMeasurement, po_data.timeOfMeasurement);
+            asn1cpp::setField (PO->objectConfidence, po_data.objectConfidence);
+            asn1cpp::setField (PO->xDistance.value, po_data.xDistanceValue);
+            asn1cpp::setField (PO->xDistance.confidence, po_data.xDistanceConfidence);
+            asn1cpp::setField (PO->yDistance.value, po_data.yDistanceValue);
+            asn1cpp::setField (PO->yDistance.confidence, po_data.yDistanceConfidence);
+            asn1cpp::setField (PO->xSpeed.value, po_data.xSpeedValue);
+            asn1cpp::setField (PO->xSpeed.confidence, po_data.xSpeedConfidence);
+            asn1cpp::setField (PO->ySpeed.value, po_data.ySpeedValue);
+            asn1cpp::setField (PO->ySpeed.confidence, po_data.ySpeedConfidence);
+            auto angle = asn1cpp::makeSeq (CartesianAngle);
+            asn1cpp::setField (angle->value, po_data.yawAngleValue);
+            asn1cpp::setField (angle->confidence, po_data.yawAngleConfidence);
+            asn1cpp::setField (PO->yawAngle, angle);
+            auto OD1 = asn1cpp::makeSeq (ObjectDimension);
+            asn1cpp::setField (OD1->value, po_data.planarObjectDimension1Value);
+            asn1cpp::setField (OD1->confidence, po_data.planarObjectDimension1Confidence);
+            asn1cpp::setField (PO->planarObjectDimension1, OD1);
+            auto OD2 = asn1cpp::makeSeq (ObjectDimension);
+            asn1cpp::setField (OD2->value, po_data.planarObjectDimension2Value);
+            asn1cpp::setField (OD2->confidence, po_data.planarObjectDimension2Confidence);
+            asn1cpp::setField (PO->planarObjectDimension2, OD2);
+            asn1cpp::setField (PO->objectRefPoint, po_data.objectRefPoint);
+            asn1cpp::sequenceof::pushList (*POsContainer, PO);
+          }
+        asn1cpp::setField (cpm->cpm.cpmParameters.perceivedObjectContainer, POsContainer);
+      }
+
+    asn1cpp::setField (cpm->cpm.cpmParameters.numberOfPerceivedObjects, d.numberOfPerceivedObjects);
+
+    auto sensorInfoContainer = asn1cpp::makeSeq (SensorInformationContainer);
+    for (const auto &sensor : s.sensors)
+      {
+        auto sensorInfo = asn1cpp::makeSeq (SensorInformation);
+        asn1cpp::setField (sensorInfo->sensorID, sensor.sensorID);
+        asn1cpp::setField (sensorInfo->type, sensor.type);
+        auto detectionArea = asn1cpp::makeSeq (DetectionArea);
+        asn1cpp::setField (detectionArea->present, DetectionArea_PR_vehicleSensor);
+        asn1cpp::setField (detectionArea->choice.vehicleSensor.refPointId, sensor.refPointId);
+        asn1cpp::setField (detectionArea->choice.vehicleSensor.xSensorOffset, sensor.xSensorOffset);
+        asn1cpp::setField (detectionArea->choice.vehicleSensor.ySensorOffset, sensor.ySensorOffset);
+        auto property = asn1cpp::makeSeq (VehicleSensorProperties);
+        asn1cpp::setField (property->range, sensor.range);
+        asn1cpp::setField (property->horizontalOpeningAngleStart, sensor.horizontalOpeningAngleStart);
+        asn1cpp::setField (property->horizontalOpeningAngleEnd, sensor.horizontalOpeningAngleEnd);
+        asn1cpp::sequenceof::pushList (detectionArea->choice.vehicleSensor.vehicleSensorPropertyList, property);
+        asn1cpp::setField (sensorInfo->detectionArea, detectionArea);
+        asn1cpp::sequenceof::pushList (*sensorInfoContainer, sensorInfo);
+      }
+    asn1cpp::setField (cpm->cpm.cpmParameters.sensorInformationContainer, sensorInfoContainer);
+
+    asn1cpp::setField (cpm->header.messageID, ItsPduHeader__messageID_cpm);
+    asn1cpp::setField (cpm->header.protocolVersion, 1);
+    asn1cpp::setField (cpm->header.stationID, s.stationID);
+    asn1cpp::setField (cpm->cpm.generationDeltaTime, d.generationDeltaTime);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.stationType, s.stationType);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeValue, d.altitudeValue);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeConfidence, d.altitudeConfidence);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.latitude, d.latitude);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.longitude, d.longitude);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, d.semiMajorConfidence);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, d.semiMinorConfidence);
+    asn1cpp::setField (cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, d.semiMajorOrientation);
+
+    auto stationDataContainer = asn1cpp::makeSeq (StationDataContainer);
+    asn1cpp::setField (stationDataContainer->present, StationDataContainer_PR_originatingVehicleContainer);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.heading.headingValue, d.headingValue);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.heading.headingConfidence, d.headingConfidence);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.speed.speedValue, d.speedValue);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.speed.speedConfidence, d.speedConfidence);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.driveDirection, d.driveDirection);
+    auto vehicleLength = asn1cpp::makeSeq (VehicleLength);
+    asn1cpp::setField (vehicleLength->vehicleLengthValue, s.vehicleLengthValue);
+    asn1cpp::setField (vehicleLength->vehicleLengthConfidenceIndication, s.vehicleLengthConfidence);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.vehicleLength, vehicleLength);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.vehicleWidth, s.vehicleWidth);
+    auto longAcc = asn1cpp::makeSeq (LongitudinalAcceleration);
+    asn1cpp::setField (longAcc->longitudinalAccelerationValue, d.longAccelerationValue);
+    asn1cpp::setField (longAcc->longitudinalAccelerationConfidence, d.longAccelerationConfidence);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.longitudinalAcceleration, longAcc);
+    auto yawRate = asn1cpp::makeSeq (YawRate);
+    asn1cpp::setField (yawRate->yawRateValue, d.yawRateValue);
+    asn1cpp::setField (yawRate->yawRateConfidence, d.yawRateConfidence);
+    asn1cpp::setField (stationDataContainer->choice.originatingVehicleContainer.yawRate, yawRate);
+    asn1cpp::setField (cpm->cpm.cpmParameters.stationDataContainer, stationDataContainer);
+
+    return cpm;
+  }
+
+  /* IVIM with a geographic location container (one segment of 8 points) and a speed limit sign */
+  asn1cpp::Seq<IVIM>
+  fillIvim ()
+  {
+    auto ivim = asn1cpp::makeSeq (IVIM);
+
+    asn1cpp::setField (ivim->header.messageID, ItsPduHeader__messageID_ivim);
+    asn1cpp::setField (ivim->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (ivim->header.stationID, fixture_stationID);
+
+    setBitString (ivim->ivi.mandatory.serviceProviderId.countryCode, 0x1A5, 10);
+    asn1cpp::setField (ivim->ivi.mandatory.serviceProviderId.providerIdentifier, 1);
+    asn1cpp::setField (ivim->ivi.mandatory.iviIdentificationNumber, 17);
+    asn1cpp::setField (ivim->ivi.mandatory.timeStamp, fixture_timestamp);
+    asn1cpp::setField (ivim->ivi.mandatory.iviStatus, 0);
+
+    auto glcCont = asn1cpp::makeSeq (IviContainer);
+    asn1cpp::setField (glcCont->present, IviContainer_PR_glc);
+    auto glc = asn1cpp::makeSeq (GeographicLocationContainer);
+    asn1cpp::setField (glc->referencePosition.latitude, fixture_latitude);
+    asn1cpp::setField (glc->referencePosition.longitude, fixture_longitude);
+    asn1cpp::setField (glc->referencePosition.positionConfidenceEllipse.semiMajorConfidence, SemiAxisLength_unavailable);
+    asn1cpp::setField (glc->referencePosition.positionConfidenceEllipse.semiMinorConfidence, SemiAxisLength_unavailable);
+    asn1cpp::setField (glc->referencePosition.positionConfidenceEllipse.semiMajorOrientation, HeadingValue_unavailable);
+    asn1cpp::setField (glc->referencePosition.altitude.altitudeValue, AltitudeValue_unavailable);
+    asn1cpp::setField (glc->referencePosition.altitude.altitudeConfidence, AltitudeConfidence_unavailable);
+
+    auto glcPart = asn1cpp::makeSeq (GlcPart);
+    asn1cpp::setField (glcPart->zoneId, 1);
+    auto zone = asn1cpp::makeSeq (Zone);
+    asn1cpp::setField (zone->present, Zone_PR_segment);
+    asn1cpp::setField (zone->choice.segment.line.present, PolygonalLine_PR_deltaPositions);
+    for (int i = 0; i < 8; i++)
+      {
+        auto deltaPos = asn1cpp::makeSeq (DeltaPosition);
+        asn1cpp::setField (deltaPos->deltaLatitude, 250 + 10 * i);
+        asn1cpp::setField (deltaPos->deltaLongitude, -180 + 5 * i);
+        asn1cpp::sequenceof::pushList (zone->choice.segment.line.choice.deltaPositions, deltaPos);
+      }
+    asn1cpp::setField (zone->choice.segment.laneWidth, 350);
+    asn1cpp::setField (glcPart->zone, zone);
+    asn1cpp::sequenceof::pushList (glc->parts, glcPart);
+    asn1cpp::setField (glcCont->choice.glc, glc);
+    asn1cpp::sequenceof::pushList (ivim->ivi.optional, glcCont);
+
+    auto givCont = asn1cpp::makeSeq (IviContainer);
+    asn1cpp::setField (givCont->present, IviContainer_PR_giv);
+    auto gicPart = asn1cpp::makeSeq (GicPart);
+    asn1cpp::sequenceof::pushList (gicPart->detectionZoneIds, 1);
+    asn1cpp::sequenceof::pushList (gicPart->relevanceZoneIds, 1);
+    asn1cpp::setField (gicPart->direction, 0);
+    asn1cpp::setField (gicPart->iviType, 1);
+    auto rsCode = asn1cpp::makeSeq (RSCode);
+    asn1cpp::setField (rsCode->code.present, RSCode__code_PR_iso14823);
+    asn1cpp::setField (rsCode->code.choice.iso14823.pictogramCode.serviceCategoryCode.present,
+                       ISO14823Code__pictogramCode__serviceCategoryCode_PR_trafficSignPictogram);
+    asn1cpp::setField (rsCode->code.choice.iso14823.pictogramCode.serviceCategoryCode.choice.trafficSignPictogram, 1);
+    asn1cpp::setField (rsCode->code.choice.iso14823.pictogramCode.pictogramCategoryCode.nature, 5);
+    asn1cpp::setField (rsCode->code.choice.iso14823.pictogramCode.pictogramCategoryCode.serialNumber, 57);
+    auto attribute = asn1cpp::makeSeq (ISO14823Attribute);
+    asn1cpp::setField (attribute->present, ISO14823Attribute_PR_spe);
+    asn1cpp::setField (attribute->choice.spe.spm, 50);
+    asn1cpp::setField (attribute->choice.spe.unit, 0);
+    asn1cpp::sequenceof::pushList (rsCode->code.choice.iso14823.attributes, attribute);
+    asn1cpp::sequenceof::pushList (gicPart->roadSignCodes, rsCode);
+    asn1cpp::sequenceof::pushList (givCont->choice.giv, gicPart);
+    asn1cpp::sequenceof::pushList (ivim->ivi.optional, givCont);
+
+    return ivim;
+  }
+
+  /* MAPEM describing a four-way intersection with 8 lanes of 6 nodes each */
+  asn1cpp::Seq<MAPEM>
+  fillMapem ()
+  {
+    auto mapem = asn1cpp::makeSeq (MAPEM);
+
+    asn1cpp::setField (mapem->header.messageID, ItsPduHeader__messageID_mapem);
+    asn1cpp::setField (mapem->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (mapem->header.stationID, fixture_stationID);
+    asn1cpp::setField (mapem->map.timeStamp, 421337);
+    asn1cpp::setField (mapem->map.msgIssueRevision, 3);
+
+    auto intersection = asn1cpp::makeSeq (IntersectionGeometry);
+    asn1cpp::setField (intersection->id.id, 1024);
+    asn1cpp::setField (intersection->revision, 3);
+    asn1cpp::setField (intersection->refPoint.lat, fixture_latitude);
+    asn1cpp::setField (intersection->refPoint.Long, fixture_longitude);
+    asn1cpp::setField (intersection->laneWidth, 350);
+
+    for (int l = 0; l < 8; l++)
+      {
+        auto lane = asn1cpp::makeSeq (GenericLane);
+        asn1cpp::setField (lane->laneID, l + 1);
+        asn1cpp::setField (lane->ingressApproach, l / 2 + 1);
+        setBitString (lane->laneAttributes.directionalUse, l % 2 ? 0x1 : 0x2, 2);
+        setBitString (lane->laneAttributes.sharedWith, 0x0, 10);
+        asn1cpp::setField (lane->laneAttributes.laneType.present, LaneTypeAttributes_PR_vehicle);
+        setBitString (lane->laneAttributes.laneType.choice.vehicle, 0x0, 8);
+        asn1cpp::setField (lane->nodeList.present, NodeListXY_PR_nodes);
+        for (int n = 0; n < 6; n++)
+          {
+            auto node = asn1cpp::makeSeq (NodeXY);
+            asn1cpp::setField (node->delta.present, NodeOffsetPointXY_PR_node_XY1);
+            asn1cpp::setField (node->delta.choice.node_XY1.x, (l % 2 ? 1 : -1) * (150 + 20 * n));
+            asn1cpp::setField (node->delta.choice.node_XY1.y, 40 * (l - 4));
+            asn1cpp::sequenceof::pushList (lane->nodeList.choice.nodes, node);
+          }
+        asn1cpp::sequenceof::pushList (intersection->laneSet, lane);
+      }
+    asn1cpp::sequenceof::pushList (mapem->map.intersections, intersection);
+
+    return mapem;
+  }
+
+  /* SPATEM for the same intersection, with 8 signal groups */
+  asn1cpp::Seq<SPATEM>
+  fillSpatem ()
+  {
+    auto spatem = asn1cpp::makeSeq (SPATEM);
+
+    asn1cpp::setField (spatem->header.messageID, ItsPduHeader__messageID_spatem);
+    asn1cpp::setField (spatem->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (spatem->header.stationID, fixture_stationID);
+    asn1cpp::setField (spatem->spat.timeStamp, 421337);
+
+    auto intersection = asn1cpp::makeSeq (IntersectionState);
+    asn1cpp::setField (intersection->id.id, 1024);
+    asn1cpp::setField (intersection->revision, 3);
+    setBitString (intersection->status, 0x0, 16);
+    asn1cpp::setField (intersection->moy, 421337);
+    asn1cpp::setField (intersection->timeStamp, 35000);
+
+    for (int g = 0; g < 8; g++)
+      {
+        auto movement = asn1cpp::makeSeq (MovementState);
+        asn1cpp::setField (movement->signalGroup, g + 1);
+        auto event = asn1cpp::makeSeq (MovementEvent);
+        asn1cpp::setField (event->eventState, g % 2 ? MovementPhaseState_stop_And_Remain : MovementPhaseState_protected_Movement_Allowed);
+        auto timing = asn1cpp::makeSeq (TimeChangeDetails);
+        asn1cpp::setField (timing->minEndTime, 12000 + 10 * g);
+        asn1cpp::setField (timing->maxEndTime, 12300 + 10 * g);
+        asn1cpp::setField (timing->likelyTime, 12150 + 10 * g);
+        asn1cpp::setField (event->timing, timing);
+        asn1cpp::sequenceof::pushList (movement->state_time_speed, event);
+        asn1cpp::sequenceof::pushList (intersection->states, movement);
+      }
+    asn1cpp::sequenceof::pushList (spatem->spat.intersections, intersection);
+
+    return spatem;
+  }
+
+  /* SREM with a single priority request */
+  asn1cpp::Seq<SREM>
+  fillSrem ()
+  {
+    auto srem = asn1cpp::makeSeq (SREM);
+
+    asn1cpp::setField (srem->header.messageID, ItsPduHeader__messageID_srem);
+    asn1cpp::setField (srem->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (srem->header.stationID, fixture_stationID);
+    asn1cpp::setField (srem->srm.timeStamp, 421337);
+    asn1cpp::setField (srem->srm.second, 35000);
+    asn1cpp::setField (srem->srm.sequenceNumber, 7);
+
+    auto request = asn1cpp::makeSeq (SignalRequestPackage);
+    asn1cpp::setField (request->request.id.id, 1024);
+    asn1cpp::setField (request->request.requestID, 1);
+    asn1cpp::setField (request->request.requestType, PriorityRequestType_priorityRequest);
+    asn1cpp::setField (request->request.inBoundLane.present, IntersectionAccessPoint_PR_lane);
+    asn1cpp::setField (request->request.inBoundLane.choice.lane, 3);
+    asn1cpp::setField (request->duration, 10000);
+    asn1cpp::sequenceof::pushList (srem->srm.requests, request);
+
+    asn1cpp::setField (srem->srm.requestor.id.present, VehicleID_PR_stationID);
+    asn1cpp::setField (srem->srm.requestor.id.choice.stationID, fixture_stationID);
+
+    return srem;
+  }
+
+  /* VAM of a pedestrian, with the mandatory containers only */
+  asn1cpp::Seq<VAM>
+  fillVam ()
+  {
+    auto vam = asn1cpp::makeSeq (VAM);
+
+    asn1cpp::setField (vam->header.messageID, 16);
+    asn1cpp::setField (vam->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField (vam->header.stationID, fixture_stationID);
+    asn1cpp::setField (vam->vam.generationDeltaTime, 41235);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.stationType, StationType_pedestrian);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.latitude, fixture_latitude);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.longitude, fixture_longitude);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, 350);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, 200);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, 1200);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.altitude.altitudeValue, 23500);
+    asn1cpp::setField (vam->vam.vamParameters.basicContainer.referencePosition.altitude.altitudeConfidence, AltitudeConfidence_unavailable);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.heading.value, 900);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.heading.confidence, 10);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.speed.speedValue, 140);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.speed.speedConfidence, 5);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.longitudinalAcceleration.longitudinalAccelerationValue, 0);
+    asn1cpp::setField (vam->vam.vamParameters.vruHighFrequencyContainer.longitudinalAcceleration.longitudinalAccelerationConfidence, 10);
+
+    return vam;
+  }
+
+  CAMSkeletonEncoder::CAM_static_data_t
+  camSkeletonStaticData ()
+  {
+    CAMSkeletonEncoder::CAM_static_data_t s;
+    s.stationID = fixture_stationID;
+    s.stationType = StationType_passengerCar;
+    s.vehicleLengthValue = 45;
+    s.vehicleLengthConfidence = VehicleLengthConfidenceIndication_noTrailerPresent;
+    s.vehicleWidth = 18;
+    return s;
+  }
+
+  CAMSkeletonEncoder::CAM_dynamic_data_t
+  camSkeletonDynamicData ()
+  {
+    CAMSkeletonEncoder::CAM_dynamic_data_t d;
+    d.generationDeltaTime = 41235;
+    d.latitude = fixture_latitude;
+    d.longitude = fixture_longitude;
+    d.semiMajorConfidence = 350;
+    d.semiMinorConfidence = 200;
+    d.semiMajorOrientation = 1200;
+    d.altitudeValue = 23500;
+    d.altitudeConfidence = AltitudeConfidence_unavailable;
+    d.headingValue = 1795;
+    d.headingConfidence = 10;
+    d.speedValue = 1389;
+    d.speedConfidence = 5;
+    d.driveDirection = DriveDirection_forward;
+    d.longAccelerationValue = 12;
+    d.longAccelerationConfidence = 10;
+    d.curvatureValue = CurvatureValue_straight;
+    d.curvatureConfidence = CurvatureConfidence_unavailable;
+    d.curvatureCalculationMode = CurvatureCalculationMode_yawRateUsed;
+    d.yawRateValue = 35;
+    d.yawRateConfidence = YawRateConfidence_unavailable;
+    d.lanePositionAvailable = true;
+    d.lanePosition = 1;
+    return d;
+  }
+
+  void
+  printCsv (std::ostream &os, const std::vector<benchmark_result_t> &results)
+  {
+    os << "message,iterations,ok,encoded_bytes,"
+       << "fill_ns,encode_ns,decode_ns,encode_msg_per_s,decode_msg_per_s,"
+       << "fill_allocs,encode_allocs,decode_allocs,fill_alloc_bytes,encode_alloc_bytes,decode_alloc_bytes" << std::endl;
+
+    for (const auto &r : results)
+      {
+        os << r.message << "," << r.iterations << "," << r.ok << "," << r.encodedBytes << ","
+           << r.fillNs << "," << r.encodeNs << "," << r.decodeNs << ","
+           << (r.encodeNs > 0 ? 1e9 / r.encodeNs : 0) << "," << (r.decodeNs > 0 ? 1e9 / r.decodeNs : 0) << ","
+           << r.fillAllocs << "," << r.encodeAllocs << "," << r.decodeAllocs << ","
+           << r.fillAllocBytes << "," << r.encodeAllocBytes << "," << r.decodeAllocBytes << std::endl;
+      }
+  }
+
+  void
+  printJson (std::ostream &os, const std::vector<benchmark_result_t> &results)
+  {
+    os << "{" << std::endl << "  \"allocationCounting\": " << (ALLOCATION_COUNTING_AVAILABLE ? "true" : "false") << "," << std::endl;
+    os << "  \"results\": [" << std::endl;
+
+    for (size_t i = 0; i < results.size (); i++)
+      {
+        const benchmark_result_t &r = results[i];
+        os << "    {\"message\": \"" << r.message << "\", \"iterations\": " << r.iterations
+           << ", \"ok\": " << (r.ok ? "true" : "false") << ", \"encodedBytes\": " << r.encodedBytes
+           << ", \"fillNs\": " << r.fillNs << ", \"encodeNs\": " << r.encodeNs << ", \"decodeNs\": " << r.decodeNs
+           << ", \"encodeMsgPerS\": " << (r.encodeNs > 0 ? 1e9 / r.encodeNs : 0)
+           << ", \"decodeMsgPerS\": " << (r.decodeNs > 0 ? 1e9 / r.decodeNs : 0)
+           << ", \"fillAllocs\": " << r.fillAllocs << ", \"encodeAllocs\": " << r.encodeAllocs << ", \"decodeAllocs\": " << r.decodeAllocs
+           << ", \"fillAllocBytes\": " << r.fillAllocBytes << ", \"encodeAllocBytes\": " << r.encodeAllocBytes
+           << ", \"decodeAllocBytes\": " << r.decodeAllocBytes << "}" << (i + 1 < results.size () ? "," : "") << std::endl;
+      }
+
+    os << "  ]" << std::endl << "}" << std::endl;
+  }
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint64_t iterations = 10000;
+  std::string format = "csv";
+  std::string output = "";
+  std::string filter = "";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("iterations", "Number of measured iterations for each message and phase", iterations);
+  cmd.AddValue ("format", "Output format: csv or json", format);
+  cmd.AddValue ("output", "Output file (if not specified, the results are printed on the standard output)", output);
+  cmd.AddValue ("filter", "Benchmark only the messages whose name contains this string", filter);
+  cmd.Parse (argc, argv);
+
+  if (format != "csv" && format != "json")
+    {
+      NS_FATAL_ERROR ("Unknown output format: " << format << ". Use csv or json.");
+    }
+
+  if (iterations == 0)
+    {
+      NS_FATAL_ERROR ("The number of iterations must be greater than zero.");
+    }
+
+  std::vector<std::pair<std::string, std::function<benchmark_result_t ()>>> benchmarks;
+
+  benchmarks.push_back ({"CAMv1", [&] () { return benchmarkMessage<CAMV1> ("CAMv1", &asn_DEF_CAMV1, fillCamV1, iterations); }});
+  benchmarks.push_back ({"CAMv2", [&] () { return benchmarkMessage<CAM> ("CAMv2", &asn_DEF_CAM, fillCamV2, iterations); }});
+  benchmarks.push_back ({"CAMv2-lf", [&] () { return benchmarkMessage<CAM> ("CAMv2-lf", &asn_DEF_CAM, fillCamV2LowFrequency, iterations); }});
+  benchmarks.push_back ({"CAMv2-skeleton", [&] () {
+    CAMSkeletonEncoder encoder;
+    CAMSkeletonEncoder::CAM_dynamic_data_t d = camSkeletonDynamicData ();
+    encoder.setStaticData (camSkeletonStaticData ());
+    return benchmarkSpecializedEncoder<CAM> ("CAMv2-skeleton", &asn_DEF_CAM,
+                                             [&] (std::string &enc) { return encoder.encode (d, enc); },
+                                             asn1cpp::uper::encode (fillCamV2 ()), iterations);
+  }});
+  benchmarks.push_back ({"DENM", [&] () { return benchmarkMessage<DENM> ("DENM", &asn_DEF_DENM, fillDenm, iterations); }});
+
+  for (long n : {0, 10, 50})
+    {
+      std::string name = "CPM-" + std::to_string (n);
+      benchmarks.push_back ({name, [=] () { return benchmarkMessage<CPM> (name, &asn_DEF_CPM, [n] () { return fillCpm (n); }, iterations); }});
+      benchmarks.push_back ({name + "-skeleton", [=] () {
+        CPMSkeletonEncoder encoder;
+        CPMSkeletonEncoder::CPM_static_data_t s;
+        CPMSkeletonEncoder::CPM_dynamic_data_t d;
+        cpmFixtureData (n, s, d);
+        encoder.setStaticData (s);
+        return benchmarkSpecializedEncoder<CPM> (name + "-skeleton", &asn_DEF_CPM,
+                                                 [&] (std::string &enc) { return encoder.encode (d, enc); },
+                                                 asn1cpp::uper::encode (fillCpm (n)), iterations);
+      }});
+    }
+
+  benchmarks.push_back ({"IVIM", [&] () { return benchmarkMessage<IVIM> ("IVIM", &asn_DEF_IVIM, fillIvim, iterations); }});
+  benchmarks.push_back ({"MAPEM", [&] () { return benchmarkMessage<MAPEM> ("MAPEM", &asn_DEF_MAPEM, fillMapem, iterations); }});
+  benchmarks.push_back ({"SPATEM", [&] () { return benchmarkMessage<SPATEM> ("SPATEM", &asn_DEF_SPATEM, fillSpatem, iterations); }});
+  benchmarks.push_back ({"SREM", [&] () { return benchmarkMessage<SREM> ("SREM", &asn_DEF_SREM, fillSrem, iterations); }});
+  benchmarks.push_back ({"VAM", [&] () { return benchmarkMessage<VAM> ("VAM", &asn_DEF_VAM, fillVam, iterations); }});
+
+  std::vector<benchmark_result_t> results;
+  bool all_ok = true;
+
+  for (auto &benchmark : benchmarks)
+    {
+      if (!filter.empty () && benchmark.first.find (filter) == std::string::npos)
+        {
+          continue;
+        }
+
+      results.push_back (benchmark.second ());
+      all_ok = all_ok && results.back ().ok;
+    }
+
+  std::ofstream file;
+  if (!output.empty ())
+    {
+      file.open (output);
+      if (!file.is_open ())
+        {
+          NS_FATAL_ERROR ("Cannot open the output file: " << output);
+        }
+    }
+  std::ostream &os = output.empty () ? std::cout : file;
+
+  if (format == "json")
+    {
+      printJson (os, results);
+    }
+  else
+    {
+      printCsv (os, results);
+    }
+
+  return all_ok ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ * Benchmark of the pairwise pathloss cache of the CniUrbanmicrocellPropagationLossModel.
+ *
+ * N vehicles are randomly placed in a square area. In each frame every vehicle transmits once, and the loss towards
+ * all the other N-1 vehicles is computed, as done by the channel. Every --update-frames frames all the vehicles move
+ * by --step meters in a random direction, emulating the mobility updates coming from SUMO, which are much less
+ * frequent than the transmissions.
+ * The same scenario (same positions and same random LOS/NLOS draws) is evaluated with the cache disabled, with the
+ * cache enabled and an exact invalidation (any movement), and with the cache enabled and a distance threshold of
+ * --threshold meters. For each configuration the benchmark reports the time per frame, the time per link, the cache
+ * hits/misses and whether the sum of all the computed losses matches the one of the uncached model.
+ *
+ * Example: ./ns3 run "cni-pathloss-benchmark --nodes=100,500,1000 --frames=20"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/cni-urbanmicrocell-propagation-loss-model.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("CniPathlossBenchmark");
+
+namespace
+{
+  typedef struct pathloss_benchmark_result {
+    std::string mode;
+    uint32_t nodes;
+    double nsPerFrame;
+    double nsPerLink;
+    uint64_t hits;
+    uint64_t misses;
+    double lossSum;
+  } pathloss_benchmark_result_t;
+
+  pathloss_benchmark_result_t
+  runScenario (std::string mode, uint32_t nodes, uint32_t frames, uint32_t updateFrames, double step,
+               bool cacheEnabled, double threshold)
+  {
+    std::mt19937 gen (12345);
+    std::uniform_real_distribution<double> coord (0.0, 2000.0);
+    std::uniform_real_distribution<double> angle (0.0, 2 * M_PI);
+
+    std::vector<Ptr<MobilityModel>> mobility;
+    for (uint32_t i = 0; i < nodes; i++)
+      {
+        Ptr<ConstantPositionMobilityModel> m = CreateObject<ConstantPositionMobilityModel> ();
+        m->SetPosition (Vector (coord (gen), coord (gen), 1.5));
+        mobility.push_back (m);
+      }
+
+    Ptr<CniUrbanmicrocellPropagationLossModel> model = CreateObject<CniUrbanmicrocellPropagationLossModel> ();
+    model->SetAttribute ("CacheEnabled", BooleanValue (cacheEnabled));
+    model->SetAttribute ("CacheDistanceThreshold", DoubleValue (threshold));
+    model->AssignStreams (1);
+
+    pathloss_benchmark_result_t result;
+    result.mode = mode;
+    result.nodes = nodes;
+    result.lossSum = 0.0;
+
+    std::chrono::duration<double, std::nano> elapsed (0);
+    for (uint32_t f = 0; f < frames; f++)
+      {
+        if (f > 0 && updateFrames > 0 && f % updateFrames == 0)
+          {
+            for (auto &m : mobility)
+              {
+                double a = angle (gen);
+                Vector pos = m->GetPosition ();
+                m->SetPosition (Vector (pos.x + step * std::cos (a), pos.y + step * std::sin (a), pos.z));
+              }
+          }
+
+        auto start = std::chrono::steady_clock::now ();
+        for (uint32_t tx = 0; tx < nodes; tx++)
+          {
+            for (uint32_t rx = 0; rx < nodes; rx++)
+              {
+                if (rx != tx)
+                  {
+                    result.lossSum += model->GetLoss (mobility[tx], mobility[rx]);
+                  }
+              }
+          }
+        elapsed += std::chrono::steady_clock::now () - start;
+      }
+
+    result.nsPerFrame = elapsed.count () / frames;
+    result.nsPerLink = result.nsPerFrame / (static_cast<double> (nodes) * (nodes - 1));
+    result.hits = model->GetCacheHits ();
+    result.misses = model->GetCacheMisses ();
+
+    model->Dispose ();
+    return result;
+  }
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string nodesList = "100,500,1000";
+  uint32_t frames = 20;
+  uint32_t updateFrames = 10;
+  double step = 1.4;
+  double threshold = 1.0;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("nodes", "Comma-separated list of the numbers of vehicles to benchmark", nodesList);
+  cmd.AddValue ("frames", "Number of measured frames, in which each vehicle transmits once", frames);
+  cmd.AddValue ("update-frames", "Number of frames between two position updates (0: static vehicles)", updateFrames);
+  cmd.AddValue ("step", "Distance in meters covered by each vehicle at every position update", step);
+  cmd.AddValue ("threshold", "Distance threshold in meters of the thresholded cache configuration", threshold);
+  cmd.Parse (argc, argv);
+
+  if (frames == 0)
+    {
+      NS_FATAL_ERROR ("The number of frames must be greater than zero.");
+    }
+
+  std::vector<uint32_t> nodes;
+  std::stringstream ss (nodesList);
+  std::string item;
+  while (std::getline (ss, item, ','))
+    {
+      uint32_t n = std::stoul (item);
+      if (n < 2)
+        {
+          NS_FATAL_ERROR ("At least two vehicles are needed for each benchmark.");
+        }
+      nodes.push_back (n);
+    }
+
+  std::cout << "mode,nodes,frames,ns_per_frame,ns_per_link,cache_hits,cache_misses,speedup,loss_sum_matches" << std::endl;
+
+  for (uint32_t n : nodes)
+    {
+      std::vector<pathloss_benchmark_result_t> results;
+      results.push_back (runScenario ("uncached", n, frames, updateFrames, step, false, 0.0));
+      results.push_back (runScenario ("cached", n, frames, updateFrames, step, true, 0.0));
+      results.push_back (runScenario ("cached-threshold", n, frames, updateFrames, step, true, threshold));
+
+      for (auto &r : results)
+        {
+          // The exact cache must give the same losses as the uncached model, the thresholded one only an approximation
+          std::cout << r.mode << "," << r.nodes << "," << frames << "," << r.nsPerFrame << "," << r.nsPerLink << ","
+                    << r.hits << "," << r.misses << "," << results.at (0).nsPerFrame / r.nsPerFrame << ","
+                    << (r.lossSum == results.at (0).lossSum ? "yes" : "no") << std::endl;
+        }
+    }
+
+  return 0;
+}
@@ -28,6 +28,8 @@
 #include "ns3/packet-socket-helper.h"
 #include "ns3/vehicle-visualizer-module.h"
 #include "ns3/PRRSupervisor.h"
+#include "ns3/v2x-spectrum-channel.h"
+#include "ns3/spectrum-wifi-helper.h"
 #include <unistd.h>
 
 using namespace ns3;
@@ -75,6 +77,10 @@ main (int argc, char *argv[])
 
   double simTime = 100;
 
+  // Use a V2XSpectrumChannel evaluating only the receivers within the range given by the link budget (SpectrumWifiPhy)
+  bool culled_channel = false;
+  bool channel_validation = false;
+
   int numberOfNodes;
   uint32_t nodeCounter = 0;
 
@@ -101,6 +107,8 @@ main (int argc, char *argv[])
   /* Cmd Line option for 802.11p */
   cmd.AddValue ("tx-power", "OBUs transmission power [dBm]", txPower);
   cmd.AddValue ("datarate", "802.11p channel data rate [Mbit/s]", datarate);
+  cmd.AddValue ("culled-channel", "Use a spatially culled spectrum channel instead of the YansWifiChannel", culled_channel);
+  cmd.AddValue ("channel-validation", "Check that no receiver outside of the culled channel range would receive the signals", channel_validation);
 
   cmd.AddValue("sim-time", "Total duration of the simulation [s]", simTime);
 
@@ -167,23 +175,44 @@ main (int argc, char *argv[])
   obuNodes.Create(numberOfNodes);
 
   /*** 2. Create and setup channel   ***/
-  YansWifiPhyHelper wifiPhy;
+  YansWifiPhyHelper yansWifiPhy;
+  SpectrumWifiPhyHelper spectrumWifiPhy;
+  WifiPhyHelper &wifiPhy = culled_channel ? static_cast<WifiPhyHelper&>(spectrumWifiPhy) : static_cast<WifiPhyHelper&>(yansWifiPhy);
   wifiPhy.Set ("TxPowerStart", DoubleValue (txPower));
   wifiPhy.Set ("TxPowerEnd", DoubleValue (txPower));
   NS_LOG_INFO("Setting up the 802.11p channel @ " << datarate << " Mbit/s, 10 MHz, and tx power " << (int)txPower << " dBm.");
 
-  YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default ();
-  /*Example of using diffrent propagation model (after applying extension with apply-extension.sh in automotive/propagation-extended/)*/
-  // YansWifiChannelHelper wifiChannel;
-  // wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
-  // wifiChannel.AddPropagationLoss ("ns3::CniUrbanmicrocellPropagationLossModel");
-  Ptr<YansWifiChannel> channel = wifiChannel.Create ();
-  wifiPhy.SetChannel (channel);
+  Ptr<V2XSpectrumChannel> v2xChannel = nullptr;
+  if(culled_channel)
+    {
+      // Same propagation models of YansWifiChannelHelper::Default ()
+      v2xChannel = CreateObject<V2XSpectrumChannel> ();
+      v2xChannel->AddPropagationLossModel (CreateObject<LogDistancePropagationLossModel> ());
+      v2xChannel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+      // -101 dBm is the default RxSensitivity of the WifiPhy
+      double cutoff = v2xChannel->setCutoffFromLinkBudget (txPower,-101.0);
+      NS_LOG_INFO("Culled channel range: " << cutoff << " m.");
+      if(channel_validation)
+        {
+          v2xChannel->enableValidationMode ();
+        }
+      spectrumWifiPhy.SetChannel (v2xChannel);
+    }
+  else
+    {
+      YansWifiChannelHelper wifiChannel = YansWifiChannelHelper::Default ();
+      /*Example of using diffrent propagation model (after applying extension with apply-extension.sh in automotive/propagation-extended/)*/
+      // YansWifiChannelHelper wifiChannel;
+      // wifiChannel.SetPropagationDelay ("ns3::ConstantSpeedPropagationDelayModel");
+      // wifiChannel.AddPropagationLoss ("ns3::CniUrbanmicrocellPropagationLossModel");
+      Ptr<YansWifiChannel> channel = wifiChannel.Create ();
+      yansWifiPhy.SetChannel (channel);
+    }
   /* To be removed when BPT is implemented */
   //Config::SetDefault ("ns3::ArpCache::DeadTimeout", TimeValue (Seconds (1)));
 
   /*** 3. Create and setup MAC ***/
-  wifiPhy.SetPcapDataLinkType (YansWifiPhyHelper::DLT_IEEE802_11);
+  wifiPhy.SetPcapDataLinkType (WifiPhyHelper::DLT_IEEE802_11);
   NqosWaveMacHelper wifi80211pMac = NqosWaveMacHelper::Default ();
   Wifi80211pHelper wifi80211p = Wifi80211pHelper::Default ();
   std::cout << "Datarate: " << datarate_config << std::endl;
@@ -295,6 +324,18 @@ main (int argc, char *argv[])
   Simulator::Stop (simulationTime);
 
   Simulator::Run ();
+
+  if(v2xChannel!=nullptr)
+    {
+      std::cout << "Culled channel: " << v2xChannel->getEvaluatedReceivers () << " evaluated receivers, "
+                << v2xChannel->getCulledReceivers () << " culled receivers";
+      if(channel_validation)
+        {
+          std::cout << ", " << v2xChannel->getValidationViolations () << " culled receivers above the sensitivity";
+        }
+      std::cout << std::endl;
+    }
+
   Simulator::Destroy ();
 
   if(m_prr_sup)
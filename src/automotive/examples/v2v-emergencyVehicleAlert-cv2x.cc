@@ -29,6 +29,7 @@
 #include <ns3/node-list.h>
 #include "ns3/vehicle-visualizer-module.h"
 #include "ns3/PRRSupervisor.h"
+#include "ns3/v2x-spectrum-channel.h"
 #include <unistd.h>
 
 using namespace ns3;
@@ -80,6 +81,11 @@ main (int argc, char *argv[])
 
   double simTime = 100;
 
+  // When one of the two ranges is set, a V2XSpectrumChannel evaluates only the receivers within them
+  double channel_max_range = 0.0;
+  double channel_interference_range = 0.0;
+  bool channel_validation = false;
+
   int numberOfNodes;
   uint32_t nodeCounter = 0;
 
@@ -114,6 +120,10 @@ main (int argc, char *argv[])
   cmd.AddValue ("baseline", "Baseline for PRR calculation", m_baseline_prr);
   cmd.AddValue ("prr-sup","Use the PRR supervisor or not",m_prr_sup);
 
+  cmd.AddValue ("channel-max-range", "Range [m] of the decodable receivers of the culled sidelink channel (0: culled channel disabled)", channel_max_range);
+  cmd.AddValue ("channel-interference-range", "Range [m] of the interference-only receivers of the culled sidelink channel", channel_interference_range);
+  cmd.AddValue ("channel-validation", "Check that no receiver outside of the culled channel range would receive the signals", channel_validation);
+
   cmd.AddValue("sim-time", "Total duration of the simulation [s])", simTime);
 
   cmd.Parse (argc, argv);
@@ -216,6 +226,14 @@ main (int argc, char *argv[])
   lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::cv2x_CniUrbanmicrocellPropagationLossModel"));
   NS_LOG_INFO("Antenna parameters set. Current EARFCN: 54990, current frequency: 5.89 GHz");
 
+  if(channel_max_range>0 || channel_interference_range>0)
+    {
+      lteHelper->SetSpectrumChannelType ("ns3::V2XSpectrumChannel");
+      lteHelper->SetSpectrumChannelAttribute ("MaxRange", DoubleValue (channel_max_range));
+      lteHelper->SetSpectrumChannelAttribute ("InterferenceRange", DoubleValue (channel_interference_range));
+      lteHelper->SetSpectrumChannelAttribute ("ValidationMode", BooleanValue (channel_validation));
+    }
+
   /*** 2. Create Internet and ipv4 helpers ***/
   InternetStackHelper internet;
   Ipv4StaticRoutingHelper ipv4RoutingHelper;
@@ -450,6 +468,21 @@ main (int argc, char *argv[])
   Simulator::Stop (simulationTime);
 
   Simulator::Run ();
+
+  // The sidelink uses the uplink channel
+  Ptr<V2XSpectrumChannel> v2xChannel = DynamicCast<V2XSpectrumChannel> (lteHelper->GetUplinkSpectrumChannel ());
+  if(v2xChannel!=nullptr)
+    {
+      std::cout << "Culled channel: " << v2xChannel->getEvaluatedReceivers () << " evaluated receivers ("
+                << v2xChannel->getInterferenceReceivers () << " interference-only), "
+                << v2xChannel->getCulledReceivers () << " culled receivers";
+      if(channel_validation)
+        {
+          std::cout << ", " << v2xChannel->getValidationViolations () << " culled receivers above the power threshold";
+        }
+      std::cout << std::endl;
+    }
+
   Simulator::Destroy ();
 
   if(m_prr_sup)
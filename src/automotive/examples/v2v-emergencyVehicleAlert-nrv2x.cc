@@ -35,6 +35,7 @@
 #include "ns3/sumo_xml_parser.h"
 #include "ns3/vehicle-visualizer-module.h"
 #include "ns3/PRRSupervisor.h"
+#include "ns3/v2x-spectrum-channel.h"
 
 
 #include <unistd.h>
@@ -132,6 +133,9 @@ main (int argc, char *argv[])
   int slThresPsschRsrp = -128;
   bool enableChannelRandomness = false;
   uint16_t channelUpdatePeriod = 500; //ms
+  double channelMaxRange = 0.0;
+  double channelInterferenceRange = 0.0;
+  bool channelValidation = false;
   uint8_t mcs = 14;
 
   /*
@@ -226,6 +230,16 @@ main (int argc, char *argv[])
   cmd.AddValue ("channelUpdatePeriod",
                 "The channel update period in ms",
                 channelUpdatePeriod);
+  cmd.AddValue ("channelMaxRange",
+                "Range in m of the decodable receivers of a culled V2XSpectrumChannel "
+                "(if both this range and channelInterferenceRange are 0, a MultiModelSpectrumChannel is used)",
+                channelMaxRange);
+  cmd.AddValue ("channelInterferenceRange",
+                "Range in m of the interference-only receivers of the culled V2XSpectrumChannel",
+                channelInterferenceRange);
+  cmd.AddValue ("channelValidation",
+                "Check that no receiver outside of the culled channel range would receive the signals",
+                channelValidation);
   cmd.AddValue ("mcs",
                 "The MCS to used for sidelink",
                 mcs);
@@ -344,6 +358,14 @@ main (int argc, char *argv[])
       nrHelper->SetPathlossAttribute ("ShadowingEnabled", BooleanValue (false));
     }
 
+  if (channelMaxRange > 0 || channelInterferenceRange > 0)
+    {
+      nrHelper->SetSpectrumChannelTypeId (V2XSpectrumChannel::GetTypeId ());
+      nrHelper->SetSpectrumChannelAttribute ("MaxRange", DoubleValue (channelMaxRange));
+      nrHelper->SetSpectrumChannelAttribute ("InterferenceRange", DoubleValue (channelInterferenceRange));
+      nrHelper->SetSpectrumChannelAttribute ("ValidationMode", BooleanValue (channelValidation));
+    }
+
   /*
    * Initialize channel and pathloss, plus other things inside bandSl. If needed,
    * the band configuration can be done manually, but we leave it for more
@@ -719,6 +741,20 @@ main (int argc, char *argv[])
   Simulator::Stop (simTime);
 
   Simulator::Run ();
+
+  Ptr<V2XSpectrumChannel> v2xChannel = DynamicCast<V2XSpectrumChannel> (allBwps.at (0).get ()->m_channel);
+  if (v2xChannel != nullptr)
+    {
+      std::cout << "Culled channel: " << v2xChannel->getEvaluatedReceivers () << " evaluated receivers ("
+                << v2xChannel->getInterferenceReceivers () << " interference-only), "
+                << v2xChannel->getCulledReceivers () << " culled receivers";
+      if (channelValidation)
+        {
+          std::cout << ", " << v2xChannel->getValidationViolations () << " culled receivers above the power threshold";
+        }
+      std::cout << std::endl;
+    }
+
   Simulator::Destroy ();
 
   if(m_prr_sup)
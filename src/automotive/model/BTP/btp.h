@@ -32,6 +32,8 @@ namespace ns3
     void setStationType(long fixed_stationtype) {m_geonet->setStationType(fixed_stationtype);}
     void setVDP(VDP* vdp){m_geonet->setVDP(vdp);}
     void setSocketTx(Ptr<Socket> socket_tx) {m_geonet->setSocketTx(socket_tx);}
+    void setDCC(Ptr<DCC> dcc) {m_geonet->setDCC(dcc);}
+    Ptr<DCC> getDCC() {return m_geonet->getDCC();}
     void setSocketRx(Ptr<Socket> socket_rx);
     void addCAMRxCallback(std::function<void(BTPDataIndication_t,Address)> rx_callback) {m_cam_ReceiveCallback=rx_callback;}
     void addDENMRxCallback(std::function<void(BTPDataIndication_t,Address)> rx_callback) {m_denm_ReceiveCallback=rx_callback;}
@@ -0,0 +1,621 @@
+#include "v2x-spectrum-channel.h"
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
+#include "ns3/node.h"
+#include "ns3/net-device.h"
+#include "ns3/angles.h"
+#include "ns3/antenna-model.h"
+#include "ns3/phased-array-model.h"
+#include "ns3/spectrum-phy.h"
+#include "ns3/spectrum-signal-parameters.h"
+#include "ns3/spectrum-propagation-loss-model.h"
+#include "ns3/phased-array-spectrum-propagation-loss-model.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/constant-position-mobility-model.h"
+
+#define V2X_CHANNEL_MAX_SEARCH_RANGE_M 100000.0 // Maximum range considered by setCutoffFromLinkBudget()
+
+namespace ns3
+{
+  NS_LOG_COMPONENT_DEFINE("V2XSpectrumChannel");
+
+  NS_OBJECT_ENSURE_REGISTERED(V2XSpectrumChannel);
+
+  static inline uint64_t
+  packCell(int64_t cx, int64_t cy)
+  {
+    return (((uint64_t) (uint32_t) cx) << 32) | ((uint64_t) (uint32_t) cy);
+  }
+
+  TypeId
+  V2XSpectrumChannel::GetTypeId ()
+  {
+    static TypeId tid = TypeId("ns3::V2XSpectrumChannel")
+        .SetParent<SpectrumChannel>()
+        .AddConstructor<V2XSpectrumChannel>()
+        .AddAttribute ("MaxRange",
+                       "Only the PHYs within this distance (in m) from the transmitter receive its signals (0: no cutoff)",
+                       DoubleValue (0.0),
+                       MakeDoubleAccessor (&V2XSpectrumChannel::setMaxRange,&V2XSpectrumChannel::getMaxRange),
+                       MakeDoubleChecker<double> ())
+        .AddAttribute ("MinRxPower",
+                       "Received power (in dBm) below which a PHY outside of MaxRange is not reported as a violation "
+                       "of the cutoff in ValidationMode",
+                       DoubleValue (-101.0),
+                       MakeDoubleAccessor (&V2XSpectrumChannel::m_min_rx_power_dbm),
+                       MakeDoubleChecker<double> ())
+        .AddAttribute ("InterferenceRange",
+                       "PHYs between MaxRange and this distance (in m) still receive the signals, to account for them "
+                       "in their SINR, but they are tracked as interference-only receivers (0: same as MaxRange)",
+                       DoubleValue (0.0),
+                       MakeDoubleAccessor (&V2XSpectrumChannel::setInterferenceRange,&V2XSpectrumChannel::getInterferenceRange),
+                       MakeDoubleChecker<double> ())
+        .AddAttribute ("MinInterferencePower",
+                       "Received power (in dBm) below which a PHY outside of InterferenceRange is not reported as a "
+                       "violation of the cutoff in ValidationMode",
+                       DoubleValue (-111.0),
+                       MakeDoubleAccessor (&V2XSpectrumChannel::m_min_interference_power_dbm),
+                       MakeDoubleChecker<double> ())
+        .AddAttribute ("FadeInterferers",
+                       "Apply the spectrum propagation loss models (fading) also to the interference-only receivers",
+                       BooleanValue (true),
+                       MakeBooleanAccessor (&V2XSpectrumChannel::m_fade_interferers),
+                       MakeBooleanChecker ())
+        .AddAttribute ("ValidationMode",
+                       "Evaluate also the PHYs outside of the cutoff (without delivering the signal to them), "
+                       "counting the ones which would have received a power above MinRxPower (or MinInterferencePower)",
+                       BooleanValue (false),
+                       MakeBooleanAccessor (&V2XSpectrumChannel::m_validation),
+                       MakeBooleanChecker ());
+    return tid;
+  }
+
+  V2XSpectrumChannel::V2XSpectrumChannel ()
+  {
+    NS_LOG_FUNCTION(this);
+  }
+
+  V2XSpectrumChannel::~V2XSpectrumChannel ()
+  {
+    NS_LOG_FUNCTION(this);
+  }
+
+  void
+  V2XSpectrumChannel::DoDispose ()
+  {
+    NS_LOG_FUNCTION(this);
+
+    for(uint32_t idx=0;idx<m_phys.size();idx++)
+      {
+        if(m_phys[idx].mobility)
+          {
+            m_phys[idx].mobility->TraceDisconnect ("CourseChange",std::to_string(idx),MakeCallback(&V2XSpectrumChannel::courseChanged,this));
+          }
+      }
+
+    m_phys.clear ();
+    m_phy_index.clear ();
+    m_unplaced.clear ();
+    m_cells.clear ();
+    m_converters.clear ();
+    m_num_phys = 0;
+
+    SpectrumChannel::DoDispose ();
+  }
+
+  uint64_t
+  V2XSpectrumChannel::cellKey (const Vector &pos) const
+  {
+    return packCell ((int64_t) std::floor (pos.x/m_cell_size_m),(int64_t) std::floor (pos.y/m_cell_size_m));
+  }
+
+  void
+  V2XSpectrumChannel::placePhy (uint32_t idx)
+  {
+    phyEntry_t &entry = m_phys[idx];
+
+    if(m_cell_size_m<=0 || !entry.mobility || entry.placed)
+      {
+        return;
+      }
+
+    entry.cell = cellKey (entry.mobility->GetPosition ());
+    std::vector<uint32_t> &cell = m_cells[entry.cell];
+    entry.cell_index = cell.size ();
+    entry.placed = true;
+    cell.push_back (idx);
+  }
+
+  void
+  V2XSpectrumChannel::unplacePhy (uint32_t idx)
+  {
+    phyEntry_t &entry = m_phys[idx];
+
+    if(!entry.placed)
+      {
+        return;
+      }
+
+    // Swap with the last PHY of the cell (empty cells are kept, as vehicles often come back to them)
+    std::vector<uint32_t> &cell = m_cells[entry.cell];
+    uint32_t last = cell.back ();
+    cell[entry.cell_index] = last;
+    m_phys[last].cell_index = entry.cell_index;
+    cell.pop_back ();
+
+    entry.placed = false;
+  }
+
+  void
+  V2XSpectrumChannel::placeNewPhys ()
+  {
+    for(size_t i=0;i<m_unplaced.size();)
+      {
+        uint32_t idx = m_unplaced[i];
+        Ptr<MobilityModel> mobility = m_phys[idx].phy->GetMobility ();
+
+        if(!mobility)
+          {
+            i++;
+            continue;
+          }
+
+        m_phys[idx].mobility = mobility;
+        mobility->TraceConnect ("CourseChange",std::to_string(idx),MakeCallback(&V2XSpectrumChannel::courseChanged,this));
+        placePhy (idx);
+
+        m_unplaced[i] = m_unplaced.back ();
+        m_unplaced.pop_back ();
+      }
+  }
+
+  void
+  V2XSpectrumChannel::rebuildGrid ()
+  {
+    m_cells.clear ();
+
+    for(uint32_t idx=0;idx<m_phys.size();idx++)
+      {
+        m_phys[idx].placed = false;
+        placePhy (idx);
+      }
+  }
+
+  void
+  V2XSpectrumChannel::courseChanged (std::string context, Ptr<const MobilityModel> mobility)
+  {
+    uint32_t idx = std::stoul (context);
+
+    if(idx>=m_phys.size () || !m_phys[idx].placed)
+      {
+        return;
+      }
+
+    if(cellKey (mobility->GetPosition ())!=m_phys[idx].cell)
+      {
+        unplacePhy (idx);
+        placePhy (idx);
+      }
+  }
+
+  void
+  V2XSpectrumChannel::updateGrid ()
+  {
+    // With a cell as large as the cutoff, at most 3x3 cells have to be visited for each transmission
+    m_outer_range_m = std::max (m_max_range_m,m_interference_range_m);
+
+    if(m_outer_range_m!=m_cell_size_m)
+      {
+        m_cell_size_m = m_outer_range_m;
+        rebuildGrid ();
+      }
+  }
+
+  void
+  V2XSpectrumChannel::setMaxRange (double range_m)
+  {
+    m_max_range_m = range_m>0 ? range_m : 0.0;
+    updateGrid ();
+  }
+
+  void
+  V2XSpectrumChannel::setInterferenceRange (double range_m)
+  {
+    m_interference_range_m = range_m>0 ? range_m : 0.0;
+    updateGrid ();
+  }
+
+  double
+  V2XSpectrumChannel::setCutoffFromLinkBudget (double tx_power_dbm, double min_rx_power_dbm, double margin_db)
+  {
+    double range_m = rangeFromLinkBudget (tx_power_dbm,min_rx_power_dbm-margin_db);
+
+    m_min_rx_power_dbm = min_rx_power_dbm;
+    setMaxRange (range_m);
+
+    return range_m;
+  }
+
+  double
+  V2XSpectrumChannel::setInterferenceCutoffFromLinkBudget (double tx_power_dbm, double min_interference_power_dbm, double margin_db)
+  {
+    double range_m = rangeFromLinkBudget (tx_power_dbm,min_interference_power_dbm-margin_db);
+
+    m_min_interference_power_dbm = min_interference_power_dbm;
+    setInterferenceRange (range_m);
+
+    return range_m;
+  }
+
+  double
+  V2XSpectrumChannel::rangeFromLinkBudget (double tx_power_dbm, double threshold_dbm)
+  {
+    NS_ABORT_MSG_IF (!m_propagationLoss,"A propagation loss model must be set before deriving the cutoff from the link budget");
+
+    threshold_dbm = std::max (threshold_dbm,tx_power_dbm-m_maxLossDb);
+    Ptr<ConstantPositionMobilityModel> tx_mobility = CreateObject<ConstantPositionMobilityModel> ();
+    Ptr<ConstantPositionMobilityModel> rx_mobility = CreateObject<ConstantPositionMobilityModel> ();
+
+    auto rxPower = [&](double distance_m)
+      {
+        rx_mobility->SetPosition (Vector (distance_m,0,0));
+        return m_propagationLoss->CalcRxPower (tx_power_dbm,tx_mobility,rx_mobility);
+      };
+
+    double low = 1.0;
+    double high = V2X_CHANNEL_MAX_SEARCH_RANGE_M;
+    double range_m;
+
+    if(rxPower (high)>=threshold_dbm)
+      {
+        NS_LOG_WARN("The received power is still above " << threshold_dbm << " dBm at " << high << " m: using it as cutoff.");
+        range_m = high;
+      }
+    else if(rxPower (low)<threshold_dbm)
+      {
+        range_m = low;
+      }
+    else
+      {
+        // Bisection on the distance at which the received power crosses the threshold
+        while(high-low>0.01)
+          {
+            double mid = (low+high)/2.0;
+            if(rxPower (mid)>=threshold_dbm)
+              {
+                low = mid;
+              }
+            else
+              {
+                high = mid;
+              }
+          }
+        range_m = high;
+      }
+
+    return range_m;
+  }
+
+  void
+  V2XSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
+  {
+    NS_LOG_FUNCTION(this << phy);
+
+    if(m_phy_index.find (PeekPointer (phy))!=m_phy_index.end ())
+      {
+        return;
+      }
+
+    // The mobility model is often aggregated after the PHY is attached to the channel: the PHY is placed in the grid
+    // at the first transmission after its mobility model becomes available
+    phyEntry_t entry = {phy,nullptr,0,0,false,0,false};
+    uint32_t idx = m_phys.size ();
+
+    m_phys.push_back (entry);
+    m_phy_index[PeekPointer (phy)] = idx;
+    m_unplaced.push_back (idx);
+    m_num_phys++;
+  }
+
+  void
+  V2XSpectrumChannel::RemoveRx (Ptr<SpectrumPhy> phy)
+  {
+    NS_LOG_FUNCTION(this << phy);
+
+    auto it = m_phy_index.find (PeekPointer (phy));
+    if(it==m_phy_index.end ())
+      {
+        return;
+      }
+
+    uint32_t idx = it->second;
+    phyEntry_t &entry = m_phys[idx];
+
+    unplacePhy (idx);
+    if(entry.mobility)
+      {
+        entry.mobility->TraceDisconnect ("CourseChange",std::to_string(idx),MakeCallback(&V2XSpectrumChannel::courseChanged,this));
+      }
+
+    m_unplaced.erase (std::remove (m_unplaced.begin (),m_unplaced.end (),idx),m_unplaced.end ());
+
+    // The slot is not reused, to keep the receivers in the order in which they were attached
+    entry.phy = nullptr;
+    entry.mobility = nullptr;
+    m_phy_index.erase (it);
+    m_num_phys--;
+  }
+
+  std::size_t
+  V2XSpectrumChannel::GetNDevices () const
+  {
+    return m_num_phys;
+  }
+
+  Ptr<NetDevice>
+  V2XSpectrumChannel::GetDevice (std::size_t i) const
+  {
+    for(const phyEntry_t &entry : m_phys)
+      {
+        if(entry.phy && i--==0)
+          {
+            return entry.phy->GetDevice ();
+          }
+      }
+
+    return nullptr;
+  }
+
+  void
+  V2XSpectrumChannel::collectCandidates (const Vector &tx_pos)
+  {
+    int64_t cx_min = (int64_t) std::floor ((tx_pos.x-m_outer_range_m)/m_cell_size_m);
+    int64_t cx_max = (int64_t) std::floor ((tx_pos.x+m_outer_range_m)/m_cell_size_m);
+    int64_t cy_min = (int64_t) std::floor ((tx_pos.y-m_outer_range_m)/m_cell_size_m);
+    int64_t cy_max = (int64_t) std::floor ((tx_pos.y+m_outer_range_m)/m_cell_size_m);
+
+    m_candidates.clear ();
+
+    for(int64_t cx=cx_min;cx<=cx_max;cx++)
+      {
+        for(int64_t cy=cy_min;cy<=cy_max;cy++)
+          {
+            auto cell_it = m_cells.find (packCell (cx,cy));
+            if(cell_it==m_cells.end ())
+              {
+                continue;
+              }
+
+            for(uint32_t idx : cell_it->second)
+              {
+                double distance_m = CalculateDistance (tx_pos,m_phys[idx].mobility->GetPosition ());
+                if(distance_m<=m_outer_range_m)
+                  {
+                    m_phys[idx].mark = m_tx_counter;
+                    m_phys[idx].decodable = m_max_range_m<=0 || distance_m<=m_max_range_m;
+                    m_candidates.push_back (idx);
+                  }
+              }
+          }
+      }
+
+    for(uint32_t idx : m_unplaced)
+      {
+        m_phys[idx].mark = m_tx_counter;
+        m_phys[idx].decodable = true;
+        m_candidates.push_back (idx);
+      }
+
+    // Same order as the unculled channels, so that simultaneous receptions are scheduled in the same order
+    std::sort (m_candidates.begin (),m_candidates.end ());
+  }
+
+  bool
+  V2XSpectrumChannel::computeRxParams (Ptr<SpectrumSignalParameters> txParams, Ptr<MobilityModel> txMobility, phyEntry_t &rx, bool fading,
+                                       Ptr<SpectrumSignalParameters> &rxParams, Time &delay)
+  {
+    Ptr<const SpectrumModel> txSpectrumModel = txParams->psd->GetSpectrumModel ();
+    Ptr<const SpectrumModel> rxSpectrumModel = rx.phy->GetRxSpectrumModel ();
+    Ptr<MobilityModel> rxMobility = rx.phy->GetMobility ();
+
+    m_evaluated_rx++;
+
+    rxParams = txParams->Copy ();
+    delay = MicroSeconds (0);
+
+    if(rxSpectrumModel && rxSpectrumModel->GetUid ()!=txSpectrumModel->GetUid ())
+      {
+        if(txSpectrumModel->IsOrthogonal (*rxSpectrumModel))
+          {
+            return false;
+          }
+
+        std::pair<SpectrumModelUid_t,SpectrumModelUid_t> key = std::make_pair (txSpectrumModel->GetUid (),rxSpectrumModel->GetUid ());
+        auto converter_it = m_converters.find (key);
+        if(converter_it==m_converters.end ())
+          {
+            converter_it = m_converters.emplace (key,SpectrumConverter (txSpectrumModel,rxSpectrumModel)).first;
+          }
+        rxParams->psd = converter_it->second.Convert (txParams->psd);
+      }
+
+    if(!txMobility || !rxMobility)
+      {
+        return true;
+      }
+
+    double txAntennaGain = 0;
+    double rxAntennaGain = 0;
+    double propagationGainDb = 0;
+    double pathLossDb = 0;
+
+    if(rxParams->txAntenna)
+      {
+        Angles txAngles (rxMobility->GetPosition (),txMobility->GetPosition ());
+        txAntennaGain = rxParams->txAntenna->GetGainDb (txAngles);
+        pathLossDb -= txAntennaGain;
+      }
+
+    Ptr<AntennaModel> rxAntenna = DynamicCast<AntennaModel> (rx.phy->GetAntenna ());
+    if(rxAntenna)
+      {
+        Angles rxAngles (txMobility->GetPosition (),rxMobility->GetPosition ());
+        rxAntennaGain = rxAntenna->GetGainDb (rxAngles);
+        pathLossDb -= rxAntennaGain;
+      }
+
+    if(m_propagationLoss)
+      {
+        propagationGainDb = m_propagationLoss->CalcRxPower (0,txMobility,rxMobility);
+        pathLossDb -= propagationGainDb;
+      }
+
+    m_gainTrace (txMobility,rxMobility,txAntennaGain,rxAntennaGain,propagationGainDb,pathLossDb);
+    m_pathLossTrace (txParams->txPhy,rx.phy,pathLossDb);
+
+    if(pathLossDb>m_maxLossDb)
+      {
+        return false;
+      }
+
+    *(rxParams->psd) *= std::pow (10.0,(-pathLossDb)/10.0);
+
+    // The fading is not computed for the interference-only receivers, when "FadeInterferers" is false
+    if(fading && m_spectrumPropagationLoss)
+      {
+        rxParams->psd = m_spectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams,txMobility,rxMobility);
+      }
+    else if(fading && m_phasedArraySpectrumPropagationLoss)
+      {
+        Ptr<const PhasedArrayModel> txPhasedArrayModel = DynamicCast<PhasedArrayModel> (txParams->txPhy->GetAntenna ());
+        Ptr<const PhasedArrayModel> rxPhasedArrayModel = DynamicCast<PhasedArrayModel> (rx.phy->GetAntenna ());
+
+        NS_ASSERT_MSG (txPhasedArrayModel && rxPhasedArrayModel,
+                       "PhasedArrayModel instances should be installed at both TX and RX SpectrumPhy in order to use PhasedArraySpectrumPropagationLoss.");
+
+        rxParams->psd = m_phasedArraySpectrumPropagationLoss->CalcRxPowerSpectralDensity (rxParams,txMobility,rxMobility,txPhasedArrayModel,rxPhasedArrayModel);
+      }
+
+    if(m_propagationDelay)
+      {
+        delay = m_propagationDelay->GetDelay (txMobility,rxMobility);
+      }
+
+    return true;
+  }
+
+  void
+  V2XSpectrumChannel::deliver (Ptr<SpectrumSignalParameters> rxParams, Time delay, Ptr<SpectrumPhy> rxPhy)
+  {
+    Ptr<NetDevice> netDev = rxPhy->GetDevice ();
+
+    if(netDev)
+      {
+        // The receiver has a NetDevice, so we expect that it is attached to a Node
+        Simulator::ScheduleWithContext (netDev->GetNode ()->GetId (),delay,&V2XSpectrumChannel::StartRx,this,rxParams,rxPhy);
+      }
+    else
+      {
+        Simulator::Schedule (delay,&V2XSpectrumChannel::StartRx,this,rxParams,rxPhy);
+      }
+  }
+
+  void
+  V2XSpectrumChannel::StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver)
+  {
+    NS_LOG_FUNCTION(this << params);
+    receiver->StartRx (params);
+  }
+
+  void
+  V2XSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
+  {
+    NS_LOG_FUNCTION(this << txParams);
+
+    NS_ASSERT_MSG (txParams->psd,"NULL txPsd");
+    NS_ASSERT_MSG (txParams->txPhy,"NULL txPhy");
+
+    // Copy it since traced value cannot be const (because of potential underlying DynamicCasts)
+    Ptr<SpectrumSignalParameters> txParamsTrace = txParams->Copy ();
+    m_txSigParamsTrace (txParamsTrace);
+
+    placeNewPhys ();
+
+    Ptr<MobilityModel> txMobility = txParams->txPhy->GetMobility ();
+    bool cutoff = m_outer_range_m>0 && txMobility;
+    Ptr<SpectrumSignalParameters> rxParams;
+    Time delay;
+
+    m_tx_counter++;
+
+    if(cutoff && !m_validation)
+      {
+        collectCandidates (txMobility->GetPosition ());
+
+        size_t delivered = 0;
+        for(uint32_t idx : m_candidates)
+          {
+            phyEntry_t &entry = m_phys[idx];
+            if(entry.phy==txParams->txPhy)
+              {
+                continue;
+              }
+
+            delivered++;
+            m_interference_rx += entry.decodable ? 0 : 1;
+            if(computeRxParams (txParams,txMobility,entry,entry.decodable || m_fade_interferers,rxParams,delay))
+              {
+                deliver (rxParams,delay,entry.phy);
+              }
+          }
+
+        size_t receivers = m_phy_index.count (PeekPointer (txParams->txPhy))>0 ? m_num_phys-1 : m_num_phys;
+        m_culled_rx += receivers-delivered;
+        return;
+      }
+
+    if(cutoff)
+      {
+        collectCandidates (txMobility->GetPosition ());
+      }
+
+    // No cutoff, or validation mode: all the receivers are evaluated in order
+    double validation_threshold_dbm = m_interference_range_m>m_max_range_m ? m_min_interference_power_dbm : m_min_rx_power_dbm;
+    for(phyEntry_t &entry : m_phys)
+      {
+        if(!entry.phy || entry.phy==txParams->txPhy)
+          {
+            continue;
+          }
+
+        if(!cutoff || entry.mark==m_tx_counter)
+          {
+            bool decodable = !cutoff || entry.decodable;
+            m_interference_rx += decodable ? 0 : 1;
+            if(computeRxParams (txParams,txMobility,entry,decodable || m_fade_interferers,rxParams,delay))
+              {
+                deliver (rxParams,delay,entry.phy);
+              }
+            continue;
+          }
+
+        m_culled_rx++;
+        if(computeRxParams (txParams,txMobility,entry,true,rxParams,delay))
+          {
+            double rx_power_dbm = 10.0*std::log10 (Integral (*(rxParams->psd)))+30.0;
+            if(rx_power_dbm>=validation_threshold_dbm)
+              {
+                m_validation_violations++;
+                NS_LOG_WARN("Receiver outside of the cutoff (" << m_outer_range_m << " m) with a received power of "
+                            << rx_power_dbm << " dBm, above " << validation_threshold_dbm << " dBm");
+              }
+          }
+      }
+  }
+}
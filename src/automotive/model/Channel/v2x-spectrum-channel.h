@@ -0,0 +1,136 @@
+#ifndef V2X_SPECTRUM_CHANNEL_H
+#define V2X_SPECTRUM_CHANNEL_H
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include "ns3/spectrum-channel.h"
+#include "ns3/spectrum-converter.h"
+#include "ns3/mobility-model.h"
+
+namespace ns3
+{
+  /*
+   * Spectrum channel for V2X scenarios with a large number of nodes
+   * The position of the attached PHYs is kept in a uniform grid, which is updated at every CourseChange of their
+   * mobility models (i.e. at every SUMO update, for the vehicles managed through TraCI). When a "MaxRange" is set,
+   * each transmission only evaluates the propagation models and schedules StartRx for the PHYs within that distance
+   * from the transmitter, instead of for every PHY attached to the channel.
+   * The receivers are still processed in the order in which they were attached, exactly as in SingleModelSpectrumChannel
+   * and MultiModelSpectrumChannel (PSDs are converted when the receiver uses a different SpectrumModel), so that the
+   * receptions inside the cutoff are the same as with those channels, as long as the propagation models are deterministic.
+   * The cutoff can be derived from the link budget with setCutoffFromLinkBudget().
+   * As the PHYs which cannot decode a signal still account for it in their SINR, an "InterferenceRange", larger than
+   * "MaxRange", can be set (e.g. with setInterferenceCutoffFromLinkBudget(), down to some dB below the noise floor):
+   * the receivers between the two ranges still get the signal, so that their SINR is not biased, but they are tracked
+   * separately from the decodable ones and, when "FadeInterferers" is false, only their pathloss is computed (i.e.
+   * the fading of the SpectrumPropagationLossModel or PhasedArraySpectrumPropagationLossModel is skipped for them).
+   * In "ValidationMode", the receivers outside of the cutoff are evaluated too (keeping also the random draws of the
+   * propagation models aligned with an unculled channel), without delivering the signal to them, and the ones which
+   * would have received a power above "MinRxPower" (or "MinInterferencePower", when an interference range is set)
+   * are counted as violations of the cutoff.
+   * This channel can be used with SpectrumWifiPhy, as a replacement of the YansWifiChannel for 802.11p: the Yans PHY
+   * calls the non-virtual YansWifiChannel::Send(), which cannot be replaced from outside of the wifi module.
+   * PHYs moving without notifying CourseChange (e.g. with a ConstantVelocityMobilityModel) are not supported when
+   * the cutoff is enabled.
+   */
+  class V2XSpectrumChannel : public SpectrumChannel
+  {
+    public:
+      static TypeId GetTypeId ();
+      V2XSpectrumChannel ();
+      virtual ~V2XSpectrumChannel ();
+
+      // SpectrumChannel and Channel interface
+      virtual void AddRx (Ptr<SpectrumPhy> phy);
+      virtual void RemoveRx (Ptr<SpectrumPhy> phy);
+      virtual void StartTx (Ptr<SpectrumSignalParameters> params);
+      virtual std::size_t GetNDevices () const;
+      virtual Ptr<NetDevice> GetDevice (std::size_t i) const;
+
+      // The cutoff is disabled when both the max range and the interference range are lower or equal than 0
+      void setMaxRange (double range_m);
+      double getMaxRange () const {return m_max_range_m;}
+      void setMinRxPower (double min_rx_power_dbm) {m_min_rx_power_dbm=min_rx_power_dbm;}
+      // The interference range is used only when it is larger than the max range
+      void setInterferenceRange (double range_m);
+      double getInterferenceRange () const {return m_interference_range_m;}
+      void setMinInterferencePower (double min_interference_power_dbm) {m_min_interference_power_dbm=min_interference_power_dbm;}
+      void setFadeInterferers (bool fade) {m_fade_interferers=fade;}
+      void enableValidationMode () {m_validation=true;}
+      void disableValidationMode () {m_validation=false;}
+
+      // Set the max range to the distance at which the (deterministic part of the) propagation loss models bring the
+      // received power below min_rx_power_dbm-margin_db, or above the "MaxLossDb" of the channel
+      // The propagation loss model must already be set, and its loss must not decrease with the distance
+      // Antenna gains and random fading are not included: they can be accounted for with margin_db
+      double setCutoffFromLinkBudget (double tx_power_dbm, double min_rx_power_dbm, double margin_db=0.0);
+      // Same as setCutoffFromLinkBudget(), for the interference range
+      double setInterferenceCutoffFromLinkBudget (double tx_power_dbm, double min_interference_power_dbm, double margin_db=0.0);
+
+      uint64_t getValidationViolations () const {return m_validation_violations;}
+      uint64_t getEvaluatedReceivers () const {return m_evaluated_rx;}
+      // Receivers between the max range and the interference range (they are counted also as evaluated receivers)
+      uint64_t getInterferenceReceivers () const {return m_interference_rx;}
+      uint64_t getCulledReceivers () const {return m_culled_rx;}
+
+    protected:
+      virtual void DoDispose ();
+
+    private:
+      typedef struct _phyEntry {
+        Ptr<SpectrumPhy> phy; //! Null when the PHY has been removed from the channel
+        Ptr<MobilityModel> mobility; //! Null until the PHY has a mobility model
+        uint64_t cell;
+        size_t cell_index; //! Position of the PHY in the vector of its grid cell
+        bool placed; //! Whether the PHY is stored in the grid
+        uint64_t mark; //! Last transmission for which the PHY was a candidate receiver
+        bool decodable; //! Whether the PHY was within the max range at the last transmission for which it was a candidate
+      } phyEntry_t;
+
+      uint64_t cellKey (const Vector &pos) const;
+      void placePhy (uint32_t idx);
+      void unplacePhy (uint32_t idx);
+      void placeNewPhys ();
+      void updateGrid ();
+      void rebuildGrid ();
+      double rangeFromLinkBudget (double tx_power_dbm, double threshold_dbm);
+      void courseChanged (std::string context, Ptr<const MobilityModel> mobility);
+      void collectCandidates (const Vector &tx_pos);
+
+      // Apply the propagation models for a single receiver; it returns false if the signal is not received at all
+      // The fading (i.e. the spectrum propagation loss models) is applied only when 'fading' is true
+      bool computeRxParams (Ptr<SpectrumSignalParameters> txParams, Ptr<MobilityModel> txMobility, phyEntry_t &rx, bool fading,
+                            Ptr<SpectrumSignalParameters> &rxParams, Time &delay);
+      void deliver (Ptr<SpectrumSignalParameters> rxParams, Time delay, Ptr<SpectrumPhy> rxPhy);
+      void StartRx (Ptr<SpectrumSignalParameters> params, Ptr<SpectrumPhy> receiver);
+
+      std::vector<phyEntry_t> m_phys;
+      std::unordered_map<const SpectrumPhy*,uint32_t> m_phy_index;
+      std::vector<uint32_t> m_unplaced; //! PHYs without a mobility model, which are always candidate receivers
+      std::unordered_map<uint64_t,std::vector<uint32_t>> m_cells;
+      std::vector<uint32_t> m_candidates;
+      size_t m_num_phys = 0;
+      uint64_t m_tx_counter = 0;
+
+      // Converters between different SpectrumModels, indexed by the UIDs of the TX and RX models
+      std::map<std::pair<SpectrumModelUid_t,SpectrumModelUid_t>,SpectrumConverter> m_converters;
+
+      double m_max_range_m = 0.0;
+      double m_interference_range_m = 0.0;
+      double m_outer_range_m = 0.0; //! Largest of the max range and the interference range
+      double m_cell_size_m = 0.0;
+      double m_min_rx_power_dbm = -101.0;
+      double m_min_interference_power_dbm = -111.0;
+      bool m_fade_interferers = true;
+      bool m_validation = false;
+
+      uint64_t m_validation_violations = 0;
+      uint64_t m_evaluated_rx = 0;
+      uint64_t m_interference_rx = 0;
+      uint64_t m_culled_rx = 0;
+  };
+}
+
+#endif // V2X_SPECTRUM_CHANNEL_H
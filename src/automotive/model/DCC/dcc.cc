@@ -0,0 +1,351 @@
+#include "dcc.h"
+#include "ns3/log.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-phy-state-helper.h"
+#include <cmath>
+
+#define DCC_MAC_OVERHEAD_BYTES 38 // 802.11 QoS data header (26 bytes), LLC/SNAP (8 bytes) and FCS (4 bytes)
+#define DCC_REF_TON_US 500 // Reference T_on of the reactive DCC tables (ETSI TS 102 687 [Annex A])
+
+namespace ns3
+{
+  NS_LOG_COMPONENT_DEFINE("DCC");
+
+  TypeId
+  DCC::GetTypeId ()
+  {
+    static TypeId tid =
+        TypeId("ns3::DCC")
+        .SetParent<Object>()
+        .AddConstructor<DCC>();
+    return tid;
+  }
+
+  DCC::DCC()
+  {
+    m_TransmitCallback = nullptr;
+    m_next_tx = Seconds(0);
+    m_last_ton = MicroSeconds(DCC_REF_TON_US);
+    m_busy_until = Seconds(0);
+  }
+
+  DCC::~DCC()
+  {
+    NS_LOG_FUNCTION(this);
+    m_event_gate.Cancel();
+    m_event_CBR.Cancel();
+  }
+
+  void
+  DCC::cleanup()
+  {
+    m_event_gate.Cancel();
+    m_event_CBR.Cancel();
+    m_measuring = false;
+    for(int dp=0;dp<DCC_NUM_DP;dp++)
+      {
+        m_queues[dp].clear();
+      }
+  }
+
+  void
+  DCC::attachWifiPhy(Ptr<WifiPhy> phy)
+  {
+    if(!phy->GetState()->TraceConnectWithoutContext("State",MakeCallback(&DCC::wifiStateNotify,this)))
+      {
+        NS_FATAL_ERROR("Error. Cannot connect the DCC to the State trace of the WifiPhy.");
+      }
+    startCBRMeasurement();
+  }
+
+  void
+  DCC::attachNrSpectrumPhy(Ptr<Object> phy)
+  {
+    if(!phy->TraceConnectWithoutContext("ChannelOccupied",MakeCallback(&DCC::nrChannelOccupied,this)))
+      {
+        NS_FATAL_ERROR("Error. Cannot connect the DCC to the ChannelOccupied trace. Is this an NrSpectrumPhy?");
+      }
+    startCBRMeasurement();
+  }
+
+  void
+  DCC::attachCv2xSpectrumPhy(Ptr<Object> phy)
+  {
+    // The cv2x module is not linked to this one: the PHY is attached through its trace source only
+    if(!phy->TraceConnectWithoutContext("SlChannelOccupancy",MakeCallback(&DCC::notifyChannelOccupancy,this)))
+      {
+        NS_FATAL_ERROR("Error. Cannot connect the DCC to the SlChannelOccupancy trace. Is this a cv2x_LteSpectrumPhy?");
+      }
+    startCBRMeasurement();
+  }
+
+  void
+  DCC::wifiStateNotify(Time start, Time duration, WifiPhyState state)
+  {
+    if(state==WifiPhyState::CCA_BUSY || state==WifiPhyState::RX || state==WifiPhyState::TX)
+      {
+        notifyChannelBusy(start,duration);
+      }
+  }
+
+  void
+  DCC::notifyChannelBusy(Time start, Time duration)
+  {
+    Time end = start+duration;
+
+    if(start<m_busy_until)
+      {
+        start = m_busy_until;
+      }
+
+    if(end<=start)
+      {
+        return;
+      }
+
+    m_busy_until = end;
+    addBusyTime(start,end,1.0);
+  }
+
+  void
+  DCC::notifyChannelOccupancy(Time duration, double fraction)
+  {
+    if(fraction>0)
+      {
+        addBusyTime(Simulator::Now(),Simulator::Now()+duration,fraction);
+      }
+  }
+
+  void
+  DCC::startCBRMeasurement()
+  {
+    if(m_measuring)
+      {
+        return;
+      }
+
+    m_measuring = true;
+    m_open_window = Simulator::Now().GetTimeStep()/m_T_CBR.GetTimeStep();
+    for(int w=0;w<DCC_CBR_WINDOWS;w++)
+      {
+        m_busy[w] = 0;
+      }
+
+    // Each window is evaluated one T_CBR after its end, as some PHYs report the busy intervals only when they end
+    m_event_CBR = Simulator::Schedule(TimeStep((m_open_window+2)*m_T_CBR.GetTimeStep())-Simulator::Now(),&DCC::evaluateCBR,this);
+  }
+
+  void
+  DCC::addBusyTime(Time start, Time end, double weight)
+  {
+    if(!m_measuring)
+      {
+        return;
+      }
+
+    int64_t period = m_T_CBR.GetTimeStep();
+    uint64_t first = std::max((uint64_t) (start.GetTimeStep()/period),m_open_window);
+    uint64_t last = (end.GetTimeStep()-1)/period;
+
+    // Split the interval among the windows it overlaps (busy time too far in the future is not accounted)
+    for(uint64_t w=first;w<=last && w<m_open_window+DCC_CBR_WINDOWS;w++)
+      {
+        int64_t w_start = std::max((int64_t) w*period,start.GetTimeStep());
+        int64_t w_end = std::min((int64_t) (w+1)*period,end.GetTimeStep());
+
+        m_busy[w%DCC_CBR_WINDOWS] += weight*(w_end-w_start)/period;
+      }
+  }
+
+  void
+  DCC::evaluateCBR()
+  {
+    double cbr = std::min(m_busy[m_open_window%DCC_CBR_WINDOWS],1.0);
+
+    m_busy[m_open_window%DCC_CBR_WINDOWS] = 0;
+    m_open_window++;
+    m_num_windows++;
+
+    m_cbr_l1 = m_num_windows>1 ? m_cbr_l0 : cbr;
+    m_cbr_l0 = cbr;
+    // ETSI TS 102 687 [5.4]: average of the last two T_CBR measurements
+    m_cbr_g = (m_cbr_l0+m_cbr_l1)/2.0;
+
+    // The LIMERIC state is updated every 200 ms
+    if(m_num_windows%2==0)
+      {
+        updateDelta();
+      }
+
+    NS_LOG_DEBUG("CBR: " << cbr << " smoothed: " << m_cbr_g << " delta: " << m_delta);
+
+    m_event_CBR = Simulator::Schedule(m_T_CBR,&DCC::evaluateCBR,this);
+  }
+
+  void
+  DCC::updateDelta()
+  {
+    // ETSI TS 102 687 [5.4] LIMERIC
+    double diff = m_cbr_target-m_cbr_g;
+    double offset;
+
+    if(diff>0)
+      {
+        offset = std::min(m_beta*diff,m_g_plus_max);
+      }
+    else
+      {
+        offset = std::max(m_beta*diff,m_g_minus_max);
+      }
+
+    m_delta = (1-m_alpha)*m_delta+offset;
+    m_delta = std::max(std::min(m_delta,m_delta_max),m_delta_min);
+  }
+
+  Time
+  DCC::computeTon(uint32_t size)
+  {
+    // 802.11 OFDM airtime: preamble and SIGNAL (40 us on 10 MHz channels) and 8 us symbols with 16 service bits and
+    // 6 tail bits
+    double bits_per_symbol = m_datarate_mbps*8;
+    double symbols = std::ceil((16+8.0*(size+DCC_MAC_OVERHEAD_BYTES)+6)/bits_per_symbol);
+
+    return MicroSeconds(40+8*(int64_t) symbols);
+  }
+
+  Time
+  DCC::computeToff(Time ton)
+  {
+    if(m_mechanism==DCC_ADAPTIVE)
+      {
+        // ETSI TS 102 687 [5.4]: the next transmission is allowed after T_on/delta, within [25 ms, 1 s]
+        Time toff = TimeStep((int64_t) (ton.GetTimeStep()/m_delta));
+        return std::max(std::min(toff,Seconds(1)),MilliSeconds(25));
+      }
+
+    // ETSI TS 102 687 [Annex A] reactive states (Relaxed, Active 1-3, Restrictive), whose T_off is defined for
+    // T_on up to 500 us and is scaled for longer packets
+    long toff_ms;
+    if(m_cbr_g<0.30)
+      {
+        toff_ms = 60;
+      }
+    else if(m_cbr_g<0.40)
+      {
+        toff_ms = 100;
+      }
+    else if(m_cbr_g<0.50)
+      {
+        toff_ms = 180;
+      }
+    else if(m_cbr_g<0.60)
+      {
+        toff_ms = 260;
+      }
+    else
+      {
+        toff_ms = 1000;
+      }
+
+    double scale = std::max(1.0,ton.GetMicroSeconds()/(double) DCC_REF_TON_US);
+    return MicroSeconds((int64_t) (toff_ms*1000*scale));
+  }
+
+  long
+  DCC::getTGenDcc_ms()
+  {
+    // ETSI EN 302 637-2 [6.1.3]: T_GenCam_Dcc is always within [T_GenCamMin, T_GenCamMax]
+    long tgen_ms = computeToff(m_last_ton).GetMilliSeconds();
+
+    return std::max(std::min(tgen_ms,1000L),100L);
+  }
+
+  bool
+  DCC::requestTransmission(Ptr<Packet> packet, uint8_t trafficClass, Time lifetime, Address dest)
+  {
+    dccPacket_t dccPacket = {packet,dest,Simulator::Now()+lifetime};
+    // DCC profile from the traffic class ID (the 6 least significant bits of the traffic class)
+    uint8_t dp = std::min(trafficClass & 0x3F,DCC_NUM_DP-1);
+    bool queued = false;
+    bool retval = true;
+
+    for(int i=0;i<DCC_NUM_DP;i++)
+      {
+        queued = queued || !m_queues[i].empty();
+      }
+
+    if(!queued && Simulator::Now()>=m_next_tx)
+      {
+        transmit(dccPacket);
+        m_stats.sentImmediately++;
+        return true;
+      }
+
+    // Full queue: the oldest packet is dropped, as the newest one carries more up-to-date information
+    if(m_queues[dp].size()>=m_queue_length)
+      {
+        m_queues[dp].pop_front();
+        m_stats.queueDrops++;
+        retval = false;
+      }
+    m_queues[dp].push_back(dccPacket);
+
+    if(!m_event_gate.IsRunning())
+      {
+        m_event_gate = Simulator::Schedule(std::max(m_next_tx-Simulator::Now(),Seconds(0)),&DCC::gateOpen,this);
+      }
+
+    return retval;
+  }
+
+  void
+  DCC::transmit(dccPacket_t &dccPacket)
+  {
+    m_last_ton = computeTon(dccPacket.packet->GetSize());
+    m_next_tx = Simulator::Now()+computeToff(m_last_ton);
+
+    if(m_TransmitCallback!=nullptr)
+      {
+        m_TransmitCallback(dccPacket.packet,dccPacket.dest);
+      }
+    else
+      {
+        NS_LOG_ERROR("DCC: no transmit callback has been set. Packet discarded.");
+      }
+  }
+
+  void
+  DCC::gateOpen()
+  {
+    bool pending = false;
+    bool sent = false;
+
+    // Serve the queue with the highest priority first, discarding the packets whose lifetime has expired
+    for(int dp=0;dp<DCC_NUM_DP;dp++)
+      {
+        std::deque<dccPacket_t> &queue = m_queues[dp];
+
+        while(!queue.empty() && queue.front().expiry<Simulator::Now())
+          {
+            queue.pop_front();
+            m_stats.lifetimeDrops++;
+          }
+
+        if(!sent && !queue.empty())
+          {
+            dccPacket_t dccPacket = queue.front();
+            queue.pop_front();
+            transmit(dccPacket);
+            m_stats.sentFromQueue++;
+            sent = true;
+          }
+
+        pending = pending || !queue.empty();
+      }
+
+    if(pending)
+      {
+        m_event_gate = Simulator::Schedule(m_next_tx-Simulator::Now(),&DCC::gateOpen,this);
+      }
+  }
+}
@@ -0,0 +1,139 @@
+#ifndef DCC_H
+#define DCC_H
+
+#include <stdint.h>
+#include <deque>
+#include <functional>
+#include "ns3/object.h"
+#include "ns3/packet.h"
+#include "ns3/address.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/event-id.h"
+#include "ns3/wifi-phy-state.h"
+
+#define DCC_NUM_DP 4 // Number of DCC profiles (DP0 to DP3), each with its own queue
+#define DCC_CBR_WINDOWS 4 // Number of T_CBR windows whose busy time is accumulated at the same time
+
+namespace ns3
+{
+  class WifiPhy;
+
+  typedef enum {
+    DCC_REACTIVE=0,
+    DCC_ADAPTIVE=1
+  } DCCMechanism_t;
+
+  typedef struct _dccStats {
+    uint64_t sentImmediately; //! Packets which found the gate open and an empty queue
+    uint64_t sentFromQueue; //! Packets which waited in one of the DCC queues
+    uint64_t queueDrops; //! Packets dropped since their queue was full (the oldest one is dropped)
+    uint64_t lifetimeDrops; //! Packets whose lifetime expired while waiting in the queue
+  } DCCStats_t;
+
+  /*
+   * Decentralized Congestion Control (ETSI TS 102 687)
+   * The DCC object measures the Channel Busy Ratio (CBR) from the PHY layer of the access technology and it acts as
+   * a gatekeeper between GeoNetworking and the socket: after each transmission, the gate stays closed for T_off, which
+   * depends on the channel load (reactive state machine or adaptive LIMERIC algorithm). Packets requested while the gate
+   * is closed are stored in one queue per DCC profile (derived from the GN traffic class ID, DP0 having the highest
+   * priority) and sent when the gate opens again.
+   * The CBR is measured every T_CBR=100 ms and the busy time can be fed by:
+   * - the PHY state of 802.11p devices (CCA_BUSY, RX and TX states), with attachWifiPhy()
+   * - the "ChannelOccupied" trace of the NR-V2X NrSpectrumPhy, with attachNrSpectrumPhy()
+   * - the "SlChannelOccupancy" trace of the C-V2X cv2x_LteSpectrumPhy, reporting the fraction of sidelink resources
+   *   above the S-RSSI threshold, with attachCv2xSpectrumPhy()
+   * - any other source, through notifyChannelBusy() and notifyChannelOccupancy()
+   */
+  class DCC : public Object
+  {
+    public:
+      static TypeId GetTypeId();
+      DCC();
+      virtual ~DCC();
+
+      void setMechanism(DCCMechanism_t mechanism) {m_mechanism=mechanism;}
+      // PHY data rate used to estimate the T_on airtime of each packet (default: 6 Mbit/s, 802.11p on 10 MHz)
+      void setDataRate(double datarate_mbps) {m_datarate_mbps=datarate_mbps;}
+      void setQueueLength(size_t queue_length) {m_queue_length=queue_length;}
+      void setCBRTarget(double cbr_target) {m_cbr_target=cbr_target;}
+
+      void attachWifiPhy(Ptr<WifiPhy> phy);
+      void attachNrSpectrumPhy(Ptr<Object> phy);
+      void attachCv2xSpectrumPhy(Ptr<Object> phy);
+      // The channel is busy from 'start' for 'duration'; intervals overlapping already notified ones are counted only once
+      void notifyChannelBusy(Time start, Time duration);
+      // A fraction of the channel resources is busy from now for 'duration' (e.g. for FDMA sidelinks)
+      void notifyChannelOccupancy(Time duration, double fraction);
+
+      // Function actually passing the packets to the lower layers (an invalid Address means broadcast)
+      void setTransmitCallback(std::function<void(Ptr<Packet>,Address)> tx_callback) {m_TransmitCallback=tx_callback;}
+      // It returns false when an older packet of the same DCC profile had to be dropped to make room for this one
+      bool requestTransmission(Ptr<Packet> packet, uint8_t trafficClass, Time lifetime, Address dest);
+
+      double getCBR() {return m_cbr_g;}
+      double getDelta() {return m_delta;}
+      Time getToff() {return computeToff(m_last_ton);}
+      // Message generation interval which the Basic Services should use, i.e. T_GenCam_Dcc of ETSI EN 302 637-2
+      long getTGenDcc_ms();
+      DCCStats_t getStats() {return m_stats;}
+
+      void cleanup();
+
+    private:
+      typedef struct _dccPacket {
+        Ptr<Packet> packet;
+        Address dest;
+        Time expiry;
+      } dccPacket_t;
+
+      void startCBRMeasurement();
+      void addBusyTime(Time start, Time end, double weight);
+      void evaluateCBR();
+      void updateDelta();
+      void wifiStateNotify(Time start, Time duration, WifiPhyState state);
+      void nrChannelOccupied(Time duration) {notifyChannelBusy(Simulator::Now(),duration);}
+
+      Time computeTon(uint32_t size);
+      Time computeToff(Time ton);
+      void transmit(dccPacket_t &dccPacket);
+      void gateOpen();
+
+      DCCMechanism_t m_mechanism = DCC_ADAPTIVE;
+      double m_datarate_mbps = 6.0;
+      size_t m_queue_length = 16;
+
+      std::function<void(Ptr<Packet>,Address)> m_TransmitCallback;
+
+      std::deque<dccPacket_t> m_queues[DCC_NUM_DP];
+      Time m_next_tx;
+      Time m_last_ton;
+      EventId m_event_gate;
+
+      // CBR measurement
+      Time m_T_CBR = MilliSeconds(100);
+      double m_busy[DCC_CBR_WINDOWS] = {};
+      uint64_t m_open_window = 0; //! First window which was not evaluated yet
+      Time m_busy_until;
+      bool m_measuring = false;
+      EventId m_event_CBR;
+      double m_cbr_l0 = 0.0; //! CBR of the last window
+      double m_cbr_l1 = 0.0; //! CBR of the previous window
+      double m_cbr_g = 0.0; //! Smoothed CBR used by the rate control algorithms
+      uint64_t m_num_windows = 0;
+
+      // ETSI TS 102 687 [5.4] LIMERIC parameters
+      double m_alpha = 0.016;
+      double m_beta = 0.0012;
+      double m_cbr_target = 0.68;
+      double m_delta_max = 0.03;
+      double m_delta_min = 0.0006;
+      double m_g_plus_max = 0.0005;
+      double m_g_minus_max = -0.00025;
+      double m_delta = 0.03;
+
+      DCCStats_t m_stats = {};
+  };
+}
+
+#endif // DCC_H
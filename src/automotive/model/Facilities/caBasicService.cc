@@ -31,10 +31,22 @@
 #include "asn_utils.h"
 #include <cmath>
 
+// Deviations between the predicted kinematics and the position updates which require a new prediction
+#define CAM_PRED_DIST_TOL_M 0.25
+#define CAM_PRED_SPEED_TOL_MS 0.1
+#define CAM_PRED_HEADING_TOL_DEG 1.0
+#define CAM_PRED_MIN_STEP_HEADING_M 0.5 // Minimum displacement to estimate the heading from two positions
+
 namespace ns3
 {
   NS_LOG_COMPONENT_DEFINE("CABasicService");
 
+  static double
+  wrapHeadingDiff(double diff)
+  {
+    return diff + ((diff>180.0) ? -360.0 : (diff<-180.0) ? 360.0 : 0.0);
+  }
+
   CABasicService::~CABasicService() {
     NS_LOG_INFO("CABasicService object destroyed.");
   }
@@ -54,6 +66,16 @@ namespace ns3
     m_prev_speed=-1;
     m_prev_distance=-1;
 
+    m_triggerMode=CAM_TRIGGER_PERIODIC;
+    m_mobility=nullptr;
+    m_kin_valid=false;
+    m_check_values_valid=false;
+    m_mob_updated=false;
+    m_mob_speed_valid=false;
+    m_mob_heading_valid=false;
+    m_mob_accel_valid=false;
+    m_mob_yawrate_valid=false;
+
     m_T_GenCam_ms=T_GenCamMax_ms;
 
     lastCamGen=-1;
@@ -74,6 +96,7 @@ namespace ns3
     // All the optional containers are disabled by default
     m_lowFreqContainerEnabled = false;
     m_specialVehContainerEnabled = false;
+    m_skeletonEncoding = true;
 
     m_CAReceiveCallback = nullptr;
     m_CAReceiveCallbackExtended = nullptr;
@@ -93,6 +116,16 @@ namespace ns3
     m_prev_speed=-1;
     m_prev_distance=-1;
 
+    m_triggerMode=CAM_TRIGGER_PERIODIC;
+    m_mobility=nullptr;
+    m_kin_valid=false;
+    m_check_values_valid=false;
+    m_mob_updated=false;
+    m_mob_speed_valid=false;
+    m_mob_heading_valid=false;
+    m_mob_accel_valid=false;
+    m_mob_yawrate_valid=false;
+
     m_T_GenCam_ms=T_GenCamMax_ms;
 
     lastCamGen=-1;
@@ -111,6 +144,7 @@ namespace ns3
     // All the optional containers are disabled by default
     m_lowFreqContainerEnabled = false;
     m_specialVehContainerEnabled = false;
+    m_skeletonEncoding = true;
 
     m_CAReceiveCallback = nullptr;
     m_CAReceiveCallbackExtended = nullptr;
@@ -295,8 +329,24 @@ namespace ns3
     generateAndEncodeCam();
     VDP::VDP_position_latlon_t now_pos = m_vdp->getPosition();
     std::cout << "CAM sent at (" << now_pos.lat << " " << now_pos.lon << ")" <<std::endl;
-    // m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::checkCamConditions, this);
-    m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::resendCam, this);
+    m_check_origin = Simulator::Now ();
+
+    switch(m_triggerMode)
+      {
+        case CAM_TRIGGER_POLLING:
+          m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::checkCamConditions, this);
+          break;
+        case CAM_TRIGGER_PREDICTIVE:
+          if(m_mobility==nullptr)
+            {
+              NS_FATAL_ERROR("Error. The predictive CAM trigger requires the mobility model of the vehicle. Use setMobilityModel().");
+            }
+          m_mobility->TraceConnectWithoutContext ("CourseChange",MakeCallback(&CABasicService::mobilityUpdate,this));
+          planCamCheck (true);
+          break;
+        default:
+          m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::resendCam, this);
+      }
   }
 
   void
@@ -309,6 +359,13 @@ namespace ns3
   void
   CABasicService::resendCam()
   {
+    int64_t now=computeTimestampUInt64 ()/NANO_TO_MILLI;
+    if(now-lastCamGen<getTGenCamDcc ())
+      {
+        m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::resendCam, this);
+        return;
+      }
+
     VDP::VDP_position_latlon_t now_pos = m_vdp->getPosition();
     std::cout << "CAM sent at (" << now_pos.lat << " " << now_pos.lon << ")" <<std::endl;
     CABasicService_error_t cam_error;
@@ -327,17 +384,241 @@ namespace ns3
   }
   void
   CABasicService::checkCamConditions()
+  {
+    evaluateCamConditions ();
+    m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::checkCamConditions, this);
+  }
+
+  void
+  CABasicService::predictiveCamCheck()
+  {
+    evaluateCamConditions ();
+    planCamCheck (true);
+  }
+
+  double
+  CABasicService::predictedDistance(double tau)
+  {
+    // Constant acceleration, without moving backwards once the vehicle stops
+    if(m_kin_accel<0 && m_kin_speed+m_kin_accel*tau<0)
+      {
+        return -m_kin_speed*m_kin_speed/(2*m_kin_accel);
+      }
+
+    return m_kin_speed*tau+0.5*m_kin_accel*tau*tau;
+  }
+
+  void
+  CABasicService::planCamCheck(bool after_check)
+  {
+    Time now_sim = Simulator::Now ();
+    int64_t now=computeTimestampUInt64 ()/NANO_TO_MILLI;
+    double heading,distance,speed;
+
+    // Right after a check, the current values are either the ones of the CAM just generated, or the ones just checked
+    if(after_check && lastCamGen==now)
+      {
+        heading = m_prev_heading;
+        distance = m_prev_distance;
+        speed = m_prev_speed;
+      }
+    else if(after_check && m_check_values_valid)
+      {
+        heading = m_check_heading;
+        distance = m_check_distance;
+        speed = m_check_speed;
+      }
+    else
+      {
+        heading = m_vdp->getHeadingValue ();
+        distance = m_vdp->getTravelledDistance ();
+        speed = m_vdp->getSpeedValue ();
+      }
+
+    // The VDP values refer to the last mobility update, which is taken as the time of the sample
+    Time sample_time = m_mob_updated ? m_mob_lasttime : now_sim;
+
+    // Rates: from the last two position updates when available (the most recent estimate), otherwise from the
+    // previous sample (the VDP does not provide them)
+    if(m_kin_valid && sample_time>m_kin_time)
+      {
+        double dt = (sample_time-m_kin_time).GetSeconds ();
+        m_kin_accel = (speed-m_kin_speed)/dt;
+        m_kin_yawrate = wrapHeadingDiff (heading-m_kin_heading)/dt;
+      }
+    else if(!m_kin_valid)
+      {
+        m_kin_accel = 0;
+        m_kin_yawrate = 0;
+      }
+
+    if(m_mob_accel_valid)
+      {
+        m_kin_accel = m_mob_accel;
+      }
+    if(m_mob_yawrate_valid)
+      {
+        m_kin_yawrate = m_mob_yawrate;
+      }
+
+    m_kin_time = sample_time;
+    m_kin_heading = heading;
+    m_kin_distance = distance;
+    m_kin_speed = speed;
+    m_kin_valid = true;
+
+    m_mob_lastpos = m_mobility->GetPosition ();
+    m_mob_lasttime = sample_time;
+    m_mob_path = 0;
+
+    // Time, in seconds from now, at which each condition of checkCamConditions() is predicted to be met (the
+    // kinematic predictions start from the time of the sample)
+    double elapsed = (now_sim-sample_time).GetSeconds ();
+    double tau = (lastCamGen+m_T_GenCam_ms-now)/1000.0;
+
+    double head_diff = wrapHeadingDiff (heading-m_prev_heading);
+    if(m_kin_yawrate!=0)
+      {
+        double tau_h = ((m_kin_yawrate>0 ? 4.0 : -4.0)-head_diff)/m_kin_yawrate-elapsed;
+        tau = std::min(tau,std::max(tau_h,0.0));
+      }
+
+    double speed_diff = speed-m_prev_speed;
+    if(m_kin_accel!=0)
+      {
+        double tau_s = ((m_kin_accel>0 ? 0.5 : -0.5)-speed_diff)/m_kin_accel-elapsed;
+        tau = std::min(tau,std::max(tau_s,0.0));
+      }
+
+    double residual = 4.0-(distance-m_prev_distance);
+    if(residual<=0)
+      {
+        tau = 0;
+      }
+    else if(m_kin_accel==0 && m_kin_speed>0)
+      {
+        tau = std::min(tau,std::max(residual/m_kin_speed-elapsed,0.0));
+      }
+    else if(m_kin_accel!=0)
+      {
+        double disc = m_kin_speed*m_kin_speed+2*m_kin_accel*residual;
+        if(disc>=0)
+          {
+            double tau_d = (-m_kin_speed+std::sqrt(disc))/m_kin_accel;
+            if(tau_d>=0 && (m_kin_accel>0 || m_kin_speed+m_kin_accel*tau_d>=0))
+              {
+                tau = std::min(tau,std::max(tau_d-elapsed,0.0));
+              }
+          }
+      }
+
+    // No condition can be met before T_GenCam_Dcc
+    tau = std::max(tau,(lastCamGen+getTGenCamDcc ()-now)/1000.0);
+
+    // Check the conditions at the first tick of the polling grid following the predicted time
+    int64_t period = MilliSeconds(m_T_CheckCamGen_ms).GetTimeStep ();
+    int64_t target = (now_sim+Seconds(std::max(tau,0.0))-m_check_origin).GetTimeStep ();
+    int64_t tick = (target+period-1)/period;
+    Time next = m_check_origin+TimeStep(tick*period);
+
+    if(next<now_sim || (after_check && next==now_sim))
+      {
+        next = m_check_origin+TimeStep(((now_sim-m_check_origin).GetTimeStep ()/period+1)*period);
+      }
+
+    m_event_camCheckConditions.Cancel ();
+    m_event_camCheckConditions = Simulator::Schedule (next-now_sim, &CABasicService::predictiveCamCheck, this);
+  }
+
+  void
+  CABasicService::mobilityUpdate(Ptr<const MobilityModel> mobility)
+  {
+    Vector pos = mobility->GetPosition ();
+    Time now = Simulator::Now ();
+    double dx = pos.x-m_mob_lastpos.x;
+    double dy = pos.y-m_mob_lastpos.y;
+    double step = std::sqrt(dx*dx+dy*dy);
+    double dt = (now-m_mob_lasttime).GetSeconds ();
+    bool contradicted = false;
+
+    if(!m_event_camCheckConditions.IsRunning ())
+      {
+        return;
+      }
+
+    if(dt>0)
+      {
+        double tau = (now-m_kin_time).GetSeconds ();
+        double pred_step = predictedDistance (tau)-predictedDistance (tau-dt);
+        double obs_speed = step/dt;
+        bool heading_valid = step>=CAM_PRED_MIN_STEP_HEADING_M;
+        // SUMO headings are measured clockwise from north
+        double obs_heading = std::atan2(dx,dy)*180.0/M_PI;
+
+        m_mob_path += step;
+
+        contradicted = std::abs(m_mob_path-predictedDistance (tau))>CAM_PRED_DIST_TOL_M ||
+                       std::abs(obs_speed-pred_step/dt)>CAM_PRED_SPEED_TOL_MS;
+
+        if(!contradicted && heading_valid)
+          {
+            double pred_heading = m_kin_heading+m_kin_yawrate*(tau-dt/2);
+
+            contradicted = std::abs(wrapHeadingDiff (std::fmod(obs_heading-pred_heading,360.0)))>CAM_PRED_HEADING_TOL_DEG;
+          }
+
+        // Rates observed over the last two position updates
+        if(m_mob_speed_valid)
+          {
+            m_mob_accel = (obs_speed-m_mob_speed)/dt;
+            m_mob_accel_valid = true;
+            m_mob_yawrate_valid = heading_valid && m_mob_heading_valid;
+            if(m_mob_yawrate_valid)
+              {
+                m_mob_yawrate = wrapHeadingDiff (std::fmod(obs_heading-m_mob_heading,360.0))/dt;
+              }
+          }
+
+        m_mob_speed = obs_speed;
+        m_mob_speed_valid = true;
+        m_mob_heading = obs_heading;
+        m_mob_heading_valid = heading_valid;
+      }
+
+    m_mob_lastpos = pos;
+    m_mob_lasttime = now;
+    m_mob_updated = true;
+
+    if(contradicted)
+      {
+        planCamCheck (false);
+      }
+  }
+
+  void
+  CABasicService::evaluateCamConditions()
   {
     int64_t now=computeTimestampUInt64 ()/NANO_TO_MILLI;
     CABasicService_error_t cam_error;
     bool condition_verified=false;
     static bool dyn_cond_verified=false;
 
+    m_check_values_valid=false;
+
     // If no initial CAM has been triggered before checkCamConditions() has been called, throw an error
     if(m_prev_heading==-1 || m_prev_speed==-1 || m_prev_distance==-1)
       {
         NS_FATAL_ERROR("Error. checkCamConditions() was called before sending any CAM and this is not allowed.");
       }
+
+    /*
+     * ETSI EN 302 637-2 V1.3.1 chap. 6.1.3: both conditions require the time elapsed since the last CAM generation to
+     * be equal to or greater than T_GenCam_Dcc
+    */
+    if(now-lastCamGen<getTGenCamDcc ())
+      {
+        return;
+      }
     /*
      * ETSI EN 302 637-2 V1.3.1 chap. 6.1.3 condition 1) (no DCC)
      * One of the following ITS-S dynamics related conditions is given:
@@ -348,7 +629,8 @@ namespace ns3
      * ITS-S and the heading included in the CAM previously transmitted by the
      * originating ITS-S exceeds 4°;
     */
-    double head_diff = m_vdp->getHeadingValue () - m_prev_heading;
+    m_check_heading = m_vdp->getHeadingValue ();
+    double head_diff = m_check_heading - m_prev_heading;
     head_diff += (head_diff>180.0) ? -360.0 : (head_diff<-180.0) ? 360.0 : 0.0;
     if (head_diff > 4.0 || head_diff < -4.0)
       {
@@ -368,7 +650,8 @@ namespace ns3
      * the position included in the CAM previously transmitted by the originating
      * ITS-S exceeds 4 m;
     */
-    double pos_diff = m_vdp->getTravelledDistance () - m_prev_distance;
+    m_check_distance = m_vdp->getTravelledDistance ();
+    double pos_diff = m_check_distance - m_prev_distance;
     if (!condition_verified && (pos_diff > 4.0 || pos_diff < -4.0))
       {
         cam_error=generateAndEncodeCam ();
@@ -387,7 +670,9 @@ namespace ns3
      * and the speed included in the CAM previously transmitted by the originating
      * ITS-S exceeds 0,5 m/s.
     */
-    double speed_diff = m_vdp->getSpeedValue () - m_prev_speed;
+    m_check_speed = m_vdp->getSpeedValue ();
+    m_check_values_valid = true;
+    double speed_diff = m_check_speed - m_prev_speed;
     if (!condition_verified && (speed_diff > 0.5 || speed_diff < -0.5))
       {
         cam_error=generateAndEncodeCam ();
@@ -424,8 +709,6 @@ namespace ns3
              NS_LOG_ERROR("Cannot generate CAM. Error code: "<<cam_error);
            }
       }
-
-    m_event_camCheckConditions = Simulator::Schedule (MilliSeconds(m_T_CheckCamGen_ms), &CABasicService::checkCamConditions, this);
   }
 
   CABasicService_error_t
@@ -434,11 +717,21 @@ namespace ns3
     VDP::CAM_mandatory_data_t cam_mandatory_data;
     CABasicService_error_t errval=CAM_NO_ERROR;
 
-    Ptr<Packet> packet;
+    int64_t now,now_centi;
 
-    BTPDataRequest_t dataRequest = {};
+    /* When the CAM has the mandatory vehicle layout, use the specialized encoder, which just patches the dynamic fields
+       inside a pre-encoded skeleton, falling back to the generic asn1cpp encoding in all the other cases */
+    if(m_vehicle==true && m_skeletonEncoding==true && m_lowFreqContainerEnabled==false &&
+       (m_specialVehContainerEnabled==false || m_vdp->getVehicleRole ().getData () == VehicleRole_default))
+      {
+        std::string skeleton_result;
 
-    int64_t now,now_centi;
+        if(encodeCamSkeleton(skeleton_result)==true)
+          {
+            sendEncodedCam(skeleton_result);
+            return errval;
+          }
+      }
 
     /* Collect data for mandatory containers */
     auto cam = asn1cpp::makeSeq(CAM);
@@ -472,10 +765,8 @@ namespace ns3
         /* Fill the basicContainer */
         asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeValue, cam_mandatory_data.altitude.getValue ());
         asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeConfidence, cam_mandatory_data.altitude.getConfidence ());
-        // asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.latitude, cam_mandatory_data.latitude); //450539080
-        // asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.longitude, cam_mandatory_data.longitude); //76553820
-        // asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.latitude, 450539080); 
-        // asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.longitude, 76553820); 
+        asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.latitude, cam_mandatory_data.latitude);
+        asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.longitude, cam_mandatory_data.longitude);
         asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, cam_mandatory_data.posConfidenceEllipse.semiMajorConfidence);
         asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, cam_mandatory_data.posConfidenceEllipse.semiMinorConfidence);
         asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, cam_mandatory_data.posConfidenceEllipse.semiMajorOrientation);
@@ -825,29 +1116,9 @@ namespace ns3
       return CAM_ASN1_UPER_ENC_ERROR;
     }
 
-    packet = Create<Packet> ((uint8_t*) encode_result.c_str(), encode_result.size());
+    sendEncodedCam(encode_result);
 
-    dataRequest.BTPType = BTP_B; //!< BTP-B
-    dataRequest.destPort = CA_PORT;
-    dataRequest.destPInfo = 0;
-    dataRequest.GNType = TSB;
-    dataRequest.GNCommProfile = UNSPECIFIED;
-    dataRequest.GNRepInt =0;
-    dataRequest.GNMaxRepInt=0;
-    dataRequest.GNMaxLife = 1;
-    dataRequest.GNMaxHL = 1;
-    dataRequest.GNTraClass = 0x02; // Store carry foward: no - Channel offload: no - Traffic Class ID: 2
-    dataRequest.lenght = packet->GetSize ();
-    dataRequest.data = packet;
-    m_btp->sendBTP(dataRequest);
-
-    m_cam_sent++;
-
-    // Store the time in which the last CAM (i.e. this one) has been generated and successfully sent
-    now=computeTimestampUInt64 ()/NANO_TO_MILLI;
     now_centi = computeTimestampUInt64 ()/NANO_TO_CENTI; //Time in centiseconds(now[ms]/10->centiseconds) for Reference Position
-    m_T_GenCam_ms=now-lastCamGen;
-    lastCamGen = now;
 
     // Save this point in the list of PH points (if the low frequency container transmission is enabled)
     if(m_lowFreqContainerEnabled == true)
@@ -897,12 +1168,127 @@ namespace ns3
     return errval;
   }
 
+  bool
+  CABasicService::encodeCamSkeleton(std::string &encoded)
+  {
+    VDP::CAM_mandatory_data_t cam_mandatory_data;
+    CAMSkeletonEncoder::CAM_static_data_t static_data;
+    CAMSkeletonEncoder::CAM_dynamic_data_t dynamic_data;
+
+    // Only the lanePosition is supported among the optional fields of the basicVehicleContainerHighFrequency
+    if(m_vdp->getAccelerationControl ().isAvailable () || m_vdp->getSteeringWheelAngle ().isAvailable () ||
+       m_vdp->getLateralAcceleration ().isAvailable () || m_vdp->getVerticalAcceleration ().isAvailable () ||
+       m_vdp->getPerformanceClass ().isAvailable () || m_vdp->getCenDsrcTollingZone ().isAvailable ())
+      {
+        return false;
+      }
+
+    cam_mandatory_data=m_vdp->getCAMMandatoryData();
+
+    // The skeleton is re-built only when the static data changes
+    static_data.stationID = m_station_id;
+    static_data.stationType = m_stationtype;
+    static_data.vehicleLengthValue = cam_mandatory_data.VehicleLength.getValue ();
+    static_data.vehicleLengthConfidence = cam_mandatory_data.VehicleLength.getConfidence ();
+    static_data.vehicleWidth = cam_mandatory_data.VehicleWidth;
+
+    if(m_camSkeletonEncoder.setStaticData (static_data)==false)
+      {
+        return false;
+      }
+
+    dynamic_data.generationDeltaTime = compute_timestampIts (m_real_time) % 65536;
+    dynamic_data.latitude = cam_mandatory_data.latitude;
+    dynamic_data.longitude = cam_mandatory_data.longitude;
+    dynamic_data.semiMajorConfidence = cam_mandatory_data.posConfidenceEllipse.semiMajorConfidence;
+    dynamic_data.semiMinorConfidence = cam_mandatory_data.posConfidenceEllipse.semiMinorConfidence;
+    dynamic_data.semiMajorOrientation = cam_mandatory_data.posConfidenceEllipse.semiMajorOrientation;
+    dynamic_data.altitudeValue = cam_mandatory_data.altitude.getValue ();
+    dynamic_data.altitudeConfidence = cam_mandatory_data.altitude.getConfidence ();
+    dynamic_data.headingValue = cam_mandatory_data.heading.getValue ();
+    dynamic_data.headingConfidence = cam_mandatory_data.heading.getConfidence ();
+    dynamic_data.speedValue = cam_mandatory_data.speed.getValue ();
+    dynamic_data.speedConfidence = cam_mandatory_data.speed.getConfidence ();
+    dynamic_data.driveDirection = cam_mandatory_data.driveDirection;
+    dynamic_data.longAccelerationValue = cam_mandatory_data.longAcceleration.getValue ();
+    dynamic_data.longAccelerationConfidence = cam_mandatory_data.longAcceleration.getConfidence ();
+    dynamic_data.curvatureValue = cam_mandatory_data.curvature.getValue ();
+    dynamic_data.curvatureConfidence = cam_mandatory_data.curvature.getConfidence ();
+    dynamic_data.curvatureCalculationMode = cam_mandatory_data.curvature_calculation_mode;
+    dynamic_data.yawRateValue = cam_mandatory_data.yawRate.getValue ();
+    dynamic_data.yawRateConfidence = cam_mandatory_data.yawRate.getConfidence ();
+
+    auto lanePosition = m_vdp->getLanePosition ();
+    dynamic_data.lanePositionAvailable = lanePosition.isAvailable ();
+    dynamic_data.lanePosition = dynamic_data.lanePositionAvailable ? lanePosition.getData () : 0;
+
+    if(m_camSkeletonEncoder.encode (dynamic_data,encoded)==false)
+      {
+        return false;
+      }
+
+    // Store all the "previous" values used in checkCamConditions()
+    m_prev_distance=m_vdp->getTravelledDistance ();
+    m_prev_speed=m_vdp->getSpeedValue ();
+    m_prev_heading=m_vdp->getHeadingValue ();
+
+    return true;
+  }
+
+  void
+  CABasicService::sendEncodedCam(const std::string &encoded)
+  {
+    BTPDataRequest_t dataRequest = {};
+    Ptr<Packet> packet;
+    int64_t now;
+
+    packet = Create<Packet> ((uint8_t*) encoded.c_str(), encoded.size());
+
+    dataRequest.BTPType = BTP_B; //!< BTP-B
+    dataRequest.destPort = CA_PORT;
+    dataRequest.destPInfo = 0;
+    dataRequest.GNType = TSB;
+    dataRequest.GNCommProfile = UNSPECIFIED;
+    dataRequest.GNRepInt =0;
+    dataRequest.GNMaxRepInt=0;
+    dataRequest.GNMaxLife = 1;
+    dataRequest.GNMaxHL = 1;
+    dataRequest.GNTraClass = 0x02; // Store carry foward: no - Channel offload: no - Traffic Class ID: 2
+    dataRequest.lenght = packet->GetSize ();
+    dataRequest.data = packet;
+    m_btp->sendBTP(dataRequest);
+
+    m_cam_sent++;
+
+    // Store the time in which the last CAM (i.e. this one) has been generated and successfully sent
+    now=computeTimestampUInt64 ()/NANO_TO_MILLI;
+    m_T_GenCam_ms=now-lastCamGen;
+    lastCamGen = now;
+  }
+
+  long
+  CABasicService::getTGenCamDcc()
+  {
+    // T_GenCam_Dcc is provided by DCC, when enabled; otherwise, the CAM generation is only limited by the
+    // T_CheckCamGen period
+    if(m_btp!=NULL && m_btp->getDCC ()!=nullptr)
+      {
+        return m_btp->getDCC ()->getTGenDcc_ms ();
+      }
+
+    return 0;
+  }
+
   uint64_t
   CABasicService::terminateDissemination()
   {
     Simulator::Remove(m_event_camCheckConditions);
     Simulator::Remove(m_event_camDisseminationStart);
     Simulator::Remove(m_event_camRsuDissemination);
+    if(m_triggerMode==CAM_TRIGGER_PREDICTIVE && m_mobility!=nullptr)
+      {
+        m_mobility->TraceDisconnectWithoutContext ("CourseChange",MakeCallback(&CABasicService::mobilityUpdate,this));
+      }
     return m_cam_sent;
   }
 
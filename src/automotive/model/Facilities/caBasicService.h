@@ -3,6 +3,7 @@
 
 #include "ns3/socket.h"
 #include "ns3/core-module.h"
+#include "ns3/mobility-model.h"
 #include "ns3/vdp.h"
 #include "ns3/asn_utils.h"
 #include "ns3/btp.h"
@@ -10,6 +11,7 @@
 #include "ns3/Seq.hpp"
 #include "ns3/Getter.hpp"
 #include "ns3/LDM.h"
+#include "ns3/specializedEncoders.h"
 
 extern "C" {
   #include "ns3/CAM.h"
@@ -28,6 +30,12 @@ namespace ns3
     CAM_CANNOT_SEND=5
   } CABasicService_error_t;
 
+  typedef enum {
+    CAM_TRIGGER_PERIODIC=0, // One CAM every T_CheckCamGen
+    CAM_TRIGGER_POLLING=1, // ETSI EN 302 637-2 generation conditions checked every T_CheckCamGen
+    CAM_TRIGGER_PREDICTIVE=2 // Same conditions, checked only when they are predicted to be met
+  } CAMTriggerMode_t;
+
   class CABasicService: public Object
   {
   public:
@@ -57,6 +65,14 @@ namespace ns3
 
     void setLowFrequencyContainer(bool enable) {m_lowFreqContainerEnabled = enable;}
     void setSpecialVehicleContainer(bool enabled) {m_specialVehContainerEnabled = enabled;}
+    // Enable/disable the specialized skeleton-based encoder, used for the CAMs with the mandatory vehicle layout (default: enabled)
+    void setSkeletonEncoding(bool enable) {m_skeletonEncoding = enable;}
+
+    // The CAM generation conditions are checked on the same T_CheckCamGen time grid in both the polling and predictive
+    // modes; the predictive mode requires the mobility model of the vehicle to be set, to detect when the position
+    // updates contradict the prediction
+    void setTriggerMode(CAMTriggerMode_t mode) {m_triggerMode=mode;}
+    void setMobilityModel(Ptr<MobilityModel> mobility) {m_mobility=mobility;}
 
     void startCamDissemination();
     void startCamDissemination(double desync_s);
@@ -76,8 +92,16 @@ namespace ns3
     void RSUDissemination();
     void resendCam();
     void checkCamConditions();
+    void evaluateCamConditions();
+    void predictiveCamCheck();
+    void planCamCheck(bool after_check);
+    double predictedDistance(double tau);
+    void mobilityUpdate(Ptr<const MobilityModel> mobility);
     CABasicService_error_t generateAndEncodeCam();
+    bool encodeCamSkeleton(std::string &encoded);
+    void sendEncodedCam(const std::string &encoded);
     int64_t computeTimestampUInt64();
+    long getTGenCamDcc();
     void vLDM_handler(asn1cpp::Seq<CAM> decodedCAM);
 
     // std::function<void(CAM_t *, Address)> m_CAReceiveCallback;
@@ -114,6 +138,36 @@ namespace ns3
     double m_prev_distance;
     double m_prev_speed;
 
+    CAMTriggerMode_t m_triggerMode;
+    Ptr<MobilityModel> m_mobility;
+    Time m_check_origin; //! Time of the first CAM, from which the T_CheckCamGen grid starts
+
+    // Predictive trigger: last VDP sample, estimated rates and mobility updates received since that sample
+    Time m_kin_time;
+    double m_kin_heading;
+    double m_kin_distance;
+    double m_kin_speed;
+    double m_kin_accel;
+    double m_kin_yawrate;
+    bool m_kin_valid;
+    Vector m_mob_lastpos;
+    Time m_mob_lasttime;
+    double m_mob_path;
+    bool m_mob_updated;
+    double m_mob_speed; //! Speed and heading observed between the last two position updates
+    double m_mob_heading;
+    bool m_mob_speed_valid;
+    bool m_mob_heading_valid;
+    double m_mob_accel;
+    double m_mob_yawrate;
+    bool m_mob_accel_valid;
+    bool m_mob_yawrate_valid;
+    // Values read during the last check of the generation conditions
+    double m_check_heading;
+    double m_check_distance;
+    double m_check_speed;
+    bool m_check_values_valid;
+
     // Statistic: number of CAMs successfully sent since the CA Basic Service has been started
     // The CA Basic Service can count up to 18446744073709551615 (UINT64_MAX) CAMs
     uint64_t m_cam_sent;
@@ -133,6 +187,10 @@ namespace ns3
     // Boolean/Enum variables to enable/disable the presence of certain optional containers in the CAM messages
     bool m_lowFreqContainerEnabled;
     bool m_specialVehContainerEnabled;
+
+    // Specialized encoder for the CAMs with the mandatory vehicle layout
+    CAMSkeletonEncoder m_camSkeletonEncoder;
+    bool m_skeletonEncoding;
   };
 }
 
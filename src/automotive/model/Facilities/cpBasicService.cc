@@ -53,6 +53,21 @@ namespace ns3 {
     m_redundancy_mitigation = true;
 
     m_cpm_sent=0;
+
+    // For now we only consider one sensor
+    // We assume a radar sensor of 50m sensing range from the vehicle front bumper
+    CPMSkeletonEncoder::CPM_vehicle_sensor_t sensor;
+    sensor.sensorID = 2;
+    sensor.type = SensorType_radar;
+    sensor.refPointId = 0;
+    sensor.xSensorOffset = 0;
+    sensor.ySensorOffset = 0;
+    sensor.range = 50;
+    sensor.horizontalOpeningAngleStart = 0;
+    sensor.horizontalOpeningAngleEnd = 3600; //360 degrees
+    m_cpm_static_data.sensors.push_back (sensor);
+
+    m_skeletonEncoding = true;
   }
 
   void
@@ -147,6 +162,7 @@ namespace ns3 {
   CPBasicService::generateAndEncodeCPM()
   {
     VDP::CPM_mandatory_data_t cpm_mandatory_data;
+    CPMSkeletonEncoder::CPM_dynamic_data_t cpm_data = {};
     Ptr<Packet> packet;
 
     BTPDataRequest_t dataRequest = {};
@@ -157,17 +173,13 @@ namespace ns3 {
 
     long numberOfPOs = 0;
 
-    /* Collect data for mandatory containers */
-    auto cpm = asn1cpp::makeSeq(CPM);
-
-    if(bool(cpm)==false)
+    //Schedule new CPM, not earlier than the generation interval allowed by DCC, when enabled
+    long gen_interval_ms = m_N_GenCpm;
+    if(m_btp->getDCC ()!=nullptr)
       {
-        NS_LOG_ERROR("Warning: unable to encode CPM.");
-        return;
+        gen_interval_ms = std::max(gen_interval_ms,m_btp->getDCC ()->getTGenDcc_ms ());
       }
-
-    //Schedule new CPM
-    m_event_cpmSend = Simulator::Schedule (MilliSeconds (m_N_GenCpm), &CPBasicService::generateAndEncodeCPM, this);
+    m_event_cpmSend = Simulator::Schedule (MilliSeconds (gen_interval_ms), &CPBasicService::generateAndEncodeCPM, this);
 
 
     /* Process select Perceived Object Container Candidates as detailed in ETSI TR 103 562, ANNEX D (D.2) */
@@ -176,10 +188,9 @@ namespace ns3 {
         std::vector<LDM::returnedVehicleData_t> LDM_POs;
         if(m_LDM->getAllPOs (LDM_POs)) // If there are any POs in the LDM
           {
-            auto POsContainer = asn1cpp::makeSeq(PerceivedObjectContainer);
             std::vector<LDM::returnedVehicleData_t>::iterator it;
             for(it = LDM_POs.begin (); it != LDM_POs.end ();it++)
-              {               
+              {
 
                 if(it->vehData.perceivedBy.getData () != (long) m_station_id)
                   break;
@@ -187,90 +198,62 @@ namespace ns3 {
                   break;
                 else
                   {
-                    auto PO = asn1cpp::makeSeq(PerceivedObject);
-                    asn1cpp::setField(PO->objectID,it->vehData.stationID);
+                    CPMSkeletonEncoder::CPM_perceived_object_t PO;
+                    PO.objectID = it->vehData.stationID;
                     long timeOfMeasurement = (Simulator::Now ().GetMicroSeconds () - it->vehData.timestamp_us)/1000;// time of measuremente in ms
                     if(timeOfMeasurement > 1500)
                         timeOfMeasurement = 1500;
-                    asn1cpp::setField(PO->timeOfMeasurement,timeOfMeasurement);
+                    PO.timeOfMeasurement = timeOfMeasurement;
                     if(it->vehData.confidence.getData () < ObjectConfidence_unavailable && it->vehData.confidence.getData () > 0)
-                      asn1cpp::setField(PO->objectConfidence,it->vehData.confidence.getData ());
+                      PO.objectConfidence = it->vehData.confidence.getData ();
                     else
-                      asn1cpp::setField(PO->objectConfidence,ObjectConfidence_unavailable);
-
-                    asn1cpp::setField(PO->xDistance.value,it->vehData.xDistance.getData ());
-                    asn1cpp::setField(PO->xDistance.confidence,DistanceConfidence_unavailable);
-                    asn1cpp::setField(PO->yDistance.value,it->vehData.yDistance.getData ());
-                    asn1cpp::setField(PO->yDistance.confidence,DistanceConfidence_unavailable);
-                    asn1cpp::setField(PO->xSpeed.value,it->vehData.xSpeed.getData ());
-                    asn1cpp::setField(PO->xSpeed.confidence,SpeedConfidence_unavailable);
-                    asn1cpp::setField(PO->ySpeed.value,it->vehData.ySpeed.getData ());
-                    asn1cpp::setField(PO->ySpeed.confidence,SpeedConfidence_unavailable);
-                    auto angle = asn1cpp::makeSeq(CartesianAngle);
+                      PO.objectConfidence = ObjectConfidence_unavailable;
+
+                    PO.xDistanceValue = it->vehData.xDistance.getData ();
+                    PO.xDistanceConfidence = DistanceConfidence_unavailable;
+                    PO.yDistanceValue = it->vehData.yDistance.getData ();
+                    PO.yDistanceConfidence = DistanceConfidence_unavailable;
+                    PO.xSpeedValue = it->vehData.xSpeed.getData ();
+                    PO.xSpeedConfidence = SpeedConfidence_unavailable;
+                    PO.ySpeedValue = it->vehData.ySpeed.getData ();
+                    PO.ySpeedConfidence = SpeedConfidence_unavailable;
                     if(it->vehData.angle.getData() < CartesianAngleValue_unavailable && it->vehData.angle.getData() > 0)
-                      asn1cpp::setField(angle->value,it->vehData.angle.getData());
+                      PO.yawAngleValue = it->vehData.angle.getData();
                     else
-                      asn1cpp::setField(angle->value,CartesianAngleValue_unavailable);
-                    asn1cpp::setField(angle->confidence,AngleConfidence_unavailable);
-                    asn1cpp::setField(PO->yawAngle,angle);
-                    auto OD1 = asn1cpp::makeSeq(ObjectDimension);
+                      PO.yawAngleValue = CartesianAngleValue_unavailable;
+                    PO.yawAngleConfidence = AngleConfidence_unavailable;
                     if(it->vehData.vehicleLength.getData() < 1023 && it->vehData.vehicleLength.getData() > 0)
-                      asn1cpp::setField(OD1->value,it->vehData.vehicleLength.getData());
+                      PO.planarObjectDimension1Value = it->vehData.vehicleLength.getData();
                     else
-                      asn1cpp::setField(OD1->value,50);//usual value for SUMO vehicles
-                    asn1cpp::setField(OD1->confidence,ObjectDimensionConfidence_unavailable);
-                    asn1cpp::setField(PO->planarObjectDimension1,OD1);
-                    auto OD2 = asn1cpp::makeSeq(ObjectDimension);
+                      PO.planarObjectDimension1Value = 50;//usual value for SUMO vehicles
+                    PO.planarObjectDimension1Confidence = ObjectDimensionConfidence_unavailable;
                     if(it->vehData.vehicleWidth.getData() < 1023 && it->vehData.vehicleWidth.getData() > 0)
-                      asn1cpp::setField(OD2->value,it->vehData.vehicleWidth.getData());
+                      PO.planarObjectDimension2Value = it->vehData.vehicleWidth.getData();
                     else
-                      asn1cpp::setField(OD2->value,18);//usual value for SUMO vehicles
-                    asn1cpp::setField(OD2->confidence,ObjectDimensionConfidence_unavailable);
-                    asn1cpp::setField(PO->planarObjectDimension2,OD2);
-                    asn1cpp::setField(PO->objectRefPoint,ObjectRefPoint_topMid);
+                      PO.planarObjectDimension2Value = 18;//usual value for SUMO vehicles
+                    PO.planarObjectDimension2Confidence = ObjectDimensionConfidence_unavailable;
+                    PO.objectRefPoint = ObjectRefPoint_topMid;
 
                     /*Rest of optional fields handling left as future work*/
 
                     //Push Perceived Object to the container
-                    asn1cpp::sequenceof::pushList(*POsContainer,PO);
+                    cpm_data.perceivedObjects.push_back (PO);
                     //Update the timestamp of the last time this PO was included in a CPM
                     m_LDM->updateCPMincluded (it->vehData.stationID,computeTimestampUInt64 ()/NANO_TO_MILLI);
                     //Increase number of POs for the numberOfPerceivedObjects field in cpmParameters container
                     numberOfPOs++;
                   }
               }
-            if(numberOfPOs != 0)
-              asn1cpp::setField(cpm->cpm.cpmParameters.perceivedObjectContainer,POsContainer);
           }
       }
 
     // Fill numberOfPerceivedObjects
-    asn1cpp::setField(cpm->cpm.cpmParameters.numberOfPerceivedObjects,numberOfPOs);
+    cpm_data.numberOfPerceivedObjects = numberOfPOs;
 
     /* Process generate Sensor Information Container as detailed in ETSI TR 103 562, ANNEX D (D.3) */
     if(now-m_T_LastSensorInfoContainer >= m_T_AddSensorInformation)
       {
-        auto sensorInfoContainer = asn1cpp::makeSeq(SensorInformationContainer);
-        //For now we only consider one sensor
-        //We assume a Lidar sensor of 50m sensing range from the vehicle front bumper
-        auto sensorInfo = asn1cpp::makeSeq(SensorInformation);
-        asn1cpp::setField(sensorInfo->sensorID,2);
-        asn1cpp::setField(sensorInfo->type,SensorType_radar);
-        auto detectionArea = asn1cpp::makeSeq(DetectionArea);
-        asn1cpp::setField(detectionArea->present,DetectionArea_PR_vehicleSensor);
-        asn1cpp::setField(detectionArea->choice.vehicleSensor.refPointId,0);
-        asn1cpp::setField(detectionArea->choice.vehicleSensor.xSensorOffset,0);
-        asn1cpp::setField(detectionArea->choice.vehicleSensor.ySensorOffset,0);
-        auto property = asn1cpp::makeSeq(VehicleSensorProperties);
-        asn1cpp::setField(property->range,50);
-        asn1cpp::setField(property->horizontalOpeningAngleStart,0);
-        asn1cpp::setField(property->horizontalOpeningAngleEnd,3600);//360 degrees
-        asn1cpp::sequenceof::pushList(detectionArea->choice.vehicleSensor.vehicleSensorPropertyList,property);
-        asn1cpp::setField(sensorInfo->detectionArea,detectionArea);
-        //We ommit free space confidence
-        asn1cpp::sequenceof::pushList(*sensorInfoContainer,sensorInfo);
-        asn1cpp::setField(cpm->cpm.cpmParameters.sensorInformationContainer,sensorInfoContainer);
-
+        cpm_data.sensorInformationContainer = true;
         m_T_LastSensorInfoContainer = now;
       }
     else
@@ -280,12 +263,6 @@ namespace ns3 {
           return; //No CPM is generated in the current cycle
       }
 
-
-    /* Fill the header */
-    asn1cpp::setField(cpm->header.messageID, ItsPduHeader__messageID_cpm);
-    asn1cpp::setField(cpm->header.protocolVersion, 1);
-    asn1cpp::setField(cpm->header.stationID, m_station_id);
-
     /*
      * Compute the generationDeltaTime, "computed as the time corresponding to the
      * time of the reference position in the CPM, considered as time of the CPM generation.
@@ -293,53 +270,42 @@ namespace ns3 {
      * remainder of the corresponding value of TimestampIts divided by 65 536 as below:
      * generationDeltaTime = TimestampIts mod 65 536"
     */
-    asn1cpp::setField(cpm->cpm.generationDeltaTime, compute_timestampIts (m_real_time) % 65536);
-
-    /* Fill the managementContainer's station type */
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.stationType, m_stationtype);
+    cpm_data.generationDeltaTime = compute_timestampIts (m_real_time) % 65536;
 
     cpm_mandatory_data=m_vdp->getCPMMandatoryData();
 
-    /* Fill the managementContainer */
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeValue, cpm_mandatory_data.altitude.getValue ());
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeConfidence, cpm_mandatory_data.altitude.getConfidence ());
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.latitude, cpm_mandatory_data.latitude);
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.longitude, cpm_mandatory_data.longitude);
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, cpm_mandatory_data.posConfidenceEllipse.semiMajorConfidence);
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, cpm_mandatory_data.posConfidenceEllipse.semiMinorConfidence);
-    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, cpm_mandatory_data.posConfidenceEllipse.semiMajorOrientation);
-    //TODO:  compute segmentInfo, get MTU and deal with needed segmentation
-
-    /* Fill the stationDataContainer */
-    auto stationDataContainer = asn1cpp::makeSeq(StationDataContainer);
-    asn1cpp::setField(stationDataContainer->present, StationDataContainer_PR_originatingVehicleContainer);
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingValue, cpm_mandatory_data.heading.getValue ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingConfidence, cpm_mandatory_data.heading.getConfidence ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedValue, cpm_mandatory_data.speed.getValue ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedConfidence, cpm_mandatory_data.speed.getConfidence ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.driveDirection, cpm_mandatory_data.driveDirection);
-
-    auto vehicleLength = asn1cpp::makeSeq(VehicleLength);
-    asn1cpp::setField(vehicleLength->vehicleLengthValue, cpm_mandatory_data.VehicleLength.getValue());
-    asn1cpp::setField(vehicleLength->vehicleLengthConfidenceIndication, cpm_mandatory_data.VehicleLength.getConfidence());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleLength,vehicleLength);
-
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleWidth, cpm_mandatory_data.VehicleWidth);
-
-    auto longAcc = asn1cpp::makeSeq(LongitudinalAcceleration);
-    asn1cpp::setField(longAcc->longitudinalAccelerationValue, cpm_mandatory_data.longAcceleration.getValue ());
-    asn1cpp::setField(longAcc->longitudinalAccelerationConfidence, cpm_mandatory_data.longAcceleration.getConfidence ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.longitudinalAcceleration,longAcc);
-
-    auto yawRate = asn1cpp::makeSeq(YawRate);
-    asn1cpp::setField(yawRate->yawRateValue, cpm_mandatory_data.yawRate.getValue ());
-    asn1cpp::setField(yawRate->yawRateConfidence, cpm_mandatory_data.yawRate.getConfidence ());
-    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.yawRate,yawRate);
-
-    asn1cpp::setField(cpm->cpm.cpmParameters.stationDataContainer, stationDataContainer);
-
-
-    std::string encode_result = asn1cpp::uper::encode(cpm);
+    cpm_data.altitudeValue = cpm_mandatory_data.altitude.getValue ();
+    cpm_data.altitudeConfidence = cpm_mandatory_data.altitude.getConfidence ();
+    cpm_data.latitude = cpm_mandatory_data.latitude;
+    cpm_data.longitude = cpm_mandatory_data.longitude;
+    cpm_data.semiMajorConfidence = cpm_mandatory_data.posConfidenceEllipse.semiMajorConfidence;
+    cpm_data.semiMinorConfidence = cpm_mandatory_data.posConfidenceEllipse.semiMinorConfidence;
+    cpm_data.semiMajorOrientation = cpm_mandatory_data.posConfidenceEllipse.semiMajorOrientation;
+    cpm_data.headingValue = cpm_mandatory_data.heading.getValue ();
+    cpm_data.headingConfidence = cpm_mandatory_data.heading.getConfidence ();
+    cpm_data.speedValue = cpm_mandatory_data.speed.getValue ();
+    cpm_data.speedConfidence = cpm_mandatory_data.speed.getConfidence ();
+    cpm_data.driveDirection = cpm_mandatory_data.driveDirection;
+    cpm_data.longAccelerationValue = cpm_mandatory_data.longAcceleration.getValue ();
+    cpm_data.longAccelerationConfidence = cpm_mandatory_data.longAcceleration.getConfidence ();
+    cpm_data.yawRateValue = cpm_mandatory_data.yawRate.getValue ();
+    cpm_data.yawRateConfidence = cpm_mandatory_data.yawRate.getConfidence ();
+
+    m_cpm_static_data.stationID = m_station_id;
+    m_cpm_static_data.stationType = m_stationtype;
+    m_cpm_static_data.vehicleLengthValue = cpm_mandatory_data.VehicleLength.getValue();
+    m_cpm_static_data.vehicleLengthConfidence = cpm_mandatory_data.VehicleLength.getConfidence();
+    m_cpm_static_data.vehicleWidth = cpm_mandatory_data.VehicleWidth;
+
+    /* Use the specialized encoder whenever possible, falling back to the generic asn1cpp encoding otherwise */
+    std::string encode_result;
+
+    if(m_skeletonEncoding==false ||
+       m_cpmSkeletonEncoder.setStaticData (m_cpm_static_data)==false ||
+       m_cpmSkeletonEncoder.encode (cpm_data,encode_result)==false)
+      {
+        encode_result = encodeCpmGeneric (cpm_data);
+      }
 
     if(encode_result.size()<1)
     {
@@ -369,6 +335,129 @@ namespace ns3 {
     m_T_GenCpm_ms=now-lastCpmGen;
     lastCpmGen = now;
   }
+
+  std::string
+  CPBasicService::encodeCpmGeneric(const CPMSkeletonEncoder::CPM_dynamic_data_t &cpm_data)
+  {
+    auto cpm = asn1cpp::makeSeq(CPM);
+
+    if(bool(cpm)==false)
+      {
+        return std::string();
+      }
+
+    if(cpm_data.numberOfPerceivedObjects != 0)
+      {
+        auto POsContainer = asn1cpp::makeSeq(PerceivedObjectContainer);
+        for(const auto &po_data : cpm_data.perceivedObjects)
+          {
+            auto PO = asn1cpp::makeSeq(PerceivedObject);
+            asn1cpp::setField(PO->objectID,po_data.objectID);
+            asn1cpp::setField(PO->timeOfMeasurement,po_data.timeOfMeasurement);
+            asn1cpp::setField(PO->objectConfidence,po_data.objectConfidence);
+            asn1cpp::setField(PO->xDistance.value,po_data.xDistanceValue);
+            asn1cpp::setField(PO->xDistance.confidence,po_data.xDistanceConfidence);
+            asn1cpp::setField(PO->yDistance.value,po_data.yDistanceValue);
+            asn1cpp::setField(PO->yDistance.confidence,po_data.yDistanceConfidence);
+            asn1cpp::setField(PO->xSpeed.value,po_data.xSpeedValue);
+            asn1cpp::setField(PO->xSpeed.confidence,po_data.xSpeedConfidence);
+            asn1cpp::setField(PO->ySpeed.value,po_data.ySpeedValue);
+            asn1cpp::setField(PO->ySpeed.confidence,po_data.ySpeedConfidence);
+            auto angle = asn1cpp::makeSeq(CartesianAngle);
+            asn1cpp::setField(angle->value,po_data.yawAngleValue);
+            asn1cpp::setField(angle->confidence,po_data.yawAngleConfidence);
+            asn1cpp::setField(PO->yawAngle,angle);
+            auto OD1 = asn1cpp::makeSeq(ObjectDimension);
+            asn1cpp::setField(OD1->value,po_data.planarObjectDimension1Value);
+            asn1cpp::setField(OD1->confidence,po_data.planarObjectDimension1Confidence);
+            asn1cpp::setField(PO->planarObjectDimension1,OD1);
+            auto OD2 = asn1cpp::makeSeq(ObjectDimension);
+            asn1cpp::setField(OD2->value,po_data.planarObjectDimension2Value);
+            asn1cpp::setField(OD2->confidence,po_data.planarObjectDimension2Confidence);
+            asn1cpp::setField(PO->planarObjectDimension2,OD2);
+            asn1cpp::setField(PO->objectRefPoint,po_data.objectRefPoint);
+            asn1cpp::sequenceof::pushList(*POsContainer,PO);
+          }
+        asn1cpp::setField(cpm->cpm.cpmParameters.perceivedObjectContainer,POsContainer);
+      }
+
+    // Fill numberOfPerceivedObjects
+    asn1cpp::setField(cpm->cpm.cpmParameters.numberOfPerceivedObjects,cpm_data.numberOfPerceivedObjects);
+
+    if(cpm_data.sensorInformationContainer)
+      {
+        auto sensorInfoContainer = asn1cpp::makeSeq(SensorInformationContainer);
+        for(const auto &sensor : m_cpm_static_data.sensors)
+          {
+            auto sensorInfo = asn1cpp::makeSeq(SensorInformation);
+            asn1cpp::setField(sensorInfo->sensorID,sensor.sensorID);
+            asn1cpp::setField(sensorInfo->type,sensor.type);
+            auto detectionArea = asn1cpp::makeSeq(DetectionArea);
+            asn1cpp::setField(detectionArea->present,DetectionArea_PR_vehicleSensor);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.refPointId,sensor.refPointId);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.xSensorOffset,sensor.xSensorOffset);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.ySensorOffset,sensor.ySensorOffset);
+            auto property = asn1cpp::makeSeq(VehicleSensorProperties);
+            asn1cpp::setField(property->range,sensor.range);
+            asn1cpp::setField(property->horizontalOpeningAngleStart,sensor.horizontalOpeningAngleStart);
+            asn1cpp::setField(property->horizontalOpeningAngleEnd,sensor.horizontalOpeningAngleEnd);
+            asn1cpp::sequenceof::pushList(detectionArea->choice.vehicleSensor.vehicleSensorPropertyList,property);
+            asn1cpp::setField(sensorInfo->detectionArea,detectionArea);
+            //We ommit free space confidence
+            asn1cpp::sequenceof::pushList(*sensorInfoContainer,sensorInfo);
+          }
+        asn1cpp::setField(cpm->cpm.cpmParameters.sensorInformationContainer,sensorInfoContainer);
+      }
+
+    /* Fill the header */
+    asn1cpp::setField(cpm->header.messageID, ItsPduHeader__messageID_cpm);
+    asn1cpp::setField(cpm->header.protocolVersion, 1);
+    asn1cpp::setField(cpm->header.stationID, m_cpm_static_data.stationID);
+
+    asn1cpp::setField(cpm->cpm.generationDeltaTime, cpm_data.generationDeltaTime);
+
+    /* Fill the managementContainer */
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.stationType, m_cpm_static_data.stationType);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeValue, cpm_data.altitudeValue);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeConfidence, cpm_data.altitudeConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.latitude, cpm_data.latitude);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.longitude, cpm_data.longitude);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, cpm_data.semiMajorConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, cpm_data.semiMinorConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, cpm_data.semiMajorOrientation);
+    //TODO:  compute segmentInfo, get MTU and deal with needed segmentation
+
+    /* Fill the stationDataContainer */
+    auto stationDataContainer = asn1cpp::makeSeq(StationDataContainer);
+    asn1cpp::setField(stationDataContainer->present, StationDataContainer_PR_originatingVehicleContainer);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingValue, cpm_data.headingValue);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingConfidence, cpm_data.headingConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedValue, cpm_data.speedValue);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedConfidence, cpm_data.speedConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.driveDirection, cpm_data.driveDirection);
+
+    auto vehicleLength = asn1cpp::makeSeq(VehicleLength);
+    asn1cpp::setField(vehicleLength->vehicleLengthValue, m_cpm_static_data.vehicleLengthValue);
+    asn1cpp::setField(vehicleLength->vehicleLengthConfidenceIndication, m_cpm_static_data.vehicleLengthConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleLength,vehicleLength);
+
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleWidth, m_cpm_static_data.vehicleWidth);
+
+    auto longAcc = asn1cpp::makeSeq(LongitudinalAcceleration);
+    asn1cpp::setField(longAcc->longitudinalAccelerationValue, cpm_data.longAccelerationValue);
+    asn1cpp::setField(longAcc->longitudinalAccelerationConfidence, cpm_data.longAccelerationConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.longitudinalAcceleration,longAcc);
+
+    auto yawRate = asn1cpp::makeSeq(YawRate);
+    asn1cpp::setField(yawRate->yawRateValue, cpm_data.yawRateValue);
+    asn1cpp::setField(yawRate->yawRateConfidence, cpm_data.yawRateConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.yawRate,yawRate);
+
+    asn1cpp::setField(cpm->cpm.cpmParameters.stationDataContainer, stationDataContainer);
+
+    return asn1cpp::uper::encode(cpm);
+  }
+
   void
   CPBasicService::startCpmDissemination()
   {
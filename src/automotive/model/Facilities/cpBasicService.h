@@ -13,6 +13,7 @@
 #include "ns3/vdpTraci.h"
 #include "ns3/LDM.h"
 #include "ns3/ldm-utils.h"
+#include "ns3/specializedEncoders.h"
 
 extern "C" {
   #include "ns3/CPM.h"
@@ -43,6 +44,8 @@ public:
   uint64_t terminateDissemination();
   void setRedundancyMitigation(bool choice){m_redundancy_mitigation = choice;}
   void disableRedundancyMitigation(){m_redundancy_mitigation = false;}
+  // Enable/disable the specialized CPM encoder, which pre-encodes the static parts of each CPM (default: enabled)
+  void setSkeletonEncoding(bool enable) {m_skeletonEncoding = enable;}
 
   const long T_GenCpmMin_ms = 100;
   const long T_GenCpm_ms = 100;
@@ -56,6 +59,7 @@ private:
   void RSUDissemination();
   void checkCpmConditions();
   void generateAndEncodeCPM();
+  std::string encodeCpmGeneric(const CPMSkeletonEncoder::CPM_dynamic_data_t &cpm_data);
   int64_t computeTimestampUInt64();
   bool checkCPMconditions(std::vector<LDM::returnedVehicleData_t>::iterator it);
   double cartesian_dist(double lon1, double lat1, double lon2, double lat2);
@@ -102,6 +106,11 @@ private:
   // ns-3 event IDs used to properly stop the simulation with terminateDissemination()
   EventId m_event_cpmDisseminationStart;
   EventId m_event_cpmSend;
+
+  // Static data of this station and specialized CPM encoder
+  CPMSkeletonEncoder::CPM_static_data_t m_cpm_static_data;
+  CPMSkeletonEncoder m_cpmSkeletonEncoder;
+  bool m_skeletonEncoding;
 };
 }
 #endif // CPBASICSERVICE_H
@@ -40,9 +40,12 @@ namespace ns3 {
     m_socket_tx = NULL;
     m_real_time = false;
     m_btp = NULL;
+    m_GNMaxHL = 1;
 
     m_DENReceiveCallback = nullptr;
     m_DENReceiveCallbackExtended = nullptr;
+
+    setupTimers();
   }
 
   bool
@@ -51,19 +54,73 @@ namespace ns3 {
     return m_station_id!=ULONG_MAX && m_stationtype!=LONG_MAX;
   }
 
-    template<typename MEM_PTR> void
-     DENBasicService::setDENTimer(Timer &timer,Time delay,MEM_PTR callback_fcn,DEN_ActionID_t actionID) {
-      if(timer.IsRunning ())
-        {
-           timer.Cancel();
-        }
+  void
+  DENBasicService::setupTimers()
+  {
+    // The repetition interval is expressed in milliseconds: validity timers (in seconds) just take more revolutions of the wheel
+    m_timers.setup(MilliSeconds(1),Seconds(1),[this](const DENTimerItem_t &item) {timerExpired(item);});
+    m_timer_generation = 0;
+  }
 
-      timer.SetFunction(callback_fcn,this);
-      timer.SetArguments(actionID);
-      timer.SetDelay (delay);
+  void
+  DENBasicService::startOriginatingTimers(DENOriginatingEntry_t &entry,uint64_t key,denData &data)
+  {
+    // Any expiration of the previous timers still stored in the wheel is ignored, as the generations are incremented
+    stopOriginatingTimers(entry);
 
-      timer.Schedule ();
-    }
+    m_timers.insert({key,DEN_TIMER_T_O_VALIDITY,entry.validityGeneration},Seconds(data.getDenmMgmtValidityDuration ()));
+
+    /* Calculate and start timers T_RepetitionDuration and T_Repetition when both parameters in denData are > 0 */
+    if(data.getDenmRepetitionDuration ()>0 && data.getDenmRepetitionInterval ()>0)
+      {
+        entry.repetitionInterval = MilliSeconds(data.getDenmRepetitionInterval());
+        entry.nextRepetition = Simulator::Now()+entry.repetitionInterval;
+        entry.repetitionEnd = Simulator::Now()+MilliSeconds(data.getDenmRepetitionDuration ());
+
+        if(entry.nextRepetition<entry.repetitionEnd)
+          {
+            entry.repetitionActive = true;
+            m_timers.insert({key,DEN_TIMER_T_REPETITION,entry.repetitionGeneration},entry.repetitionInterval);
+          }
+      }
+  }
+
+  void
+  DENBasicService::stopOriginatingTimers(DENOriginatingEntry_t &entry)
+  {
+    entry.validityGeneration = ++m_timer_generation;
+    entry.repetitionGeneration = ++m_timer_generation;
+    entry.repetitionActive = false;
+  }
+
+  void
+  DENBasicService::timerExpired(const DENTimerItem_t &item)
+  {
+    if(item.timer==DEN_TIMER_T_R_VALIDITY)
+      {
+        auto rx_it = m_receivingITSSTable.find(item.key);
+        if(rx_it!=m_receivingITSSTable.end() && rx_it->second.validityGeneration==item.generation)
+          {
+            T_R_ValidityStop(item.key);
+          }
+        return;
+      }
+
+    auto orig_it = m_originatingITSSTable.find(item.key);
+    if(orig_it==m_originatingITSSTable.end())
+      {
+        return;
+      }
+
+    if(item.timer==DEN_TIMER_T_O_VALIDITY && orig_it->second.validityGeneration==item.generation)
+      {
+        T_O_ValidityStop(item.key);
+      }
+    else if(item.timer==DEN_TIMER_T_REPETITION && orig_it->second.repetitionActive && orig_it->second.repetitionGeneration==item.generation)
+      {
+        T_RepetitionStop(item.key);
+      }
+  }
 
   DENBasicService_error_t
   DENBasicService::fillDENM(asn1cpp::Seq<DENM> &denm, denData &data, const DEN_ActionID_t actionID,long referenceTimeLong)
@@ -418,25 +475,6 @@ namespace ns3 {
     return DENM_NO_ERROR;
   }
 
-  template <typename T> int
-  DENBasicService::asn_maybe_assign_optional_data(T *data, T **asn_structure, std::queue<void *> &ptr_queue)
-  {
-    if(data==NULL) {
-        return 0;
-      }
-
-    *asn_structure = (T*)calloc(1, sizeof(T));
-
-    if(*asn_structure == NULL)
-        return -1;
-
-    *(*asn_structure) = *data;
-
-    ptr_queue.push ((void *) *asn_structure);
-
-    return 1;
-  }
-
   DENBasicService::DENBasicService(unsigned long fixed_stationid,long fixed_stationtype,Ptr<Socket> socket_tx)
   {
     m_station_id = (StationID_t) fixed_stationid;
@@ -445,6 +483,9 @@ namespace ns3 {
     m_socket_tx = socket_tx;
     m_real_time = false;
     m_btp = NULL;
+    m_GNMaxHL = 1;
+
+    setupTimers();
   }
 
   void
@@ -524,7 +565,7 @@ namespace ns3 {
     actionid.originatingStationID = m_station_id;
     actionid.sequenceNumber = m_seq_number;
 
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)m_station_id,(long)m_seq_number);
+    uint64_t map_index = actionIDKey(m_station_id,m_seq_number);
 
     m_seq_number++;
 
@@ -560,32 +601,20 @@ namespace ns3 {
     dataRequest.GNRepInt =0;
     dataRequest.GNMaxRepInt=0;
     dataRequest.GNMaxLife = 60;
-    dataRequest.GNMaxHL = 1;
+    dataRequest.GNMaxHL = m_GNMaxHL;
     dataRequest.GNTraClass = 0x01; // Store carry foward: no - Channel offload: no - Traffic Class ID: 1
     dataRequest.lenght = packet->GetSize ();
     dataRequest.data = packet;
 
-    /* 8. 9. Create an entry in the originating ITS-S message table and set the state to ACTIVE and start the T_O_Validity timer. */
-    /* As all the timers are stored, in this case, for each entry in the table, we have to set them before saving the new entry to a map, which is done as last operation. */
-    /* We are basically adding the current entry, containing the already UPER encoded DENM packet, to a map of <ActionID,ITSSOriginatingTableEntry> */
-    ITSSOriginatingTableEntry entry(*packet, ITSSOriginatingTableEntry::STATE_ACTIVE,actionid);
-
     m_btp->sendBTP(dataRequest);
 
-    m_originatingTimerTable.emplace(map_index,std::tuple<Timer,Timer,Timer>());
-
-    DENBasicService::setDENTimer(std::get<V_O_VALIDITY_INDEX>(m_originatingTimerTable[map_index]),Seconds(data.getDenmMgmtValidityDuration ()),&DENBasicService::T_O_ValidityStop,actionid);
-
-    /* 10. Calculate and start timers T_RepetitionDuration and T_Repetition when both parameters in denData are > 0 */
-    if(data.getDenmRepetitionDuration ()>0 && data.getDenmRepetitionInterval ()>0)
-      {
-        DENBasicService::setDENTimer(std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]),MilliSeconds(data.getDenmRepetitionInterval()),&DENBasicService::T_RepetitionStop,actionid);
-        DENBasicService::setDENTimer(std::get<T_REPETITION_DURATION_INDEX>(m_originatingTimerTable[map_index]),MilliSeconds(data.getDenmRepetitionDuration ()),&DENBasicService::T_RepetitionDurationStop,actionid);
-      }
-
-    /* 11. Finally create the entry after starting all the timers (it refers to the step '8' of appDENM_trigger in ETSI EN302 637-3 V1.3.1 */
+    /* 8. 9. Create an entry in the originating ITS-S message table, containing the already UPER encoded DENM packet,
+     * set the state to ACTIVE and start the T_O_Validity timer. */
+    DENOriginatingEntry_t &entry = m_originatingITSSTable[map_index];
+    entry.entry = ITSSOriginatingTableEntry(*packet, ITSSOriginatingTableEntry::STATE_ACTIVE,actionid);
 
-    m_originatingITSSTable[map_index]=entry;
+    /* 10. 11. Calculate and start timers T_RepetitionDuration and T_Repetition when both parameters in denData are > 0 */
+    startOriginatingTimers(entry,map_index,data);
 
     /* 12. Send actionID to the requesting ITS-S application. This is requested by the standard, but we are already reporting the actionID using &actionID */
 
@@ -596,7 +625,7 @@ namespace ns3 {
   DENBasicService::appDENM_update(denData data, const DEN_ActionID_t actionid)
   {
     DENBasicService_error_t fillDENM_rval=DENM_NO_ERROR;
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)actionid.originatingStationID,(long)actionid.sequenceNumber);
+    uint64_t map_index = actionIDKey(actionid.originatingStationID,actionid.sequenceNumber);
 
     if(!CheckMainAttributes ())
       {
@@ -622,25 +651,20 @@ namespace ns3 {
     /* 2. Compare actionID in the application request with entries in the originating ITS-S message table (i.e. m_originatingITSSTable, implemented as a map) */
     /* Gather also the proper entry in the table, if available. */
 
-    T_Repetition_Mutex.lock();
-    std::map<std::pair<unsigned long,long>, ITSSOriginatingTableEntry>::iterator entry_map_it = m_originatingITSSTable.find(map_index);
+    auto entry_map_it = m_originatingITSSTable.find(map_index);
     if (entry_map_it == m_originatingITSSTable.end())
       {
-        T_Repetition_Mutex.unlock();
         return DENM_UNKNOWN_ACTIONID;
       }
 
-    /* 3. Stop T_O_Validity, T_RepetitionDuration and T_Repetition (if they were started - this check is already performed by the setTimer* methods) */
-    std::get<V_O_VALIDITY_INDEX>(m_originatingTimerTable[map_index]).Cancel();
-    std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]).Cancel();
-    std::get<T_REPETITION_DURATION_INDEX>(m_originatingTimerTable[map_index]).Cancel();
+    /* 3. Stop T_O_Validity, T_RepetitionDuration and T_Repetition (if they were started) */
+    stopOriginatingTimers(entry_map_it->second);
 
     /* 4. 5. 6. Manage transmission interval, reference time and fill DENM */
     fillDENM_rval=fillDENM(denm,data,actionid,compute_timestampIts (m_real_time));
 
     if(fillDENM_rval!=DENM_NO_ERROR)
       {
-        T_Repetition_Mutex.unlock();
         return fillDENM_rval;
       }
 
@@ -666,7 +690,7 @@ namespace ns3 {
     dataRequest.GNRepInt =0;
     dataRequest.GNMaxRepInt=0;
     dataRequest.GNMaxLife = 60; // 60 seconds
-    dataRequest.GNMaxHL = 1;
+    dataRequest.GNMaxHL = m_GNMaxHL;
     dataRequest.GNTraClass = 0x01; // Store carry foward: no - Channel offload: no - Traffic Class ID: 1
     dataRequest.lenght = packet->GetSize ();
     dataRequest.data = packet;
@@ -674,19 +698,11 @@ namespace ns3 {
     m_btp->sendBTP(dataRequest);
 
     /* 9. Update the entry in the originating ITS-S message table. */
-    entry_map_it->second.setDENMPacket(*packet);
+    entry_map_it->second.entry.setDENMPacket(*packet);
 
-    /* 10. Start timer T_O_Validity. */
-    DENBasicService::setDENTimer(std::get<V_O_VALIDITY_INDEX>(m_originatingTimerTable[map_index]),Seconds(data.getDenmMgmtValidityDuration ()),&DENBasicService::T_O_ValidityStop,actionid);
+    /* 10. 11. Start timer T_O_Validity and, when both parameters in denData are > 0, T_RepetitionDuration and T_Repetition */
+    startOriginatingTimers(entry_map_it->second,map_index,data);
 
-    /* 11. Calculate and start timers T_RepetitionDuration and T_Repetition when both parameters in denData are > 0 */
-    if(data.getDenmRepetitionDuration ()>0 && data.getDenmRepetitionInterval ()>0)
-      {
-        DENBasicService::setDENTimer(std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]),MilliSeconds(data.getDenmRepetitionInterval()),&DENBasicService::T_RepetitionStop,actionid);
-        DENBasicService::setDENTimer(std::get<T_REPETITION_DURATION_INDEX>(m_originatingTimerTable[map_index]),MilliSeconds(data.getDenmRepetitionDuration ()),&DENBasicService::T_RepetitionDurationStop,actionid);
-      }
-
-    T_Repetition_Mutex.unlock();
     return DENM_NO_ERROR;
   }
 
@@ -716,28 +732,24 @@ namespace ns3 {
         return DENM_ALLOC_ERROR;
       }
 
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)actionid.originatingStationID,(long)actionid.sequenceNumber);
+    uint64_t map_index = actionIDKey(actionid.originatingStationID,actionid.sequenceNumber);
 
     /* 1. If validity is expired return DENM_T_O_VALIDITY_EXPIRED */
     if (compute_timestampIts (m_real_time) > data.getDenmMgmtDetectionTime () + (data.getDenmMgmtValidityDuration ()*MILLI))
         return DENM_T_O_VALIDITY_EXPIRED;
 
     /* 2. Compare actionID in the application request with entries in the originating ITS-S message table and the receiving ITS-S message table */
-    T_Repetition_Mutex.lock();
-
-    std::map<std::pair<unsigned long,long>, ITSSOriginatingTableEntry>::iterator entry_originating_table = m_originatingITSSTable.find(map_index);
+    auto entry_originating_table = m_originatingITSSTable.find(map_index);
     /* 2a. If actionID exists in the originating ITS-S message table and the entry state is ACTIVE, then set termination to isCancellation.*/
     if (entry_originating_table != m_originatingITSSTable.end())
       {
-        T_Repetition_Mutex.unlock();
         return DENM_UNKNOWN_ACTIONID_ORIGINATING;
       }
-    else if(entry_originating_table->second.getStatus()==ITSSOriginatingTableEntry::STATE_ACTIVE)
+    else if(entry_originating_table->second.entry.getStatus()==ITSSOriginatingTableEntry::STATE_ACTIVE)
       {
         asn_termination=Termination_isCancellation;
         if(!asn1cpp::setField(denm->denm.management.termination,asn_termination))
           {
-            T_Repetition_Mutex.unlock();
             return DENM_ALLOC_ERROR;
           }
         else
@@ -747,23 +759,20 @@ namespace ns3 {
       }
     else
       {
-        T_Repetition_Mutex.unlock();
         return DENM_NON_ACTIVE_ACTIONID_ORIGINATING;
       }
 
     /* 2b. If actionID exists in the receiving ITS-S message table and the entry state is ACTIVE, then set termination to isNegation.*/
-    std::map<std::pair<unsigned long,long>, ITSSReceivingTableEntry>::iterator entry_receiving_table = m_receivingITSSTable.find(map_index);
+    auto entry_receiving_table = m_receivingITSSTable.find(map_index);
     if (entry_receiving_table != m_receivingITSSTable.end())
       {
-        T_Repetition_Mutex.unlock();
         return DENM_UNKNOWN_ACTIONID_RECEIVING;
       }
-    else if(entry_receiving_table->second.getStatus()==ITSSReceivingTableEntry::STATE_ACTIVE)
+    else if(entry_receiving_table->second.entry.getStatus()==ITSSReceivingTableEntry::STATE_ACTIVE)
       {
         asn_termination=Termination_isNegation;
         if(!asn1cpp::setField(denm->denm.management.termination,asn_termination))
           {
-            T_Repetition_Mutex.unlock();
             return DENM_ALLOC_ERROR;
           }
         else
@@ -773,17 +782,15 @@ namespace ns3 {
       }
     else
       {
-        T_Repetition_Mutex.unlock();
         return DENM_NON_ACTIVE_ACTIONID_RECEIVING;
       }
 
     if(termination==1)
       {
-        referenceTime=entry_receiving_table->second.getReferenceTime();
+        referenceTime=entry_receiving_table->second.entry.getReferenceTime();
 
         if(referenceTime==-1)
           {
-            T_Repetition_Mutex.unlock();
             return DENM_WRONG_TABLE_DATA;
           }
       }
@@ -796,18 +803,13 @@ namespace ns3 {
     fillDENM_rval=fillDENM(denm,data,actionid,referenceTime);
     if(fillDENM_rval!=DENM_NO_ERROR)
       {
-        T_Repetition_Mutex.unlock();
         //freeDENM(denm);
         return fillDENM_rval;
       }
 
-    /* 4a. Gather the proper timers from the timers table */
-    std::map<std::pair<unsigned long,long>, std::tuple<Timer,Timer,Timer>>::iterator entry_timers_table = m_originatingTimerTable.find(map_index);
-
-    /* 4b. Stop T_O_Validity, T_RepetitionDuration and T_Repetition (if they were started - this check is already performed by the setTimer* methods) */
-    std::get<V_O_VALIDITY_INDEX>(entry_timers_table->second).Cancel();
-    std::get<T_REPETITION_INDEX>(entry_timers_table->second).Cancel();
-    std::get<T_REPETITION_DURATION_INDEX>(entry_timers_table->second).Cancel();
+    /* 4. Stop T_O_Validity, T_RepetitionDuration and T_Repetition (if they were started) */
+    DENOriginatingEntry_t &originating_entry = m_originatingITSSTable[map_index];
+    stopOriginatingTimers(originating_entry);
 
     /* 5. Construct DENM and pass it to the lower layers (now UDP, in the future BTP and GeoNetworking, then UDP) */
     /** Encoding **/
@@ -832,7 +834,7 @@ namespace ns3 {
     dataRequest.GNRepInt =0;
     dataRequest.GNMaxRepInt=0;
     dataRequest.GNMaxLife = 60;
-    dataRequest.GNMaxHL = 1;
+    dataRequest.GNMaxHL = m_GNMaxHL;
     dataRequest.GNTraClass = 0x01; // Store carry foward: no - Channel offload: no - Traffic Class ID: 1
     dataRequest.lenght = packet->GetSize ();
     dataRequest.data = packet;
@@ -841,28 +843,17 @@ namespace ns3 {
     /* 6a. If termination is set to 1, create an entry in the originating ITS-S message table and set the state to NEGATED. */
     if(termination==1)
       {
-        ITSSOriginatingTableEntry entry(*packet, ITSSOriginatingTableEntry::STATE_NEGATED,actionid);
-        m_originatingITSSTable[map_index]=entry;
+        originating_entry.entry = ITSSOriginatingTableEntry(*packet, ITSSOriginatingTableEntry::STATE_NEGATED,actionid);
       }
     /* 6b. If termination is set to 0, update the entry in the originating ITS-S message table and set the state to CANCELLED. */
     else
       {
-        entry_originating_table->second.setDENMPacket(*packet);
-        entry_originating_table->second.setStatus(ITSSOriginatingTableEntry::STATE_CANCELLED);
-      }
-
-    /* 7. Start timer T_O_Validity. */
-    DENBasicService::setDENTimer(std::get<V_O_VALIDITY_INDEX>(entry_timers_table->second),Seconds(data.getDenmMgmtValidityDuration ()),&DENBasicService::T_O_ValidityStop,actionid);
-
-    /* 8. Calculate and start timers T_RepetitionDuration and T_Repetition when both parameters in denData are > 0 */
-    if(data.getDenmRepetitionDuration ()>0 && data.getDenmRepetitionInterval ()>0)
-      {
-        DENBasicService::setDENTimer(std::get<T_REPETITION_INDEX>(entry_timers_table->second),MilliSeconds(data.getDenmRepetitionInterval()),&DENBasicService::T_RepetitionStop,actionid);
-        DENBasicService::setDENTimer(std::get<T_REPETITION_DURATION_INDEX>(entry_timers_table->second),MilliSeconds(data.getDenmRepetitionDuration ()),&DENBasicService::T_RepetitionDurationStop,actionid);
+        originating_entry.entry.setDENMPacket(*packet);
+        originating_entry.entry.setStatus(ITSSOriginatingTableEntry::STATE_CANCELLED);
       }
 
-    T_Repetition_Mutex.unlock();
-
+    /* 7. 8. Start timer T_O_Validity and, when both parameters in denData are > 0, T_RepetitionDuration and T_Repetition */
+    startOriginatingTimers(originating_entry,map_index,data);
 
     return DENM_NO_ERROR;
   }
@@ -879,7 +870,7 @@ namespace ns3 {
 
     long detectionTime_long;
     long referenceTime_long;
-    std::pair <unsigned long, long> map_index;
+    uint64_t map_index;
 
     packet = dataIndication.data;
 
@@ -931,9 +922,9 @@ namespace ns3 {
     /* Lookup entries in the receiving ITS-S message table with the received actionID */
     actionID.originatingStationID = asn1cpp::getField(decoded_denm->denm.management.actionID.originatingStationID,unsigned long);
     actionID.sequenceNumber = asn1cpp::getField(decoded_denm->denm.management.actionID.sequenceNumber,long);
-    map_index = std::make_pair((unsigned long)actionID.originatingStationID ,(long)actionID.sequenceNumber);
+    map_index = actionIDKey(actionID.originatingStationID,actionID.sequenceNumber);
 
-    std::map<std::pair<unsigned long,long>, ITSSReceivingTableEntry>::iterator entry_rx_map_it = m_receivingITSSTable.find(map_index);
+    auto entry_rx_map_it = m_receivingITSSTable.find(map_index);
 
     termination = asn1cpp::getField(decoded_denm->denm.management.termination,long,&termination_ok);
 
@@ -952,15 +943,15 @@ namespace ns3 {
           {
             /* if not, create an entry in the receiving ITS-S message table with the received DENM and set the state to ACTIVE (SSP is not yet implemented) */
             ITSSReceivingTableEntry entry(*packet,ITSSReceivingTableEntry::STATE_ACTIVE,actionID,referenceTime_long,detectionTime_long);
-            m_receivingITSSTable[map_index]=entry;
+            m_receivingITSSTable[map_index].entry=entry;
           }
       }
     else
       {
         /* b. If entry does exist in the receiving ITS-S message table, check if the received referenceTime is less than the entry referenceTime,
          * or the received detectionTime is less than the entry detectionTime */
-        long stored_reference_time = entry_rx_map_it->second.getReferenceTime ();
-        long stored_detection_time =  entry_rx_map_it->second.getDetectionTime ();
+        long stored_reference_time = entry_rx_map_it->second.entry.getReferenceTime ();
+        long stored_detection_time =  entry_rx_map_it->second.entry.getDetectionTime ();
 
         if (referenceTime_long < stored_reference_time || detectionTime_long < stored_detection_time)
           {
@@ -978,8 +969,8 @@ namespace ns3 {
             if(referenceTime_long == stored_reference_time &&
                detectionTime_long == stored_detection_time &&
                (
-                 (!termination_ok &&  !entry_rx_map_it->second.isTerminationSet()) ||
-                 (termination_ok && termination==entry_rx_map_it->second.getTermination ())
+                 (!termination_ok &&  !entry_rx_map_it->second.entry.isTerminationSet()) ||
+                 (termination_ok && termination==entry_rx_map_it->second.entry.getTermination ())
                ))
               {
                 /* 1. If yes, discard received DENM and omit execution of further steps. */
@@ -991,18 +982,16 @@ namespace ns3 {
                 /* 2. Otherwise, update the entry in receiving ITS-S message table, set entry state according
                  * to the termination value of the received DENM. (SSP is not yet implemented) */
                 ITSSReceivingTableEntry entry(*packet,ITSSReceivingTableEntry::STATE_ACTIVE,actionID,referenceTime_long,detectionTime_long,decoded_denm->denm.management.termination);
-                entry_rx_map_it->second=entry;
+                entry_rx_map_it->second.entry=entry;
               }
           }
 
       }
 
     /* Start/restart T_R_Validity timer. */
-    if(m_T_R_Validity_Table.find(map_index) == m_T_R_Validity_Table.end()) {
-      m_T_R_Validity_Table[map_index] = Timer();
-    }
-
-    DENBasicService::setDENTimer(m_T_R_Validity_Table[map_index],Seconds((long)validityDuration),&DENBasicService::T_R_ValidityStop,actionID);
+    DENReceivingEntry_t &rx_entry = m_receivingITSSTable[map_index];
+    rx_entry.validityGeneration = ++m_timer_generation;
+    m_timers.insert({map_index,DEN_TIMER_T_R_VALIDITY,rx_entry.validityGeneration},Seconds((long)validityDuration));
 
     /* Fill den_data with the received information */
     bool location_ok,situation_ok,alacarte_ok;
@@ -1034,36 +1023,18 @@ namespace ns3 {
   }
 
   void
-  DENBasicService::T_O_ValidityStop(DEN_ActionID_t entry_actionid)
+  DENBasicService::T_O_ValidityStop(uint64_t key)
   {
-    T_Repetition_Mutex.lock ();
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)entry_actionid.originatingStationID,(long)entry_actionid.sequenceNumber);
-
-    std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]).Cancel();
-    std::get<T_REPETITION_DURATION_INDEX>(m_originatingTimerTable[map_index]).Cancel();
-
-    // When an entry expires, discard also the information related to its (now stopped) timers
-    m_originatingTimerTable.erase (map_index);
-    m_originatingITSSTable.erase (map_index);
-    T_Repetition_Mutex.unlock ();
+    // When an entry expires, T_Repetition is implicitly stopped, as its expirations will not find the entry anymore
+    m_originatingITSSTable.erase (key);
   }
 
   void
-  DENBasicService::T_RepetitionDurationStop(DEN_ActionID_t entry_actionid)
+  DENBasicService::T_RepetitionStop(uint64_t key)
   {
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)entry_actionid.originatingStationID,(long)entry_actionid.sequenceNumber);
+    DENOriginatingEntry_t &entry = m_originatingITSSTable[key];
 
-    std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]).Cancel();
-  }
-
-  void
-  DENBasicService::T_RepetitionStop(DEN_ActionID_t entry_actionid)
-  {
-    T_Repetition_Mutex.lock();
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)entry_actionid.originatingStationID,(long)entry_actionid.sequenceNumber);
-    T_Repetition_Mutex.unlock ();
-
-    Ptr<Packet> packet = Create<Packet> (m_originatingITSSTable[map_index].getDENMPacket ());
+    Ptr<Packet> packet = Create<Packet> (entry.entry.getDENMPacket ());
     // We should never reach this point if m_socket_tx==NULL (i.e. the corresponding timer will never be started)
     // So, it should not be necessary to check that m_socket_tx!=NULL
 
@@ -1078,47 +1049,36 @@ namespace ns3 {
     dataRequest.GNRepInt = 0;
     dataRequest.GNMaxRepInt = 0;
     dataRequest.GNMaxLife = 60;
-    dataRequest.GNMaxHL = 1;
+    dataRequest.GNMaxHL = m_GNMaxHL;
     dataRequest.GNTraClass = 0x01; // Store carry foward: no - Channel offload: no - Traffic Class ID: 1
     dataRequest.lenght = packet->GetSize ();
     dataRequest.data = packet;
     m_btp->sendBTP(dataRequest);
 
-    // Restart timer
-    std::get<T_REPETITION_INDEX>(m_originatingTimerTable[map_index]).Schedule();
+    // Restart timer, unless T_RepetitionDuration expires before the next repetition
+    // The next repetition is computed from the nominal one, so that any delay of the wheel does not accumulate
+    entry.nextRepetition += entry.repetitionInterval;
+    if(entry.nextRepetition<entry.repetitionEnd)
+      {
+        m_timers.insert({key,DEN_TIMER_T_REPETITION,entry.repetitionGeneration},entry.nextRepetition-Simulator::Now());
+      }
+    else
+      {
+        entry.repetitionActive = false;
+      }
   }
 
   void
-  DENBasicService::T_R_ValidityStop(DEN_ActionID_t entry_actionid)
+  DENBasicService::T_R_ValidityStop(uint64_t key)
   {
-    T_Repetition_Mutex.lock();
-    std::pair <unsigned long, long> map_index = std::make_pair((unsigned long)entry_actionid.originatingStationID,(long)entry_actionid.sequenceNumber);
-
-    // When an entry expires, discard also the information related to its (now stopped) timers
-    m_T_R_Validity_Table.erase (map_index);
-    m_receivingITSSTable.erase (map_index);
-    T_Repetition_Mutex.unlock ();
+    m_receivingITSSTable.erase (key);
   }
 
   /* This cleanup function will attemp to stop any possibly still-running timer */
   void
   DENBasicService::cleanup(void)
   {
-    for(std::map<std::pair<unsigned long,long>, std::tuple<Timer,Timer,Timer>>::iterator m_originatingTimerTable_it=m_originatingTimerTable.begin ();
-        m_originatingTimerTable_it!=m_originatingTimerTable.end ();
-        m_originatingTimerTable_it++)
-      {
-         std::get<V_O_VALIDITY_INDEX>(m_originatingTimerTable_it->second).Cancel();
-         std::get<T_REPETITION_INDEX>(m_originatingTimerTable_it->second).Cancel();
-         std::get<T_REPETITION_DURATION_INDEX>(m_originatingTimerTable_it->second).Cancel();
-      }
-
-    for(std::map<std::pair<unsigned long,long>, Timer>::iterator m_T_R_Validity_Table_it=m_T_R_Validity_Table.begin ();
-        m_T_R_Validity_Table_it!=m_T_R_Validity_Table.end ();
-        m_T_R_Validity_Table_it++)
-      {
-         m_T_R_Validity_Table_it->second.Cancel();
-      }
+    m_timers.clear();
 
     // Cleanup the BTP object (which will in turn perform the "cleanup" operation on the underlying GeoNet object)
     m_btp->cleanup();
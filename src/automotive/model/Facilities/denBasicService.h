@@ -10,13 +10,9 @@
 #include "ns3/btp.h"
 #include "ns3/btpHeader.h"
 #include "ns3/btpdatarequest.h"
+#include "ns3/timing-wheel.h"
 #include <functional>
-#include <mutex>
-#include <queue>
-
-#define V_O_VALIDITY_INDEX 0
-#define T_REPETITION_INDEX 1
-#define T_REPETITION_DURATION_INDEX 2
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -62,6 +58,8 @@ namespace ns3 {
     void setSocketTx(Ptr<Socket> socket_tx);
     void setSocketRx(Ptr<Socket> socket_rx);
     void setGeoArea(GeoArea_t geoArea){m_geoArea = geoArea;}
+    // Maximum number of GeoNetworking hops of the generated DENMs (1, i.e. single hop, by default)
+    void setGNMaxHopLimit(int16_t max_hop_limit){m_GNMaxHL = max_hop_limit;}
 
     void setRealTime(bool real_time){m_real_time=real_time;}
 
@@ -73,15 +71,43 @@ namespace ns3 {
 
     DENBasicService_error_t fillDENM(asn1cpp::Seq<DENM> &denm, denData &data, const DEN_ActionID_t actionID, long referenceTimeLong);
 
-    template<typename MEM_PTR> void setDENTimer(Timer &timer,Time delay,MEM_PTR callback_fcn,DEN_ActionID_t actionID);
-
-    void T_O_ValidityStop(DEN_ActionID_t entry_actionid);
-    void T_RepetitionDurationStop(DEN_ActionID_t entry_actionid);
-    void T_RepetitionStop(DEN_ActionID_t entry_actionid);
-
-    void T_R_ValidityStop(DEN_ActionID_t entry_actionid);
-
-    template <typename T> static int asn_maybe_assign_optional_data(T *data, T **asn_structure,std::queue<void *> &ptr_queue);
+    typedef enum {
+      DEN_TIMER_T_O_VALIDITY=0,
+      DEN_TIMER_T_REPETITION=1,
+      DEN_TIMER_T_R_VALIDITY=2
+    } DENTimer_t;
+
+    typedef struct _denTimerItem {
+      uint64_t key;
+      DENTimer_t timer;
+      uint64_t generation;
+    } DENTimerItem_t;
+
+    typedef struct _denOriginatingEntry {
+      ITSSOriginatingTableEntry entry;
+      uint64_t validityGeneration; //! Set to a new value when T_O_Validity is (re)started, to ignore its stale expirations
+      uint64_t repetitionGeneration; //! Same as validityGeneration, for T_Repetition
+      bool repetitionActive;
+      Time repetitionInterval;
+      Time nextRepetition;
+      Time repetitionEnd; //! Expiration of T_RepetitionDuration
+    } DENOriginatingEntry_t;
+
+    typedef struct _denReceivingEntry {
+      ITSSReceivingTableEntry entry;
+      uint64_t validityGeneration; //! Set to a new value when T_R_Validity is (re)started
+    } DENReceivingEntry_t;
+
+    static uint64_t actionIDKey(unsigned long stationID,long sequenceNumber) {return (((uint64_t) stationID) << 32) | (((uint64_t) sequenceNumber) & 0xFFFFFFFF);}
+
+    void setupTimers();
+    void startOriginatingTimers(DENOriginatingEntry_t &entry,uint64_t key,denData &data);
+    void stopOriginatingTimers(DENOriginatingEntry_t &entry);
+    void timerExpired(const DENTimerItem_t &item);
+
+    void T_O_ValidityStop(uint64_t key);
+    void T_RepetitionStop(uint64_t key);
+    void T_R_ValidityStop(uint64_t key);
 
     std::function<void(denData,Address)> m_DENReceiveCallback;
     std::function<void(denData,Address,unsigned long,long)> m_DENReceiveCallbackExtended;
@@ -97,14 +123,19 @@ namespace ns3 {
     Ptr<btp> m_btp;
 
     GeoArea_t m_geoArea;
+    int16_t m_GNMaxHL;
 
     Ptr<Socket> m_socket_tx; // Socket TX
 
-    std::map<std::pair<unsigned long,long>,ITSSOriginatingTableEntry> m_originatingITSSTable;
-    std::map<std::pair<unsigned long,long>,ITSSReceivingTableEntry> m_receivingITSSTable;
+    // Originating and receiving ITS-S message tables, indexed by actionIDKey()
+    std::unordered_map<uint64_t,DENOriginatingEntry_t> m_originatingITSSTable;
+    std::unordered_map<uint64_t,DENReceivingEntry_t> m_receivingITSSTable;
 
-    std::map<std::pair<unsigned long,long>,std::tuple<Timer,Timer,Timer>> m_originatingTimerTable;
-    std::map<std::pair<unsigned long,long>,Timer> m_T_R_Validity_Table;
+    // T_O_Validity, T_Repetition (stopped by T_RepetitionDuration) and T_R_Validity of all the entries
+    TimingWheel<DENTimerItem_t> m_timers;
+    // Timer generations are drawn from a counter shared by all the entries: an entry erased at the expiration of its
+    // validity and then created again never reuses the generation of a timer still stored in the wheel
+    uint64_t m_timer_generation;
 
     /* den_data private fillers (ASN.1 types), used within "receiveDENM" */
     void fillDenDataHeader(asn1cpp::Seq<ItsPduHeader> denm_header, denData &denm_data);
@@ -112,14 +143,6 @@ namespace ns3 {
     void fillDenDataSituation(asn1cpp::Seq<SituationContainer> denm_situation_container, denData &denm_data);
     void fillDenDataLocation(asn1cpp::Seq<LocationContainer> denm_location_container, denData &denm_data);
     void fillDenDataAlacarte(asn1cpp::Seq<AlacarteContainer> denm_alacarte_container, denData &denm_data);
-
-    /*
-    * Mutex to protect m_originatingITSSTable when appDENM_update() and the callback for the expiration of the T_Repetion timer may try to
-    * access the map concurrently, resulting in a thread-unsafe code.
-    */
-    std::mutex T_Repetition_Mutex;
-
-    std::queue<void *> m_ptr_queue;
   };
 
 }
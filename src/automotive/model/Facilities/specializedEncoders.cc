@@ -0,0 +1,521 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "specializedEncoders.h"
+
+namespace ns3
+{
+  namespace
+  {
+    /* ASN.1 constraints of the CAM/CPM fields (ETSI TS 102 894-2, EN 302 637-2 and TR 103 562), as in the asn1c-generated code */
+    typedef UperConstrained<0,255> ProtocolVersionC;
+    typedef UperConstrained<0,255> MessageIDC;
+    typedef UperConstrained<0,4294967295LL> StationIDC;
+    typedef UperConstrained<0,65535> GenerationDeltaTimeC;
+    typedef UperConstrained<0,255> StationTypeC;
+    typedef UperConstrained<-900000000,900000001> LatitudeC;
+    typedef UperConstrained<-1800000000,1800000001> LongitudeC;
+    typedef UperConstrained<0,4095> SemiAxisLengthC;
+    typedef UperConstrained<0,3601> HeadingValueC;
+    typedef UperConstrained<-100000,800001> AltitudeValueC;
+    typedef UperConstrained<0,15> AltitudeConfidenceC;
+    typedef UperConstrained<1,127> HeadingConfidenceC;
+    typedef UperConstrained<0,16383> SpeedValueC;
+    typedef UperConstrained<1,127> SpeedConfidenceC;
+    typedef UperConstrained<0,2> DriveDirectionC;
+    typedef UperConstrained<1,1023> VehicleLengthValueC;
+    typedef UperConstrained<0,4> VehicleLengthConfidenceIndicationC;
+    typedef UperConstrained<1,62> VehicleWidthC;
+    typedef UperConstrained<-160,161> LongitudinalAccelerationValueC;
+    typedef UperConstrained<0,102> AccelerationConfidenceC;
+    typedef UperConstrained<-1023,1023> CurvatureValueC;
+    typedef UperConstrained<0,7> CurvatureConfidenceC;
+    typedef UperConstrained<0,2> CurvatureCalculationModeC; // Extensible: preceded by one extension bit
+    typedef UperConstrained<-32766,32767> YawRateValueC;
+    typedef UperConstrained<0,8> YawRateConfidenceC;
+    typedef UperConstrained<-1,14> LanePositionC;
+
+    typedef UperConstrained<0,255> IdentifierC;
+    typedef UperConstrained<-1500,1500> TimeOfMeasurementC;
+    typedef UperConstrained<0,101> ObjectConfidenceC;
+    typedef UperConstrained<-132768,132767> DistanceValueC;
+    typedef UperConstrained<0,102> DistanceConfidenceC;
+    typedef UperConstrained<-16383,16383> SpeedValueExtendedC;
+    typedef UperConstrained<0,3601> CartesianAngleValueC;
+    typedef UperConstrained<1,127> AngleConfidenceC;
+    typedef UperConstrained<0,1023> ObjectDimensionValueC;
+    typedef UperConstrained<0,102> ObjectDimensionConfidenceC;
+    typedef UperConstrained<0,8> ObjectRefPointC;
+    typedef UperConstrained<0,255> NumberOfPerceivedObjectsC;
+    typedef UperConstrained<1,128> ContainerSizeC; // SIZE(1..128,...): preceded by one extension bit
+    typedef UperConstrained<0,15> SensorTypeC;
+    typedef UperConstrained<0,255> RefPointIdC;
+    typedef UperConstrained<-5000,0> XSensorOffsetC;
+    typedef UperConstrained<-1000,1000> YSensorOffsetC;
+    typedef UperConstrained<1,10> VehicleSensorPropertyListSizeC;
+    typedef UperConstrained<0,10000> RangeC;
+
+    /* Bit offsets of each field inside the mandatory vehicle CAM */
+    constexpr size_t CAM_OFF_PROTOCOLVERSION = 0;
+    constexpr size_t CAM_OFF_MESSAGEID = CAM_OFF_PROTOCOLVERSION + ProtocolVersionC::bits;
+    constexpr size_t CAM_OFF_STATIONID = CAM_OFF_MESSAGEID + MessageIDC::bits;
+    constexpr size_t CAM_OFF_GENDELTATIME = CAM_OFF_STATIONID + StationIDC::bits;
+    // CamParameters: extension bit + presence bits of lowFrequencyContainer and specialVehicleContainer
+    constexpr size_t CAM_OFF_CAMPARAMETERS = CAM_OFF_GENDELTATIME + GenerationDeltaTimeC::bits;
+    // BasicContainer: extension bit
+    constexpr size_t CAM_OFF_BASICCONTAINER = CAM_OFF_CAMPARAMETERS + 3;
+    constexpr size_t CAM_OFF_STATIONTYPE = CAM_OFF_BASICCONTAINER + 1;
+    constexpr size_t CAM_OFF_LATITUDE = CAM_OFF_STATIONTYPE + StationTypeC::bits;
+    constexpr size_t CAM_OFF_LONGITUDE = CAM_OFF_LATITUDE + LatitudeC::bits;
+    constexpr size_t CAM_OFF_SEMIMAJORCONF = CAM_OFF_LONGITUDE + LongitudeC::bits;
+    constexpr size_t CAM_OFF_SEMIMINORCONF = CAM_OFF_SEMIMAJORCONF + SemiAxisLengthC::bits;
+    constexpr size_t CAM_OFF_SEMIMAJORORIENT = CAM_OFF_SEMIMINORCONF + SemiAxisLengthC::bits;
+    constexpr size_t CAM_OFF_ALTITUDEVALUE = CAM_OFF_SEMIMAJORORIENT + HeadingValueC::bits;
+    constexpr size_t CAM_OFF_ALTITUDECONF = CAM_OFF_ALTITUDEVALUE + AltitudeValueC::bits;
+    // HighFrequencyContainer: extension bit + choice index (always basicVehicleContainerHighFrequency, i.e. 0)
+    constexpr size_t CAM_OFF_HFCONTAINER = CAM_OFF_ALTITUDECONF + AltitudeConfidenceC::bits;
+    // BasicVehicleContainerHighFrequency: presence bits of the 7 optional fields (always absent)
+    constexpr size_t CAM_OFF_BVCHF = CAM_OFF_HFCONTAINER + 2;
+    constexpr size_t CAM_OFF_HEADINGVALUE = CAM_OFF_BVCHF + 7;
+    constexpr size_t CAM_OFF_HEADINGCONF = CAM_OFF_HEADINGVALUE + HeadingValueC::bits;
+    constexpr size_t CAM_OFF_SPEEDVALUE = CAM_OFF_HEADINGCONF + HeadingConfidenceC::bits;
+    constexpr size_t CAM_OFF_SPEEDCONF = CAM_OFF_SPEEDVALUE + SpeedValueC::bits;
+    constexpr size_t CAM_OFF_DRIVEDIRECTION = CAM_OFF_SPEEDCONF + SpeedConfidenceC::bits;
+    constexpr size_t CAM_OFF_VEHICLELENGTHVALUE = CAM_OFF_DRIVEDIRECTION + DriveDirectionC::bits;
+    constexpr size_t CAM_OFF_VEHICLELENGTHCONF = CAM_OFF_VEHICLELENGTHVALUE + VehicleLengthValueC::bits;
+    constexpr size_t CAM_OFF_VEHICLEWIDTH = CAM_OFF_VEHICLELENGTHCONF + VehicleLengthConfidenceIndicationC::bits;
+    constexpr size_t CAM_OFF_LONGACCVALUE = CAM_OFF_VEHICLEWIDTH + VehicleWidthC::bits;
+    constexpr size_t CAM_OFF_LONGACCCONF = CAM_OFF_LONGACCVALUE + LongitudinalAccelerationValueC::bits;
+    constexpr size_t CAM_OFF_CURVATUREVALUE = CAM_OFF_LONGACCCONF + AccelerationConfidenceC::bits;
+    constexpr size_t CAM_OFF_CURVATURECONF = CAM_OFF_CURVATUREVALUE + CurvatureValueC::bits;
+    constexpr size_t CAM_OFF_CURVATURECALCMODE = CAM_OFF_CURVATURECONF + CurvatureConfidenceC::bits;
+    constexpr size_t CAM_OFF_YAWRATEVALUE = CAM_OFF_CURVATURECALCMODE + 1 + CurvatureCalculationModeC::bits;
+    constexpr size_t CAM_OFF_YAWRATECONF = CAM_OFF_YAWRATEVALUE + YawRateValueC::bits;
+    constexpr size_t CAM_TOTAL_BITS = CAM_OFF_YAWRATECONF + YawRateConfidenceC::bits;
+    // Optional lanePosition: as accelerationControl is never present, it is encoded right after the yawRate
+    constexpr size_t CAM_OFF_LANEPOSITION_PRESENCE = CAM_OFF_BVCHF + 1;
+    constexpr size_t CAM_OFF_LANEPOSITION = CAM_TOTAL_BITS;
+    constexpr size_t CAM_TOTAL_BITS_LANEPOSITION = CAM_OFF_LANEPOSITION + LanePositionC::bits;
+
+    template <class T>
+    inline bool
+    patch(uint8_t *buf, size_t offset, long long value)
+    {
+      if(!T::inRange(value))
+        {
+          return false;
+        }
+      UperBitWriter::patchBits(buf,offset,(uint64_t)(value-T::lb),T::bits);
+      return true;
+    }
+  }
+
+  void
+  UperBitWriter::putBits(uint64_t value, unsigned int nbits)
+  {
+    while(nbits>0)
+      {
+        size_t bit_in_byte = m_bits%8;
+
+        if(bit_in_byte==0)
+          {
+            m_buf.push_back(0);
+          }
+
+        unsigned int free_bits = 8-bit_in_byte;
+        unsigned int n = nbits<free_bits ? nbits : free_bits;
+        uint8_t chunk = (uint8_t) ((value >> (nbits-n)) & ((1U<<n)-1));
+
+        m_buf.back() |= (uint8_t) (chunk << (free_bits-n));
+
+        m_bits+=n;
+        nbits-=n;
+      }
+  }
+
+  void
+  UperBitWriter::append(const UperBitWriter &other)
+  {
+    size_t full_bytes = other.m_bits/8;
+
+    if(m_bits%8==0)
+      {
+        // Fast path: octet-aligned copy
+        m_buf.insert(m_buf.end(),other.m_buf.begin(),other.m_buf.begin()+full_bytes);
+        m_bits+=full_bytes*8;
+      }
+    else
+      {
+        for(size_t i=0;i<full_bytes;i++)
+          {
+            putBits(other.m_buf[i],8);
+          }
+      }
+
+    unsigned int remaining = other.m_bits%8;
+    if(remaining>0)
+      {
+        putBits(other.m_buf[full_bytes]>>(8-remaining),remaining);
+      }
+  }
+
+  std::string
+  UperBitWriter::str() const
+  {
+    // A complete UPER encoding is always at least one octet long (X.691, 11.1)
+    if(m_buf.empty())
+      {
+        return std::string(1,'\0');
+      }
+
+    return std::string(m_buf.begin(),m_buf.end());
+  }
+
+  void
+  UperBitWriter::patchBits(uint8_t *buf, size_t offset, uint64_t value, unsigned int nbits)
+  {
+    while(nbits>0)
+      {
+        size_t byte = offset/8;
+        unsigned int free_bits = 8-offset%8;
+        unsigned int n = nbits<free_bits ? nbits : free_bits;
+        uint8_t mask = (uint8_t) (((1U<<n)-1) << (free_bits-n));
+        uint8_t chunk = (uint8_t) ((value >> (nbits-n)) & ((1U<<n)-1));
+
+        buf[byte] = (uint8_t) ((buf[byte] & ~mask) | (chunk << (free_bits-n)));
+
+        offset+=n;
+        nbits-=n;
+      }
+  }
+
+  CAMSkeletonEncoder::CAMSkeletonEncoder()
+  {
+    static_assert(CAM_TOTAL_BITS<=m_encoded_bytes*8 && CAM_TOTAL_BITS>(m_encoded_bytes-1)*8,
+                  "Wrong size of the mandatory CAM skeleton");
+    static_assert(CAM_TOTAL_BITS_LANEPOSITION<=m_encoded_bytes*8,
+                  "The lanePosition does not fit in the mandatory CAM skeleton");
+
+    m_static = {};
+    m_valid = false;
+  }
+
+  bool
+  CAMSkeletonEncoder::setStaticData(const CAM_static_data_t &data)
+  {
+    if(m_valid && data.stationID==m_static.stationID && data.stationType==m_static.stationType &&
+       data.vehicleLengthValue==m_static.vehicleLengthValue && data.vehicleLengthConfidence==m_static.vehicleLengthConfidence &&
+       data.vehicleWidth==m_static.vehicleWidth)
+      {
+        return true;
+      }
+
+    m_static = data;
+    m_skeleton.assign(m_encoded_bytes,'\0');
+
+    uint8_t *buf = (uint8_t *) &m_skeleton[0];
+
+    // The extension bits, the presence bits and the choice index are all equal to 0, as in the zeroed buffer
+    m_valid = patch<ProtocolVersionC>(buf,CAM_OFF_PROTOCOLVERSION,2) && // protocolVersion_currentVersion
+              patch<MessageIDC>(buf,CAM_OFF_MESSAGEID,2) && // FIX_CAMID
+              patch<StationIDC>(buf,CAM_OFF_STATIONID,data.stationID) &&
+              patch<StationTypeC>(buf,CAM_OFF_STATIONTYPE,data.stationType) &&
+              patch<VehicleLengthValueC>(buf,CAM_OFF_VEHICLELENGTHVALUE,data.vehicleLengthValue) &&
+              patch<VehicleLengthConfidenceIndicationC>(buf,CAM_OFF_VEHICLELENGTHCONF,data.vehicleLengthConfidence) &&
+              patch<VehicleWidthC>(buf,CAM_OFF_VEHICLEWIDTH,data.vehicleWidth);
+
+    return m_valid;
+  }
+
+  bool
+  CAMSkeletonEncoder::encode(const CAM_dynamic_data_t &data, std::string &encoded) const
+  {
+    if(!m_valid)
+      {
+        return false;
+      }
+
+    uint8_t buf[m_encoded_bytes];
+    std::copy(m_skeleton.begin(),m_skeleton.end(),buf);
+
+    bool ok = patch<GenerationDeltaTimeC>(buf,CAM_OFF_GENDELTATIME,data.generationDeltaTime) &&
+              patch<LatitudeC>(buf,CAM_OFF_LATITUDE,data.latitude) &&
+              patch<LongitudeC>(buf,CAM_OFF_LONGITUDE,data.longitude) &&
+              patch<SemiAxisLengthC>(buf,CAM_OFF_SEMIMAJORCONF,data.semiMajorConfidence) &&
+              patch<SemiAxisLengthC>(buf,CAM_OFF_SEMIMINORCONF,data.semiMinorConfidence) &&
+              patch<HeadingValueC>(buf,CAM_OFF_SEMIMAJORORIENT,data.semiMajorOrientation) &&
+              patch<AltitudeValueC>(buf,CAM_OFF_ALTITUDEVALUE,data.altitudeValue) &&
+              patch<AltitudeConfidenceC>(buf,CAM_OFF_ALTITUDECONF,data.altitudeConfidence) &&
+              patch<HeadingValueC>(buf,CAM_OFF_HEADINGVALUE,data.headingValue) &&
+              patch<HeadingConfidenceC>(buf,CAM_OFF_HEADINGCONF,data.headingConfidence) &&
+              patch<SpeedValueC>(buf,CAM_OFF_SPEEDVALUE,data.speedValue) &&
+              patch<SpeedConfidenceC>(buf,CAM_OFF_SPEEDCONF,data.speedConfidence) &&
+              patch<DriveDirectionC>(buf,CAM_OFF_DRIVEDIRECTION,data.driveDirection) &&
+              patch<LongitudinalAccelerationValueC>(buf,CAM_OFF_LONGACCVALUE,data.longAccelerationValue) &&
+              patch<AccelerationConfidenceC>(buf,CAM_OFF_LONGACCCONF,data.longAccelerationConfidence) &&
+              patch<CurvatureValueC>(buf,CAM_OFF_CURVATUREVALUE,data.curvatureValue) &&
+              patch<CurvatureConfidenceC>(buf,CAM_OFF_CURVATURECONF,data.curvatureConfidence) &&
+              // The extension bit before the curvatureCalculationMode is already 0 in the skeleton
+              patch<CurvatureCalculationModeC>(buf,CAM_OFF_CURVATURECALCMODE+1,data.curvatureCalculationMode) &&
+              patch<YawRateValueC>(buf,CAM_OFF_YAWRATEVALUE,data.yawRateValue) &&
+              patch<YawRateConfidenceC>(buf,CAM_OFF_YAWRATECONF,data.yawRateConfidence);
+
+    if(ok && data.lanePositionAvailable)
+      {
+        UperBitWriter::patchBits(buf,CAM_OFF_LANEPOSITION_PRESENCE,1,1);
+        ok = patch<LanePositionC>(buf,CAM_OFF_LANEPOSITION,data.lanePosition);
+      }
+
+    if(!ok)
+      {
+        return false;
+      }
+
+    encoded.assign((char *) buf,m_encoded_bytes);
+    return true;
+  }
+
+  CPMSkeletonEncoder::CPMSkeletonEncoder()
+  {
+    m_static = {};
+    m_valid = false;
+    m_static_set = false;
+  }
+
+  bool
+  CPMSkeletonEncoder::setStaticData(const CPM_static_data_t &data)
+  {
+    bool sensors_equal = data.sensors.size()==m_static.sensors.size();
+
+    for(size_t i=0;sensors_equal && i<data.sensors.size();i++)
+      {
+        const CPM_vehicle_sensor_t &a = data.sensors[i];
+        const CPM_vehicle_sensor_t &b = m_static.sensors[i];
+
+        sensors_equal = a.sensorID==b.sensorID && a.type==b.type && a.refPointId==b.refPointId &&
+                        a.xSensorOffset==b.xSensorOffset && a.ySensorOffset==b.ySensorOffset && a.range==b.range &&
+                        a.horizontalOpeningAngleStart==b.horizontalOpeningAngleStart &&
+                        a.horizontalOpeningAngleEnd==b.horizontalOpeningAngleEnd;
+      }
+
+    if(m_static_set && sensors_equal && data.stationID==m_static.stationID && data.stationType==m_static.stationType &&
+       data.vehicleLengthValue==m_static.vehicleLengthValue && data.vehicleLengthConfidence==m_static.vehicleLengthConfidence &&
+       data.vehicleWidth==m_static.vehicleWidth)
+      {
+        return m_valid;
+      }
+
+    m_static = data;
+    m_static_set = true;
+
+    m_header.clear();
+    m_stationType.clear();
+    m_vehicleDimensions.clear();
+    m_sensorInformationContainer.clear();
+
+    m_valid = m_header.put<ProtocolVersionC>(1) &&
+              m_header.put<MessageIDC>(14) && // ItsPduHeader__messageID_cpm
+              m_header.put<StationIDC>(data.stationID) &&
+              m_stationType.put<StationTypeC>(data.stationType) &&
+              m_vehicleDimensions.put<VehicleLengthValueC>(data.vehicleLengthValue) &&
+              m_vehicleDimensions.put<VehicleLengthConfidenceIndicationC>(data.vehicleLengthConfidence) &&
+              m_vehicleDimensions.put<VehicleWidthC>(data.vehicleWidth);
+
+    if(!m_valid)
+      {
+        return false;
+      }
+
+    // SensorInformationContainer: SIZE(1..128,...)
+    if(!data.sensors.empty())
+      {
+        m_sensorInformationContainer.putBits(0,1);
+        m_valid = m_sensorInformationContainer.put<ContainerSizeC>(data.sensors.size());
+
+        for(size_t i=0;m_valid && i<data.sensors.size();i++)
+          {
+            const CPM_vehicle_sensor_t &sensor = data.sensors[i];
+
+            // SensorInformation: extension bit + presence of freeSpaceConfidence
+            m_sensorInformationContainer.putBits(0,2);
+            m_valid = m_sensorInformationContainer.put<IdentifierC>(sensor.sensorID) &&
+                      m_sensorInformationContainer.put<SensorTypeC>(sensor.type);
+
+            // DetectionArea: extension bit + choice index (vehicleSensor, i.e. 0)
+            m_sensorInformationContainer.putBits(0,1+3);
+
+            // VehicleSensor: extension bit + presence of refPointId (DEFAULT 0) and zSensorOffset
+            m_sensorInformationContainer.putBits(0,1);
+            m_sensorInformationContainer.putBits(sensor.refPointId!=0 ? 1 : 0,1);
+            m_sensorInformationContainer.putBits(0,1);
+            if(sensor.refPointId!=0)
+              {
+                m_valid = m_valid && m_sensorInformationContainer.put<RefPointIdC>(sensor.refPointId);
+              }
+            m_valid = m_valid &&
+                      m_sensorInformationContainer.put<XSensorOffsetC>(sensor.xSensorOffset) &&
+                      m_sensorInformationContainer.put<YSensorOffsetC>(sensor.ySensorOffset) &&
+                      // One VehicleSensorProperties entry
+                      m_sensorInformationContainer.put<VehicleSensorPropertyListSizeC>(1);
+
+            // VehicleSensorProperties: extension bit + presence of the vertical opening angles
+            m_sensorInformationContainer.putBits(0,3);
+            m_valid = m_valid &&
+                      m_sensorInformationContainer.put<RangeC>(sensor.range) &&
+                      m_sensorInformationContainer.put<CartesianAngleValueC>(sensor.horizontalOpeningAngleStart) &&
+                      m_sensorInformationContainer.put<CartesianAngleValueC>(sensor.horizontalOpeningAngleEnd);
+          }
+      }
+
+    return m_valid;
+  }
+
+  bool
+  CPMSkeletonEncoder::encodePerceivedObject(const CPM_perceived_object_t &po)
+  {
+    // PerceivedObject: extension bit + presence bits of the 16 optional (or DEFAULT) fields
+    // Only objectConfidence (DEFAULT 0), yawAngle, planarObjectDimension1/2 and objectRefPoint (DEFAULT 0) are used
+    m_writer.putBits(0,1);
+    m_writer.putBits(0,2); // sensorIDList, objectAge
+    m_writer.putBits(po.objectConfidence!=0 ? 1 : 0,1);
+    m_writer.putBits(0,5); // zDistance, zSpeed, xAcceleration, yAcceleration, zAcceleration
+    m_writer.putBits(0x7,3); // yawAngle, planarObjectDimension1, planarObjectDimension2
+    m_writer.putBits(0,1); // verticalObjectDimension
+    m_writer.putBits(po.objectRefPoint!=0 ? 1 : 0,1);
+    m_writer.putBits(0,3); // dynamicStatus, classification, matchedPosition
+
+    return m_writer.put<IdentifierC>(po.objectID) &&
+           m_writer.put<TimeOfMeasurementC>(po.timeOfMeasurement) &&
+           (po.objectConfidence==0 || m_writer.put<ObjectConfidenceC>(po.objectConfidence)) &&
+           m_writer.put<DistanceValueC>(po.xDistanceValue) &&
+           m_writer.put<DistanceConfidenceC>(po.xDistanceConfidence) &&
+           m_writer.put<DistanceValueC>(po.yDistanceValue) &&
+           m_writer.put<DistanceConfidenceC>(po.yDistanceConfidence) &&
+           m_writer.put<SpeedValueExtendedC>(po.xSpeedValue) &&
+           m_writer.put<SpeedConfidenceC>(po.xSpeedConfidence) &&
+           m_writer.put<SpeedValueExtendedC>(po.ySpeedValue) &&
+           m_writer.put<SpeedConfidenceC>(po.ySpeedConfidence) &&
+           m_writer.put<CartesianAngleValueC>(po.yawAngleValue) &&
+           m_writer.put<AngleConfidenceC>(po.yawAngleConfidence) &&
+           m_writer.put<ObjectDimensionValueC>(po.planarObjectDimension1Value) &&
+           m_writer.put<ObjectDimensionConfidenceC>(po.planarObjectDimension1Confidence) &&
+           m_writer.put<ObjectDimensionValueC>(po.planarObjectDimension2Value) &&
+           m_writer.put<ObjectDimensionConfidenceC>(po.planarObjectDimension2Confidence) &&
+           (po.objectRefPoint==0 || m_writer.put<ObjectRefPointC>(po.objectRefPoint));
+  }
+
+  bool
+  CPMSkeletonEncoder::encode(const CPM_dynamic_data_t &data, std::string &encoded)
+  {
+    // Extended SIZE encodings (more than 128 perceived objects) are not supported by the specialized encoder
+    if(!m_valid || data.perceivedObjects.size()>ContainerSizeC::ub)
+      {
+        return false;
+      }
+
+    bool sensorInfo = data.sensorInformationContainer && !m_static.sensors.empty();
+    bool poc = !data.perceivedObjects.empty();
+
+    m_writer.clear();
+    m_writer.reserve(64+data.perceivedObjects.size()*24);
+
+    m_writer.append(m_header);
+    if(!m_writer.put<GenerationDeltaTimeC>(data.generationDeltaTime))
+      {
+        return false;
+      }
+
+    // CpmParameters: extension bit + presence bits of stationDataContainer, sensorInformationContainer,
+    // perceivedObjectContainer and freeSpaceAddendumContainer
+    m_writer.putBits(0,1);
+    m_writer.putBits(1,1);
+    m_writer.putBits(sensorInfo ? 1 : 0,1);
+    m_writer.putBits(poc ? 1 : 0,1);
+    m_writer.putBits(0,1);
+
+    // CpmManagementContainer: extension bit + presence of perceivedObjectContainerSegmentInfo
+    m_writer.putBits(0,2);
+    m_writer.append(m_stationType);
+
+    bool ok = m_writer.put<LatitudeC>(data.latitude) &&
+              m_writer.put<LongitudeC>(data.longitude) &&
+              m_writer.put<SemiAxisLengthC>(data.semiMajorConfidence) &&
+              m_writer.put<SemiAxisLengthC>(data.semiMinorConfidence) &&
+              m_writer.put<HeadingValueC>(data.semiMajorOrientation) &&
+              m_writer.put<AltitudeValueC>(data.altitudeValue) &&
+              m_writer.put<AltitudeConfidenceC>(data.altitudeConfidence);
+
+    if(!ok)
+      {
+        return false;
+      }
+
+    // StationDataContainer: extension bit + choice index (originatingVehicleContainer, i.e. 0)
+    m_writer.putBits(0,2);
+
+    // OriginatingVehicleContainer: extension bit + presence bits of the 12 optional (or DEFAULT) fields
+    // vehicleOrientationAngle, driveDirection (DEFAULT 0), longitudinalAcceleration, lateralAcceleration,
+    // verticalAcceleration, yawRate, pitchAngle, rollAngle, vehicleLength, vehicleWidth, vehicleHeight, trailerDataContainer
+    m_writer.putBits(0,2);
+    m_writer.putBits(data.driveDirection!=0 ? 1 : 0,1);
+    m_writer.putBits(0x93,8); // 1 0 0 1 0 0 1 1
+    m_writer.putBits(0,2);
+
+    ok = m_writer.put<HeadingValueC>(data.headingValue) &&
+         m_writer.put<HeadingConfidenceC>(data.headingConfidence) &&
+         m_writer.put<SpeedValueC>(data.speedValue) &&
+         m_writer.put<SpeedConfidenceC>(data.speedConfidence) &&
+         (data.driveDirection==0 || m_writer.put<DriveDirectionC>(data.driveDirection)) &&
+         m_writer.put<LongitudinalAccelerationValueC>(data.longAccelerationValue) &&
+         m_writer.put<AccelerationConfidenceC>(data.longAccelerationConfidence) &&
+         m_writer.put<YawRateValueC>(data.yawRateValue) &&
+         m_writer.put<YawRateConfidenceC>(data.yawRateConfidence);
+
+    if(!ok)
+      {
+        return false;
+      }
+
+    m_writer.append(m_vehicleDimensions);
+
+    if(sensorInfo)
+      {
+        m_writer.append(m_sensorInformationContainer);
+      }
+
+    if(poc)
+      {
+        m_writer.putBits(0,1);
+        m_writer.put<ContainerSizeC>(data.perceivedObjects.size());
+
+        for(size_t i=0;i<data.perceivedObjects.size();i++)
+          {
+            if(!encodePerceivedObject(data.perceivedObjects[i]))
+              {
+                return false;
+              }
+          }
+      }
+
+    if(!m_writer.put<NumberOfPerceivedObjectsC>(data.numberOfPerceivedObjects))
+      {
+        return false;
+      }
+
+    encoded = m_writer.str();
+    return true;
+  }
+}
@@ -0,0 +1,233 @@
+#ifndef SPECIALIZEDENCODERS_H
+#define SPECIALIZEDENCODERS_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+  /* Number of bits needed by UPER to encode a constrained whole number with the given range (X.691, 11.5.7.1) */
+  constexpr unsigned int uperRangeBits(unsigned long long range)
+  {
+    return range==0 ? 0 : 1+uperRangeBits(range>>1);
+  }
+
+  /* Compile-time description of a constrained (non-extensible) INTEGER or ENUMERATED with contiguous values */
+  template <long long LB, long long UB>
+  struct UperConstrained
+  {
+    static constexpr long long lb = LB;
+    static constexpr long long ub = UB;
+    static constexpr unsigned int bits = uperRangeBits((unsigned long long)(UB-LB));
+
+    static bool inRange(long long value) {return value>=LB && value<=UB;}
+  };
+
+  /*
+   * Minimal UPER bit writer, used by the specialized CAM/CPM encoders
+   * Bits are always written MSB first and the final encoding is padded to a whole number of octets,
+   * exactly as done by uper_encode() when encoding a complete PDU
+   */
+  class UperBitWriter
+  {
+    public:
+      UperBitWriter() : m_bits(0) {}
+
+      void reserve(size_t bytes) {m_buf.reserve(bytes);}
+      void clear() {m_buf.clear(); m_bits=0;}
+      size_t bits() const {return m_bits;}
+
+      void putBits(uint64_t value, unsigned int nbits);
+
+      // Returns false (without writing anything) when the value is outside the constraint of T
+      template <class T>
+      bool put(long long value)
+      {
+        if(!T::inRange(value))
+          {
+            return false;
+          }
+        putBits((uint64_t)(value-T::lb),T::bits);
+        return true;
+      }
+
+      // Append all the bits (not necessarily octet-aligned) stored inside another writer
+      void append(const UperBitWriter &other);
+
+      std::string str() const;
+
+      // Overwrite nbits bits starting from bit position 'offset' inside an already encoded buffer
+      static void patchBits(uint8_t *buf, size_t offset, uint64_t value, unsigned int nbits);
+
+    private:
+      std::vector<uint8_t> m_buf;
+      size_t m_bits;
+  };
+
+  /*
+   * Specialized encoder for the mandatory CAM layout of a vehicle, i.e. a CAM with a basicVehicleContainerHighFrequency
+   * without optional fields (except for the lanePosition, which is always provided by VDPTraCI), without low frequency
+   * container and without special vehicle container
+   * Since all the fields of this layout have a fixed size, the whole message has a fixed size too: a skeleton with all
+   * the static fields (header, station type, vehicle length and width) is pre-encoded once per station, and each
+   * encode() call only patches the dynamic fields at their (compile-time) bit offsets
+   * The output is bit-exact with respect to asn1cpp::uper::encode() applied to the same CAM
+   */
+  class CAMSkeletonEncoder
+  {
+    public:
+      typedef struct CAM_static_data {
+        unsigned long stationID;
+        long stationType;
+        long vehicleLengthValue;
+        long vehicleLengthConfidence;
+        long vehicleWidth;
+      } CAM_static_data_t;
+
+      typedef struct CAM_dynamic_data {
+        long generationDeltaTime;
+        long latitude;
+        long longitude;
+        long semiMajorConfidence;
+        long semiMinorConfidence;
+        long semiMajorOrientation;
+        long altitudeValue;
+        long altitudeConfidence;
+        long headingValue;
+        long headingConfidence;
+        long speedValue;
+        long speedConfidence;
+        long driveDirection;
+        long longAccelerationValue;
+        long longAccelerationConfidence;
+        long curvatureValue;
+        long curvatureConfidence;
+        long curvatureCalculationMode;
+        long yawRateValue;
+        long yawRateConfidence;
+        bool lanePositionAvailable;
+        long lanePosition;
+      } CAM_dynamic_data_t;
+
+      CAMSkeletonEncoder();
+
+      // (Re-)build the skeleton only if the static data changed since the last call
+      // It returns false if any static field cannot be encoded
+      bool setStaticData(const CAM_static_data_t &data);
+
+      // It returns false (leaving 'encoded' untouched) if any field is out of its ASN.1 constraints,
+      // i.e. exactly when the generic asn1c encoder would fail
+      bool encode(const CAM_dynamic_data_t &data, std::string &encoded) const;
+
+      bool isValid() const {return m_valid;}
+      static constexpr size_t encodedSize() {return m_encoded_bytes;}
+
+    private:
+      static const size_t m_encoded_bytes = 41;
+
+      CAM_static_data_t m_static;
+      bool m_valid;
+      std::string m_skeleton;
+  };
+
+  /*
+   * Specialized encoder for the CPM layout generated by the CP Basic Service (vehicle originating container with
+   * heading, speed, drive direction, longitudinal acceleration, yaw rate, vehicle length and width, an optional sensor
+   * information container made of vehicle sensors and an optional perceived object container)
+   * The header, the station type, the vehicle dimensions and the whole sensor information container are pre-encoded
+   * once per station, while only the dynamic fields and the perceived objects are written for each message
+   */
+  class CPMSkeletonEncoder
+  {
+    public:
+      typedef struct CPM_vehicle_sensor {
+        long sensorID;
+        long type;
+        long refPointId;
+        long xSensorOffset;
+        long ySensorOffset;
+        long range;
+        long horizontalOpeningAngleStart;
+        long horizontalOpeningAngleEnd;
+      } CPM_vehicle_sensor_t;
+
+      typedef struct CPM_static_data {
+        unsigned long stationID;
+        long stationType;
+        long vehicleLengthValue;
+        long vehicleLengthConfidence;
+        long vehicleWidth;
+        std::vector<CPM_vehicle_sensor_t> sensors;
+      } CPM_static_data_t;
+
+      typedef struct CPM_perceived_object {
+        long objectID;
+        long timeOfMeasurement;
+        long objectConfidence;
+        long xDistanceValue;
+        long xDistanceConfidence;
+        long yDistanceValue;
+        long yDistanceConfidence;
+        long xSpeedValue;
+        long xSpeedConfidence;
+        long ySpeedValue;
+        long ySpeedConfidence;
+        long yawAngleValue;
+        long yawAngleConfidence;
+        long planarObjectDimension1Value;
+        long planarObjectDimension1Confidence;
+        long planarObjectDimension2Value;
+        long planarObjectDimension2Confidence;
+        long objectRefPoint;
+      } CPM_perceived_object_t;
+
+      typedef struct CPM_dynamic_data {
+        long generationDeltaTime;
+        long latitude;
+        long longitude;
+        long semiMajorConfidence;
+        long semiMinorConfidence;
+        long semiMajorOrientation;
+        long altitudeValue;
+        long altitudeConfidence;
+        long headingValue;
+        long headingConfidence;
+        long speedValue;
+        long speedConfidence;
+        long driveDirection;
+        long longAccelerationValue;
+        long longAccelerationConfidence;
+        long yawRateValue;
+        long yawRateConfidence;
+        bool sensorInformationContainer;
+        long numberOfPerceivedObjects;
+        std::vector<CPM_perceived_object_t> perceivedObjects;
+      } CPM_dynamic_data_t;
+
+      CPMSkeletonEncoder();
+
+      bool setStaticData(const CPM_static_data_t &data);
+      bool encode(const CPM_dynamic_data_t &data, std::string &encoded);
+
+      bool isValid() const {return m_valid;}
+
+    private:
+      bool encodePerceivedObject(const CPM_perceived_object_t &po);
+
+      CPM_static_data_t m_static;
+      bool m_valid;
+      bool m_static_set;
+
+      // Pre-encoded static parts
+      UperBitWriter m_header;
+      UperBitWriter m_stationType;
+      UperBitWriter m_vehicleDimensions;
+      UperBitWriter m_sensorInformationContainer;
+
+      // Writer reused across messages, to avoid re-allocating its buffer every time
+      UperBitWriter m_writer;
+  };
+}
+
+#endif // SPECIALIZEDENCODERS_H
@@ -60,6 +60,9 @@ namespace ns3 {
     m_PRRSupervisor_ptr = NULL;
 
     m_PRRsupervisor_beacons = true;
+
+    m_GNLocT.setLifetime (Seconds (m_GnLifeTimeLocTE));
+    m_GNLocT.setDPLLength (m_GnDPLLength);
   }
 
   void
@@ -67,6 +70,10 @@ namespace ns3 {
   {
     Simulator::Cancel(m_event_EPVupdate);
     Simulator::Cancel(m_event_Beacon);
+    m_GNLocT.clear ();
+    cleanCBFBuffer ();
+    if (m_dcc)
+      m_dcc->cleanup ();
     if (m_socket_tx)
       m_socket_tx->ShutdownRecv ();
   }
@@ -130,6 +137,13 @@ namespace ns3 {
     m_GnLocalGnAddr = getGNMac48(m_socket_tx->GetNode ()->GetDevice (0)->GetAddress ());
   }
 
+  void
+  GeoNet::setDCC(Ptr<DCC> dcc)
+  {
+    m_dcc = dcc;
+    m_dcc->setTransmitCallback (std::bind(&GeoNet::sendPDU,this,std::placeholders::_1,std::placeholders::_2));
+  }
+
   void
   GeoNet::setBeacon ()
   {
@@ -329,10 +343,27 @@ namespace ns3 {
     return dataConfirm;
   }
 
+  PRRMessageType_t
+  GeoNet::PRRMessageType (GNDataRequest_t dataRequest)
+  {
+    uint8_t port[2];
+
+    // The PRR Supervisor classifies the messages according to the BTP destination port (the first field of both
+    // BTP-A and BTP-B headers)
+    if(m_PRRSupervisor_ptr==nullptr || (dataRequest.upperProtocol!=BTP_A && dataRequest.upperProtocol!=BTP_B) ||
+       dataRequest.data->CopyData (port,2)<2)
+      {
+        return PRR_MSG_OTHER;
+      }
+
+    return PRRSupervisor::messageTypeFromBTPPort ((port[0] << 8) | port[1]);
+  }
+
   GNDataConfirm_t
   GeoNet::sendSHB (GNDataRequest_t dataRequest,GNCommonHeader commonHeader, GNBasicHeader basicHeader,GNlpv_t longPV)
   {
     SHBheader header;
+    PRRMessageType_t prrType = PRRMessageType (dataRequest);
     //1) Create SHB GN-PDU with SHB header setting according to ETSI EN 302 636-4-1 [10.3.10.2]
     //a) and b) already done
     //c) SHB extended header
@@ -367,16 +398,10 @@ namespace ns3 {
 
     if(m_PRRSupervisor_ptr!=nullptr)
     {
-      uint8_t *buffer = new uint8_t[dataRequest.data->GetSize ()];
-
-      dataRequest.data->CopyData (buffer,dataRequest.data->GetSize ());
-
-      m_PRRSupervisor_ptr->signalSentPacket (PRRSupervisor::bufToString (buffer,dataRequest.data->GetSize ()),m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id);
-
-      delete[] buffer;
+      m_PRRSupervisor_ptr->signalSentPacket (dataRequest.data,m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id,prrType);
     }
 
-    if(m_socket_tx->Send (dataRequest.data)==-1)
+    if(transmitPDU (dataRequest.data,false,Mac48Address ())==-1)
       {
         NS_LOG_ERROR("Cannot send SHB packet ");
         return UNSPECIFIED_ERROR;
@@ -392,6 +417,7 @@ namespace ns3 {
   GeoNet::sendGBC (GNDataRequest_t dataRequest,GNCommonHeader commonHeader, GNBasicHeader basicHeader,GNlpv_t longPV)
   {
     GBCheader header;
+    PRRMessageType_t prrType = PRRMessageType (dataRequest);
     //1) Create SHB GN-PDU with GBC header setting according to ETSI EN 302 636-4-1 [10.3.11.2]
     //a) and b) already done
     //GBC extended header
@@ -411,13 +437,18 @@ namespace ns3 {
     {
       return UNSUPPORTED_TRA_CLASS;//Not implemented yet
     }
-    //!3)Execute forwarding algorithm selection procedure, not implemented because RSU in our case will always be inside the target area
-    //4) if packet is buffered in any of the forwarding packets, omit further steps
-    if(m_GNAreaForwardingAlgorithm == 2)
-    {
-      /* push packet into CBF buffer */
-      return UNSPECIFIED_ERROR;
+    //3)Execute forwarding algorithm selection procedure as specified in [Annex D]
+    //The source always broadcasts the packet when it is inside the area (simple forwarding and CBF) and when CBF is used
+    //outside of it. Greedy forwarding is used only for multi-hop packets: with a hop limit of 1 the next hop could not
+    //forward the packet anyway, and broadcasting it lets all the neighbours inside the area receive it
+    bool unicast = false;
+    Mac48Address nextHop;
+    if(basicHeader.GetRemainingHL () > 1 && !isInsideGeoArea (dataRequest.GnAddress) &&
+       (m_GNNonAreaForwardingAlgorithm == GN_NONAREA_UNSPECIFIED || m_GNNonAreaForwardingAlgorithm == GN_NONAREA_GREEDY))
+    {
+      unicast = greedyNextHop (dataRequest.GnAddress,nextHop);
     }
+    //!4)The source never buffers packets in the forwarding buffers (SCF is not implemented)
     //!5)Security profile settings not implemented
     //6)If the optional repetition interval paramter in the GN-dataRequest parameter is set
     if(dataRequest.GNRepInt != 0)
@@ -436,16 +467,10 @@ namespace ns3 {
 
     if(m_PRRSupervisor_ptr!=nullptr)
     {
-      uint8_t *buffer = new uint8_t[dataRequest.data->GetSize ()];
-
-      dataRequest.data->CopyData (buffer,dataRequest.data->GetSize ());
-
-      m_PRRSupervisor_ptr->signalSentPacket (PRRSupervisor::bufToString (buffer,dataRequest.data->GetSize ()),m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id);
-
-      delete[] buffer;
+      m_PRRSupervisor_ptr->signalSentPacket (dataRequest.data,m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id,prrType);
     }
 
-    if(m_socket_tx->Send (dataRequest.data)==-1)
+    if(transmitPDU (dataRequest.data,unicast,nextHop)==-1)
     {
       NS_LOG_ERROR("Cannot send GBC packet ");
       return UNSPECIFIED_ERROR;
@@ -484,17 +509,11 @@ namespace ns3 {
 
     if(m_PRRSupervisor_ptr!=nullptr && m_PRRsupervisor_beacons==true)
     {
-      uint8_t *buffer = new uint8_t[dataRequest.data->GetSize ()];
-
-      dataRequest.data->CopyData (buffer,dataRequest.data->GetSize ());
-
-      m_PRRSupervisor_ptr->signalSentPacket (PRRSupervisor::bufToString (buffer,dataRequest.data->GetSize ()),m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id);
-
-      delete[] buffer;
+      m_PRRSupervisor_ptr->signalSentPacket (dataRequest.data,m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,m_station_id,PRR_MSG_BEACON);
     }
 
     //if(!m_GnIsMobile)return ACCEPTED;
-    if(m_socket_tx->Send (dataRequest.data)==-1)
+    if(transmitPDU (dataRequest.data,false,Mac48Address ())==-1)
     {
       NS_LOG_ERROR("Cannot send BEACON packet ");
       return UNSPECIFIED_ERROR;
@@ -508,14 +527,21 @@ namespace ns3 {
 
   bool
   GeoNet::isInsideGeoArea (GeoArea_t geoArea)
+  {
+    if((m_egoPV.POS_EPV.lat==0)||(m_egoPV.POS_EPV.lon==0))return false;//In case egoPV hasnt updated for the first time yet
+
+    return isInsideGeoArea (geoArea,m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon);
+  }
+
+  bool
+  GeoNet::isInsideGeoArea (GeoArea_t geoArea, double lat, double lon)
   {
     //forwarding algorithm selection as specified in  ETSI EN 302 636-4-1 [Annex D]
     //Compute function F specified in ETSI EN 302 931
     double x,y,r,f,geoLon,geoLat;
     VDP::VDP_position_cartesian_t egoPos, geoPos;
-    if((m_egoPV.POS_EPV.lat==0)||(m_egoPV.POS_EPV.lon==0))return false;//In case egoPV hasnt updated for the first time yet
 
-    egoPos = m_vdp->getXY(m_egoPV.POS_EPV.lon,m_egoPV.POS_EPV.lat); //Compute cartesian position of the vehicle
+    egoPos = m_vdp->getXY(lon,lat); //Compute cartesian position of the vehicle
     geoLon = ((double) geoArea.posLong)/DOT_ONE_MICRO;
     geoLat = ((double)geoArea.posLat)/DOT_ONE_MICRO;
     geoPos = m_vdp->getXY(geoLon, geoLat); // Compute cartesian position of the geoArea center
@@ -565,18 +591,12 @@ namespace ns3 {
   GeoNet::hasNeighbour ()
   {
     bool retval = false;
-    m_LocT_Mutex.lock ();
-    std::map<GNAddress,GNLocTE>::iterator locT_it = m_GNLocT.begin ();
-    while(locT_it != m_GNLocT.end ())
-    {
-      if(locT_it->second.IS_NEIGHBOUR)
+    m_GNLocT.forEach ([&retval](GNLocTE &entry) {
+      if(entry.IS_NEIGHBOUR)
       {
         retval = true;
-        break;
       }
-      locT_it++;
-    }
-    m_LocT_Mutex.unlock ();
+    });
     return retval;
   }
 
@@ -636,17 +656,6 @@ namespace ns3 {
 
     dataIndication.data = socket->RecvFrom (from);
 
-    uint8_t *buffer;
-    uint32_t dataSize;
-    if(m_PRRSupervisor_ptr!=nullptr)
-    {
-      buffer = new uint8_t[dataIndication.data->GetSize ()];
-
-      dataSize = dataIndication.data->GetSize ();
-
-      dataIndication.data->CopyData (buffer,dataSize);
-    }
-
     dataIndication.data->RemoveHeader (basicHeader, 4);
     dataIndication.GNRemainingLife = basicHeader.GetLifeTime ();
     dataIndication.GNRemainingHL = basicHeader.GetRemainingHL ();
@@ -684,10 +693,8 @@ namespace ns3 {
     {
         if(dataIndication.GNType!=BEACON || m_PRRsupervisor_beacons==true)
         {
-            m_PRRSupervisor_ptr->signalReceivedPacket (PRRSupervisor::bufToString (buffer,dataSize),m_station_id);
+            m_PRRSupervisor_ptr->signalReceivedPacket (dataIndication.data,m_station_id);
         }
-
-        delete[] buffer;
     }
 
     switch(dataIndication.GNType)
@@ -696,7 +703,7 @@ namespace ns3 {
         if(commonHeader.GetHeaderSubType ()==0) processSHB (dataIndication,from);
         break;
       case GBC:
-          processGBC (dataIndication,from,commonHeader.GetHeaderSubType ());
+          processGBC (dataIndication,from,basicHeader,commonHeader);
         break;
       case TSB:
             if((commonHeader.GetHeaderSubType ()==0)) processSHB (dataIndication,from);
@@ -707,39 +714,57 @@ namespace ns3 {
   }
 
   void
-  GeoNet::processGBC (GNDataIndication_t dataIndication,Address from, uint8_t shape)
+  GeoNet::processGBC (GNDataIndication_t dataIndication,Address from,GNBasicHeader basicHeader,GNCommonHeader commonHeader)
   {
     // GBC Processing according to ETSI EN 302 636-4-1 [10.3.11.3] 1 and 2 already done in receiveGN method
     GBCheader header;
     dataIndication.data->RemoveHeader (header,56);
     dataIndication.SourcePV = header.GetLongPositionV ();
     dataIndication.GnAddressDest = header.GetGeoArea ();
-    dataIndication.GnAddressDest.shape = shape;
+    dataIndication.GnAddressDest.shape = commonHeader.GetHeaderSubType ();
+
+    //A packet originated by this station and re-broadcasted by a forwarder: there is no LocTE for the station itself,
+    //so DPD cannot detect it, and it must be discarded before DAD, the LocT update, the delivery and the forwarding
+    if(dataIndication.SourcePV.GnAddress == m_GNAddress)
+    {
+      NS_LOG_INFO("Own GBC packet received from a forwarder");
+      m_fwd_stats.redundantRebroadcasts++;
+      return;
+    }
+
+    uint64_t sourceKey = GNLocationTable::addressKey (dataIndication.SourcePV.GnAddress);
+    uint16_t seqNumber = header.GetSeqNumber ();
 
     //3)Determine function F as specified in ETSI EN 302 931
-    m_LocT_Mutex.lock ();
-    std::map<GNAddress, GNLocTE>::iterator entry_map_it = m_GNLocT.find(dataIndication.SourcePV.GnAddress);
-    if(entry_map_it != m_GNLocT.end())
+    bool inside = isInsideGeoArea (dataIndication.GnAddressDest);
+    bool cbf = inside ? (m_GNAreaForwardingAlgorithm==GN_AREA_CBF || m_GNAreaForwardingAlgorithm==GN_AREA_ADVANCED) :
+                        (m_GNNonAreaForwardingAlgorithm==GN_NONAREA_CBF);
+
+    //With CBF, a packet received again while it is still buffered means that another router already forwarded it:
+    //stop the CBF timer and discard the buffered copy ([E.3] and [F.3])
+    if(cbf)
     {
-      //a)
-      if((!isInsideGeoArea (dataIndication.GnAddressDest)) && ((m_GNNonAreaForwardingAlgorithm==0)||(m_GNNonAreaForwardingAlgorithm==1)))
+      auto cbf_it = m_CbfBuffer.find (std::make_pair (sourceKey,seqNumber));
+      if(cbf_it != m_CbfBuffer.end ())
       {
-        //execute DPD as specified in A.2
-        if(DPD(header.GetSeqNumber (),dataIndication.SourcePV.GnAddress))
-        {
-          NS_LOG_ERROR("Duplicate received");
-          return;
-        }
+        cbf_it->second.timer.Cancel ();
+        m_CbfBufferBytes -= cbf_it->second.packet->GetSize ();
+        m_CbfBuffer.erase (cbf_it);
+        m_fwd_stats.cbfSuppressed++;
+        m_fwd_stats.redundantRebroadcasts++;
+        return;
       }
-      //b)
-      if((isInsideGeoArea (dataIndication.GnAddressDest)) && ((m_GNAreaForwardingAlgorithm==0)||(m_GNAreaForwardingAlgorithm==1)))
+    }
+
+    GNLocTE *locte = m_GNLocT.find (dataIndication.SourcePV.GnAddress);
+    if(locte != nullptr)
+    {
+      //a) and b) execute DPD as specified in A.2, for any forwarding algorithm
+      if(DPD(seqNumber,locte))
       {
-        //execute DPD as specified in A.2
-        if(DPD(header.GetSeqNumber (),dataIndication.SourcePV.GnAddress))
-        {
-          NS_LOG_ERROR("Duplicate received");
-          return;
-        }
+        NS_LOG_INFO("Duplicate received");
+        m_fwd_stats.redundantRebroadcasts++;
+        return;
       }
     }
     //4) DAD
@@ -751,21 +776,29 @@ namespace ns3 {
       }
     }
     //Check for LocTE existence
-    if (entry_map_it == m_GNLocT.end())
+    if (locte == nullptr)
     {
       //5) If LocTE doesn't exist
-      newLocTE (dataIndication.SourcePV);//a) create PV with the SO PV in the extended header
-      m_GNLocT[dataIndication.SourcePV.GnAddress].IS_NEIGHBOUR = false;//b) Set the IS_NEIGHBOUR flag to FALSE
+      locte = newLocTE (dataIndication.SourcePV);//a) create PV with the SO PV in the extended header
+      locte->IS_NEIGHBOUR = false;//b) Set the IS_NEIGHBOUR flag to FALSE
       //c) PDR not implemented yet
+      locte->DPL.insert (seqNumber);
     }
     else
     {
       //6)If the LocTe exist update LongPV, PDR not implemented yet
-      LocTUpdate (dataIndication.SourcePV,entry_map_it);
+      LocTUpdate (dataIndication.SourcePV,locte);
+    }
+
+    //Keep a copy of the payload for forwarding, before passing it to the upper layers
+    Ptr<Packet> fwdPacket = nullptr;
+    if(basicHeader.GetRemainingHL () > 1)
+    {
+      fwdPacket = dataIndication.data->Copy ();
     }
-    m_LocT_Mutex.unlock ();
+
     //7)Determine function F(x,y) as specified in ETSI EN 302 931
-    if(isInsideGeoArea (dataIndication.GnAddressDest))
+    if(inside)
     {
       //a) Pass the payload to the upper protocol entity
       dataIndication.GNType = GBC;
@@ -774,10 +807,259 @@ namespace ns3 {
     }
     else
     {
-      NS_LOG_INFO("GBC packet discarded because GeoNetworking reported it as out-of-range");
+      NS_LOG_INFO("GBC packet not passed to the upper layers because GeoNetworking reported it as out-of-range");
+    }
+
+    //Position of the previous forwarder (sender), from its LocTE, if available
+    GNLocTE *sender = nullptr;
+    if(PacketSocketAddress::IsMatchingType (from))
+    {
+      sender = m_GNLocT.findByLLAddress (getGNMac48 (PacketSocketAddress::ConvertFrom (from).GetPhysicalAddress ()));
+    }
+    double senderLat = 0, senderLon = 0;
+    if(sender != nullptr)
+    {
+      senderLat = (double) sender->lpv.latitude/DOT_ONE_MICRO;
+      senderLon = (double) sender->lpv.longitude/DOT_ONE_MICRO;
+    }
+
+    double progress = 0;
+    if(!inside)
+    {
+      //A router outside the area does not forward packets coming from a sender inside the area
+      if(sender != nullptr && isInsideGeoArea (dataIndication.GnAddressDest,senderLat,senderLon))
+      {
+        return;
+      }
+
+      //Non-area CBF [E.3]: only a router making progress towards the area with respect to the sender forwards the packet
+      if(cbf && sender != nullptr)
+      {
+        double destLat = (double) dataIndication.GnAddressDest.posLat/DOT_ONE_MICRO;
+        double destLon = (double) dataIndication.GnAddressDest.posLong/DOT_ONE_MICRO;
+        progress = haversineDist (senderLat,senderLon,destLat,destLon) -
+                   haversineDist (m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,destLat,destLon);
+        if(progress <= 0)
+        {
+          m_fwd_stats.cbfNoProgressDrops++;
+          return;
+        }
+      }
+    }
+
+    //The packet would be forwarded, but the RHL reaches zero with the decrement
+    if(fwdPacket == nullptr)
+    {
+      m_fwd_stats.hopLimitDiscards++;
+      return;
+    }
+
+    //8)9) Decrement the RHL and re-build the GN-PDU to be forwarded
+    basicHeader.SetRemainingHL (basicHeader.GetRemainingHL () - 1);
+    fwdPacket->AddHeader (header);
+    fwdPacket->AddHeader (commonHeader);
+    fwdPacket->AddHeader (basicHeader);
+
+    //10)Forwarding algorithm selection procedure as specified in [Annex D]
+    if(inside)
+    {
+      if(!cbf)
+      {
+        //Simple GeoBroadcast forwarding [F.2]
+        sendForwardedGBC (fwdPacket,false,Mac48Address ());
+      }
+      else
+      {
+        //Area CBF [F.3]: the timeout decreases with the distance from the sender
+        //(TO_CBF_MAX if the sender position is unknown)
+        double dist = 0;
+        if(sender != nullptr)
+        {
+          dist = haversineDist (senderLat,senderLon,m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon);
+        }
+        bufferCBF (fwdPacket,sourceKey,seqNumber,dist);
+      }
+    }
+    else
+    {
+      if(!cbf)
+      {
+        //Greedy forwarding [E.2]
+        Mac48Address nextHop;
+        bool unicast = greedyNextHop (dataIndication.GnAddressDest,nextHop);
+        sendForwardedGBC (fwdPacket,unicast,nextHop);
+      }
+      else
+      {
+        //Non-area CBF [E.3]: the timeout decreases with the progress towards the area
+        bufferCBF (fwdPacket,sourceKey,seqNumber,progress);
+      }
+    }
+  }
+
+  bool
+  GeoNet::greedyNextHop (GeoArea_t geoArea, Mac48Address &nextHop)
+  {
+    //Greedy forwarding as specified in ETSI EN 302 636-4-1 [E.2]: select the neighbour with the Most Forward
+    //progress within Radius (MFR) towards the center of the destination area
+    double destLat = (double) geoArea.posLat/DOT_ONE_MICRO;
+    double destLon = (double) geoArea.posLong/DOT_ONE_MICRO;
+    double mfr = haversineDist (m_egoPV.POS_EPV.lat,m_egoPV.POS_EPV.lon,destLat,destLon);
+    bool found = false;
+
+    m_GNLocT.forEach ([&](GNLocTE &entry) {
+      if(!entry.IS_NEIGHBOUR)
+      {
+        return;
+      }
+
+      double dist = haversineDist ((double) entry.lpv.latitude/DOT_ONE_MICRO,(double) entry.lpv.longitude/DOT_ONE_MICRO,destLat,destLon);
+      if(dist < mfr)
+      {
+        mfr = dist;
+        nextHop = entry.LL_ADDR;
+        found = true;
+      }
+    });
+
+    if(found)
+    {
+      m_fwd_stats.greedyUnicasts++;
+    }
+    else
+    {
+      //Local optimum: no neighbour is closer to the destination, broadcast the packet (SCF is not implemented)
+      m_fwd_stats.greedyLocalOptimum++;
+    }
+
+    return found;
+  }
+
+  bool
+  GeoNet::sendForwardedGBC (Ptr<Packet> packet, bool unicast, Mac48Address nextHop)
+  {
+    if(m_socket_tx==NULL)
+    {
+      NS_LOG_ERROR("GeoNet: SOCKET NOT FOUND ");
+      return false;
+    }
+
+    if(transmitPDU (packet,unicast,nextHop)==-1)
+    {
+      NS_LOG_ERROR("Cannot forward GBC packet ");
+      return false;
+    }
+
+    m_fwd_stats.forwardedPackets++;
+    return true;
+  }
+
+  void
+  GeoNet::bufferCBF (Ptr<Packet> packet, uint64_t sourceKey, uint16_t seqNumber, double dist)
+  {
+    //CBF timeout as specified in ETSI EN 302 636-4-1 [E.3] and [F.3]: TO_CBF_MAX for dist=0 (or unknown sender),
+    //linearly decreasing to TO_CBF_MIN for dist=DIST_MAX
+    double timeout_ms = m_GNCbfMinTime;
+    if(dist < m_GnDefaultMaxCommunicationRange)
+    {
+      timeout_ms = m_GNCbfMaxTime + ((double) m_GNCbfMinTime - m_GNCbfMaxTime)/m_GnDefaultMaxCommunicationRange * dist;
+    }
+
+    //Buffer management: drop the oldest packets when the buffer is full
+    uint32_t maxBytes = m_FnCbfPacketBufferSize*1024;
+    while(!m_CbfBuffer.empty () && m_CbfBufferBytes + packet->GetSize () > maxBytes)
+    {
+      auto oldest_it = m_CbfBuffer.begin ();
+      for(auto it = m_CbfBuffer.begin (); it != m_CbfBuffer.end (); it++)
+      {
+        if(it->second.order < oldest_it->second.order)
+        {
+          oldest_it = it;
+        }
+      }
+      oldest_it->second.timer.Cancel ();
+      m_CbfBufferBytes -= oldest_it->second.packet->GetSize ();
+      m_CbfBuffer.erase (oldest_it);
+      m_fwd_stats.cbfBufferDrops++;
+    }
+
+    GNCbfPacket_t cbfPacket;
+    cbfPacket.packet = packet;
+    cbfPacket.order = m_CbfBufferOrder++;
+    cbfPacket.timer = Simulator::Schedule (MicroSeconds ((uint64_t) (timeout_ms*1000)),&GeoNet::CBFTimeout,this,sourceKey,seqNumber);
+
+    m_CbfBuffer[std::make_pair (sourceKey,seqNumber)] = cbfPacket;
+    m_CbfBufferBytes += packet->GetSize ();
+    m_fwd_stats.cbfBuffered++;
+  }
+
+  void
+  GeoNet::CBFTimeout (uint64_t sourceKey, uint16_t seqNumber)
+  {
+    auto cbf_it = m_CbfBuffer.find (std::make_pair (sourceKey,seqNumber));
+    if(cbf_it == m_CbfBuffer.end ())
+    {
+      return;
+    }
+
+    //No other router forwarded the packet before the timer expiration: broadcast it
+    Ptr<Packet> packet = cbf_it->second.packet;
+    m_CbfBufferBytes -= packet->GetSize ();
+    m_CbfBuffer.erase (cbf_it);
+
+    if(sendForwardedGBC (packet,false,Mac48Address ()))
+    {
+      m_fwd_stats.cbfForwarded++;
+    }
+  }
+
+  int
+  GeoNet::transmitPDU (Ptr<Packet> packet, bool unicast, Mac48Address nextHop)
+  {
+    Address dest; //An invalid address means broadcast, through the connected socket
+    Ptr<NetDevice> device = m_socket_tx->GetNode ()->GetDevice (0);
+    //Unicast transmissions are possible only on devices with MAC-48 addresses (e.g. 802.11p); on the other ones the
+    //packet is broadcasted
+    if(unicast && device->GetAddress ().GetLength () == 6)
+    {
+      dest = getGNAddress (device->GetIfIndex (),nextHop);
+    }
+
+    if(m_dcc == nullptr)
+    {
+      return dest.IsInvalid () ? m_socket_tx->Send (packet) : m_socket_tx->SendTo (packet,0,dest);
+    }
+
+    //The DCC gatekeeper needs the lifetime (basic header, byte 2) and the traffic class (common header, byte 2) of
+    //the GN-PDU: read them directly from the serialized headers
+    uint8_t headers[7];
+    packet->CopyData (headers,7);
+    m_dcc->requestTransmission (packet,headers[6],Seconds (decodeLT (headers[2])),dest);
+    return 0;
+  }
+
+  void
+  GeoNet::sendPDU (Ptr<Packet> packet, Address dest)
+  {
+    int send_ret = dest.IsInvalid () ? m_socket_tx->Send (packet) : m_socket_tx->SendTo (packet,0,dest);
+
+    if(send_ret==-1)
+    {
+      NS_LOG_ERROR("Cannot send the GN-PDU released by the DCC gatekeeper");
     }
   }
 
+  void
+  GeoNet::cleanCBFBuffer ()
+  {
+    for(auto &cbf_entry : m_CbfBuffer)
+    {
+      cbf_entry.second.timer.Cancel ();
+    }
+    m_CbfBuffer.clear ();
+    m_CbfBufferBytes = 0;
+  }
+
   bool
   GeoNet::DAD(GNAddress address)
   {
@@ -795,13 +1077,12 @@ namespace ns3 {
   }
 
   bool
-  GeoNet::DPD(uint16_t seqNumber,GNAddress address)
+  GeoNet::DPD(uint16_t seqNumber,GNLocTE *locte)
   {
-    std::set<uint16_t>::iterator it = m_GNLocT[address].DPL.find(seqNumber);
-    if(it == m_GNLocT[address].DPL.end ())
+    if(!locte->DPL.contains (seqNumber))
     {
       //If entry doesnt exist, the packet is not a duplicate and should be added to the list
-      m_GNLocT[address].DPL.insert (seqNumber);
+      locte->DPL.insert (seqNumber);
       return false;
     }
     else
@@ -835,22 +1116,20 @@ namespace ns3 {
       }
     }
     //4)update PV in the SO LocTE with the SO PV fields of the SHB extended header
-    m_LocT_Mutex.lock ();
-    std::map<GNAddress, GNLocTE>::iterator entry_map_it = m_GNLocT.find(dataIndication.SourcePV.GnAddress);
+    GNLocTE *locte = m_GNLocT.find (dataIndication.SourcePV.GnAddress);
 
     //Not specified in the protocol but first check if LocTE exist in the LocTable
-    if (entry_map_it == m_GNLocT.end())
+    if (locte == nullptr)
     {
       newLocTE (dataIndication.SourcePV);
     }
     else
     {
       //Update LongPV
-      LocTUpdate (dataIndication.SourcePV,entry_map_it);
+      LocTUpdate (dataIndication.SourcePV,locte);
       //6)Set IS_NEIGHBOUR flag to true
-      entry_map_it->second.IS_NEIGHBOUR = true;
+      locte->IS_NEIGHBOUR = true;
     }
-    m_LocT_Mutex.unlock ();
     //7) Pass the payload to the upper protocol entity if it's not a beacon packet
     if(dataIndication.GNType != BEACON)
     {
@@ -858,62 +1137,41 @@ namespace ns3 {
     }
   }
 
-  void
+  GeoNet::GNLocTE *
   GeoNet::newLocTE (GNlpv_t lpv)
   {
     //Create new LocT entry according to ETSI EN 302 636-4-1 [8.1.2]
-    GNLocTE new_entry;
-    new_entry.GN_ADDR = lpv.GnAddress;
-    new_entry.LL_ADDR = lpv.GnAddress.GetLLAddress();
-    new_entry.version = 1;
-    new_entry.lpv = lpv;
-    new_entry.LS_PENDING = false;
-    new_entry.IS_NEIGHBOUR = true;
-    new_entry.DPL.clear ();//!Duplicate packet list
-    new_entry.timestamp = compute_timestampIts (true);
-    new_entry.PDR = 0; //!Packet data rate, yet to be implemented
-
-    //Before storing the new entry, start the T(LocTE) as specified in [8.1.3]
-    m_GNLocTTimer.emplace(lpv.GnAddress, Timer());
-    GeoNet::setTLocT(m_GNLocTTimer[lpv.GnAddress],Seconds(m_GnLifeTimeLocTE),&GeoNet::LocTE_timeout,lpv.GnAddress);
+    //The T(LocTE) timer is started by the Location Table when storing the new entry, as specified in [8.1.3]
+    bool created;
+    GNLocTE *new_entry = m_GNLocT.insert (lpv.GnAddress,created);
+    new_entry->GN_ADDR = lpv.GnAddress;
+    new_entry->LL_ADDR = lpv.GnAddress.GetLLAddress();
+    new_entry->version = 1;
+    new_entry->lpv = lpv;
+    new_entry->LS_PENDING = false;
+    new_entry->IS_NEIGHBOUR = true;
+    new_entry->DPL.clear ();//!Duplicate packet list
+    new_entry->timestamp = compute_timestampIts (true);
+    new_entry->PDR = 0; //!Packet data rate, yet to be implemented
     //!LS_PENDING timer [8.1.3] not implemented yet
 
-    //Store new entry
-    m_GNLocT.emplace(lpv.GnAddress,new_entry);
-  }
-
-  template<typename MEM_PTR> void
-  GeoNet::setTLocT(Timer &timer,Time delay,MEM_PTR callback_fcn,GNAddress address)
-  {
-    if(timer.IsRunning ())
-    {
-       timer.Cancel();
-    }
-
-    timer.SetFunction(callback_fcn,this);
-    timer.SetArguments(address);
-    timer.SetDelay (delay);
-
-    timer.Schedule ();
+    return new_entry;
   }
 
   void
-  GeoNet::LocTUpdate (GNlpv_t lpv, std::map<GNAddress,GNLocTE>::iterator locte_it)
+  GeoNet::LocTUpdate (GNlpv_t lpv, GNLocTE *locte)
   {
     //Update LongPV as especified in clause C.2
     long TSTpv_rp =  lpv.TST; //! Timestamp for the position vector in the received GN packet
-    long TSTpv_locT = locte_it->second.timestamp; //! Timestamp for the position vector in the LocT to be updated
+    long TSTpv_locT = locte->timestamp; //! Timestamp for the position vector in the LocT to be updated
     if(((TSTpv_rp>TSTpv_locT) && ((TSTpv_rp-TSTpv_locT)<=TS_MAX/2)) ||
        ((TSTpv_locT>TSTpv_rp) && ((TSTpv_locT-TSTpv_rp)>TS_MAX/2)))
     {
       //TSTpv_rp greater than TSTpv_locT
-      //Cancel T(LocTE) from previous entry even if this is done by setTLocT
-      m_GNLocTTimer[lpv.GnAddress].Cancel();
-      //Before updating entry, start the T(LocTE) as specified in [8.1.3]
-      m_GNLocTTimer.emplace(lpv.GnAddress, Timer ());
-      GeoNet::setTLocT(m_GNLocTTimer[lpv.GnAddress],Seconds(m_GnLifeTimeLocTE),&GeoNet::LocTE_timeout,lpv.GnAddress);
+      //Before updating entry, restart the T(LocTE) as specified in [8.1.3]
+      m_GNLocT.refresh (locte);
       //PVlocT <- PVrp
-      locte_it->second.lpv = lpv;
+      locte->lpv = lpv;
     }
     else
     {
@@ -921,15 +1179,6 @@ namespace ns3 {
     }
   }
 
-  void
-  GeoNet::LocTE_timeout (GNAddress entry_address)
-  {
-      m_LocT_Mutex.lock ();
-      m_GNLocTTimer.erase(entry_address);
-      m_GNLocT.erase(entry_address);
-      m_LocT_Mutex.unlock ();
-  }
-
   Ptr<Socket>
   GeoNet::createGNPacketSocket(Ptr<Node> node_ptr)
   {
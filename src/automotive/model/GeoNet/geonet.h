@@ -3,8 +3,6 @@
 #include <stdint.h>
 #include <string>
 #include <map>
-#include <set>
-#include <mutex>
 #include "ns3/vdpTraci.h"
 #include "ns3/asn_utils.h"
 #include "ns3/address.h"
@@ -19,9 +17,11 @@
 #include "ns3/gbc-header.h"
 #include "ns3/beacon-header.h"
 #include "ns3/gn-address.h"
+#include "ns3/gn-location-table.h"
 #include "ns3/longpositionvector.h"
 #include "ns3/btpdatarequest.h"
 #include "ns3/PRRSupervisor.h"
+#include "ns3/dcc.h"
 
 extern "C" {
   #include "ns3/CAM.h"
@@ -32,25 +32,25 @@ extern "C" {
 
 namespace ns3
 {
+  // ETSI EN 302 636-4-1 ANNEX H: itsGnNonAreaForwardingAlgorithm and itsGnAreaForwardingAlgorithm
+  typedef enum {
+    GN_NONAREA_UNSPECIFIED=0,
+    GN_NONAREA_GREEDY=1,
+    GN_NONAREA_CBF=2
+  } GNNonAreaForwardingAlgorithm_t;
+
+  typedef enum {
+    GN_AREA_UNSPECIFIED=0,
+    GN_AREA_SIMPLE=1,
+    GN_AREA_CBF=2,
+    GN_AREA_ADVANCED=3
+  } GNAreaForwardingAlgorithm_t;
+
   class GeoNet : public Object
   {
     public:
 
-      typedef struct _LocTableEntry {
-        /**
-        *   ETSI EN 302 636-4-1 [8.1.2]
-        */
-        GNAddress GN_ADDR;
-        Mac48Address LL_ADDR;
-        uint8_t type;
-        uint8_t version;
-        GNlpv_t lpv; //! long position vector
-        bool LS_PENDING;
-        bool IS_NEIGHBOUR;
-        std::set<uint16_t> DPL; //! Duplicate packet list
-        long timestamp;
-        uint32_t PDR;
-      } GNLocTE;
+      typedef GNLocationTable::GNLocTE GNLocTE;
 
       typedef struct _egoPositionVector {
         /**
@@ -63,6 +63,19 @@ namespace ns3
         uint32_t PAI_EPV;
       }GNegoPV;
 
+      typedef struct _forwardingStats {
+        uint64_t forwardedPackets; //! GBC packets re-transmitted by this router, with any algorithm
+        uint64_t greedyUnicasts; //! Packets sent to the next hop selected by greedy forwarding
+        uint64_t greedyLocalOptimum; //! Greedy forwarding without any neighbour making progress (packet broadcasted)
+        uint64_t cbfBuffered; //! Packets stored in the CBF buffer
+        uint64_t cbfForwarded; //! Packets broadcasted at the expiration of their CBF timer
+        uint64_t cbfSuppressed; //! Buffered packets discarded since another router forwarded them first
+        uint64_t cbfBufferDrops; //! Buffered packets dropped due to the CBF buffer being full
+        uint64_t cbfNoProgressDrops; //! Packets not buffered since this router would not make any progress
+        uint64_t redundantRebroadcasts; //! GBC packets received again after their first reception (duplicates)
+        uint64_t hopLimitDiscards; //! Packets which could not be forwarded since their hop limit was reached
+      } GNForwardingStats_t;
+
 
       static TypeId GetTypeId ();
       GeoNet();
@@ -81,16 +94,25 @@ namespace ns3
       void disablePRRsupervisorForBeacons() {m_PRRsupervisor_beacons=false;}
       void enablePRRsupervisorForBeacons() {m_PRRsupervisor_beacons=true;}
 
+      // Forwarding algorithms used for multi-hop GeoBroadcast (the default ones are SIMPLE inside the destination area
+      // and GREEDY outside of it). Packets are forwarded only when sent with a maximum hop limit greater than 1
+      void setAreaForwardingAlgorithm(GNAreaForwardingAlgorithm_t algorithm) {m_GNAreaForwardingAlgorithm=algorithm;}
+      void setNonAreaForwardingAlgorithm(GNNonAreaForwardingAlgorithm_t algorithm) {m_GNNonAreaForwardingAlgorithm=algorithm;}
+      GNForwardingStats_t getForwardingStats() {return m_fwd_stats;}
+
+      // When a DCC object is set, all the GN-PDUs are passed to its gatekeeper instead of being sent directly
+      void setDCC(Ptr<DCC> dcc);
+      Ptr<DCC> getDCC() {return m_dcc;}
+
       // This static method creates a new GeoNetworking socket, starting from the ns-3 PacketSocket and properly binding/connecting it
       // It requires as input a pointer to the node to which the socket should be bound
       static Ptr<Socket> createGNPacketSocket(Ptr<Node> node_ptr);
 
   private:
-      void LocTE_timeout(GNAddress entry_address);
-      void newLocTE(GNlpv_t longPositionVector);
-      void LocTUpdate(GNlpv_t lpv,std::map<GNAddress,GNLocTE>::iterator locte_it);
+      GNLocTE *newLocTE(GNlpv_t longPositionVector);
+      void LocTUpdate(GNlpv_t lpv,GNLocTE *locte);
       void processSHB(GNDataIndication_t dataIndication,Address address);
-      void processGBC(GNDataIndication_t dataIndication,Address address,uint8_t shape);
+      void processGBC(GNDataIndication_t dataIndication,Address address,GNBasicHeader basicHeader,GNCommonHeader commonHeader);
       uint8_t encodeLT(double seconds);
       double decodeLT(uint8_t lifeTime);
       bool hasNeighbour();
@@ -98,21 +120,39 @@ namespace ns3
       GNDataConfirm_t sendGBC(GNDataRequest_t dataRequest,GNCommonHeader commonHeader,GNBasicHeader basicHeader,GNlpv_t longPV);
       GNDataConfirm_t sendBeacon(GNDataRequest_t dataRequest,GNCommonHeader commonHeader,GNBasicHeader basicHeader,GNlpv_t longPV);
       bool isInsideGeoArea(GeoArea_t geoArea);
-      bool DPD(uint16_t seqNumber,GNAddress address);
+      bool isInsideGeoArea(GeoArea_t geoArea,double lat,double lon);
+      bool greedyNextHop(GeoArea_t geoArea,Mac48Address &nextHop);
+      bool sendForwardedGBC(Ptr<Packet> packet,bool unicast,Mac48Address nextHop);
+      void bufferCBF(Ptr<Packet> packet,uint64_t sourceKey,uint16_t seqNumber,double dist);
+      void CBFTimeout(uint64_t sourceKey,uint16_t seqNumber);
+      void cleanCBFBuffer();
+      int transmitPDU(Ptr<Packet> packet,bool unicast,Mac48Address nextHop);
+      PRRMessageType_t PRRMessageType(GNDataRequest_t dataRequest);
+      void sendPDU(Ptr<Packet> packet,Address dest);
+      bool DPD(uint16_t seqNumber,GNLocTE *locte);
       bool DAD(GNAddress address);
       void setBeacon();
       void saveRepPacket(GNDataRequest_t dataRequest);
       void maxRepIntTimeout(GNDataRequest_t dataRequest);
 
 
-      std::map<GNAddress,GNLocTE> m_GNLocT;//! ETSI EN 302 636-4-1 [8.1]
-      std::map<GNAddress,Timer> m_GNLocTTimer; //! Timer for every new entry in th Location Table
-      template<typename MEM_PTR> void setTLocT(Timer &timer,Time delay,MEM_PTR callback_fcn,GNAddress address);
+      GNLocationTable m_GNLocT;//! ETSI EN 302 636-4-1 [8.1], with the T(LocTE) timers of all the entries
 
       std::map<GNDataRequest_t,std::pair<Timer,Timer>> m_Repetition_packets;//! Timers for packets with repetition interval enabled
-      template<typename MEM_PTR> void setRepInt(Timer &timer,Time delay,MEM_PTR callback_fcn,GNDataRequest_t dataRequest);
 
-      std::mutex m_LocT_Mutex;
+      typedef struct _cbfPacket {
+        Ptr<Packet> packet; //! Complete GN-PDU, ready to be broadcasted
+        EventId timer;
+        uint64_t order; //! Insertion order, to drop the oldest packet when the buffer is full
+      } GNCbfPacket_t;
+
+      //! ETSI EN 302 636-4-1 [E.3] and [F.3] CBF packet buffer, indexed by source GN address and sequence number
+      std::map<std::pair<uint64_t,uint16_t>,GNCbfPacket_t> m_CbfBuffer;
+      uint32_t m_CbfBufferBytes = 0;
+      uint64_t m_CbfBufferOrder = 0;
+
+      GNForwardingStats_t m_fwd_stats = {};
+      template<typename MEM_PTR> void setRepInt(Timer &timer,Time delay,MEM_PTR callback_fcn,GNDataRequest_t dataRequest);
 
       GNegoPV m_egoPV; //! ETSI EN 302 636-4-1 [8.2]
       void EPVupdate();
@@ -167,11 +207,12 @@ namespace ns3
       uint16_t m_GnBroadcastCBFDefSectorAngle = 30;
       uint16_t m_GnUcForwardingPacketBufferSize = 256;
       uint16_t m_GnBcForwardingPacketBufferSize = 1024;
-      uint16_t m_FnCbfPacketBufferSize = 256;
+      uint16_t m_FnCbfPacketBufferSize = 256; //! kbytes
       uint16_t m_GnDefaultTrafficClass = 0;
       bool m_RSU_epv_set = false;
 
       Ptr<PRRSupervisor> m_PRRSupervisor_ptr = nullptr;
+      Ptr<DCC> m_dcc = nullptr;
       bool m_PRRsupervisor_beacons = true;
 
   };
@@ -0,0 +1,273 @@
+#include "gn-location-table.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#define GN_LL_ADDRESS_MASK 0x0000FFFFFFFFFFFFULL
+
+namespace ns3
+{
+  NS_LOG_COMPONENT_DEFINE ("GNLocationTable");
+
+  void
+  GNDuplicatePacketList::setLength(uint8_t length)
+  {
+    if(length==0 || length>GN_DPL_MAX_LENGTH)
+      {
+        NS_LOG_WARN("Invalid DPL length " << (int) length << ". Using " << GN_DPL_MAX_LENGTH << " instead.");
+        length=GN_DPL_MAX_LENGTH;
+      }
+
+    if(length!=m_length)
+      {
+        m_length=length;
+        clear();
+      }
+  }
+
+  bool
+  GNDuplicatePacketList::contains(uint16_t seqNumber) const
+  {
+    for(uint8_t i=0;i<m_size;i++)
+      {
+        if(m_seqNumbers[i]==seqNumber)
+          {
+            return true;
+          }
+      }
+    return false;
+  }
+
+  void
+  GNDuplicatePacketList::insert(uint16_t seqNumber)
+  {
+    // When the list is full, the oldest sequence number is overwritten
+    m_seqNumbers[m_head]=seqNumber;
+    m_head=(m_head+1)%m_length;
+    if(m_size<m_length)
+      {
+        m_size++;
+      }
+  }
+
+  GNLocationTable::GNLocationTable()
+  {
+    m_dpl_length = 8;
+    m_size = 0;
+    m_slots.resize(64);
+    m_mask = m_slots.size()-1;
+    setLifetime(Seconds(20));
+  }
+
+  void
+  GNLocationTable::setLifetime(Time lifetime)
+  {
+    m_lifetime = lifetime;
+    m_wheel.setup(MilliSeconds(100),m_lifetime,[this](const uint64_t &key) {expire(key);});
+
+    // setup() empties the wheel: re-arm the lifetime of the entries which are already stored, if any
+    for(slot_t &slot : m_slots)
+      {
+        if(slot.used)
+          {
+            slot.expiry = Simulator::Now()+m_lifetime;
+            m_wheel.insert(slot.key,m_lifetime);
+          }
+      }
+  }
+
+  uint64_t
+  GNLocationTable::addressKey(const GNAddress &address)
+  {
+    uint8_t buf[8];
+    uint64_t key = 0;
+
+    address.Serialize(buf);
+    for(int i=0;i<8;i++)
+      {
+        key = (key<<8) | buf[i];
+      }
+
+    return key;
+  }
+
+  size_t
+  GNLocationTable::hashKey(uint64_t key)
+  {
+    // Only the 48 bits of the LL address are hashed: all the entries with the same LL address share the same probe
+    // sequence, which is what findByLLAddress() relies on
+    key &= GN_LL_ADDRESS_MASK;
+
+    // splitmix64 finalizer: the lower bits of the GN addresses (MAC-derived) are often very similar
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return (size_t) key;
+  }
+
+  size_t
+  GNLocationTable::findSlot(uint64_t key) const
+  {
+    // The load factor is kept below 1/2, so an empty slot is always found
+    size_t idx = hashKey(key) & m_mask;
+    while(m_slots[idx].used && m_slots[idx].key!=key)
+      {
+        idx = (idx+1) & m_mask;
+      }
+    return idx;
+  }
+
+  GNLocationTable::GNLocTE *
+  GNLocationTable::find(const GNAddress &address)
+  {
+    size_t idx = findSlot(addressKey(address));
+    return m_slots[idx].used ? &m_slots[idx].entry : nullptr;
+  }
+
+  GNLocationTable::GNLocTE *
+  GNLocationTable::findByLLAddress(const Mac48Address &address)
+  {
+    uint8_t buf[6];
+    uint64_t ll_key = 0;
+
+    address.CopyTo(buf);
+    for(int i=0;i<6;i++)
+      {
+        ll_key = (ll_key<<8) | buf[i];
+      }
+
+    size_t idx = hashKey(ll_key) & m_mask;
+    while(m_slots[idx].used)
+      {
+        if((m_slots[idx].key & GN_LL_ADDRESS_MASK)==ll_key)
+          {
+            return &m_slots[idx].entry;
+          }
+        idx = (idx+1) & m_mask;
+      }
+
+    return nullptr;
+  }
+
+  GNLocationTable::GNLocTE *
+  GNLocationTable::insert(const GNAddress &address, bool &created)
+  {
+    uint64_t key = addressKey(address);
+    size_t idx = findSlot(key);
+
+    if(m_slots[idx].used)
+      {
+        created = false;
+        return &m_slots[idx].entry;
+      }
+
+    if(2*(m_size+1)>m_slots.size())
+      {
+        rehash(2*m_slots.size());
+        idx = findSlot(key);
+      }
+
+    slot_t &slot = m_slots[idx];
+    slot.key = key;
+    slot.used = true;
+    slot.entry = GNLocTE();
+    slot.entry.GN_ADDR = address;
+    slot.entry.DPL.setLength(m_dpl_length);
+    slot.expiry = Simulator::Now()+m_lifetime;
+    m_size++;
+
+    m_wheel.insert(key,m_lifetime);
+
+    created = true;
+    return &slot.entry;
+  }
+
+  void
+  GNLocationTable::refresh(GNLocTE *entry)
+  {
+    size_t idx = findSlot(addressKey(entry->GN_ADDR));
+
+    if(m_slots[idx].used)
+      {
+        // No need to touch the wheel: the entry will be re-armed when its previous expiration is reached
+        m_slots[idx].expiry = Simulator::Now()+m_lifetime;
+      }
+  }
+
+  void
+  GNLocationTable::expire(const uint64_t &key)
+  {
+    size_t idx = findSlot(key);
+
+    if(!m_slots[idx].used)
+      {
+        return;
+      }
+
+    if(m_slots[idx].expiry>Simulator::Now())
+      {
+        m_wheel.insert(key,m_slots[idx].expiry-Simulator::Now());
+      }
+    else
+      {
+        eraseSlot(idx);
+      }
+  }
+
+  void
+  GNLocationTable::eraseSlot(size_t idx)
+  {
+    size_t hole = idx;
+    size_t next = idx;
+
+    // Backward-shift deletion: move back the following entries of the same cluster which can fill the hole, so
+    // that no tombstone is needed
+    while(true)
+      {
+        next = (next+1) & m_mask;
+
+        if(!m_slots[next].used)
+          {
+            break;
+          }
+
+        size_t home = hashKey(m_slots[next].key) & m_mask;
+        if(((next-home) & m_mask) >= ((next-hole) & m_mask))
+          {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+          }
+      }
+
+    m_slots[hole].used = false;
+    m_size--;
+  }
+
+  void
+  GNLocationTable::rehash(size_t capacity)
+  {
+    std::vector<slot_t> old_slots(capacity);
+    old_slots.swap(m_slots);
+    m_mask = capacity-1;
+
+    for(slot_t &slot : old_slots)
+      {
+        if(slot.used)
+          {
+            m_slots[findSlot(slot.key)] = slot;
+          }
+      }
+  }
+
+  void
+  GNLocationTable::clear()
+  {
+    m_wheel.clear();
+    for(slot_t &slot : m_slots)
+      {
+        slot.used = false;
+      }
+    m_size = 0;
+  }
+}
@@ -0,0 +1,129 @@
+#ifndef GN_LOCATION_TABLE_H
+#define GN_LOCATION_TABLE_H
+
+#include <stdint.h>
+#include <vector>
+#include "ns3/nstime.h"
+#include "ns3/mac48-address.h"
+#include "ns3/gn-address.h"
+#include "ns3/longpositionvector.h"
+#include "ns3/timing-wheel.h"
+
+#define GN_DPL_MAX_LENGTH 32
+
+namespace ns3
+{
+  /*
+   * Duplicate packet list of a Location Table entry (ETSI EN 302 636-4-1 [A.2])
+   * It is a fixed-size ring keeping the last 'length' sequence numbers received from a source, i.e. no memory is
+   * allocated when packets are received
+   */
+  class GNDuplicatePacketList
+  {
+    public:
+      GNDuplicatePacketList() : m_length(8), m_size(0), m_head(0) {}
+
+      void setLength(uint8_t length);
+      bool contains(uint16_t seqNumber) const;
+      void insert(uint16_t seqNumber);
+      void clear() {m_size=0; m_head=0;}
+      uint8_t size() const {return m_size;}
+
+    private:
+      uint16_t m_seqNumbers[GN_DPL_MAX_LENGTH];
+      uint8_t m_length;
+      uint8_t m_size;
+      uint8_t m_head;
+  };
+
+  /*
+   * GeoNetworking Location Table (ETSI EN 302 636-4-1 [8.1])
+   * The entries are stored in an open-addressing hash table (linear probing, backward-shift deletion) indexed by the
+   * 64 bits of the GN address (hashing only its link layer part, so that entries can also be found by LL address),
+   * and their lifetime T(LocTE) is handled by a single timing wheel shared by all the entries instead of one ns-3
+   * Timer per entry: refreshing an entry only updates its expiration time, and the entry
+   * is re-inserted in the wheel only when its previous expiration is reached
+   * Entries are removed only when their lifetime expires (or when the whole table is cleared), so that each entry
+   * always has exactly one item in the wheel
+   * Pointers returned by find() and insert() are only valid until the next insert() call or entry expiration
+   */
+  class GNLocationTable
+  {
+    public:
+      typedef struct _LocTableEntry {
+        /**
+        *   ETSI EN 302 636-4-1 [8.1.2]
+        */
+        GNAddress GN_ADDR;
+        Mac48Address LL_ADDR;
+        uint8_t type;
+        uint8_t version;
+        GNlpv_t lpv; //! long position vector
+        bool LS_PENDING;
+        bool IS_NEIGHBOUR;
+        GNDuplicatePacketList DPL; //! Duplicate packet list
+        long timestamp;
+        uint32_t PDR;
+      } GNLocTE;
+
+      GNLocationTable();
+
+      GNLocationTable(const GNLocationTable&) = delete;
+      GNLocationTable& operator=(const GNLocationTable&) = delete;
+
+      void setLifetime(Time lifetime);
+      void setDPLLength(uint8_t length) {m_dpl_length=length;}
+
+      GNLocTE *find(const GNAddress &address);
+      // Look for the entry of the router with the given link layer address (e.g. the sender of a packet to be forwarded)
+      GNLocTE *findByLLAddress(const Mac48Address &address);
+      // It returns the existing entry for 'address' or a new, default initialized, one, which will expire after the
+      // T(LocTE) lifetime unless refresh() is called on it
+      GNLocTE *insert(const GNAddress &address, bool &created);
+      // Restart the T(LocTE) timer of an entry
+      void refresh(GNLocTE *entry);
+      void clear();
+
+      size_t size() const {return m_size;}
+
+      static uint64_t addressKey(const GNAddress &address);
+
+      template <typename F>
+      void
+      forEach(F fcn)
+      {
+        for(slot_t &slot : m_slots)
+          {
+            if(slot.used)
+              {
+                fcn(slot.entry);
+              }
+          }
+      }
+
+    private:
+      typedef struct _slot {
+        uint64_t key;
+        bool used;
+        Time expiry;
+        GNLocTE entry;
+      } slot_t;
+
+      static size_t hashKey(uint64_t key);
+
+      size_t findSlot(uint64_t key) const;
+      void eraseSlot(size_t idx);
+      void rehash(size_t capacity);
+      void expire(const uint64_t &key);
+
+      std::vector<slot_t> m_slots;
+      size_t m_mask;
+      size_t m_size;
+
+      Time m_lifetime;
+      uint8_t m_dpl_length;
+      TimingWheel<uint64_t> m_wheel;
+  };
+}
+
+#endif // GN_LOCATION_TABLE_H
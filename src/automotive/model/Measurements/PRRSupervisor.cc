@@ -20,19 +20,29 @@
 
 #include "PRRSupervisor.h"
 #include <sstream>
+#include <fstream>
 #include <cfloat>
+#include <cmath>
+#include "ns3/btp.h"
 
-#define DEG_2_RAD(val) ((val)*M_PI/180.0)
+namespace ns3 {
+  NS_LOG_COMPONENT_DEFINE("PRRSupervisor");
+  NS_OBJECT_ENSURE_REGISTERED(PRRSupervisorTag);
 
-namespace {
-  double PRRSupervisor_haversineDist(double lat_a, double lon_a, double lat_b, double lon_b) {
-      // 12742000 is the mean Earth radius (6371 km) * 2 * 1000 (to convert from km to m)
-      return 12742000.0*asin(sqrt(sin(DEG_2_RAD(lat_b-lat_a)/2)*sin(DEG_2_RAD(lat_b-lat_a)/2)+cos(DEG_2_RAD(lat_a))*cos(DEG_2_RAD(lat_b))*sin(DEG_2_RAD(lon_b-lon_a)/2)*sin(DEG_2_RAD(lon_b-lon_a)/2)));
+  TypeId
+  PRRSupervisorTag::GetTypeId ()
+  {
+    static TypeId tid = TypeId("ns3::PRRSupervisorTag")
+        .SetParent <Tag>()
+        .AddConstructor <PRRSupervisorTag>();
+    return tid;
   }
-}
 
-namespace ns3 {
-  NS_LOG_COMPONENT_DEFINE("PRRSupervisor");
+  TypeId
+  PRRSupervisorTag::GetInstanceTypeId () const
+  {
+    return GetTypeId ();
+  }
 
   TypeId
   PRRSupervisor::GetTypeId ()
@@ -47,15 +57,16 @@ namespace ns3 {
   {
     NS_LOG_FUNCTION(this);
 
-    std::list<EventId>::iterator eventit = eventList.begin();
-    while(eventit != eventList.end())
-    {
-      if(eventit->IsExpired() == false)
-      {
-        Simulator::Cancel(*eventit);
-      }
-      eventit = eventList.erase(eventit);
-    }
+    m_prr_wheel.clear ();
+    m_event_periodicExport.Cancel ();
+    m_event_destroyExport.Cancel ();
+  }
+
+  void
+  PRRSupervisor::setupWheel ()
+  {
+    // The PRR of each packet is computed 3 seconds after its transmission (with a 100 ms granularity)
+    m_prr_wheel.setup (MilliSeconds (100),Seconds (3),[this](const uint64_t &packetID) {computePRR(packetID);});
   }
 
   std::string
@@ -73,44 +84,128 @@ namespace ns3 {
     return bufss.str();
   }
 
+  PRRMessageType_t
+  PRRSupervisor::messageTypeFromBTPPort(uint16_t port)
+  {
+    switch(port)
+    {
+      case CA_PORT:
+        return PRR_MSG_CAM;
+      case DEN_PORT:
+        return PRR_MSG_DENM;
+      case CP_PORT:
+        return PRR_MSG_CPM;
+      case IVIM_PORT:
+        return PRR_MSG_IVIM;
+      default:
+        return PRR_MSG_OTHER;
+    }
+  }
+
+  std::string
+  PRRSupervisor::messageTypeName(PRRMessageType_t type)
+  {
+    static const char *names[PRR_MSG_NUM_TYPES+1] = {"CAM","DENM","CPM","IVIM","beacon","other","all"};
+
+    return names[type];
+  }
+
   void
-  PRRSupervisor::signalSentPacket(std::string buf, double lat, double lon, uint64_t vehicleID)
+  PRRSupervisor::resetDistanceBins()
   {
-    EventId computePRR_id;
+    // The last bin collects the receivers found at the border of the baseline, due to rounding errors
+    m_dist_bins = static_cast<size_t>(std::ceil(m_baseline_m/m_dist_bin_width_m))+1;
+    m_bin_attempts.assign(PRR_MSG_NUM_TYPES*m_dist_bins,0);
+    m_bin_successes.assign(PRR_MSG_NUM_TYPES*m_dist_bins,0);
+  }
+
+  void
+  PRRSupervisor::setDistanceBinWidth(double width_m)
+  {
+    if(width_m<=0)
+    {
+      NS_FATAL_ERROR("Error: the width of the PRR distance bins must be positive (" << width_m << " m).");
+    }
+
+    m_dist_bin_width_m=width_m;
+    resetDistanceBins();
+  }
+
+  void
+  PRRSupervisor::signalSentPacket(Ptr<Packet> packet, double lat, double lon, uint64_t vehicleID, PRRMessageType_t type)
+  {
+    PRRSupervisorTag tag;
 
     if(m_traci_ptr == nullptr)
     {
       NS_FATAL_ERROR("Fatal error: TraCI client not set in PRR Supervisor.");
     }
 
-    std::vector<std::string> ids = m_traci_ptr->TraCIAPI::vehicle.getIDList ();
+    // A packet sent more than once (e.g. with a GN repetition interval) keeps its first identifier
+    if(!packet->FindFirstMatchingByteTag (tag))
+    {
+      tag.setPacketID (m_next_packetID++);
+      packet->AddByteTag (tag);
+    }
 
-    for(std::vector<std::string>::iterator it=ids.begin();it!=ids.end();++it)
+    // Only the first transmission defines the baseline, the transmission time and the PRR computation time
+    auto packet_it = m_packetbuff_map.find(tag.getPacketID ());
+    if(packet_it != m_packetbuff_map.end())
     {
-      uint64_t stationID = std::stol(it->substr (3));
-      libsumo::TraCIPosition pos = m_traci_ptr->TraCIAPI::vehicle.getPosition (*it);
-      pos=m_traci_ptr->TraCIAPI::simulation.convertXYtoLonLat (pos.x,pos.y);
+      return;
+    }
+
+    baselineVehicleData_t &baselineData = m_packetbuff_map[tag.getPacketID ()];
+    baselineData.type = type;
+    baselineData.x = 0;
+    baselineData.senderID = vehicleID;
+    baselineData.txTime_ns = Simulator::Now ().GetNanoSeconds ();
+
+    // The baseline is computed on the ns-3 positions of the vehicles, through the grid index of the TraCI client
+    Vector senderPos = getSenderPosition (lat,lon,vehicleID);
+
+    m_traci_ptr->ForEachVehicleInRange (senderPos,m_baseline_m,[this,&baselineData,&senderPos](const std::string &id,const Vector &pos) {
+      uint64_t stationID = std::stol(id.substr (3));
 
       if(m_excluded_vehID_enabled==false || (m_excluded_vehID_list.find(stationID)==m_excluded_vehID_list.end())) {
-        if(PRRSupervisor_haversineDist(lat,lon,pos.y,pos.x)<=m_baseline_m)
-        {
-            m_packetbuff_map[buf].vehList.push_back(stationID);
-        }
+        baselineData.vehList.push_back(stationID);
+        baselineData.distance.push_back(std::hypot (pos.x-senderPos.x,pos.y-senderPos.y));
       }
-    }
+    });
 
-    computePRR_id = Simulator::Schedule(Seconds (3), &PRRSupervisor::computePRR, this, buf);
-    eventList.push_back (computePRR_id);
+    baselineData.received.assign(baselineData.vehList.size(),false);
 
-    m_latency_map[buf] = Simulator::Now ().GetNanoSeconds ();
+    m_prr_wheel.insert (tag.getPacketID (),Seconds (3));
+  }
+
+  Vector
+  PRRSupervisor::getSenderPosition(double lat, double lon, uint64_t vehicleID)
+  {
+    // The cache of the vehicle positions is refreshed once per mobility update
+    if(m_station_pos_generation != m_traci_ptr->GetPositionsGeneration ())
+    {
+      m_station_pos.clear ();
+      m_traci_ptr->ForEachVehicle ([this](const std::string &id,const Vector &pos) {
+        m_station_pos[std::stol(id.substr (3))] = pos;
+      });
+      m_station_pos_generation = m_traci_ptr->GetPositionsGeneration ();
+    }
 
-    m_vehicleid_map[buf] = vehicleID;
+    auto pos_it = m_station_pos.find (vehicleID);
+    if(pos_it != m_station_pos.end ())
+    {
+      return pos_it->second;
+    }
+
+    // The sender is not a SUMO vehicle (e.g. it is an RSU): convert its position
+    libsumo::TraCIPosition pos = m_traci_ptr->TraCIAPI::simulation.convertLonLattoXY (lon,lat);
+    return Vector (pos.x,pos.y,0.0);
   }
 
   void
-  PRRSupervisor::signalReceivedPacket(std::string buf, uint64_t vehicleID)
+  PRRSupervisor::signalReceivedPacket(Ptr<const Packet> packet, uint64_t vehicleID)
   {
-    baselineVehicleData_t currBaselineData;
+    PRRSupervisorTag tag;
     double curr_latency_ms = DBL_MAX;
 
     if(m_traci_ptr == nullptr)
@@ -118,53 +213,91 @@ namespace ns3 {
       NS_FATAL_ERROR("Fatal error: TraCI client not set in PRR Supervisor.");
     }
 
-    if(m_packetbuff_map.count(buf)>0)
+    if(!packet->FindFirstMatchingByteTag (tag))
     {
-      currBaselineData = m_packetbuff_map[buf];
+      return;
+    }
 
-      if(std::find(currBaselineData.vehList.begin(), currBaselineData.vehList.end(), vehicleID) != currBaselineData.vehList.end())
+    auto packet_it = m_packetbuff_map.find(tag.getPacketID ());
+    if(packet_it == m_packetbuff_map.end())
+    {
+      return;
+    }
+
+    baselineVehicleData_t &baselineData = packet_it->second;
+
+    // The sender may receive back its own packet when it is forwarded (e.g. by GeoNetworking) and it must not be
+    // counted as one of its receivers
+    if(vehicleID == baselineData.senderID)
+    {
+      return;
+    }
+
+    // Each vehicle is counted only once, even when it receives more copies of the same packet (e.g. forwarded ones),
+    // and only the first reception by a vehicle inside the baseline contributes to the latency
+    bool first_reception = false;
+    for(size_t i=0;i<baselineData.vehList.size();i++)
+    {
+      if(baselineData.vehList[i]==vehicleID)
       {
-        (m_packetbuff_map[buf].x)++;
+        if(!baselineData.received[i])
+        {
+          baselineData.received[i]=true;
+          baselineData.x++;
+          first_reception = true;
+        }
+        break;
       }
     }
 
-    // Compute latency in ms
-    if(m_latency_map.count(buf)>0)
+    if(!first_reception)
     {
-        uint64_t senderID = m_vehicleid_map[buf];
+      return;
+    }
 
-        curr_latency_ms = static_cast<double>(Simulator::Now ().GetNanoSeconds () - m_latency_map[buf])/1000000.0;
-        m_count_latency++;
+    // Compute latency in ms
+    uint64_t senderID = baselineData.senderID;
 
-        m_avg_latency_ms += (curr_latency_ms-m_avg_latency_ms)/m_count_latency;
+    curr_latency_ms = static_cast<double>(Simulator::Now ().GetNanoSeconds () - baselineData.txTime_ns)/1000000.0;
+    m_count_latency++;
 
-        if(m_count_latency_per_veh.count(senderID)<=0) {
-            m_count_latency_per_veh[senderID]=0;
-        }
+    m_avg_latency_ms += (curr_latency_ms-m_avg_latency_ms)/m_count_latency;
+    m_latency_hist[baselineData.type].record (static_cast<uint64_t>(curr_latency_ms*1000.0));
 
-        if(m_avg_latency_ms_per_veh.count(senderID)<=0) {
-            m_avg_latency_ms_per_veh[senderID]=0;
-        }
+    if(m_count_latency_per_veh.count(senderID)<=0) {
+        m_count_latency_per_veh[senderID]=0;
+    }
 
-        m_count_latency_per_veh[senderID]++;
-        m_avg_latency_ms_per_veh[senderID] += (curr_latency_ms - m_avg_latency_ms_per_veh[senderID])/m_count_latency_per_veh[senderID];
+    if(m_avg_latency_ms_per_veh.count(senderID)<=0) {
+        m_avg_latency_ms_per_veh[senderID]=0;
+    }
 
-        if(m_verbose_stdout == true) {
-          std::cout << "|Latency| ID: " << vehicleID << " Current: " << curr_latency_ms << " - Average: " << m_avg_latency_ms << std::endl;
-        }
+    m_count_latency_per_veh[senderID]++;
+    m_avg_latency_ms_per_veh[senderID] += (curr_latency_ms - m_avg_latency_ms_per_veh[senderID])/m_count_latency_per_veh[senderID];
+
+    if(m_verbose_stdout == true) {
+      std::cout << "|Latency| ID: " << vehicleID << " Current: " << curr_latency_ms << " - Average: " << m_avg_latency_ms << std::endl;
     }
   }
 
   void
-  PRRSupervisor::computePRR(std::string buf)
+  PRRSupervisor::computePRR(const uint64_t &packetID)
   {
     double PRR = 0.0;
 
-    if(m_packetbuff_map[buf].vehList.size()>1)
+    auto packet_it = m_packetbuff_map.find(packetID);
+    if(packet_it == m_packetbuff_map.end())
+    {
+      return;
+    }
+
+    baselineVehicleData_t &baselineData = packet_it->second;
+
+    if(baselineData.vehList.size()>1)
     {
-      uint64_t senderID = m_vehicleid_map[buf];
+      uint64_t senderID = baselineData.senderID;
 
-      PRR = (double) m_packetbuff_map[buf].x/(double) (m_packetbuff_map[buf].vehList.size()-1.0);
+      PRR = (double) baselineData.x/(double) (baselineData.vehList.size()-1.0);
       m_count++;
       m_avg_PRR += (PRR-m_avg_PRR)/m_count;
 
@@ -182,12 +315,129 @@ namespace ns3 {
 
       m_count_per_veh[senderID]++;
       m_avg_PRR_per_veh[senderID] += (PRR-m_avg_PRR_per_veh[senderID])/m_count_per_veh[senderID];
+    }
+
+    for(size_t i=0;i<baselineData.vehList.size();i++)
+    {
+      if(baselineData.vehList[i]==baselineData.senderID)
+      {
+        continue;
+      }
+
+      size_t bin = std::min(static_cast<size_t>(baselineData.distance[i]/m_dist_bin_width_m),m_dist_bins-1);
+      m_bin_attempts[baselineData.type*m_dist_bins+bin]++;
+      if(baselineData.received[i])
+      {
+        m_bin_successes[baselineData.type*m_dist_bins+bin]++;
+      }
+    }
+
+    // Some time has passed -> remove the packet, also when no PRR could be computed for it
+    m_packetbuff_map.erase(packet_it);
+  }
+
+  double
+  PRRSupervisor::getLatencyPercentile_ms(double p, PRRMessageType_t type)
+  {
+    if(type<PRR_MSG_NUM_TYPES)
+    {
+      return m_latency_hist[type].percentile (p)/1000.0;
+    }
+
+    HdrHistogram all;
+    for(auto &hist : m_latency_hist)
+    {
+      all.merge (hist);
+    }
+
+    return all.percentile (p)/1000.0;
+  }
+
+  double
+  PRRSupervisor::getPRRDistanceBin(PRRMessageType_t type, size_t bin)
+  {
+    if(type>=PRR_MSG_NUM_TYPES || bin>=m_dist_bins || m_bin_attempts[type*m_dist_bins+bin]==0)
+    {
+      return -1.0;
+    }
+
+    return (double) m_bin_successes[type*m_dist_bins+bin]/(double) m_bin_attempts[type*m_dist_bins+bin];
+  }
+
+  void
+  PRRSupervisor::exportStats(std::string prefix)
+  {
+    double now_s = Simulator::Now ().GetSeconds ();
+    bool first = m_export_started.insert (prefix).second;
+    std::ios_base::openmode mode = first ? std::ios::out|std::ios::trunc : std::ios::out|std::ios::app;
+
+    std::ofstream prrfile(prefix+"_prr.csv",mode);
+    std::ofstream latfile(prefix+"_latency.csv",mode);
+
+    if(!prrfile.is_open() || !latfile.is_open())
+    {
+      NS_LOG_ERROR("PRRSupervisor: cannot open the statistics files with prefix " << prefix);
+      return;
+    }
+
+    if(first)
+    {
+      prrfile << "time_s,msg_type,dist_min_m,dist_max_m,receivers,received,PRR" << std::endl;
+      latfile << "time_s,msg_type,count,mean_ms,min_ms,p50_ms,p90_ms,p99_ms,p999_ms,max_ms" << std::endl;
+    }
+
+    for(int type=0;type<PRR_MSG_NUM_TYPES;type++)
+    {
+      for(size_t bin=0;bin<m_dist_bins;bin++)
+      {
+        uint64_t attempts = m_bin_attempts[type*m_dist_bins+bin];
 
-      m_packetbuff_map.erase(buf);
-      m_vehicleid_map.erase(buf);
+        if(attempts==0)
+        {
+          continue;
+        }
+
+        prrfile << now_s << "," << messageTypeName((PRRMessageType_t) type) << "," << bin*m_dist_bin_width_m << ","
+                << (bin+1)*m_dist_bin_width_m << "," << attempts << "," << m_bin_successes[type*m_dist_bins+bin] << ","
+                << getPRRDistanceBin((PRRMessageType_t) type,bin) << "\n";
+      }
     }
 
-    // Some time has passed -> remove the packet from the latency map too
-    m_latency_map.erase(buf);
+    HdrHistogram all;
+    for(int type=0;type<=PRR_MSG_NUM_TYPES;type++)
+    {
+      const HdrHistogram &hist = type<PRR_MSG_NUM_TYPES ? m_latency_hist[type] : all;
+
+      if(type<PRR_MSG_NUM_TYPES)
+      {
+        all.merge (hist);
+      }
+
+      if(hist.getCount ()==0)
+      {
+        continue;
+      }
+
+      latfile << now_s << "," << messageTypeName((PRRMessageType_t) type) << "," << hist.getCount () << ","
+              << hist.getMean ()/1000.0 << "," << hist.getMin ()/1000.0 << "," << hist.percentile (50)/1000.0 << ","
+              << hist.percentile (90)/1000.0 << "," << hist.percentile (99)/1000.0 << "," << hist.percentile (99.9)/1000.0 << ","
+              << hist.getMax ()/1000.0 << "\n";
+    }
+  }
+
+  void
+  PRRSupervisor::enablePeriodicExport(std::string prefix, Time interval)
+  {
+    m_event_periodicExport.Cancel ();
+    m_event_destroyExport.Cancel ();
+    m_event_periodicExport = Simulator::Schedule (interval,&PRRSupervisor::periodicExport,this,prefix,interval);
+    m_event_destroyExport = Simulator::ScheduleDestroy (&PRRSupervisor::exportStats,this,prefix);
+  }
+
+  void
+  PRRSupervisor::periodicExport(std::string prefix, Time interval)
+  {
+    exportStats (prefix);
+    m_event_periodicExport = Simulator::Schedule (interval,&PRRSupervisor::periodicExport,this,prefix,interval);
   }
 }
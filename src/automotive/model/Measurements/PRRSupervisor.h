@@ -1,31 +1,76 @@
 #ifndef PRRSUPERVISOR_H
 #define PRRSUPERVISOR_H
 
-#include <list>
+#include <vector>
 #include <unordered_map>
 #include <string>
 #include "ns3/traci-client.h"
+#include "ns3/packet.h"
+#include "ns3/tag.h"
 #include "ns3/event-id.h"
+#include "ns3/timing-wheel.h"
+#include "ns3/hdr-histogram.h"
 
 namespace ns3 {
+  /*
+   * Byte tag carrying the 64-bit identifier assigned by the PRRSupervisor to each transmitted packet
+   * A byte tag is used instead of a packet tag as it is preserved also when the lower layers (e.g. the LTE/NR RLC)
+   * fragment and reassemble the packet
+   */
+  class PRRSupervisorTag : public Tag {
+    public:
+      static TypeId GetTypeId();
+      virtual TypeId GetInstanceTypeId() const;
+      virtual uint32_t GetSerializedSize() const {return 8;}
+      virtual void Serialize(TagBuffer i) const {i.WriteU64(m_packetID);}
+      virtual void Deserialize(TagBuffer i) {m_packetID=i.ReadU64();}
+      virtual void Print(std::ostream &os) const {os << "PRR packet ID=" << m_packetID;}
+
+      void setPacketID(uint64_t packetID) {m_packetID=packetID;}
+      uint64_t getPacketID() const {return m_packetID;}
+
+    private:
+      uint64_t m_packetID = 0;
+  };
+
+  typedef enum {
+    PRR_MSG_CAM=0,
+    PRR_MSG_DENM=1,
+    PRR_MSG_CPM=2,
+    PRR_MSG_IVIM=3,
+    PRR_MSG_BEACON=4,
+    PRR_MSG_OTHER=5,
+    PRR_MSG_NUM_TYPES=6
+  } PRRMessageType_t;
+
   class PRRSupervisor : public Object {
     typedef struct baselineVehicleData {
-      std::list<uint64_t> vehList;
+      std::vector<uint64_t> vehList; //! Vehicles inside the baseline when the packet was sent
+      std::vector<bool> received; //! Whether each vehicle of vehList has already received the packet
+      std::vector<float> distance; //! Distance of each vehicle of vehList from the sender, in meters
       int x;
+      uint64_t senderID;
+      int64_t txTime_ns;
+      PRRMessageType_t type;
     } baselineVehicleData_t;
 
     public:
       static TypeId GetTypeId();
-      PRRSupervisor() {}
-      PRRSupervisor(int baseline_m) : m_baseline_m(baseline_m) {}
+      PRRSupervisor() {setupWheel(); resetDistanceBins();}
+      PRRSupervisor(int baseline_m) : m_baseline_m(baseline_m) {setupWheel(); resetDistanceBins();}
       virtual ~PRRSupervisor();
 
       static std::string bufToString(uint8_t *buf, uint32_t bufsize);
 
       void setTraCIClient(Ptr<TraciClient> traci_ptr) {m_traci_ptr = traci_ptr;}
 
-      void signalSentPacket(std::string buf,double lat,double lon,uint64_t vehicleID);
-      void signalReceivedPacket(std::string buf,uint64_t vehicleID);
+      static PRRMessageType_t messageTypeFromBTPPort(uint16_t port);
+      static std::string messageTypeName(PRRMessageType_t type);
+
+      // The packet is tagged with a new identifier, which is then used to match its receptions
+      void signalSentPacket(Ptr<Packet> packet,double lat,double lon,uint64_t vehicleID,PRRMessageType_t type=PRR_MSG_OTHER);
+      // Packets without a PRRSupervisorTag (e.g. coming from outside of the simulation) are ignored
+      void signalReceivedPacket(Ptr<const Packet> packet,uint64_t vehicleID);
 
       double getAveragePRR_overall(void) {return m_avg_PRR;}
       double getAverageLatency_overall(void) {return m_avg_latency_ms;}
@@ -33,17 +78,36 @@ namespace ns3 {
       double getAveragePRR_vehicle(uint64_t vehicleID) {return m_avg_PRR_per_veh[vehicleID];}
       double getAverageLatency_vehicle(uint64_t vehicleID) {return m_avg_latency_ms_per_veh[vehicleID];}
 
+      // Latency percentile (p in [0,100]) in ms, over all the receptions of the given type of message (or of any type)
+      double getLatencyPercentile_ms(double p,PRRMessageType_t type=PRR_MSG_NUM_TYPES);
+      // PRR of the given type of message, for the receivers between [bin*width,(bin+1)*width) meters from the sender
+      double getPRRDistanceBin(PRRMessageType_t type,size_t bin);
+      size_t getNumDistanceBins() {return m_dist_bins;}
+      // The distance bins are reset when their width is changed
+      void setDistanceBinWidth(double width_m);
+
+      // Append a snapshot of the PRR per distance bin (<prefix>_prr.csv) and of the latency distribution
+      // (<prefix>_latency.csv) to two CSV files, which are created at the first snapshot
+      void exportStats(std::string prefix);
+      // Export a snapshot every 'interval' and when the simulation is destroyed (a new call replaces the previous one)
+      void enablePeriodicExport(std::string prefix,Time interval);
+
       void enableVerboseOnStdout() {m_verbose_stdout=true;}
       void disableVerboseOnStdout() {m_verbose_stdout=false;}
 
       void addExcludedID(uint64_t m_vehid) {m_excluded_vehID_list.insert(m_vehid); m_excluded_vehID_enabled=true;}
       void clearExcludedIDs() {m_excluded_vehID_list.clear(); m_excluded_vehID_enabled=false;}
     private:
-      void computePRR(std::string buf);
-
-      std::unordered_map<std::string,baselineVehicleData_t> m_packetbuff_map;
-      std::unordered_map<std::string,int64_t> m_latency_map;
-      std::unordered_map<std::string,uint64_t> m_vehicleid_map;
+      void setupWheel();
+      Vector getSenderPosition(double lat,double lon,uint64_t vehicleID);
+      void resetDistanceBins();
+      void periodicExport(std::string prefix,Time interval);
+      void computePRR(const uint64_t &packetID);
+
+      // Packets sent in the last 3 seconds, indexed by packet ID, whose PRR is computed when they expire
+      std::unordered_map<uint64_t,baselineVehicleData_t> m_packetbuff_map;
+      TimingWheel<uint64_t> m_prr_wheel;
+      uint64_t m_next_packetID = 1;
       int m_count = 0;
       uint64_t m_count_latency = 0;
       double m_avg_PRR = 0.0;
@@ -53,11 +117,23 @@ namespace ns3 {
       std::unordered_map<uint64_t,int> m_count_per_veh;
       std::unordered_map<uint64_t,uint64_t> m_count_latency_per_veh;
       Ptr<TraciClient> m_traci_ptr = nullptr;
+      // ns-3 position of each SUMO vehicle, indexed by station ID, as of the last mobility update
+      std::unordered_map<uint64_t,Vector> m_station_pos;
+      uint64_t m_station_pos_generation = 0;
       double m_baseline_m = 150.0;
 
-      bool m_verbose_stdout = false;
+      // Streaming distributions: one latency histogram (in microseconds) per message type and the number of baseline
+      // receivers/successful receptions per message type and transmitter-receiver distance bin
+      std::vector<HdrHistogram> m_latency_hist = std::vector<HdrHistogram>(PRR_MSG_NUM_TYPES);
+      double m_dist_bin_width_m = 10.0;
+      size_t m_dist_bins = 0;
+      std::vector<uint64_t> m_bin_attempts;
+      std::vector<uint64_t> m_bin_successes;
+      std::set<std::string> m_export_started;
+      EventId m_event_periodicExport;
+      EventId m_event_destroyExport;
 
-      std::list<EventId> eventList;
+      bool m_verbose_stdout = false;
 
       std::set<uint64_t> m_excluded_vehID_list;
       bool m_excluded_vehID_enabled = false;
@@ -0,0 +1,130 @@
+#ifndef HDR_HISTOGRAM_H
+#define HDR_HISTOGRAM_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+
+namespace ns3
+{
+  /*
+   * Fixed-memory High Dynamic Range histogram of non-negative integer values
+   * Values below 2^sub_bits are stored exactly; larger values are stored in log-linear buckets, each power of two
+   * being split into 2^(sub_bits-1) buckets, so that the relative error of any reported value is below 2^-(sub_bits-1)
+   * Values above 2^max_exp are clamped to the last bucket (the exact maximum is still tracked)
+   */
+  class HdrHistogram
+  {
+    public:
+      HdrHistogram(unsigned int sub_bits=8, unsigned int max_exp=40) : m_sub_bits(sub_bits), m_max_exp(max_exp)
+      {
+        m_half = 1ULL << (m_sub_bits-1);
+        m_buckets.assign((m_max_exp-m_sub_bits+2)*m_half,0);
+      }
+
+      void
+      record(uint64_t value, uint64_t count=1)
+      {
+        size_t idx = std::min(index(value),m_buckets.size()-1);
+
+        m_buckets[idx] += count;
+        m_count += count;
+        m_sum += static_cast<double>(value)*count;
+        m_min = std::min(m_min,value);
+        m_max = std::max(m_max,value);
+      }
+
+      // The two histograms must have been created with the same parameters
+      void
+      merge(const HdrHistogram &other)
+      {
+        for(size_t i=0;i<m_buckets.size() && i<other.m_buckets.size();i++)
+          {
+            m_buckets[i] += other.m_buckets[i];
+          }
+        m_count += other.m_count;
+        m_sum += other.m_sum;
+        m_min = std::min(m_min,other.m_min);
+        m_max = std::max(m_max,other.m_max);
+      }
+
+      // Highest value equivalent (within the histogram precision) to the p-th percentile, with p in [0,100]
+      uint64_t
+      percentile(double p) const
+      {
+        if(m_count==0)
+          {
+            return 0;
+          }
+
+        uint64_t target = std::max<uint64_t>(1,static_cast<uint64_t>(p/100.0*m_count+0.5));
+        uint64_t cumulative = 0;
+
+        for(size_t i=0;i<m_buckets.size();i++)
+          {
+            cumulative += m_buckets[i];
+            if(cumulative>=target)
+              {
+                return std::min(highestEquivalent(i),m_max);
+              }
+          }
+
+        return m_max;
+      }
+
+      void
+      reset()
+      {
+        std::fill(m_buckets.begin(),m_buckets.end(),0);
+        m_count = 0;
+        m_sum = 0;
+        m_min = UINT64_MAX;
+        m_max = 0;
+      }
+
+      uint64_t getCount() const {return m_count;}
+      double getMean() const {return m_count>0 ? m_sum/m_count : 0.0;}
+      uint64_t getMin() const {return m_count>0 ? m_min : 0;}
+      uint64_t getMax() const {return m_max;}
+
+    private:
+      size_t
+      index(uint64_t value) const
+      {
+        if(value<(m_half << 1))
+          {
+            return value;
+          }
+
+        unsigned int msb = 63-__builtin_clzll(value);
+        unsigned int shift = msb-(m_sub_bits-1);
+
+        return shift*m_half+(value >> shift);
+      }
+
+      uint64_t
+      highestEquivalent(size_t idx) const
+      {
+        if(idx<(m_half << 1))
+          {
+            return idx;
+          }
+
+        uint64_t shift = idx/m_half-1;
+        uint64_t mantissa = idx-shift*m_half;
+
+        return ((mantissa+1) << shift)-1;
+      }
+
+      unsigned int m_sub_bits;
+      unsigned int m_max_exp;
+      uint64_t m_half;
+      std::vector<uint64_t> m_buckets;
+      uint64_t m_count = 0;
+      double m_sum = 0;
+      uint64_t m_min = UINT64_MAX;
+      uint64_t m_max = 0;
+  };
+}
+
+#endif // HDR_HISTOGRAM_H
@@ -0,0 +1,184 @@
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <stdint.h>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include "ns3/simulator.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+
+namespace ns3
+{
+  /*
+   * Hashed timing wheel driven by a single ns-3 event
+   * Items are stored in the bucket of the first tick following their expiration time, and the expiration callback
+   * is called for them when the wheel reaches that tick. Expirations are thus delayed by at most one granularity
+   * interval with respect to the requested delay
+   * The wheel only keeps an event scheduled while it contains at least one item, at the first tick with an item to
+   * expire: empty ticks are skipped, so that a fine granularity does not cost one event per tick when the items
+   * expire far apart. The event is re-scheduled on insertion only when the new item expires before it, so that
+   * thousands of lifetimes refreshed at every received packet do not cost one scheduler operation each
+   * Items cannot be removed: users which need to postpone an expiration should check, inside the callback, whether
+   * the item is still valid and re-insert it with the remaining delay
+   */
+  template <typename T>
+  class TimingWheel
+  {
+    public:
+      typedef std::function<void(const T&)> ExpireCallback;
+
+      TimingWheel() : m_granularity(MilliSeconds(100)), m_tick(0), m_next_tick(0), m_items(0), m_advancing(false) {m_buckets.resize(m_default_buckets);}
+      ~TimingWheel() {m_event.Cancel();}
+
+      TimingWheel(const TimingWheel&) = delete;
+      TimingWheel& operator=(const TimingWheel&) = delete;
+
+      // 'horizon' should be the maximum delay normally used, to size the wheel so that each item is visited only once
+      void
+      setup(Time granularity, Time horizon, ExpireCallback callback)
+      {
+        clear();
+        m_granularity = granularity;
+        m_callback = callback;
+        m_buckets.assign(horizon.GetTimeStep()/granularity.GetTimeStep()+2,std::vector<wheel_item_t>());
+      }
+
+      void
+      insert(const T &item, Time delay)
+      {
+        uint64_t now_tick = Simulator::Now().GetTimeStep()/m_granularity.GetTimeStep();
+
+        if(!m_advancing && !m_event.IsRunning())
+          {
+            // Align the wheel to the current time (it may have been idle for a long time)
+            m_tick = now_tick;
+          }
+
+        int64_t expiry = Simulator::Now().GetTimeStep()+delay.GetTimeStep();
+        uint64_t expiry_tick = (expiry+m_granularity.GetTimeStep()-1)/m_granularity.GetTimeStep();
+
+        if(expiry_tick<=now_tick)
+          {
+            expiry_tick=now_tick+1;
+          }
+
+        m_buckets[expiry_tick%m_buckets.size()].push_back({item,expiry_tick});
+        m_items++;
+
+        // While advancing, the next tick is computed at the end of advance()
+        if(!m_advancing && (!m_event.IsRunning() || expiry_tick<m_next_tick))
+          {
+            m_event.Cancel();
+            scheduleTick(expiry_tick);
+          }
+      }
+
+      void
+      clear()
+      {
+        m_event.Cancel();
+        for(auto &bucket : m_buckets)
+          {
+            bucket.clear();
+          }
+        m_items=0;
+      }
+
+      size_t size() const {return m_items;}
+      Time getGranularity() const {return m_granularity;}
+
+    private:
+      typedef struct _wheel_item {
+        T item;
+        uint64_t expiry_tick;
+      } wheel_item_t;
+
+      static const size_t m_default_buckets = 64;
+
+      Time tickTime(uint64_t tick) const {return TimeStep(tick*m_granularity.GetTimeStep());}
+
+      void
+      scheduleTick(uint64_t tick)
+      {
+        m_next_tick = tick;
+        m_event = Simulator::Schedule(tickTime(tick)-Simulator::Now(),&TimingWheel<T>::advance,this);
+      }
+
+      // First tick, after the current one, at which an item expires
+      // Items stored in an earlier bucket but belonging to a later revolution expire at least one revolution after
+      // that bucket, so the scan can stop at the first bucket with an item expiring in the current revolution
+      uint64_t
+      nextTick() const
+      {
+        uint64_t next = UINT64_MAX;
+
+        for(uint64_t k=1;k<=m_buckets.size();k++)
+          {
+            for(const wheel_item_t &it : m_buckets[(m_tick+k)%m_buckets.size()])
+              {
+                next = std::min(next,it.expiry_tick);
+              }
+
+            if(next<=m_tick+k)
+              {
+                break;
+              }
+          }
+
+        return next;
+      }
+
+      void
+      advance()
+      {
+        m_tick = m_next_tick;
+        m_advancing=true;
+
+        // Swap the bucket out, so that the callbacks can safely insert new items in the wheel
+        std::vector<wheel_item_t> expired;
+        expired.swap(m_buckets[m_tick%m_buckets.size()]);
+
+        for(const wheel_item_t &it : expired)
+          {
+            if(it.expiry_tick>m_tick)
+              {
+                // Delay longer than a whole revolution: wait for the next round
+                m_buckets[it.expiry_tick%m_buckets.size()].push_back(it);
+                continue;
+              }
+
+            m_items--;
+            if(m_callback)
+              {
+                m_callback(it.item);
+              }
+          }
+
+        // Give back the (already allocated) storage, if the bucket was not refilled in the meantime
+        if(m_buckets[m_tick%m_buckets.size()].empty())
+          {
+            expired.clear();
+            expired.swap(m_buckets[m_tick%m_buckets.size()]);
+          }
+
+        m_advancing=false;
+        if(m_items>0)
+          {
+            scheduleTick(nextTick());
+          }
+      }
+
+      Time m_granularity;
+      ExpireCallback m_callback;
+      std::vector<std::vector<wheel_item_t>> m_buckets;
+      uint64_t m_tick; //! Last tick reached by the wheel
+      uint64_t m_next_tick; //! Tick of the scheduled event
+      size_t m_items;
+      bool m_advancing;
+      EventId m_event;
+  };
+}
+
+#endif // TIMING_WHEEL_H
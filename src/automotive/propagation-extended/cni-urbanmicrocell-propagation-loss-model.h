@@ -25,6 +25,9 @@
 
 #include <ns3/propagation-loss-model.h>
 #include <ns3/propagation-environment.h>
+#include <ns3/nstime.h>
+#include <ns3/vector.h>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -35,6 +38,14 @@ namespace ns3 {
  * 
  * This class implements the outdoor propagation model for 6 GHz based on 3GPP sepcifications:
  * 3GPP TR 36.885 V14.0.0 (2016-06) / Section A.1.4
+ *
+ * When "CacheEnabled" is set, the deterministic part of the loss (LOS and NLOS pathloss, LOS probability and free space
+ * loss) is cached for each ordered pair of mobility models, and it is recomputed only when one of the two nodes has moved
+ * by more than "CacheDistanceThreshold" meters (by default, at any change of position), or after InvalidateCache() is
+ * called.
+ * The cache is disabled by default, as its memory grows with the square of the number of nodes.
+ * The random number used to select LOS or NLOS is drawn once per (unordered) pair of nodes, and it is kept for
+ * "CoherenceTime" (by default, for the whole simulation).
  */
 class CniUrbanmicrocellPropagationLossModel : public PropagationLossModel
 {
@@ -70,6 +81,19 @@ public:
 
   };
 
+  /**
+   * hash function for MobilityDuo
+   */
+  struct MobilityDuoHash
+  {
+    std::size_t operator() (const MobilityDuo& duo) const
+    {
+      std::size_t ha = std::hash<const MobilityModel*> () (PeekPointer (duo.a));
+      std::size_t hb = std::hash<const MobilityModel*> () (PeekPointer (duo.b));
+      return ha ^ (hb + 0x9e3779b97f4a7c15ULL + (ha << 6) + (ha >> 2));
+    }
+  };
+
   // inherited from Object
   static TypeId GetTypeId (void);
   CniUrbanmicrocellPropagationLossModel ();
@@ -93,8 +117,55 @@ public:
    */
   double GetLoss (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
 
+  /**
+   * Force the recomputation of the deterministic loss of all the pairs of nodes (e.g. after a mobility update
+   * which moved the nodes by less than the distance threshold)
+   */
+  void InvalidateCache (void);
+
+  /**
+   * \return the number of GetLoss() calls which used the cached loss
+   */
+  uint64_t GetCacheHits (void) const;
+  /**
+   * \return the number of GetLoss() calls which computed the loss
+   */
+  uint64_t GetCacheMisses (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
 private:
 
+  /**
+   * random number used to select LOS or NLOS, for a pair of nodes
+   */
+  struct PairDraw
+  {
+    double value; ///< random number in [0,1]
+    Time drawTime; ///< time at which the number was drawn
+  };
+
+  /**
+   * deterministic part of the loss, for an ordered pair of nodes
+   */
+  struct PairLoss
+  {
+    Vector posA; ///< position of the first node when the loss was computed
+    Vector posB; ///< position of the second node when the loss was computed
+    double losLoss; ///< LOS pathloss (0 below the minimum distance of the model)
+    double nlosLoss; ///< NLOS pathloss (0 below the minimum distance of the model)
+    double plos; ///< LOS probability
+    double freeLoss; ///< free space loss
+    uint64_t epoch; ///< value of m_cacheEpoch when the loss was computed
+    PairDraw *draw; ///< random number of the pair, stored in m_randomMap
+  };
+
+  void ComputeLoss (const Vector &posA, const Vector &posB, PairLoss &pl) const;
+  PairDraw *GetDraw (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
+  double GetDrawValue (PairDraw *draw) const;
+  double CombineLoss (const PairLoss &pl, double r) const;
+
   // inherited from PropagationLossModel
   virtual double DoCalcRxPower (double txPowerDbm, Ptr<MobilityModel> a, Ptr<MobilityModel> b) const;
   virtual int64_t DoAssignStreams (int64_t stream);
@@ -104,8 +175,16 @@ private:
   bool m_isLosEnabled;
   Ptr<UniformRandomVariable> m_rand;
   // Map to keep track of random numbers generated per pair of nodes
-  //mutable std::map<Ptr<MobilityModel>, std::map<Ptr<MobilityModel>, double> > m_randomMap;
-  mutable std::map<MobilityDuo, double> m_randomMap;
+  // The elements of an unordered_map are never moved, so they can be referenced by the entries of m_lossCache
+  mutable std::unordered_map<MobilityDuo, PairDraw, MobilityDuoHash> m_randomMap;
+  Time m_coherenceTime;
+
+  bool m_cacheEnabled;
+  double m_cacheDistanceThreshold;
+  mutable std::unordered_map<MobilityDuo, PairLoss, MobilityDuoHash> m_lossCache;
+  uint64_t m_cacheEpoch;
+  mutable uint64_t m_cacheHits;
+  mutable uint64_t m_cacheMisses;
 
 };
 
@@ -0,0 +1,270 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/caBasicService.h"
+#include "ns3/geonet.h"
+#include "ns3/btp.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "automotive-test-vdp.h"
+
+using namespace ns3;
+
+namespace
+{
+  const double lat0 = 45.0;
+  const double lon0 = 7.6;
+  const double metersPerDegree = 111320.0;
+
+  // Mobility trace, with a position update every 100 ms (like a SUMO step), 50 ms after the T_CheckCamGen grid
+  const Time updateOffset = MilliSeconds (50);
+  const Time updatePeriod = MilliSeconds (100);
+  const Time camStart = Seconds (1.0);
+  const Time simEnd = Seconds (20.0);
+
+  // Each phase of the trace is meant to exercise a different CAM generation condition:
+  // [0,3.5) s stopped (T_GenCamMax), [3.5,7.5) s accelerating at 2 m/s^2 (speed), [7.5,10) s at a constant 8 m/s
+  // (distance), [10,12) s turning at 20 deg/s (heading), [12,14) s braking at 4 m/s^2 (speed), then stopped (T_GenCamMax)
+  const double phaseAccelStart = 3.5;
+  const double phaseConstStart = 7.5;
+  const double phaseTurnStart = 10.0;
+  const double phaseBrakeStart = 12.0;
+  const double phaseStopStart = 14.0;
+
+  void
+  phaseRates (double t, double &accel, double &yawrate)
+  {
+    accel = 0;
+    yawrate = 0;
+
+    if (t >= phaseAccelStart && t < phaseConstStart)
+      {
+        accel = 2.0;
+      }
+    else if (t >= phaseTurnStart && t < phaseBrakeStart)
+      {
+        yawrate = 20.0;
+      }
+    else if (t >= phaseBrakeStart && t < phaseStopStart)
+      {
+        accel = -4.0;
+      }
+  }
+}
+
+// The predictive CAM trigger must generate the CAMs at the same times as the polling one (within T_CheckCamGen), as it
+// checks the same ETSI EN 302 637-2 conditions on the same time grid, only skipping the checks which cannot be met
+class CamTriggerPredictiveTestCase : public TestCase
+{
+public:
+  CamTriggerPredictiveTestCase ();
+  virtual ~CamTriggerPredictiveTestCase ();
+
+private:
+  virtual void DoRun (void);
+  std::vector<Time> RunTrace (CAMTriggerMode_t mode);
+  void MobilityStep (double t);
+
+  VDPTestStub *m_vdp;
+  Ptr<ConstantPositionMobilityModel> m_mobility;
+  double m_x, m_y, m_heading, m_speed, m_distance;
+};
+
+CamTriggerPredictiveTestCase::CamTriggerPredictiveTestCase ()
+  : TestCase ("The predictive CAM trigger generates the same CAMs as the polling one")
+{
+}
+
+CamTriggerPredictiveTestCase::~CamTriggerPredictiveTestCase ()
+{
+}
+
+void
+CamTriggerPredictiveTestCase::MobilityStep (double t)
+{
+  double dt = updatePeriod.GetSeconds ();
+  double accel, yawrate;
+
+  // Rates of the interval ending at this update
+  phaseRates (t-dt,accel,yawrate);
+
+  double speed = std::max (m_speed+accel*dt,0.0);
+  double heading = std::fmod (m_heading+yawrate*dt,360.0);
+  double step = (m_speed+speed)/2*dt;
+  // The displacement follows the heading in the middle of the interval (clockwise from north, with y pointing north)
+  double mid_heading = (m_heading+yawrate*dt/2)*M_PI/180.0;
+
+  m_x += step*std::sin (mid_heading);
+  m_y += step*std::cos (mid_heading);
+  m_speed = speed;
+  m_heading = heading;
+  m_distance += step;
+
+  m_vdp->setPosition (lat0+m_y/metersPerDegree,lon0+m_x/(metersPerDegree*std::cos (lat0*M_PI/180.0)));
+  m_vdp->setSpeedValue (m_speed);
+  m_vdp->setHeadingValue (m_heading);
+  m_vdp->setTravelledDistance (m_distance);
+  m_mobility->SetPosition (Vector (m_x,m_y,0.0));
+}
+
+std::vector<Time>
+CamTriggerPredictiveTestCase::RunTrace (CAMTriggerMode_t mode)
+{
+  std::vector<Time> camTimes;
+
+  NodeContainer nodes;
+  nodes.Create (2);
+
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetChannel (channel);
+      nodes.Get (i)->AddDevice (device);
+    }
+
+  PacketSocketHelper packetSocket;
+  packetSocket.Install (nodes);
+
+  m_x = 0;
+  m_y = 0;
+  m_heading = 90.0;
+  m_speed = 0;
+  m_distance = 0;
+  VDPTestStub senderVdp (lat0,lon0);
+  VDPTestStub receiverVdp (lat0,lon0);
+  m_vdp = &senderVdp;
+  m_vdp->setHeadingValue (m_heading);
+  m_mobility = CreateObject<ConstantPositionMobilityModel> ();
+  m_mobility->SetPosition (Vector (m_x,m_y,0.0));
+
+  // Sender vehicle
+  Ptr<GeoNet> senderGeoNet = CreateObject<GeoNet> ();
+  Ptr<btp> senderBtp = CreateObject<btp> ();
+  Ptr<CABasicService> sender = CreateObject<CABasicService> ();
+  Ptr<Socket> senderSocket = GeoNet::createGNPacketSocket (nodes.Get (0));
+  senderBtp->setGeoNet (senderGeoNet);
+  sender->setBTP (senderBtp);
+  sender->setSocketTx (senderSocket);
+  sender->setSocketRx (senderSocket);
+  sender->setStationProperties (1,StationType_passengerCar);
+  senderBtp->setVDP (&senderVdp);
+  sender->setVDP (&senderVdp);
+  sender->setTriggerMode (mode);
+  sender->setMobilityModel (m_mobility);
+
+  // Receiver RSU, recording the CAM generation times (the channel has no propagation delay)
+  Ptr<GeoNet> receiverGeoNet = CreateObject<GeoNet> ();
+  Ptr<btp> receiverBtp = CreateObject<btp> ();
+  Ptr<CABasicService> receiver = CreateObject<CABasicService> ();
+  Ptr<Socket> receiverSocket = GeoNet::createGNPacketSocket (nodes.Get (1));
+  receiverBtp->setGeoNet (receiverGeoNet);
+  receiver->setBTP (receiverBtp);
+  receiver->setSocketTx (receiverSocket);
+  receiver->setSocketRx (receiverSocket);
+  receiver->setStationProperties (2,StationType_roadSideUnit);
+  receiverBtp->setVDP (&receiverVdp);
+  receiver->setVDP (&receiverVdp);
+  receiver->setFixedPositionRSU (lat0,lon0);
+  receiver->addCARxCallback ([&camTimes] (asn1cpp::Seq<CAM> cam, Address from) {
+    camTimes.push_back (Simulator::Now ());
+  });
+
+  for (Time t = updateOffset; t < simEnd; t += updatePeriod)
+    {
+      Simulator::Schedule (t,&CamTriggerPredictiveTestCase::MobilityStep,this,t.GetSeconds ());
+    }
+
+  sender->startCamDissemination (camStart.GetSeconds ());
+  Simulator::Stop (simEnd);
+  Simulator::Run ();
+
+  sender->terminateDissemination ();
+  senderGeoNet->cleanup ();
+  receiverGeoNet->cleanup ();
+  Simulator::Destroy ();
+  m_mobility = nullptr;
+  m_vdp = nullptr;
+
+  return camTimes;
+}
+
+void
+CamTriggerPredictiveTestCase::DoRun (void)
+{
+  // Both traces end with several seconds without any dynamics-related CAM, so that the state of the CAM generation
+  // frequency management is the initial one at the beginning of each run
+  std::vector<Time> polling = RunTrace (CAM_TRIGGER_POLLING);
+  std::vector<Time> predictive = RunTrace (CAM_TRIGGER_PREDICTIVE);
+  // Default T_CheckCamGen of the CA Basic Service
+  Time tolerance = MilliSeconds (100);
+
+  NS_TEST_ASSERT_MSG_GT (polling.size (), 0, "No CAM received with the polling trigger");
+  NS_TEST_ASSERT_MSG_EQ (predictive.size (), polling.size (), "Different number of CAMs with the predictive trigger");
+  for (size_t i = 0; i < polling.size (); i++)
+    {
+      Time diff = predictive[i] > polling[i] ? predictive[i] - polling[i] : polling[i] - predictive[i];
+      NS_TEST_EXPECT_MSG_LT_OR_EQ (diff, tolerance, "CAM " << i << " generated at " << predictive[i].GetSeconds () <<
+                                   " s with the predictive trigger and at " << polling[i].GetSeconds () << " s with the polling one");
+    }
+
+  // Check that each phase of the trace actually triggers the expected generation condition (with the polling trigger,
+  // whose checks are not skipped): T_GenCamMax when stopped, and a shorter interval in all the other phases
+  auto intervalsIn = [&polling] (double start, double end) {
+    std::vector<double> intervals;
+    for (size_t i = 1; i < polling.size (); i++)
+      {
+        if (polling[i-1].GetSeconds () >= start && polling[i].GetSeconds () < end)
+          {
+            intervals.push_back (polling[i].GetSeconds () - polling[i-1].GetSeconds ());
+          }
+      }
+    return intervals;
+  };
+
+  std::vector<std::pair<double,double>> dynamicPhases = {{phaseAccelStart+0.5,phaseConstStart},
+                                                         {phaseConstStart+0.5,phaseTurnStart},
+                                                         {phaseTurnStart+0.5,phaseBrakeStart},
+                                                         {phaseBrakeStart,phaseStopStart}};
+  for (auto phase : dynamicPhases)
+    {
+      std::vector<double> intervals = intervalsIn (phase.first,phase.second);
+      NS_TEST_EXPECT_MSG_GT (intervals.size (), 0, "No CAMs between " << phase.first << " s and " << phase.second << " s");
+      for (double interval : intervals)
+        {
+          NS_TEST_EXPECT_MSG_LT (interval, 0.999, "Dynamics-related condition not triggered between " << phase.first <<
+                                 " s and " << phase.second << " s");
+        }
+    }
+
+  std::vector<std::pair<double,double>> stoppedPhases = {{camStart.GetSeconds (),phaseAccelStart},
+                                                         {phaseStopStart+1.0,simEnd.GetSeconds ()}};
+  for (auto phase : stoppedPhases)
+    {
+      std::vector<double> intervals = intervalsIn (phase.first,phase.second);
+      NS_TEST_EXPECT_MSG_GT (intervals.size (), 0, "No CAMs between " << phase.first << " s and " << phase.second << " s");
+      for (double interval : intervals)
+        {
+          NS_TEST_EXPECT_MSG_EQ_TOL (interval, 1.0, 1e-6, "T_GenCamMax not respected while the vehicle is stopped");
+        }
+    }
+}
+
+class AutomotiveCamTriggerTestSuite : public TestSuite
+{
+public:
+  AutomotiveCamTriggerTestSuite ();
+};
+
+AutomotiveCamTriggerTestSuite::AutomotiveCamTriggerTestSuite ()
+  : TestSuite ("automotive-cam-trigger", UNIT)
+{
+  AddTestCase (new CamTriggerPredictiveTestCase, TestCase::QUICK);
+}
+
+static AutomotiveCamTriggerTestSuite automotiveCamTriggerTestSuite;
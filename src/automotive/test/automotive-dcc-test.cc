@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/dcc.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/yans-wifi-phy.h"
+
+using namespace ns3;
+
+// CBR measured by the DCC from the busy intervals (notifyChannelBusy(), e.g. fed by the 802.11p PHY state) and from the
+// busy fractions of the channel resources (notifyChannelOccupancy(), e.g. fed by the SlChannelOccupancy trace of the
+// C-V2X PHY), over consecutive T_CBR=100 ms windows
+class DccCbrMeasurementTestCase : public TestCase
+{
+public:
+  DccCbrMeasurementTestCase ();
+  virtual ~DccCbrMeasurementTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void NotifyBusy (Time delay, Time duration);
+  void NotifyOccupancy (Time duration, double fraction);
+  void CheckCBR (double expected, std::string msg);
+
+  Ptr<DCC> m_dcc;
+};
+
+DccCbrMeasurementTestCase::DccCbrMeasurementTestCase ()
+  : TestCase ("DCC CBR measurement from busy intervals and channel occupancy fractions")
+{
+}
+
+DccCbrMeasurementTestCase::~DccCbrMeasurementTestCase ()
+{
+}
+
+void
+DccCbrMeasurementTestCase::NotifyBusy (Time delay, Time duration)
+{
+  m_dcc->notifyChannelBusy (Simulator::Now ()+delay,duration);
+}
+
+void
+DccCbrMeasurementTestCase::NotifyOccupancy (Time duration, double fraction)
+{
+  m_dcc->notifyChannelOccupancy (duration,fraction);
+}
+
+void
+DccCbrMeasurementTestCase::CheckCBR (double expected, std::string msg)
+{
+  NS_TEST_EXPECT_MSG_EQ_TOL (m_dcc->getCBR (),expected,1e-9,msg);
+}
+
+void
+DccCbrMeasurementTestCase::DoRun (void)
+{
+  m_dcc = CreateObject<DCC> ();
+  // The PHY is used only to start the CBR measurement: the busy time is notified directly by the test
+  Ptr<YansWifiPhy> phy = CreateObject<YansWifiPhy> ();
+  m_dcc->attachWifiPhy (phy);
+
+  // Window 0: two overlapping busy intervals, [10,40) ms and [20,50) ms, counted once -> 0.4
+  Simulator::Schedule (MilliSeconds (10),&DccCbrMeasurementTestCase::NotifyBusy,this,Seconds (0),MilliSeconds (30));
+  Simulator::Schedule (MilliSeconds (10),&DccCbrMeasurementTestCase::NotifyBusy,this,MilliSeconds (10),MilliSeconds (30));
+  // Window 1: half of the resources busy for 40 ms and a quarter of them for 20 ms -> 0.2 + 0.05
+  Simulator::Schedule (MilliSeconds (120),&DccCbrMeasurementTestCase::NotifyOccupancy,this,MilliSeconds (40),0.5);
+  Simulator::Schedule (MilliSeconds (150),&DccCbrMeasurementTestCase::NotifyOccupancy,this,MilliSeconds (20),0.25);
+  // Windows 2 and 3: all the resources busy for 40 ms across the boundary -> 0.2 in each window
+  Simulator::Schedule (MilliSeconds (280),&DccCbrMeasurementTestCase::NotifyOccupancy,this,MilliSeconds (40),1.0);
+
+  // Each window is evaluated one T_CBR after its end and the CBR is averaged over the last two windows
+  Simulator::Schedule (MilliSeconds (250),&DccCbrMeasurementTestCase::CheckCBR,this,0.4,
+                       "Wrong CBR for overlapping busy intervals");
+  Simulator::Schedule (MilliSeconds (350),&DccCbrMeasurementTestCase::CheckCBR,this,(0.25+0.4)/2.0,
+                       "Wrong CBR for partially occupied channel resources");
+  Simulator::Schedule (MilliSeconds (450),&DccCbrMeasurementTestCase::CheckCBR,this,(0.2+0.25)/2.0,
+                       "Wrong CBR for an occupancy spanning two windows");
+  Simulator::Schedule (MilliSeconds (550),&DccCbrMeasurementTestCase::CheckCBR,this,(0.2+0.2)/2.0,
+                       "Wrong CBR for an occupancy spanning two windows");
+
+  Simulator::Stop (MilliSeconds (600));
+  Simulator::Run ();
+
+  m_dcc->cleanup ();
+  m_dcc = nullptr;
+  Simulator::Destroy ();
+}
+
+class AutomotiveDccTestSuite : public TestSuite
+{
+public:
+  AutomotiveDccTestSuite ();
+};
+
+AutomotiveDccTestSuite::AutomotiveDccTestSuite ()
+  : TestSuite ("automotive-dcc", UNIT)
+{
+  AddTestCase (new DccCbrMeasurementTestCase, TestCase::QUICK);
+}
+
+static AutomotiveDccTestSuite automotiveDccTestSuite;
@@ -0,0 +1,217 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/denBasicService.h"
+#include "ns3/timing-wheel.h"
+#include "ns3/asn_utils.h"
+#include "ns3/geonet.h"
+#include "ns3/btp.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/packet-socket-helper.h"
+#include "automotive-test-vdp.h"
+
+using namespace ns3;
+
+namespace
+{
+  const double lat0 = 45.0;
+  const double lon0 = 7.6;
+}
+
+// A fine-grained wheel must only wake up at the ticks with an item to expire, and an item inserted while the wheel is
+// waiting for a later tick must still expire on time
+class TimingWheelSparseTicksTestCase : public TestCase
+{
+public:
+  TimingWheelSparseTicksTestCase ();
+  virtual ~TimingWheelSparseTicksTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Insert (int item, Time delay);
+
+  TimingWheel<int> m_wheel;
+  std::vector<std::pair<int,Time>> m_expired;
+};
+
+TimingWheelSparseTicksTestCase::TimingWheelSparseTicksTestCase ()
+  : TestCase ("The timing wheel skips the ticks without expiring items")
+{
+}
+
+TimingWheelSparseTicksTestCase::~TimingWheelSparseTicksTestCase ()
+{
+}
+
+void
+TimingWheelSparseTicksTestCase::Insert (int item, Time delay)
+{
+  m_wheel.insert (item,delay);
+}
+
+void
+TimingWheelSparseTicksTestCase::DoRun (void)
+{
+  // Same configuration as the DEN Basic Service timers
+  m_wheel.setup (MilliSeconds (1),Seconds (1),[this] (const int &item) {m_expired.push_back ({item,Simulator::Now ()});});
+
+  Simulator::Schedule (Seconds (0),&TimingWheelSparseTicksTestCase::Insert,this,1,Seconds (600));
+  Simulator::Schedule (MilliSeconds (1500),&TimingWheelSparseTicksTestCase::Insert,this,2,MilliSeconds (10));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_expired.size (), 2, "Wrong number of expired items");
+  NS_TEST_EXPECT_MSG_EQ (m_expired[0].first, 2, "The item inserted last, with the shortest delay, should expire first");
+  NS_TEST_EXPECT_MSG_EQ (m_expired[0].second, MilliSeconds (1510), "Item inserted in a waiting wheel expired late");
+  NS_TEST_EXPECT_MSG_EQ (m_expired[1].first, 1, "Wrong second expired item");
+  NS_TEST_EXPECT_MSG_EQ (m_expired[1].second, Seconds (600), "Long delay item expired at the wrong time");
+  // Only the two insertions and the two expirations, instead of one event per tick (1 ms) for 600 s
+  NS_TEST_EXPECT_MSG_LT (Simulator::GetEventCount (), 10, "The wheel woke up at empty ticks");
+
+  Simulator::Destroy ();
+}
+
+// An ActionID whose T_R_Validity expires and which is then received again, before the wheel item of its first
+// (longer) validity fires: the new receiving entry must not be erased by that stale item. The erasure would be visible
+// as a repetition of the new DENM being passed again to the application, as a new DENM
+class DenStaleValidityTestCase : public TestCase
+{
+public:
+  DenStaleValidityTestCase ();
+  virtual ~DenStaleValidityTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Trigger (Ptr<DENBasicService> service, long validity_s, bool repeated);
+  void Update (Ptr<DENBasicService> service, long validity_s);
+
+  DEN_ActionID_t m_actionID;
+};
+
+DenStaleValidityTestCase::DenStaleValidityTestCase ()
+  : TestCase ("A stale T_R_Validity expiration does not erase a re-created receiving entry")
+{
+}
+
+DenStaleValidityTestCase::~DenStaleValidityTestCase ()
+{
+}
+
+void
+DenStaleValidityTestCase::Trigger (Ptr<DENBasicService> service, long validity_s, bool repeated)
+{
+  denData data;
+
+  data.setDenmMandatoryFields (compute_timestampIts (false),lat0,lon0);
+  data.setValidityDuration (validity_s);
+  if (repeated)
+    {
+      // One repetition per second, for the whole validity
+      data.setDenmRepetition (validity_s*1000,1000);
+    }
+
+  NS_TEST_ASSERT_MSG_EQ (service->appDENM_trigger (data,m_actionID), DENM_NO_ERROR, "Cannot trigger the DENM");
+}
+
+void
+DenStaleValidityTestCase::Update (Ptr<DENBasicService> service, long validity_s)
+{
+  denData data;
+
+  data.setDenmMandatoryFields (compute_timestampIts (false),lat0,lon0);
+  data.setValidityDuration (validity_s);
+
+  NS_TEST_ASSERT_MSG_EQ (service->appDENM_update (data,m_actionID), DENM_NO_ERROR, "Cannot update the DENM");
+}
+
+void
+DenStaleValidityTestCase::DoRun (void)
+{
+  // Two originators with the same station ID (e.g. an ITS-S restarted with a new DEN Basic Service), and one receiver
+  NodeContainer nodes;
+  nodes.Create (3);
+
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      device->SetChannel (channel);
+      nodes.Get (i)->AddDevice (device);
+    }
+
+  PacketSocketHelper packetSocket;
+  packetSocket.Install (nodes);
+
+  GeoArea_t geoArea = {};
+  geoArea.posLat = (int32_t) (lat0*DOT_ONE_MICRO);
+  geoArea.posLong = (int32_t) (lon0*DOT_ONE_MICRO);
+  geoArea.distA = 500;
+  geoArea.shape = CIRCULAR;
+
+  const unsigned long stationIDs[3] = {100,100,200};
+  std::vector<VDPTestStub> vdps (nodes.GetN (),VDPTestStub (lat0,lon0));
+  std::vector<Ptr<DENBasicService>> services;
+  std::vector<Ptr<GeoNet>> geonets;
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      Ptr<GeoNet> geonet = CreateObject<GeoNet> ();
+      Ptr<btp> btpObj = CreateObject<btp> ();
+      Ptr<DENBasicService> service = CreateObject<DENBasicService> ();
+      Ptr<Socket> socket = GeoNet::createGNPacketSocket (nodes.Get (i));
+
+      btpObj->setGeoNet (geonet);
+      service->setBTP (btpObj);
+      service->setSocketTx (socket);
+      service->setSocketRx (socket);
+      service->setStationProperties (stationIDs[i],StationType_roadSideUnit);
+      service->setVDP (&vdps[i]);
+      service->setFixedPositionRSU (lat0,lon0);
+      service->setGeoArea (geoArea);
+
+      services.push_back (service);
+      geonets.push_back (geonet);
+    }
+
+  std::vector<Time> received;
+  services[2]->addDENRxCallback ([&received] (denData data, Address from) {
+    received.push_back (Simulator::Now ());
+  });
+
+  // First originator: validity of 5 s (wheel item at 5.1 s), then shortened to 1 s by an update (expiration at 2.1 s)
+  Simulator::Schedule (MilliSeconds (100),&DenStaleValidityTestCase::Trigger,this,services[0],5,false);
+  Simulator::Schedule (MilliSeconds (1100),&DenStaleValidityTestCase::Update,this,services[0],1);
+  // Second originator: same ActionID (same station ID and first sequence number), repeated every second
+  Simulator::Schedule (MilliSeconds (3500),&DenStaleValidityTestCase::Trigger,this,services[1],10,true);
+
+  Simulator::Stop (Seconds (8));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (received.size (), 3, "The repetitions of the re-received DENM were passed to the application");
+  NS_TEST_EXPECT_MSG_EQ (received[0], MilliSeconds (100), "Wrong reception time of the first DENM");
+  NS_TEST_EXPECT_MSG_EQ (received[1], MilliSeconds (1100), "Wrong reception time of the updated DENM");
+  NS_TEST_EXPECT_MSG_EQ (received[2], MilliSeconds (3500), "Wrong reception time of the re-received DENM");
+
+  for (uint32_t i = 0; i < services.size (); i++)
+    {
+      services[i]->cleanup ();
+    }
+  Simulator::Destroy ();
+}
+
+class AutomotiveDenTimersTestSuite : public TestSuite
+{
+public:
+  AutomotiveDenTimersTestSuite ();
+};
+
+AutomotiveDenTimersTestSuite::AutomotiveDenTimersTestSuite ()
+  : TestSuite ("automotive-den-timers", UNIT)
+{
+  AddTestCase (new TimingWheelSparseTicksTestCase, TestCase::QUICK);
+  AddTestCase (new DenStaleValidityTestCase, TestCase::QUICK);
+}
+
+static AutomotiveDenTimersTestSuite automotiveDenTimersTestSuite;
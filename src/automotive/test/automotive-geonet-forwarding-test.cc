@@ -0,0 +1,436 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/geonet.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/node-container.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/packet-socket-helper.h"
+#include "ns3/PRRSupervisor.h"
+#include "ns3/traci-client.h"
+#include "automotive-test-vdp.h"
+
+using namespace ns3;
+
+namespace
+{
+  // Stations on a line, along the same parallel, with a spacing of about 100 m
+  const double lat0 = 45.0;
+  const double lon0 = 7.6;
+  const double dlon = 0.00127;
+
+  // Stations of a chain, in which each station is in range only of the stations at most "range" positions before
+  // or after it (by default, of the previous and of the next one)
+  struct GeoNetChain
+  {
+    NodeContainer nodes;
+    std::vector<Ptr<SimpleNetDevice>> devices;
+    std::vector<VDPTestStub> vdps;
+    std::vector<Ptr<GeoNet>> geonets;
+    // Number of GBC packets passed to the upper layers by each station
+    std::vector<int> received;
+  };
+
+  void
+  SetupChain (GeoNetChain &chain, uint32_t n, uint32_t range = 1)
+  {
+    chain.nodes.Create (n);
+
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+    for (uint32_t i = 0; i < n; i++)
+      {
+        Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+        device->SetAddress (Mac48Address::Allocate ());
+        device->SetChannel (channel);
+        chain.nodes.Get (i)->AddDevice (device);
+        chain.devices.push_back (device);
+      }
+    for (uint32_t i = 0; i < n; i++)
+      {
+        for (uint32_t j = i + range + 1; j < n; j++)
+          {
+            channel->BlackList (chain.devices[i],chain.devices[j]);
+            channel->BlackList (chain.devices[j],chain.devices[i]);
+          }
+      }
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install (chain.nodes);
+
+    // The stubs are referenced by the GeoNet objects: the vector must not be resized after this point
+    for (uint32_t i = 0; i < n; i++)
+      {
+        chain.vdps.emplace_back (lat0,lon0+i*dlon);
+      }
+
+    chain.received.assign (n,0);
+    for (uint32_t i = 0; i < n; i++)
+      {
+        Ptr<GeoNet> geonet = CreateObject<GeoNet> ();
+        Ptr<Socket> socket = GeoNet::createGNPacketSocket (chain.nodes.Get (i));
+
+        geonet->setVDP (&chain.vdps[i]);
+        geonet->setSocketTx (socket);
+        geonet->setStationProperties (1000+i,StationType_roadSideUnit);
+        geonet->setFixedPositionRSU (lat0,lon0+i*dlon);
+        geonet->setAreaForwardingAlgorithm (GN_AREA_SIMPLE);
+        socket->SetRecvCallback (MakeCallback (&GeoNet::receiveGN,geonet));
+        geonet->addRxCallback ([&chain,i] (GNDataIndication_t dataIndication, Address from) {
+          if (dataIndication.GNType == GBC)
+            {
+              chain.received[i]++;
+            }
+        });
+
+        chain.geonets.push_back (geonet);
+      }
+  }
+
+  void
+  CleanupChain (GeoNetChain &chain)
+  {
+    for (Ptr<GeoNet> geonet : chain.geonets)
+      {
+        geonet->cleanup ();
+      }
+  }
+
+  // GBC request with a circular destination area, centered on the station with the given index in the chain
+  GNDataRequest_t
+  ChainGBCRequest (uint32_t center, uint16_t radius, int16_t maxHL = 3)
+  {
+    GNDataRequest_t dataRequest = {};
+    dataRequest.upperProtocol = BTP_B;
+    dataRequest.GNType = GBC;
+    dataRequest.GNCommProfile = UNSPECIFIED;
+    dataRequest.GNMaxLife = 1;
+    dataRequest.GNMaxHL = maxHL;
+    dataRequest.GNTraClass = 0x02;
+    dataRequest.GnAddress.posLat = (int32_t) (lat0*DOT_ONE_MICRO);
+    dataRequest.GnAddress.posLong = (int32_t) ((lon0+center*dlon)*DOT_ONE_MICRO);
+    dataRequest.GnAddress.distA = radius;
+    dataRequest.GnAddress.shape = CIRCULAR;
+    dataRequest.data = Create<Packet> (100);
+    dataRequest.lenght = dataRequest.data->GetSize ();
+
+    return dataRequest;
+  }
+}
+
+// Multi-hop GBC on a chain A - B - C, in which A and C are not in range: the packet sent by A is re-broadcasted by B
+// and thus received back by A, which is inside the destination area. A must drop it, without passing it to the upper
+// layers and without forwarding it again, while C must receive it exactly once
+class GeoNetOwnPacketDropTestCase : public TestCase
+{
+public:
+  GeoNetOwnPacketDropTestCase ();
+  virtual ~GeoNetOwnPacketDropTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void SendGBC (Ptr<GeoNet> geonet);
+};
+
+GeoNetOwnPacketDropTestCase::GeoNetOwnPacketDropTestCase ()
+  : TestCase ("A GBC packet received back from a forwarder is dropped by its source")
+{
+}
+
+GeoNetOwnPacketDropTestCase::~GeoNetOwnPacketDropTestCase ()
+{
+}
+
+void
+GeoNetOwnPacketDropTestCase::SendGBC (Ptr<GeoNet> geonet)
+{
+  // Circular area centered in B, including all the three stations
+  NS_TEST_ASSERT_MSG_EQ (geonet->sendGN (ChainGBCRequest (1,500)), ACCEPTED, "The GBC packet was not accepted by GeoNetworking");
+}
+
+void
+GeoNetOwnPacketDropTestCase::DoRun (void)
+{
+  GeoNetChain chain;
+  SetupChain (chain,3);
+  std::vector<Ptr<GeoNet>> &geonets = chain.geonets;
+  std::vector<int> &received = chain.received;
+
+  // Let the stations exchange some beacons before sending the GBC packet
+  Simulator::Schedule (Seconds (1.0),&GeoNetOwnPacketDropTestCase::SendGBC,this,geonets[0]);
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+
+  GeoNet::GNForwardingStats_t statsA = geonets[0]->getForwardingStats ();
+  GeoNet::GNForwardingStats_t statsB = geonets[1]->getForwardingStats ();
+  GeoNet::GNForwardingStats_t statsC = geonets[2]->getForwardingStats ();
+
+  NS_TEST_ASSERT_MSG_EQ (received[0], 0, "The source passed its own GBC packet to the upper layers");
+  NS_TEST_ASSERT_MSG_EQ (statsA.forwardedPackets, 0, "The source forwarded its own GBC packet");
+  NS_TEST_ASSERT_MSG_EQ (statsA.redundantRebroadcasts, 1, "The source did not drop its own GBC packet received from B");
+  NS_TEST_ASSERT_MSG_EQ (received[1], 1, "B did not receive the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (statsB.forwardedPackets, 1, "B did not forward the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (received[2], 1, "C did not receive the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (statsC.forwardedPackets, 1, "C did not forward the GBC packet exactly once");
+
+  CleanupChain (chain);
+  Simulator::Destroy ();
+}
+
+// Greedy forwarding on a chain A - B - C - D, with a destination area including only D: each station outside the
+// area unicasts the packet to its neighbour closer to D, so that only the next hop receives it. D receives it with
+// a RHL of 1 and cannot forward it further
+class GeoNetGreedyForwardingTestCase : public TestCase
+{
+public:
+  GeoNetGreedyForwardingTestCase ();
+  virtual ~GeoNetGreedyForwardingTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void SendGBC (Ptr<GeoNet> geonet);
+};
+
+GeoNetGreedyForwardingTestCase::GeoNetGreedyForwardingTestCase ()
+  : TestCase ("Greedy forwarding unicasts a GBC packet to the neighbour closest to the area")
+{
+}
+
+GeoNetGreedyForwardingTestCase::~GeoNetGreedyForwardingTestCase ()
+{
+}
+
+void
+GeoNetGreedyForwardingTestCase::SendGBC (Ptr<GeoNet> geonet)
+{
+  // Circular area centered in D, not including C
+  NS_TEST_ASSERT_MSG_EQ (geonet->sendGN (ChainGBCRequest (3,50)), ACCEPTED, "The GBC packet was not accepted by GeoNetworking");
+}
+
+void
+GeoNetGreedyForwardingTestCase::DoRun (void)
+{
+  GeoNetChain chain;
+  SetupChain (chain,4);
+  for (Ptr<GeoNet> geonet : chain.geonets)
+    {
+      geonet->setNonAreaForwardingAlgorithm (GN_NONAREA_GREEDY);
+    }
+
+  Simulator::Schedule (Seconds (1.0),&GeoNetGreedyForwardingTestCase::SendGBC,this,chain.geonets[0]);
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      GeoNet::GNForwardingStats_t stats = chain.geonets[i]->getForwardingStats ();
+      NS_TEST_ASSERT_MSG_EQ (chain.received[i], 0, "Station " << i << " outside the area passed the GBC packet to the upper layers");
+      NS_TEST_ASSERT_MSG_EQ (stats.greedyUnicasts, 1, "Station " << i << " did not unicast the GBC packet to its next hop");
+      NS_TEST_ASSERT_MSG_EQ (stats.greedyLocalOptimum, 0, "Station " << i << " did not find a next hop closer to the area");
+      NS_TEST_ASSERT_MSG_EQ (stats.redundantRebroadcasts, 0, "Station " << i << " received a unicast not addressed to it");
+    }
+  GeoNet::GNForwardingStats_t statsD = chain.geonets[3]->getForwardingStats ();
+  NS_TEST_ASSERT_MSG_EQ (chain.received[3], 1, "D did not receive the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (statsD.forwardedPackets, 0, "D forwarded the GBC packet with a RHL of 1");
+  NS_TEST_ASSERT_MSG_EQ (statsD.hopLimitDiscards, 1, "D did not discard the GBC packet due to its hop limit");
+
+  CleanupChain (chain);
+  Simulator::Destroy ();
+}
+
+// Area CBF on A, B, C, all in range of each other and inside the destination area: B and C both buffer the packet sent
+// by A, but C, farther from A, has a shorter CBF timer and forwards it first. B receives the packet again while it is
+// still buffered, so it must cancel its timer and discard the buffered copy, without forwarding it
+class GeoNetCBFSuppressionTestCase : public TestCase
+{
+public:
+  GeoNetCBFSuppressionTestCase ();
+  virtual ~GeoNetCBFSuppressionTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void SendGBC (Ptr<GeoNet> geonet);
+};
+
+GeoNetCBFSuppressionTestCase::GeoNetCBFSuppressionTestCase ()
+  : TestCase ("A duplicate of a buffered GBC packet cancels its CBF timer")
+{
+}
+
+GeoNetCBFSuppressionTestCase::~GeoNetCBFSuppressionTestCase ()
+{
+}
+
+void
+GeoNetCBFSuppressionTestCase::SendGBC (Ptr<GeoNet> geonet)
+{
+  NS_TEST_ASSERT_MSG_EQ (geonet->sendGN (ChainGBCRequest (1,500)), ACCEPTED, "The GBC packet was not accepted by GeoNetworking");
+}
+
+void
+GeoNetCBFSuppressionTestCase::DoRun (void)
+{
+  GeoNetChain chain;
+  SetupChain (chain,3,2);
+  for (Ptr<GeoNet> geonet : chain.geonets)
+    {
+      geonet->setAreaForwardingAlgorithm (GN_AREA_CBF);
+    }
+
+  Simulator::Schedule (Seconds (1.0),&GeoNetCBFSuppressionTestCase::SendGBC,this,chain.geonets[0]);
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+
+  GeoNet::GNForwardingStats_t statsA = chain.geonets[0]->getForwardingStats ();
+  GeoNet::GNForwardingStats_t statsB = chain.geonets[1]->getForwardingStats ();
+  GeoNet::GNForwardingStats_t statsC = chain.geonets[2]->getForwardingStats ();
+
+  NS_TEST_ASSERT_MSG_EQ (chain.received[1], 1, "B did not receive the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (chain.received[2], 1, "C did not receive the GBC packet exactly once");
+  NS_TEST_ASSERT_MSG_EQ (statsC.cbfBuffered, 1, "C did not buffer the GBC packet");
+  NS_TEST_ASSERT_MSG_EQ (statsC.cbfForwarded, 1, "C did not forward the GBC packet at the expiration of its CBF timer");
+  NS_TEST_ASSERT_MSG_EQ (statsB.cbfBuffered, 1, "B did not buffer the GBC packet");
+  NS_TEST_ASSERT_MSG_EQ (statsB.cbfSuppressed, 1, "B did not discard the buffered GBC packet forwarded by C");
+  NS_TEST_ASSERT_MSG_EQ (statsB.cbfForwarded, 0, "B forwarded the GBC packet after its CBF timer was cancelled");
+  NS_TEST_ASSERT_MSG_EQ (statsB.forwardedPackets, 0, "B forwarded the GBC packet after its CBF timer was cancelled");
+  NS_TEST_ASSERT_MSG_EQ (statsA.redundantRebroadcasts, 1, "The source did not drop its own GBC packet received from C");
+
+  CleanupChain (chain);
+  Simulator::Destroy ();
+}
+
+// Single-hop GBC on a chain A - B, with a destination area including only A: B is outside the area and its sender A is
+// inside it, so B would not forward the packet anyway, and the packet must not be counted as discarded due to the
+// hop limit
+class GeoNetHopLimitDiscardTestCase : public TestCase
+{
+public:
+  GeoNetHopLimitDiscardTestCase ();
+  virtual ~GeoNetHopLimitDiscardTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void SendGBC (Ptr<GeoNet> geonet);
+};
+
+GeoNetHopLimitDiscardTestCase::GeoNetHopLimitDiscardTestCase ()
+  : TestCase ("Only GBC packets which would be forwarded are counted as hop limit discards")
+{
+}
+
+GeoNetHopLimitDiscardTestCase::~GeoNetHopLimitDiscardTestCase ()
+{
+}
+
+void
+GeoNetHopLimitDiscardTestCase::SendGBC (Ptr<GeoNet> geonet)
+{
+  NS_TEST_ASSERT_MSG_EQ (geonet->sendGN (ChainGBCRequest (0,50,1)), ACCEPTED, "The GBC packet was not accepted by GeoNetworking");
+}
+
+void
+GeoNetHopLimitDiscardTestCase::DoRun (void)
+{
+  GeoNetChain chain;
+  SetupChain (chain,2);
+
+  Simulator::Schedule (Seconds (1.0),&GeoNetHopLimitDiscardTestCase::SendGBC,this,chain.geonets[0]);
+  Simulator::Stop (Seconds (2.0));
+  Simulator::Run ();
+
+  GeoNet::GNForwardingStats_t statsB = chain.geonets[1]->getForwardingStats ();
+  NS_TEST_ASSERT_MSG_EQ (chain.received[1], 0, "B outside the area passed the GBC packet to the upper layers");
+  NS_TEST_ASSERT_MSG_EQ (statsB.forwardedPackets, 0, "B forwarded a GBC packet coming from inside the area");
+  NS_TEST_ASSERT_MSG_EQ (statsB.hopLimitDiscards, 0, "B counted a GBC packet it would not forward as a hop limit discard");
+
+  CleanupChain (chain);
+  Simulator::Destroy ();
+}
+
+namespace ns3 {
+
+// PRR of a GBC packet on the chain A - B - C, with a baseline including all the three stations: A receives back its
+// own packet when B forwards it, but it must not be counted as one of the receivers, so that the PRR is exactly 1
+// (B and C receive the packet) and never greater than 1. The TraCI client is not connected to SUMO: the positions
+// of the vehicles are directly written into its grid index
+class GeoNetForwardedPRRTestCase : public TestCase
+{
+public:
+  GeoNetForwardedPRRTestCase ();
+  virtual ~GeoNetForwardedPRRTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void SendGBC (Ptr<GeoNet> geonet);
+};
+
+GeoNetForwardedPRRTestCase::GeoNetForwardedPRRTestCase ()
+  : TestCase ("The source of a forwarded GBC packet is not counted in its PRR")
+{
+}
+
+GeoNetForwardedPRRTestCase::~GeoNetForwardedPRRTestCase ()
+{
+}
+
+void
+GeoNetForwardedPRRTestCase::SendGBC (Ptr<GeoNet> geonet)
+{
+  NS_TEST_ASSERT_MSG_EQ (geonet->sendGN (ChainGBCRequest (1,500)), ACCEPTED, "The GBC packet was not accepted by GeoNetworking");
+}
+
+void
+GeoNetForwardedPRRTestCase::DoRun (void)
+{
+  GeoNetChain chain;
+  SetupChain (chain,3);
+
+  Ptr<TraciClient> traci = CreateObject<TraciClient> ();
+  for (uint32_t i = 0; i < chain.geonets.size (); i++)
+    {
+      traci->m_gridVehicles.emplace_back ("veh" + std::to_string (1000+i),Vector (i*100.0,0.0,0.0));
+    }
+  traci->RebuildSpatialGrid ();
+
+  Ptr<PRRSupervisor> prrSup = CreateObject<PRRSupervisor> (250);
+  prrSup->setTraCIClient (traci);
+  for (Ptr<GeoNet> geonet : chain.geonets)
+    {
+      geonet->setPRRSupervisor (prrSup);
+      geonet->disablePRRsupervisorForBeacons ();
+    }
+
+  // The PRR is computed 3 seconds after the transmission
+  Simulator::Schedule (Seconds (1.0),&GeoNetForwardedPRRTestCase::SendGBC,this,chain.geonets[0]);
+  Simulator::Stop (Seconds (5.0));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (chain.received[2], 1, "C did not receive the GBC packet through B");
+  NS_TEST_ASSERT_MSG_EQ (chain.geonets[0]->getForwardingStats ().redundantRebroadcasts, 1, "A did not receive back its own GBC packet");
+  NS_TEST_ASSERT_MSG_LT_OR_EQ (prrSup->getAveragePRR_overall (), 1.0, "The PRR is greater than 1");
+  NS_TEST_ASSERT_MSG_EQ_TOL (prrSup->getAveragePRR_overall (), 1.0, 1e-9, "The PRR does not count exactly B and C");
+  NS_TEST_ASSERT_MSG_EQ_TOL (prrSup->getAveragePRR_vehicle (1000), 1.0, 1e-9, "The PRR of A does not count exactly B and C");
+
+  CleanupChain (chain);
+  Simulator::Destroy ();
+}
+
+} // namespace ns3
+
+class AutomotiveGeoNetForwardingTestSuite : public TestSuite
+{
+public:
+  AutomotiveGeoNetForwardingTestSuite ();
+};
+
+AutomotiveGeoNetForwardingTestSuite::AutomotiveGeoNetForwardingTestSuite ()
+  : TestSuite ("automotive-geonet-forwarding", UNIT)
+{
+  AddTestCase (new GeoNetOwnPacketDropTestCase, TestCase::QUICK);
+  AddTestCase (new GeoNetForwardedPRRTestCase, TestCase::QUICK);
+  AddTestCase (new GeoNetGreedyForwardingTestCase, TestCase::QUICK);
+  AddTestCase (new GeoNetCBFSuppressionTestCase, TestCase::QUICK);
+  AddTestCase (new GeoNetHopLimitDiscardTestCase, TestCase::QUICK);
+}
+
+static AutomotiveGeoNetForwardingTestSuite automotiveGeoNetForwardingTestSuite;
@@ -0,0 +1,409 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include "ns3/specializedEncoders.h"
+#include "ns3/test.h"
+#include <random>
+
+extern "C" {
+  #include "ns3/CAM.h"
+  #include "ns3/CPM.h"
+}
+
+#include "ns3/Seq.hpp"
+#include "ns3/Setter.hpp"
+#include "ns3/Encoding.hpp"
+#include "ns3/SequenceOf.hpp"
+
+using namespace ns3;
+
+namespace
+{
+  long
+  randomIn(std::mt19937 &rng, long lb, long ub)
+  {
+    return std::uniform_int_distribution<long>(lb,ub)(rng);
+  }
+
+  // Build the same CAM as CABasicService::generateAndEncodeCam() for a vehicle without optional fields,
+  // and encode it with the generic asn1c encoder
+  std::string
+  genericCam(const CAMSkeletonEncoder::CAM_static_data_t &s, const CAMSkeletonEncoder::CAM_dynamic_data_t &d)
+  {
+    auto cam = asn1cpp::makeSeq(CAM);
+    asn1cpp::setField(cam->header.messageID, 2);
+    asn1cpp::setField(cam->header.protocolVersion, protocolVersion_currentVersion);
+    asn1cpp::setField(cam->header.stationID, s.stationID);
+    asn1cpp::setField(cam->cam.generationDeltaTime, d.generationDeltaTime);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.stationType, s.stationType);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeValue, d.altitudeValue);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.altitude.altitudeConfidence, d.altitudeConfidence);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.latitude, d.latitude);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.longitude, d.longitude);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, d.semiMajorConfidence);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, d.semiMinorConfidence);
+    asn1cpp::setField(cam->cam.camParameters.basicContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, d.semiMajorOrientation);
+
+    asn1cpp::setField(cam->cam.camParameters.highFrequencyContainer.present, HighFrequencyContainer_PR_basicVehicleContainerHighFrequency);
+    auto &hf = cam->cam.camParameters.highFrequencyContainer.choice.basicVehicleContainerHighFrequency;
+    asn1cpp::setField(hf.heading.headingValue, d.headingValue);
+    asn1cpp::setField(hf.heading.headingConfidence, d.headingConfidence);
+    asn1cpp::setField(hf.speed.speedValue, d.speedValue);
+    asn1cpp::setField(hf.speed.speedConfidence, d.speedConfidence);
+    asn1cpp::setField(hf.driveDirection, d.driveDirection);
+    asn1cpp::setField(hf.vehicleLength.vehicleLengthValue, s.vehicleLengthValue);
+    asn1cpp::setField(hf.vehicleLength.vehicleLengthConfidenceIndication, s.vehicleLengthConfidence);
+    asn1cpp::setField(hf.vehicleWidth, s.vehicleWidth);
+    asn1cpp::setField(hf.longitudinalAcceleration.longitudinalAccelerationValue, d.longAccelerationValue);
+    asn1cpp::setField(hf.longitudinalAcceleration.longitudinalAccelerationConfidence, d.longAccelerationConfidence);
+    asn1cpp::setField(hf.curvature.curvatureValue, d.curvatureValue);
+    asn1cpp::setField(hf.curvature.curvatureConfidence, d.curvatureConfidence);
+    asn1cpp::setField(hf.curvatureCalculationMode, d.curvatureCalculationMode);
+    asn1cpp::setField(hf.yawRate.yawRateValue, d.yawRateValue);
+    asn1cpp::setField(hf.yawRate.yawRateConfidence, d.yawRateConfidence);
+    if (d.lanePositionAvailable)
+      {
+        asn1cpp::setField(hf.lanePosition, d.lanePosition);
+      }
+
+    return asn1cpp::uper::encode(cam);
+  }
+
+  // Build the same CPM as CPBasicService::generateAndEncodeCPM() and encode it with the generic asn1c encoder
+  std::string
+  genericCpm(const CPMSkeletonEncoder::CPM_static_data_t &s, const CPMSkeletonEncoder::CPM_dynamic_data_t &d)
+  {
+    auto cpm = asn1cpp::makeSeq(CPM);
+
+    if(!d.perceivedObjects.empty())
+      {
+        auto POsContainer = asn1cpp::makeSeq(PerceivedObjectContainer);
+        for(const auto &po_data : d.perceivedObjects)
+          {
+            auto PO = asn1cpp::makeSeq(PerceivedObject);
+            asn1cpp::setField(PO->objectID,po_data.objectID);
+            asn1cpp::setField(PO->timeOfMeasurement,po_data.timeOfMeasurement);
+            asn1cpp::setField(PO->objectConfidence,po_data.objectConfidence);
+            asn1cpp::setField(PO->xDistance.value,po_data.xDistanceValue);
+            asn1cpp::setField(PO->xDistance.confidence,po_data.xDistanceConfidence);
+            asn1cpp::setField(PO->yDistance.value,po_data.yDistanceValue);
+            asn1cpp::setField(PO->yDistance.confidence,po_data.yDistanceConfidence);
+            asn1cpp::setField(PO->xSpeed.value,po_data.xSpeedValue);
+            asn1cpp::setField(PO->xSpeed.confidence,po_data.xSpeedConfidence);
+            asn1cpp::setField(PO->ySpeed.value,po_data.ySpeedValue);
+            asn1cpp::setField(PO->ySpeed.confidence,po_data.ySpeedConfidence);
+            auto angle = asn1cpp::makeSeq(CartesianAngle);
+            asn1cpp::setField(angle->value,po_data.yawAngleValue);
+            asn1cpp::setField(angle->confidence,po_data.yawAngleConfidence);
+            asn1cpp::setField(PO->yawAngle,angle);
+            auto OD1 = asn1cpp::makeSeq(ObjectDimension);
+            asn1cpp::setField(OD1->value,po_data.planarObjectDimension1Value);
+            asn1cpp::setField(OD1->confidence,po_data.planarObjectDimension1Confidence);
+            asn1cpp::setField(PO->planarObjectDimension1,OD1);
+            auto OD2 = asn1cpp::makeSeq(ObjectDimension);
+            asn1cpp::setField(OD2->value,po_data.planarObjectDimension2Value);
+            asn1cpp::setField(OD2->confidence,po_data.planarObjectDimension2Confidence);
+            asn1cpp::setField(PO->planarObjectDimension2,OD2);
+            asn1cpp::setField(PO->objectRefPoint,po_data.objectRefPoint);
+            asn1cpp::sequenceof::pushList(*POsContainer,PO);
+          }
+        asn1cpp::setField(cpm->cpm.cpmParameters.perceivedObjectContainer,POsContainer);
+      }
+
+    asn1cpp::setField(cpm->cpm.cpmParameters.numberOfPerceivedObjects,d.numberOfPerceivedObjects);
+
+    if(d.sensorInformationContainer && !s.sensors.empty())
+      {
+        auto sensorInfoContainer = asn1cpp::makeSeq(SensorInformationContainer);
+        for(const auto &sensor : s.sensors)
+          {
+            auto sensorInfo = asn1cpp::makeSeq(SensorInformation);
+            asn1cpp::setField(sensorInfo->sensorID,sensor.sensorID);
+            asn1cpp::setField(sensorInfo->type,sensor.type);
+            auto detectionArea = asn1cpp::makeSeq(DetectionArea);
+            asn1cpp::setField(detectionArea->present,DetectionArea_PR_vehicleSensor);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.refPointId,sensor.refPointId);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.xSensorOffset,sensor.xSensorOffset);
+            asn1cpp::setField(detectionArea->choice.vehicleSensor.ySensorOffset,sensor.ySensorOffset);
+            auto property = asn1cpp::makeSeq(VehicleSensorProperties);
+            asn1cpp::setField(property->range,sensor.range);
+            asn1cpp::setField(property->horizontalOpeningAngleStart,sensor.horizontalOpeningAngleStart);
+            asn1cpp::setField(property->horizontalOpeningAngleEnd,sensor.horizontalOpeningAngleEnd);
+            asn1cpp::sequenceof::pushList(detectionArea->choice.vehicleSensor.vehicleSensorPropertyList,property);
+            asn1cpp::setField(sensorInfo->detectionArea,detectionArea);
+            asn1cpp::sequenceof::pushList(*sensorInfoContainer,sensorInfo);
+          }
+        asn1cpp::setField(cpm->cpm.cpmParameters.sensorInformationContainer,sensorInfoContainer);
+      }
+
+    asn1cpp::setField(cpm->header.messageID, ItsPduHeader__messageID_cpm);
+    asn1cpp::setField(cpm->header.protocolVersion, 1);
+    asn1cpp::setField(cpm->header.stationID, s.stationID);
+    asn1cpp::setField(cpm->cpm.generationDeltaTime, d.generationDeltaTime);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.stationType, s.stationType);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeValue, d.altitudeValue);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.altitude.altitudeConfidence, d.altitudeConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.latitude, d.latitude);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.longitude, d.longitude);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorConfidence, d.semiMajorConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMinorConfidence, d.semiMinorConfidence);
+    asn1cpp::setField(cpm->cpm.cpmParameters.managementContainer.referencePosition.positionConfidenceEllipse.semiMajorOrientation, d.semiMajorOrientation);
+
+    auto stationDataContainer = asn1cpp::makeSeq(StationDataContainer);
+    asn1cpp::setField(stationDataContainer->present, StationDataContainer_PR_originatingVehicleContainer);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingValue, d.headingValue);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.heading.headingConfidence, d.headingConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedValue, d.speedValue);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.speed.speedConfidence, d.speedConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.driveDirection, d.driveDirection);
+    auto vehicleLength = asn1cpp::makeSeq(VehicleLength);
+    asn1cpp::setField(vehicleLength->vehicleLengthValue, s.vehicleLengthValue);
+    asn1cpp::setField(vehicleLength->vehicleLengthConfidenceIndication, s.vehicleLengthConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleLength,vehicleLength);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.vehicleWidth, s.vehicleWidth);
+    auto longAcc = asn1cpp::makeSeq(LongitudinalAcceleration);
+    asn1cpp::setField(longAcc->longitudinalAccelerationValue, d.longAccelerationValue);
+    asn1cpp::setField(longAcc->longitudinalAccelerationConfidence, d.longAccelerationConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.longitudinalAcceleration,longAcc);
+    auto yawRate = asn1cpp::makeSeq(YawRate);
+    asn1cpp::setField(yawRate->yawRateValue, d.yawRateValue);
+    asn1cpp::setField(yawRate->yawRateConfidence, d.yawRateConfidence);
+    asn1cpp::setField(stationDataContainer->choice.originatingVehicleContainer.yawRate,yawRate);
+    asn1cpp::setField(cpm->cpm.cpmParameters.stationDataContainer, stationDataContainer);
+
+    return asn1cpp::uper::encode(cpm);
+  }
+
+  CAMSkeletonEncoder::CAM_dynamic_data_t
+  randomCamDynamicData(std::mt19937 &rng)
+  {
+    CAMSkeletonEncoder::CAM_dynamic_data_t d;
+    d.generationDeltaTime = randomIn(rng,0,65535);
+    d.latitude = randomIn(rng,-900000000,900000001);
+    d.longitude = randomIn(rng,-1800000000,1800000001);
+    d.semiMajorConfidence = randomIn(rng,0,4095);
+    d.semiMinorConfidence = randomIn(rng,0,4095);
+    d.semiMajorOrientation = randomIn(rng,0,3601);
+    d.altitudeValue = randomIn(rng,-100000,800001);
+    d.altitudeConfidence = randomIn(rng,0,15);
+    d.headingValue = randomIn(rng,0,3601);
+    d.headingConfidence = randomIn(rng,1,127);
+    d.speedValue = randomIn(rng,0,16383);
+    d.speedConfidence = randomIn(rng,1,127);
+    d.driveDirection = randomIn(rng,0,2);
+    d.longAccelerationValue = randomIn(rng,-160,161);
+    d.longAccelerationConfidence = randomIn(rng,0,102);
+    d.curvatureValue = randomIn(rng,-1023,1023);
+    d.curvatureConfidence = randomIn(rng,0,7);
+    d.curvatureCalculationMode = randomIn(rng,0,2);
+    d.yawRateValue = randomIn(rng,-32766,32767);
+    d.yawRateConfidence = randomIn(rng,0,8);
+    d.lanePositionAvailable = randomIn(rng,0,1);
+    d.lanePosition = randomIn(rng,-1,14);
+    return d;
+  }
+
+  CPMSkeletonEncoder::CPM_perceived_object_t
+  randomPerceivedObject(std::mt19937 &rng)
+  {
+    CPMSkeletonEncoder::CPM_perceived_object_t po;
+    po.objectID = randomIn(rng,0,255);
+    po.timeOfMeasurement = randomIn(rng,-1500,1500);
+    po.objectConfidence = randomIn(rng,0,3)==0 ? 0 : randomIn(rng,0,101);
+    po.xDistanceValue = randomIn(rng,-132768,132767);
+    po.xDistanceConfidence = randomIn(rng,0,102);
+    po.yDistanceValue = randomIn(rng,-132768,132767);
+    po.yDistanceConfidence = randomIn(rng,0,102);
+    po.xSpeedValue = randomIn(rng,-16383,16383);
+    po.xSpeedConfidence = randomIn(rng,1,127);
+    po.ySpeedValue = randomIn(rng,-16383,16383);
+    po.ySpeedConfidence = randomIn(rng,1,127);
+    po.yawAngleValue = randomIn(rng,0,3601);
+    po.yawAngleConfidence = randomIn(rng,1,127);
+    po.planarObjectDimension1Value = randomIn(rng,0,1023);
+    po.planarObjectDimension1Confidence = randomIn(rng,0,102);
+    po.planarObjectDimension2Value = randomIn(rng,0,1023);
+    po.planarObjectDimension2Confidence = randomIn(rng,0,102);
+    po.objectRefPoint = randomIn(rng,0,3)==0 ? 0 : randomIn(rng,0,8);
+    return po;
+  }
+}
+
+// Bit-exact equivalence between the CAM skeleton encoder and the generic asn1c encoder
+class CamSkeletonEncoderTestCase : public TestCase
+{
+public:
+  CamSkeletonEncoderTestCase ();
+  virtual ~CamSkeletonEncoderTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+CamSkeletonEncoderTestCase::CamSkeletonEncoderTestCase ()
+  : TestCase ("CAM skeleton encoder is bit-exact with asn1c")
+{
+}
+
+CamSkeletonEncoderTestCase::~CamSkeletonEncoderTestCase ()
+{
+}
+
+void
+CamSkeletonEncoderTestCase::DoRun (void)
+{
+  std::mt19937 rng (12345);
+  CAMSkeletonEncoder encoder;
+
+  CAMSkeletonEncoder::CAM_static_data_t s = {};
+
+  for (int i = 0; i < 2000; i++)
+    {
+      // Change the static data only once in a while, to also exercise the cached skeleton
+      if (i % 50 == 0)
+        {
+          s.stationID = (unsigned long) randomIn (rng, 0, 4294967295L);
+          s.stationType = randomIn (rng, 0, 255);
+          s.vehicleLengthValue = randomIn (rng, 1, 1023);
+          s.vehicleLengthConfidence = randomIn (rng, 0, 4);
+          s.vehicleWidth = randomIn (rng, 1, 62);
+        }
+      NS_TEST_ASSERT_MSG_EQ (encoder.setStaticData (s), true, "Valid static data rejected");
+
+      CAMSkeletonEncoder::CAM_dynamic_data_t d = randomCamDynamicData (rng);
+
+      std::string fast;
+      NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), true, "Valid CAM rejected by the skeleton encoder");
+      std::string generic = genericCam (s, d);
+      NS_TEST_ASSERT_MSG_EQ (fast.size (), CAMSkeletonEncoder::encodedSize (), "Wrong encoded CAM size");
+      NS_TEST_ASSERT_MSG_EQ ((fast == generic), true, "Skeleton and generic CAM encodings differ (iteration " << i << ")");
+    }
+
+  // Out of range values must make both encoders fail
+  s = {1234, 5, 45, 4, 18};
+  encoder.setStaticData (s);
+  CAMSkeletonEncoder::CAM_dynamic_data_t d = randomCamDynamicData (rng);
+  std::string fast;
+  d.speedValue = 16384;
+  NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), false, "Out of range speed accepted");
+  NS_TEST_ASSERT_MSG_EQ (genericCam (s, d).size (), 0, "Out of range speed accepted by asn1c");
+  d.speedValue = 0;
+  d.latitude = 900000002;
+  NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), false, "Out of range latitude accepted");
+  NS_TEST_ASSERT_MSG_EQ (genericCam (s, d).size (), 0, "Out of range latitude accepted by asn1c");
+
+  s.vehicleWidth = 63;
+  NS_TEST_ASSERT_MSG_EQ (encoder.setStaticData (s), false, "Out of range vehicle width accepted");
+  d.latitude = 0;
+  NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), false, "Encoding with an invalid skeleton accepted");
+}
+
+// Bit-exact equivalence between the CPM skeleton encoder and the generic asn1c encoder, with 0, 10 and 50 objects
+class CpmSkeletonEncoderTestCase : public TestCase
+{
+public:
+  CpmSkeletonEncoderTestCase ();
+  virtual ~CpmSkeletonEncoderTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+CpmSkeletonEncoderTestCase::CpmSkeletonEncoderTestCase ()
+  : TestCase ("CPM skeleton encoder is bit-exact with asn1c")
+{
+}
+
+CpmSkeletonEncoderTestCase::~CpmSkeletonEncoderTestCase ()
+{
+}
+
+void
+CpmSkeletonEncoderTestCase::DoRun (void)
+{
+  std::mt19937 rng (54321);
+  CPMSkeletonEncoder encoder;
+  const size_t numObjects[] = {0, 1, 10, 50, 128};
+
+  for (int i = 0; i < 500; i++)
+    {
+      CPMSkeletonEncoder::CPM_static_data_t s;
+      s.stationID = (unsigned long) randomIn (rng, 0, 4294967295L);
+      s.stationType = randomIn (rng, 0, 255);
+      s.vehicleLengthValue = randomIn (rng, 1, 1023);
+      s.vehicleLengthConfidence = randomIn (rng, 0, 4);
+      s.vehicleWidth = randomIn (rng, 1, 62);
+
+      long numSensors = randomIn (rng, 0, 3);
+      for (long j = 0; j < numSensors; j++)
+        {
+          CPMSkeletonEncoder::CPM_vehicle_sensor_t sensor;
+          sensor.sensorID = randomIn (rng, 0, 255);
+          sensor.type = randomIn (rng, 0, 15);
+          sensor.refPointId = randomIn (rng, 0, 1) ? 0 : randomIn (rng, 0, 255);
+          sensor.xSensorOffset = randomIn (rng, -5000, 0);
+          sensor.ySensorOffset = randomIn (rng, -1000, 1000);
+          sensor.range = randomIn (rng, 0, 10000);
+          sensor.horizontalOpeningAngleStart = randomIn (rng, 0, 3601);
+          sensor.horizontalOpeningAngleEnd = randomIn (rng, 0, 3601);
+          s.sensors.push_back (sensor);
+        }
+
+      NS_TEST_ASSERT_MSG_EQ (encoder.setStaticData (s), true, "Valid static data rejected");
+
+      CPMSkeletonEncoder::CPM_dynamic_data_t d;
+      CAMSkeletonEncoder::CAM_dynamic_data_t c = randomCamDynamicData (rng);
+      d.generationDeltaTime = c.generationDeltaTime;
+      d.latitude = c.latitude;
+      d.longitude = c.longitude;
+      d.semiMajorConfidence = c.semiMajorConfidence;
+      d.semiMinorConfidence = c.semiMinorConfidence;
+      d.semiMajorOrientation = c.semiMajorOrientation;
+      d.altitudeValue = c.altitudeValue;
+      d.altitudeConfidence = c.altitudeConfidence;
+      d.headingValue = c.headingValue;
+      d.headingConfidence = c.headingConfidence;
+      d.speedValue = c.speedValue;
+      d.speedConfidence = c.speedConfidence;
+      d.driveDirection = c.driveDirection;
+      d.longAccelerationValue = c.longAccelerationValue;
+      d.longAccelerationConfidence = c.longAccelerationConfidence;
+      d.yawRateValue = c.yawRateValue;
+      d.yawRateConfidence = c.yawRateConfidence;
+      d.sensorInformationContainer = randomIn (rng, 0, 1);
+
+      size_t n = numObjects[i % 5];
+      for (size_t j = 0; j < n; j++)
+        {
+          d.perceivedObjects.push_back (randomPerceivedObject (rng));
+        }
+      d.numberOfPerceivedObjects = n;
+
+      std::string fast;
+      NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), true, "Valid CPM rejected by the skeleton encoder");
+      std::string generic = genericCpm (s, d);
+      NS_TEST_ASSERT_MSG_EQ ((fast == generic), true, "Skeleton and generic CPM encodings differ (iteration " << i << ", " << n << " objects)");
+
+      // Out of range values inside a perceived object must make both encoders fail
+      if (n > 0)
+        {
+          d.perceivedObjects[n - 1].objectID = 256;
+          NS_TEST_ASSERT_MSG_EQ (encoder.encode (d, fast), false, "Out of range object ID accepted");
+          NS_TEST_ASSERT_MSG_EQ (genericCpm (s, d).size (), 0, "Out of range object ID accepted by asn1c");
+        }
+    }
+}
+
+class AutomotiveSpecializedEncodersTestSuite : public TestSuite
+{
+public:
+  AutomotiveSpecializedEncodersTestSuite ();
+};
+
+AutomotiveSpecializedEncodersTestSuite::AutomotiveSpecializedEncodersTestSuite ()
+  : TestSuite ("automotive-specialized-encoders", UNIT)
+{
+  AddTestCase (new CamSkeletonEncoderTestCase, TestCase::QUICK);
+  AddTestCase (new CpmSkeletonEncoderTestCase, TestCase::QUICK);
+}
+
+static AutomotiveSpecializedEncodersTestSuite automotiveSpecializedEncodersTestSuite;
@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#ifndef AUTOMOTIVE_TEST_VDP_H
+#define AUTOMOTIVE_TEST_VDP_H
+
+#include "ns3/vdp.h"
+#include <cmath>
+
+namespace ns3 {
+  // Minimal VDP for the automotive unit tests: the kinematic state is set directly by the test
+  // (e.g. following a scripted trajectory) and the (lat,lon) to (x,y) projection is a simple
+  // equirectangular one, which is accurate enough over the few hundred meters covered by a test
+  class VDPTestStub : public VDP
+  {
+  public:
+    VDPTestStub(double lat, double lon)
+    {
+      m_lat=lat;
+      m_lon=lon;
+      m_lat0=lat;
+      m_speed_ms=0;
+      m_heading_deg=0;
+      m_travelled_distance=0;
+      m_vehicle_length=VDPValueConfidence<long,long>(VehicleLengthValue_unavailable,VehicleLengthConfidenceIndication_unavailable);
+      m_vehicle_width=VehicleWidth_unavailable;
+    }
+
+    void setPosition(double lat, double lon) {m_lat=lat; m_lon=lon;}
+    void setSpeedValue(double speed_ms) {m_speed_ms=speed_ms;}
+    void setHeadingValue(double heading_deg) {m_heading_deg=heading_deg;}
+    void setTravelledDistance(double distance) {m_travelled_distance=distance;}
+
+    CAM_mandatory_data_t getCAMMandatoryData()
+    {
+      CAM_mandatory_data_t CAMdata;
+
+      CAMdata.speed = VDPValueConfidence<>(m_speed_ms*CENTI,SpeedConfidence_unavailable);
+      CAMdata.longitude=(Longitude_t)(m_lon*DOT_ONE_MICRO);
+      CAMdata.latitude=(Latitude_t)(m_lat*DOT_ONE_MICRO);
+      CAMdata.altitude = VDPValueConfidence<>(AltitudeValue_unavailable,AltitudeConfidence_unavailable);
+      CAMdata.posConfidenceEllipse.semiMajorConfidence=SemiAxisLength_unavailable;
+      CAMdata.posConfidenceEllipse.semiMinorConfidence=SemiAxisLength_unavailable;
+      CAMdata.posConfidenceEllipse.semiMajorOrientation=HeadingValue_unavailable;
+      CAMdata.longAcceleration = VDPValueConfidence<>(LongitudinalAccelerationValue_unavailable,AccelerationConfidence_unavailable);
+      CAMdata.heading = VDPValueConfidence<>(m_heading_deg*DECI,HeadingConfidence_unavailable);
+      CAMdata.driveDirection = DriveDirection_unavailable;
+      CAMdata.curvature = VDPValueConfidence<>(CurvatureValue_unavailable,CurvatureConfidence_unavailable);
+      CAMdata.curvature_calculation_mode = CurvatureCalculationMode_unavailable;
+      CAMdata.VehicleLength = m_vehicle_length;
+      CAMdata.VehicleWidth = m_vehicle_width;
+      CAMdata.yawRate = VDPValueConfidence<>(YawRateValue_unavailable,YawRateConfidence_unavailable);
+
+      return CAMdata;
+    }
+
+    CPM_mandatory_data_t getCPMMandatoryData()
+    {
+      CAM_mandatory_data_t CAMdata = getCAMMandatoryData ();
+      CPM_mandatory_data_t CPMdata;
+
+      CPMdata.speed = CAMdata.speed;
+      CPMdata.longitude = CAMdata.longitude;
+      CPMdata.latitude = CAMdata.latitude;
+      CPMdata.altitude = CAMdata.altitude;
+      CPMdata.posConfidenceEllipse = CAMdata.posConfidenceEllipse;
+      CPMdata.longAcceleration = CAMdata.longAcceleration;
+      CPMdata.heading = CAMdata.heading;
+      CPMdata.driveDirection = CAMdata.driveDirection;
+      CPMdata.curvature = CAMdata.curvature;
+      CPMdata.curvature_calculation_mode = CAMdata.curvature_calculation_mode;
+      CPMdata.VehicleLength = CAMdata.VehicleLength;
+      CPMdata.VehicleWidth = CAMdata.VehicleWidth;
+      CPMdata.yawRate = CAMdata.yawRate;
+
+      return CPMdata;
+    }
+
+    double getSpeedValue() {return m_speed_ms;}
+    double getTravelledDistance() {return m_travelled_distance;}
+    double getHeadingValue() {return m_heading_deg;}
+
+    VDP_position_latlon_t getPosition()
+    {
+      VDP_position_latlon_t pos;
+      pos.lat=m_lat;
+      pos.lon=m_lon;
+      pos.alt=DBL_MAX;
+      return pos;
+    }
+
+    VDP_position_cartesian_t getPositionXY() {return getXY(m_lon,m_lat);}
+
+    VDP_position_cartesian_t getXY(double lon, double lat)
+    {
+      VDP_position_cartesian_t posxy;
+      posxy.x=(lon*M_PI/180.0)*std::cos(m_lat0*M_PI/180.0)*m_earth_radius;
+      posxy.y=(lat*M_PI/180.0)*m_earth_radius;
+      posxy.z=DBL_MAX;
+      return posxy;
+    }
+
+    VDPDataItem<int> getLanePosition() {return VDPDataItem<int>(false);}
+    VDPDataItem<uint8_t> getExteriorLights() {return VDPDataItem<uint8_t>(false);}
+
+  private:
+    const double m_earth_radius=6371000.0;
+
+    double m_lat,m_lon;
+    double m_lat0; // Reference latitude of the equirectangular projection
+    double m_speed_ms;
+    double m_heading_deg;
+    double m_travelled_distance;
+  };
+}
+
+#endif // AUTOMOTIVE_TEST_VDP_H
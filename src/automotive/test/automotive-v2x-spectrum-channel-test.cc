@@ -0,0 +1,248 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+
+#include <map>
+#include <vector>
+#include "ns3/v2x-spectrum-channel.h"
+#include "ns3/multi-model-spectrum-channel.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/spectrum-phy.h"
+#include "ns3/spectrum-model.h"
+#include "ns3/spectrum-value.h"
+#include "ns3/spectrum-signal-parameters.h"
+#include "ns3/propagation-loss-model.h"
+#include "ns3/propagation-delay-model.h"
+#include "ns3/constant-position-mobility-model.h"
+
+using namespace ns3;
+
+namespace
+{
+  // Signal received by a test PHY
+  struct RxRecord
+  {
+    Time time;
+    std::vector<double> psd;
+  };
+
+  // Minimal PHY, recording the signals it receives, indexed by the transmission and by the receiver
+  class V2XTestSpectrumPhy : public SpectrumPhy
+  {
+  public:
+    V2XTestSpectrumPhy (uint32_t id, std::map<std::pair<uint32_t,uint32_t>,RxRecord> *log, uint32_t *tx)
+      : m_id (id), m_log (log), m_tx (tx) {}
+
+    virtual void SetDevice (Ptr<NetDevice> d) {m_device=d;}
+    virtual Ptr<NetDevice> GetDevice () const {return m_device;}
+    virtual void SetMobility (Ptr<MobilityModel> m) {m_mobility=m;}
+    virtual Ptr<MobilityModel> GetMobility () const {return m_mobility;}
+    virtual void SetChannel (Ptr<SpectrumChannel> c) {}
+    virtual Ptr<const SpectrumModel> GetRxSpectrumModel () const {return m_rxSpectrumModel;}
+    virtual Ptr<Object> GetAntenna () const {return nullptr;}
+    void SetRxSpectrumModel (Ptr<const SpectrumModel> model) {m_rxSpectrumModel=model;}
+
+    virtual void StartRx (Ptr<SpectrumSignalParameters> params)
+    {
+      RxRecord record;
+      record.time = Simulator::Now ();
+      record.psd.assign (params->psd->ConstValuesBegin (),params->psd->ConstValuesEnd ());
+      // A receiver getting the same transmission twice is detected as a missing entry in the other log
+      (*m_log)[std::make_pair (*m_tx,m_id)] = record;
+      m_count++;
+    }
+
+    uint32_t m_count = 0;
+
+  private:
+    uint32_t m_id;
+    std::map<std::pair<uint32_t,uint32_t>,RxRecord> *m_log;
+    uint32_t *m_tx;
+    Ptr<NetDevice> m_device;
+    Ptr<MobilityModel> m_mobility;
+    Ptr<const SpectrumModel> m_rxSpectrumModel;
+  };
+
+  Ptr<SpectrumModel>
+  CreateTestSpectrumModel (double offset_hz)
+  {
+    std::vector<double> freqs;
+    for (uint32_t i = 0; i < 10; i++)
+      {
+        freqs.push_back (5.9e9+offset_hz+i*180e3);
+      }
+    return Create<SpectrumModel> (freqs);
+  }
+}
+
+// The same transmissions on a V2XSpectrumChannel with a MaxRange of 300 m and on a MultiModelSpectrumChannel, with the
+// same deterministic propagation models and receivers at and around the cutoff, in the same cell of the grid of the
+// transmitter and in the neighbouring ones: the V2X channel must call StartRx exactly for the receivers of the
+// MultiModelSpectrumChannel within the cutoff, at the same times and with the same PSDs (also for a receiver with a
+// different SpectrumModel), including a receiver moving inside the cutoff between two transmissions
+class V2XSpectrumChannelCutoffTestCase : public TestCase
+{
+public:
+  V2XSpectrumChannelCutoffTestCase ();
+  virtual ~V2XSpectrumChannelCutoffTestCase ();
+
+private:
+  virtual void DoRun (void);
+  void Transmit (Ptr<SpectrumChannel> channel, Ptr<SpectrumPhy> txPhy);
+  void Move (Ptr<MobilityModel> mobility, Vector position);
+  void NextTransmission ();
+
+  uint32_t m_tx = 0;
+  Ptr<SpectrumModel> m_txSpectrumModel;
+};
+
+V2XSpectrumChannelCutoffTestCase::V2XSpectrumChannelCutoffTestCase ()
+  : TestCase ("The V2X spectrum channel delivers the same signals as MultiModelSpectrumChannel within the cutoff")
+{
+}
+
+V2XSpectrumChannelCutoffTestCase::~V2XSpectrumChannelCutoffTestCase ()
+{
+}
+
+void
+V2XSpectrumChannelCutoffTestCase::Transmit (Ptr<SpectrumChannel> channel, Ptr<SpectrumPhy> txPhy)
+{
+  Ptr<SpectrumSignalParameters> txParams = Create<SpectrumSignalParameters> ();
+  txParams->psd = Create<SpectrumValue> (m_txSpectrumModel);
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      (*txParams->psd)[i] = 1e-9*(i+1);
+    }
+  txParams->duration = MilliSeconds (1);
+  txParams->txPhy = txPhy;
+  channel->StartTx (txParams);
+}
+
+void
+V2XSpectrumChannelCutoffTestCase::Move (Ptr<MobilityModel> mobility, Vector position)
+{
+  mobility->SetPosition (position);
+}
+
+void
+V2XSpectrumChannelCutoffTestCase::NextTransmission ()
+{
+  m_tx++;
+}
+
+void
+V2XSpectrumChannelCutoffTestCase::DoRun (void)
+{
+  const double cutoff_m = 300.0;
+  const Vector txPos (1000.0,1000.0,1.5);
+  // Receivers at and around the cutoff, also along the diagonals (i.e. in the corner cells of the 3x3 grid block)
+  const std::vector<Vector> offsets = {{50.0,0.0,0.0},{-150.0,100.0,0.0},{299.9,0.0,0.0},{300.0,0.0,0.0},{0.0,-300.0,0.0},
+                                       {300.1,0.0,0.0},{212.0,212.0,0.0},{-213.0,-213.0,0.0},{0.0,450.0,0.0},{-900.0,0.0,0.0},
+                                       {150.0,0.0,0.0},{600.0,0.0,0.0}};
+  // The receiver with a different (overlapping) SpectrumModel, and the one moving inside the cutoff
+  const uint32_t otherModelRx = 10;
+  const uint32_t movingRx = 11;
+  const Vector movingRxPos (txPos.x+250.0,txPos.y,txPos.z);
+
+  m_txSpectrumModel = CreateTestSpectrumModel (0.0);
+  Ptr<SpectrumModel> otherSpectrumModel = CreateTestSpectrumModel (90e3);
+
+  Ptr<V2XSpectrumChannel> v2xChannel = CreateObject<V2XSpectrumChannel> ();
+  Ptr<MultiModelSpectrumChannel> refChannel = CreateObject<MultiModelSpectrumChannel> ();
+  std::vector<Ptr<SpectrumChannel>> channels = {v2xChannel,refChannel};
+  for (Ptr<SpectrumChannel> channel : channels)
+    {
+      channel->AddPropagationLossModel (CreateObject<LogDistancePropagationLossModel> ());
+      channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+    }
+  v2xChannel->setMaxRange (cutoff_m);
+
+  std::map<std::pair<uint32_t,uint32_t>,RxRecord> v2xLog;
+  std::map<std::pair<uint32_t,uint32_t>,RxRecord> refLog;
+  std::vector<Ptr<MobilityModel>> mobilities;
+  std::vector<Ptr<V2XTestSpectrumPhy>> v2xPhys;
+  std::vector<Ptr<V2XTestSpectrumPhy>> refPhys;
+
+  // PHY 0 is the transmitter; each position is shared by a PHY attached to each channel
+  for (uint32_t i = 0; i <= offsets.size (); i++)
+    {
+      Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (i == 0 ? txPos : Vector (txPos.x+offsets[i-1].x,txPos.y+offsets[i-1].y,txPos.z));
+      mobilities.push_back (mobility);
+
+      Ptr<V2XTestSpectrumPhy> v2xPhy = CreateObject<V2XTestSpectrumPhy> (i,&v2xLog,&m_tx);
+      Ptr<V2XTestSpectrumPhy> refPhy = CreateObject<V2XTestSpectrumPhy> (i,&refLog,&m_tx);
+      Ptr<const SpectrumModel> rxSpectrumModel = (i == otherModelRx+1) ? otherSpectrumModel : m_txSpectrumModel;
+      for (Ptr<V2XTestSpectrumPhy> phy : {v2xPhy,refPhy})
+        {
+          phy->SetMobility (mobility);
+          phy->SetRxSpectrumModel (rxSpectrumModel);
+        }
+      v2xChannel->AddRx (v2xPhy);
+      refChannel->AddRx (refPhy);
+      v2xPhys.push_back (v2xPhy);
+      refPhys.push_back (refPhy);
+    }
+
+  // Two transmissions, the second one after the moving receiver has entered the cutoff
+  Simulator::Schedule (Seconds (1.0),&V2XSpectrumChannelCutoffTestCase::Transmit,this,v2xChannel,v2xPhys[0]);
+  Simulator::Schedule (Seconds (1.0),&V2XSpectrumChannelCutoffTestCase::Transmit,this,refChannel,refPhys[0]);
+  Simulator::Schedule (Seconds (1.5),&V2XSpectrumChannelCutoffTestCase::Move,this,mobilities[movingRx+1],movingRxPos);
+  Simulator::Schedule (Seconds (1.5),&V2XSpectrumChannelCutoffTestCase::NextTransmission,this);
+  Simulator::Schedule (Seconds (2.0),&V2XSpectrumChannelCutoffTestCase::Transmit,this,v2xChannel,v2xPhys[0]);
+  Simulator::Schedule (Seconds (2.0),&V2XSpectrumChannelCutoffTestCase::Transmit,this,refChannel,refPhys[0]);
+  Simulator::Stop (Seconds (3.0));
+  Simulator::Run ();
+
+  NS_TEST_ASSERT_MSG_EQ (v2xPhys[0]->m_count, 0, "The transmitter received its own signal");
+  NS_TEST_ASSERT_MSG_EQ (refLog.size (), 2*offsets.size (), "The reference channel did not deliver the signals to all the receivers");
+
+  uint32_t expected = 0;
+  for (const auto &ref : refLog)
+    {
+      uint32_t tx = ref.first.first;
+      uint32_t rx = ref.first.second;
+      Vector rxPos = (rx == movingRx+1 && tx == 1) ? movingRxPos : Vector (txPos.x+offsets[rx-1].x,txPos.y+offsets[rx-1].y,txPos.z);
+      auto v2x_it = v2xLog.find (ref.first);
+
+      if (CalculateDistance (txPos,rxPos) > cutoff_m)
+        {
+          NS_TEST_ASSERT_MSG_EQ ((v2x_it == v2xLog.end ()), true, "Receiver " << rx << " outside of the cutoff received transmission " << tx);
+          continue;
+        }
+
+      expected++;
+      NS_TEST_ASSERT_MSG_EQ ((v2x_it != v2xLog.end ()), true, "Receiver " << rx << " within the cutoff did not receive transmission " << tx);
+      NS_TEST_ASSERT_MSG_EQ (v2x_it->second.time, ref.second.time, "Receiver " << rx << " started receiving transmission " << tx << " at a different time");
+      NS_TEST_ASSERT_MSG_EQ (v2x_it->second.psd.size (), ref.second.psd.size (), "Receiver " << rx << " got a PSD with a different number of bands");
+      for (size_t b = 0; b < ref.second.psd.size (); b++)
+        {
+          NS_TEST_ASSERT_MSG_EQ_TOL (v2x_it->second.psd[b], ref.second.psd[b], ref.second.psd[b]*1e-12,
+                                     "Receiver " << rx << " got a different PSD in band " << b << " for transmission " << tx);
+        }
+    }
+  // 7 receivers within the cutoff in the first transmission, 8 in the second one
+  NS_TEST_ASSERT_MSG_EQ (expected, 15, "Unexpected number of receivers within the cutoff");
+  NS_TEST_ASSERT_MSG_EQ (v2xLog.size (), expected, "The V2X channel delivered signals outside of the cutoff");
+  NS_TEST_ASSERT_MSG_EQ (refPhys[otherModelRx+1]->m_count, 2, "The receiver with a different SpectrumModel did not get the signals");
+  NS_TEST_ASSERT_MSG_EQ (v2xPhys[otherModelRx+1]->m_count, 2, "The receiver with a different SpectrumModel did not get the signals");
+  NS_TEST_ASSERT_MSG_EQ (v2xChannel->getCulledReceivers (), 2*offsets.size ()-expected, "Wrong number of culled receivers");
+
+  v2xChannel->Dispose ();
+  refChannel->Dispose ();
+  Simulator::Destroy ();
+}
+
+class AutomotiveV2XSpectrumChannelTestSuite : public TestSuite
+{
+public:
+  AutomotiveV2XSpectrumChannelTestSuite ();
+};
+
+AutomotiveV2XSpectrumChannelTestSuite::AutomotiveV2XSpectrumChannelTestSuite ()
+  : TestSuite ("automotive-v2x-spectrum-channel", UNIT)
+{
+  AddTestCase (new V2XSpectrumChannelCutoffTestCase, TestCase::QUICK);
+}
+
+static AutomotiveV2XSpectrumChannelTestSuite automotiveV2XSpectrumChannelTestSuite;
@@ -23,50 +23,196 @@
 #include "ns3/cv2x_lte-enb-net-device.h"
 #include "ns3/cv2x_lte-ue-net-device.h"
 #include "ns3/cv2x_lte-spectrum-phy.h"
+#include <ns3/abort.h>
 
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <limits>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("cv2x_LteGlobalPathlossDatabase");
 
+cv2x_LteGlobalPathlossDatabase::cv2x_LteGlobalPathlossDatabase (void)
+  : m_singlePrecision (false)
+{
+}
+
 cv2x_LteGlobalPathlossDatabase::~cv2x_LteGlobalPathlossDatabase (void)
 {
 }
 
+void
+cv2x_LteGlobalPathlossDatabase::SetSinglePrecision (bool singlePrecision)
+{
+  NS_LOG_FUNCTION (this << singlePrecision);
+  NS_ABORT_MSG_IF (!m_rowCellId.empty (), "The precision must be set before the first update");
+  m_singlePrecision = singlePrecision;
+}
+
+uint32_t
+cv2x_LteGlobalPathlossDatabase::GetCellRow (Ptr<SpectrumPhy> phy)
+{
+  auto it = m_phyRow.find (PeekPointer (phy));
+  if (it != m_phyRow.end ())
+    {
+      return it->second;
+    }
+  uint16_t cellId = phy->GetDevice ()->GetObject<cv2x_LteEnbNetDevice> ()->GetCellId ();
+  if (cellId >= m_cellRow.size ())
+    {
+      m_cellRow.resize (cellId + 1, -1);
+    }
+  if (m_cellRow[cellId] < 0)
+    {
+      m_cellRow[cellId] = m_rowCellId.size ();
+      m_rowCellId.push_back (cellId);
+      if (m_singlePrecision)
+        {
+          m_pathlossFloat.emplace_back ();
+        }
+      else
+        {
+          m_pathloss.emplace_back ();
+        }
+    }
+  m_phyRow[PeekPointer (phy)] = m_cellRow[cellId];
+  return m_cellRow[cellId];
+}
+
+uint32_t
+cv2x_LteGlobalPathlossDatabase::GetUeColumn (Ptr<SpectrumPhy> phy)
+{
+  auto it = m_phyColumn.find (PeekPointer (phy));
+  if (it != m_phyColumn.end ())
+    {
+      return it->second;
+    }
+  uint64_t imsi = phy->GetDevice ()->GetObject<cv2x_LteUeNetDevice> ()->GetImsi ();
+  auto imsiIt = m_imsiColumn.find (imsi);
+  if (imsiIt == m_imsiColumn.end ())
+    {
+      imsiIt = m_imsiColumn.emplace (imsi, m_columnImsi.size ()).first;
+      m_columnImsi.push_back (imsi);
+    }
+  m_phyColumn[PeekPointer (phy)] = imsiIt->second;
+  return imsiIt->second;
+}
+
+void
+cv2x_LteGlobalPathlossDatabase::SetPathloss (uint32_t row, uint32_t column, double lossDb)
+{
+  if (m_singlePrecision)
+    {
+      std::vector<float> &values = m_pathlossFloat[row];
+      if (column >= values.size ())
+        {
+          values.resize (m_columnImsi.size (), std::numeric_limits<float>::quiet_NaN ());
+        }
+      values[column] = lossDb;
+    }
+  else
+    {
+      std::vector<double> &values = m_pathloss[row];
+      if (column >= values.size ())
+        {
+          values.resize (m_columnImsi.size (), std::numeric_limits<double>::quiet_NaN ());
+        }
+      values[column] = lossDb;
+    }
+}
+
+double
+cv2x_LteGlobalPathlossDatabase::GetValue (uint32_t row, uint32_t column) const
+{
+  if (m_singlePrecision)
+    {
+      const std::vector<float> &values = m_pathlossFloat[row];
+      return column < values.size () ? values[column] : std::numeric_limits<double>::quiet_NaN ();
+    }
+  const std::vector<double> &values = m_pathloss[row];
+  return column < values.size () ? values[column] : std::numeric_limits<double>::quiet_NaN ();
+}
+
 void 
 cv2x_LteGlobalPathlossDatabase::Print ()
 {
   NS_LOG_FUNCTION (this);
-  for (std::map<uint16_t, std::map<uint64_t, double> >::const_iterator cellIdIt = m_pathlossMap.begin ();
-       cellIdIt != m_pathlossMap.end ();
-       ++cellIdIt)
+  std::vector<uint64_t> imsis (m_columnImsi);
+  std::sort (imsis.begin (), imsis.end ());
+  for (uint32_t cellId = 0; cellId < m_cellRow.size (); ++cellId)
     {
-      for (std::map<uint64_t, double>::const_iterator imsiIt = cellIdIt->second.begin ();
-           imsiIt != cellIdIt->second.end ();
-           ++imsiIt)
+      if (m_cellRow[cellId] < 0)
+        {
+          continue;
+        }
+      for (uint64_t imsi : imsis)
         {
-          std::cout << "CellId: " << cellIdIt->first << " IMSI: " << imsiIt->first << " pathloss: " << imsiIt->second << " dB" << std::endl;
+          double lossDb = GetValue (m_cellRow[cellId], m_imsiColumn.at (imsi));
+          if (!std::isnan (lossDb))
+            {
+              std::cout << "CellId: " << cellId << " IMSI: " << imsi << " pathloss: " << lossDb << " dB" << std::endl;
+            }
         }
     }
 }
 
+void
+cv2x_LteGlobalPathlossDatabase::WriteBinary (std::string fileName) const
+{
+  NS_LOG_FUNCTION (this << fileName);
+  std::ofstream outFile (fileName.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!outFile.is_open ())
+    {
+      NS_LOG_ERROR ("Can't open file " << fileName);
+      return;
+    }
+
+  uint32_t header[3] = {static_cast<uint32_t> (m_rowCellId.size ()),
+                        static_cast<uint32_t> (m_columnImsi.size ()),
+                        static_cast<uint32_t> (m_singlePrecision ? sizeof (float) : sizeof (double))};
+  outFile.write (reinterpret_cast<const char *> (header), sizeof (header));
+  outFile.write (reinterpret_cast<const char *> (m_rowCellId.data ()), m_rowCellId.size () * sizeof (uint16_t));
+  outFile.write (reinterpret_cast<const char *> (m_columnImsi.data ()), m_columnImsi.size () * sizeof (uint64_t));
+  for (uint32_t row = 0; row < m_rowCellId.size (); ++row)
+    {
+      if (m_singlePrecision)
+        {
+          std::vector<float> values (m_pathlossFloat[row]);
+          values.resize (m_columnImsi.size (), std::numeric_limits<float>::quiet_NaN ());
+          outFile.write (reinterpret_cast<const char *> (values.data ()), values.size () * sizeof (float));
+        }
+      else
+        {
+          std::vector<double> values (m_pathloss[row]);
+          values.resize (m_columnImsi.size (), std::numeric_limits<double>::quiet_NaN ());
+          outFile.write (reinterpret_cast<const char *> (values.data ()), values.size () * sizeof (double));
+        }
+    }
+  outFile.close ();
+}
+
 
 double
 cv2x_LteGlobalPathlossDatabase::GetPathloss (uint16_t cellId, uint64_t imsi)
 {
   NS_LOG_FUNCTION (this);
-  std::map<uint16_t, std::map<uint64_t, double> >::iterator cellIt = m_pathlossMap.find (cellId);
-  if (cellIt == m_pathlossMap.end())
+  if (cellId >= m_cellRow.size () || m_cellRow[cellId] < 0)
+    {
+      return std::numeric_limits<double>::infinity ();
+    }
+  auto ueIt = m_imsiColumn.find (imsi);
+  if (ueIt == m_imsiColumn.end ())
     {
       return std::numeric_limits<double>::infinity ();
     }
-  std::map<uint64_t, double>::iterator ueIt = cellIt->second.find (imsi);
-  if (ueIt ==  cellIt->second.end())
+  double lossDb = GetValue (m_cellRow[cellId], ueIt->second);
+  if (std::isnan (lossDb))
     {
       return std::numeric_limits<double>::infinity ();
     }
-  return ueIt->second;
+  return lossDb;
 }
  
 
@@ -77,9 +223,7 @@ cv2x_DownlinkLteGlobalPathlossDatabase::UpdatePathloss (std::string context,
                                         double lossDb)
 {
   NS_LOG_FUNCTION (this << lossDb);
-  uint16_t cellId = txPhy->GetDevice ()->GetObject<cv2x_LteEnbNetDevice> ()->GetCellId ();
-  uint16_t imsi = rxPhy->GetDevice ()->GetObject<cv2x_LteUeNetDevice> ()->GetImsi ();
-  m_pathlossMap[cellId][imsi] = lossDb;
+  SetPathloss (GetCellRow (txPhy), GetUeColumn (rxPhy), lossDb);
 }
 
 
@@ -90,9 +234,7 @@ cv2x_UplinkLteGlobalPathlossDatabase::UpdatePathloss (std::string context,
                                         double lossDb)
 {
   NS_LOG_FUNCTION (this << lossDb);
-  uint16_t imsi = txPhy->GetDevice ()->GetObject<cv2x_LteUeNetDevice> ()->GetImsi ();
-  uint16_t cellId = rxPhy->GetDevice ()->GetObject<cv2x_LteEnbNetDevice> ()->GetCellId ();
-  m_pathlossMap[cellId][imsi] = lossDb;
+  SetPathloss (GetCellRow (rxPhy), GetUeColumn (txPhy), lossDb);
 }
 
 
@@ -25,7 +25,8 @@
 #include <ns3/log.h>
 #include <ns3/ptr.h>
 #include <string>
-#include <map>
+#include <vector>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -43,6 +44,7 @@ class cv2x_LteGlobalPathlossDatabase
 {
 public:
 
+  cv2x_LteGlobalPathlossDatabase (void);
   virtual ~cv2x_LteGlobalPathlossDatabase (void);
 
   /** 
@@ -71,12 +73,66 @@ public:
    */
   void Print ();
 
+  /**
+   * Store the pathloss values as float instead of double. It must be
+   * called before the first update.
+   *
+   * \param singlePrecision true to store the values as float
+   */
+  void SetSinglePrecision (bool singlePrecision);
+
+  /**
+   * Write the pathloss matrix to a binary file, in native byte order:
+   * the number of cells, the number of UEs and the size of a value
+   * (uint32_t each), the cell IDs (uint16_t each), the IMSIs (uint64_t
+   * each) and then the pathloss of each cell to each UE, cell after
+   * cell (NaN if never updated).
+   *
+   * \param fileName the name of the file
+   */
+  void WriteBinary (std::string fileName) const;
+
 protected:
   /**
-   * List of the last pathloss value for each UE by CellId.
-   * ( CELL ID,  ( IMSI,PATHLOSS ))
+   * \param phy the PHY of the eNB
+   * \return the row of the eNB cell in the pathloss matrix
+   */
+  uint32_t GetCellRow (Ptr<SpectrumPhy> phy);
+  /**
+   * \param phy the PHY of the UE
+   * \return the column of the UE in the pathloss matrix
+   */
+  uint32_t GetUeColumn (Ptr<SpectrumPhy> phy);
+  /**
+   * Store a pathloss value
+   *
+   * \param row the row of the cell
+   * \param column the column of the UE
+   * \param lossDb the loss in dB
+   */
+  void SetPathloss (uint32_t row, uint32_t column, double lossDb);
+
+private:
+  /**
+   * \param row the row of the cell
+   * \param column the column of the UE
+   * \return the stored pathloss value, NaN if never updated
+   */
+  double GetValue (uint32_t row, uint32_t column) const;
+
+  std::vector<int32_t> m_cellRow; ///< row of each cell ID, -1 if none
+  std::vector<uint16_t> m_rowCellId; ///< cell ID of each row
+  std::unordered_map<uint64_t, uint32_t> m_imsiColumn; ///< column of each IMSI
+  std::vector<uint64_t> m_columnImsi; ///< IMSI of each column
+  std::unordered_map<const SpectrumPhy *, uint32_t> m_phyRow; ///< row of each eNB PHY already seen
+  std::unordered_map<const SpectrumPhy *, uint32_t> m_phyColumn; ///< column of each UE PHY already seen
+  bool m_singlePrecision; ///< store the values as float
+  /**
+   * Last pathloss value of each cell (row) to each UE (column), only one
+   * of them is used depending on m_singlePrecision
    */
-  std::map<uint16_t, std::map<uint64_t, double> > m_pathlossMap;
+  std::vector<std::vector<double> > m_pathloss;
+  std::vector<std::vector<float> > m_pathlossFloat; ///< the pathloss values as float
 };
 
 /**
@@ -1110,6 +1110,7 @@ cv2x_LteHelper::InstallSingleUeDevice (Ptr<Node> n)
           slPhy->SetLtePhyRxDataEndOkCallback (MakeCallback (&cv2x_LteUePhy::PhyPduReceived, ccPhy));
           slPhy->SetLtePhyRxCtrlEndOkCallback (MakeCallback (&cv2x_LteUePhy::ReceiveLteControlMessageList, ccPhy));
           slPhy->SetLtePhyRxSlssCallback (MakeCallback (&cv2x_LteUePhy::ReceiveSlss, ccPhy));
+          slPhy->SetLtePhyRxSlStartCallback (MakeCallback (&cv2x_LteUePhy::ResumeSubframeIndication, ccPhy));
         }
     }
 
@@ -27,6 +27,8 @@
 #include <ns3/cv2x_lte-ue-rrc.h>
 #include <ns3/cv2x_lte-enb-net-device.h>
 #include <ns3/cv2x_lte-ue-net-device.h>
+#include <ns3/boolean.h>
+#include <ns3/uinteger.h>
 
 namespace ns3 {
 
@@ -36,7 +38,9 @@ NS_OBJECT_ENSURE_REGISTERED (cv2x_LteStatsCalculator);
 
 cv2x_LteStatsCalculator::cv2x_LteStatsCalculator ()
   : m_dlOutputFilename (""),
-    m_ulOutputFilename ("")
+    m_ulOutputFilename (""),
+    m_binaryOutput (false),
+    m_outputBufferSize (1 << 20)
 {
   // Nothing to do here
 
@@ -55,11 +59,27 @@ cv2x_LteStatsCalculator::GetTypeId (void)
     .SetParent<Object> ()
     .SetGroupName("Lte")
     .AddConstructor<cv2x_LteStatsCalculator> ()
+    .AddAttribute ("BinaryOutput",
+                   "If true, the results are written in binary format (see cv2x_StatsOutputFile).",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&cv2x_LteStatsCalculator::m_binaryOutput),
+                   MakeBooleanChecker ())
+    .AddAttribute ("OutputBufferSize",
+                   "Size in bytes of the write buffer of each output file.",
+                   UintegerValue (1 << 20),
+                   MakeUintegerAccessor (&cv2x_LteStatsCalculator::m_outputBufferSize),
+                   MakeUintegerChecker<uint32_t> ())
   ;
   return tid;
 }
 
 
+bool
+cv2x_LteStatsCalculator::OpenOutputFile (cv2x_StatsOutputFile &file, std::string fileName, std::string header)
+{
+  return file.Open (fileName, header, m_binaryOutput, m_outputBufferSize);
+}
+
 void
 cv2x_LteStatsCalculator::SetUlOutputFilename (std::string outputFilename)
 {
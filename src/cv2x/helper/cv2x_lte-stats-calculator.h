@@ -24,6 +24,7 @@
 
 #include "ns3/object.h"
 #include "ns3/string.h"
+#include "ns3/cv2x_stats-output-file.h"
 #include <map>
 
 namespace ns3 {
@@ -237,6 +238,16 @@ protected:
    */
   static uint64_t FindImsiForUe (std::string path, uint16_t rnti);
 
+  /**
+   * Open an output file of the calculator, with the configured format
+   * and buffer size
+   * @param file the output file
+   * @param fileName the name of the file
+   * @param header the header line
+   * @return true if the file was opened
+   */
+  bool OpenOutputFile (cv2x_StatsOutputFile &file, std::string fileName, std::string header);
+
 private:
   /**
    * List of IMSI by path in the attribute system
@@ -277,6 +288,16 @@ private:
    * Name of the file where the sidelink shared channel ue mac results will be saved
    */
   std::string m_slSchUeOutputFilename;
+
+  /**
+   * Write the results in binary format
+   */
+  bool m_binaryOutput;
+
+  /**
+   * Size of the write buffer of each output file
+   */
+  uint32_t m_outputBufferSize;
 };
 
 } // namespace ns3
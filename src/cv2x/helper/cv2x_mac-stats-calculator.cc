@@ -33,10 +33,10 @@ NS_LOG_COMPONENT_DEFINE ("cv2x_MacStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (cv2x_MacStatsCalculator);
 
 cv2x_MacStatsCalculator::cv2x_MacStatsCalculator ()
-  : m_dlFirstWrite (true),
-    m_ulFirstWrite (true),
-    m_slUeFirstWrite (true),
-    m_slSchUeFirstWrite (true)
+  : m_dlOutput (),
+    m_ulOutput (),
+    m_slUeOutput (),
+    m_slSchUeOutput ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -133,41 +133,24 @@ cv2x_MacStatsCalculator::DlScheduling (uint16_t cellId, uint64_t imsi, cv2x_DlSc
 		  dlSchedulingCallbackInfo.rnti << (uint32_t) dlSchedulingCallbackInfo.mcsTb1 << dlSchedulingCallbackInfo.sizeTb1 << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << dlSchedulingCallbackInfo.sizeTb2);
   NS_LOG_INFO ("Write DL Mac Stats in " << GetDlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_dlFirstWrite == true )
+  if (!m_dlOutput.IsOpen ()
+      && !OpenOutputFile (m_dlOutput, GetDlOutputFilename (), "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId"))
     {
-      outFile.open (GetDlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
-      m_dlFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcsTb1\tsizeTb1\tmcsTb2\tsizeTb2\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetDlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << (uint32_t) cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << dlSchedulingCallbackInfo.frameNo << "\t";
-  outFile << dlSchedulingCallbackInfo.subframeNo << "\t";
-  outFile << dlSchedulingCallbackInfo.rnti << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.mcsTb1 << "\t";
-  outFile << dlSchedulingCallbackInfo.sizeTb1 << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.mcsTb2 << "\t";
-  outFile << dlSchedulingCallbackInfo.sizeTb2 << "\t";
-  outFile << (uint32_t) dlSchedulingCallbackInfo.componentCarrierId << std::endl;
-  outFile.close ();
+  m_dlOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_dlOutput << (uint32_t) cellId;
+  m_dlOutput << imsi;
+  m_dlOutput << dlSchedulingCallbackInfo.frameNo;
+  m_dlOutput << dlSchedulingCallbackInfo.subframeNo;
+  m_dlOutput << dlSchedulingCallbackInfo.rnti;
+  m_dlOutput << (uint32_t) dlSchedulingCallbackInfo.mcsTb1;
+  m_dlOutput << dlSchedulingCallbackInfo.sizeTb1;
+  m_dlOutput << (uint32_t) dlSchedulingCallbackInfo.mcsTb2;
+  m_dlOutput << dlSchedulingCallbackInfo.sizeTb2;
+  m_dlOutput << (uint32_t) dlSchedulingCallbackInfo.componentCarrierId;
+  m_dlOutput.EndRow ();
 }
 
 void
@@ -177,39 +160,22 @@ cv2x_MacStatsCalculator::UlScheduling (uint16_t cellId, uint64_t imsi, uint32_t
   NS_LOG_FUNCTION (this << cellId << imsi << frameNo << subframeNo << rnti << (uint32_t) mcsTb << size);
   NS_LOG_INFO ("Write UL Mac Stats in " << GetUlOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_ulFirstWrite == true )
-    {
-      outFile.open (GetUlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-      m_ulFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId";
-      outFile << std::endl;
-    }
-  else
+  if (!m_ulOutput.IsOpen ()
+      && !OpenOutputFile (m_ulOutput, GetUlOutputFilename (), "% time\tcellId\tIMSI\tframe\tsframe\tRNTI\tmcs\tsize\tccId"))
     {
-      outFile.open (GetUlOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << (uint32_t) cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << frameNo << "\t";
-  outFile << subframeNo << "\t";
-  outFile << rnti << "\t";
-  outFile << (uint32_t) mcsTb << "\t";
-  outFile << size << "\t";
-  outFile << (uint32_t) componentCarrierId << std::endl;
-  outFile.close ();
+  m_ulOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_ulOutput << (uint32_t) cellId;
+  m_ulOutput << imsi;
+  m_ulOutput << frameNo;
+  m_ulOutput << subframeNo;
+  m_ulOutput << rnti;
+  m_ulOutput << (uint32_t) mcsTb;
+  m_ulOutput << size;
+  m_ulOutput << (uint32_t) componentCarrierId;
+  m_ulOutput.EndRow ();
 }
 
 void
@@ -218,46 +184,29 @@ cv2x_MacStatsCalculator::SlUeScheduling (cv2x_SlUeMacStatParameters params)
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_frameNo << params.m_subframeNo << params.m_rnti << (uint32_t) params.m_mcs << params.m_pscchRi << params.m_pscchFrame1 << params.m_pscchSubframe1 << params.m_pscchFrame2 << params.m_pscchSubframe2 << params.m_psschTxStartRB << params.m_psschTxLengthRB << params.m_psschItrp);
   NS_LOG_INFO ("Write SL UE Mac Stats in " << GetSlUeOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_slUeFirstWrite == true )
+  if (!m_slUeOutput.IsOpen ()
+      && !OpenOutputFile (m_slUeOutput, GetSlUeOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tframe\tsframe\tpscchRi\tpscchF1\tpscchSF1\tpscchF2\tpscchSF2\tmcs\tTBS\tpsschRB\tpsschLen\tpssch_itrp"))
     {
-      outFile.open (GetSlUeOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeOutputFilename ().c_str ());
-          return;
-        }
-      m_slUeFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tframe\tsframe\tpscchRi\tpscchF1\tpscchSF1\tpscchF2\tpscchSF2\tmcs\tTBS\tpsschRB\tpsschLen\tpssch_itrp";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetSlUeOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlUeOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << (uint32_t) params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  outFile << params.m_frameNo << "\t";
-  outFile << params.m_subframeNo << "\t";
-  outFile << params.m_pscchRi << "\t";
-  outFile << params.m_pscchFrame1 << "\t";
-  outFile << params.m_pscchSubframe1 << "\t";
-  outFile << params.m_pscchFrame2 << "\t";
-  outFile << params.m_pscchSubframe2 << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_tbSize << "\t";
-  outFile << params.m_psschTxStartRB << "\t";
-  outFile << params.m_psschTxLengthRB << "\t";
-  outFile << params.m_psschItrp << std::endl;
-  outFile.close ();
+  m_slUeOutput << (uint32_t) params.m_timestamp;
+  m_slUeOutput << (uint32_t) params.m_cellId;
+  m_slUeOutput << params.m_imsi;
+  m_slUeOutput << params.m_rnti;
+  m_slUeOutput << params.m_frameNo;
+  m_slUeOutput << params.m_subframeNo;
+  m_slUeOutput << params.m_pscchRi;
+  m_slUeOutput << params.m_pscchFrame1;
+  m_slUeOutput << params.m_pscchSubframe1;
+  m_slUeOutput << params.m_pscchFrame2;
+  m_slUeOutput << params.m_pscchSubframe2;
+  m_slUeOutput << (uint32_t) params.m_mcs;
+  m_slUeOutput << params.m_tbSize;
+  m_slUeOutput << params.m_psschTxStartRB;
+  m_slUeOutput << params.m_psschTxLengthRB;
+  m_slUeOutput << params.m_psschItrp;
+  m_slUeOutput.EndRow ();
 }
 
 void
@@ -266,44 +215,27 @@ cv2x_MacStatsCalculator::SlSharedChUeScheduling (cv2x_SlUeMacStatParameters para
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_rnti << params.m_frameNo << params.m_subframeNo << (uint32_t) params.m_mcs << params.m_tbSize << params.m_psschTxStartRB << params.m_psschTxLengthRB);
   NS_LOG_INFO ("Write SL Shared Channel UE Mac Stats in " << GetSlSchUeOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_slSchUeFirstWrite == true )
-    {
-      outFile.open (GetSlSchUeOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlSchUeOutputFilename ().c_str ());
-          return;
-        }
-      m_slSchUeFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tSlPframe\tSlPsframe\tSchStartframe\tSchSsframe\tframe\tsframe\tmcs\tTBS\tpsschRB\tpsschLen";
-      outFile << std::endl;
-    }
-  else
+  if (!m_slSchUeOutput.IsOpen ()
+      && !OpenOutputFile (m_slSchUeOutput, GetSlSchUeOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tSlPframe\tSlPsframe\tSchStartframe\tSchSsframe\tframe\tsframe\tmcs\tTBS\tpsschRB\tpsschLen"))
     {
-      outFile.open (GetSlSchUeOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlSchUeOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << (uint32_t) params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  outFile << params.m_frameNo << "\t";
-  outFile << params.m_subframeNo << "\t";
-  outFile << params.m_psschFrameStart << "\t";
-  outFile << params.m_psschSubframeStart << "\t";
-  outFile << params.m_psschFrame << "\t";
-  outFile << params.m_psschSubframe << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_tbSize << "\t";
-  outFile << params.m_psschTxStartRB << "\t";
-  outFile << params.m_psschTxLengthRB << std::endl;
-  outFile.close ();
+  m_slSchUeOutput << (uint32_t) params.m_timestamp;
+  m_slSchUeOutput << (uint32_t) params.m_cellId;
+  m_slSchUeOutput << params.m_imsi;
+  m_slSchUeOutput << params.m_rnti;
+  m_slSchUeOutput << params.m_frameNo;
+  m_slSchUeOutput << params.m_subframeNo;
+  m_slSchUeOutput << params.m_psschFrameStart;
+  m_slSchUeOutput << params.m_psschSubframeStart;
+  m_slSchUeOutput << params.m_psschFrame;
+  m_slSchUeOutput << params.m_psschSubframe;
+  m_slSchUeOutput << (uint32_t) params.m_mcs;
+  m_slSchUeOutput << params.m_tbSize;
+  m_slSchUeOutput << params.m_psschTxStartRB;
+  m_slSchUeOutput << params.m_psschTxLengthRB;
+  m_slSchUeOutput.EndRow ();
 }
 
 void
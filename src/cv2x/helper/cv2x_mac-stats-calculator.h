@@ -199,36 +199,24 @@ public:
 
 private:
   /**
-   * When writing DL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the DL MAC statistics
    */
-  bool m_dlFirstWrite;
+  cv2x_StatsOutputFile m_dlOutput;
 
   /**
-   * When writing UL MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the UL MAC statistics
    */
-  bool m_ulFirstWrite;
+  cv2x_StatsOutputFile m_ulOutput;
 
   /**
-   * When writing SL UE MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the SL UE MAC statistics
    */
-  bool m_slUeFirstWrite;
+  cv2x_StatsOutputFile m_slUeOutput;
 
   /**
-   * When writing SL Shared Channel UE MAC statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the SL Shared Channel UE MAC statistics
    */
-  bool m_slSchUeFirstWrite;
+  cv2x_StatsOutputFile m_slSchUeOutput;
 
 };
 
@@ -34,10 +34,10 @@ NS_LOG_COMPONENT_DEFINE ("cv2x_PhyRxStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (cv2x_PhyRxStatsCalculator);
 
 cv2x_PhyRxStatsCalculator::cv2x_PhyRxStatsCalculator ()
-  : m_dlRxFirstWrite (true),
-    m_ulRxFirstWrite (true),
+  : m_dlRxOutput (),
+    m_ulRxOutput (),
     m_slRxFirstWrite (true),
-    m_slPscchRxFirstWrite (true)
+    m_slPscchRxOutput ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -133,43 +133,26 @@ cv2x_PhyRxStatsCalculator::DlPhyReception (cv2x_PhyReceptionStatParameters param
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write DL Rx Phy Stats in " << GetDlRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_dlRxFirstWrite == true )
+  if (!m_dlRxOutput.IsOpen ()
+      && !OpenOutputFile (m_dlRxOutput, GetDlRxOutputFilename (), "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId"))
     {
-      outFile.open (GetDlRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlRxOutputFilename ().c_str ());
-          return;
-        }
-      m_dlRxFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetDlRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlRxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  outFile << (uint32_t) params.m_txMode << "\t";
-  outFile << (uint32_t) params.m_layer << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_size << "\t";
-  outFile << (uint32_t) params.m_rv << "\t";
-  outFile << (uint32_t) params.m_ndi << "\t";
-  outFile << (uint32_t) params.m_correctness << "\t";
-  outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
+//   m_dlRxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_dlRxOutput << params.m_timestamp;
+  m_dlRxOutput << (uint32_t) params.m_cellId;
+  m_dlRxOutput << params.m_imsi;
+  m_dlRxOutput << params.m_rnti;
+  m_dlRxOutput << (uint32_t) params.m_txMode;
+  m_dlRxOutput << (uint32_t) params.m_layer;
+  m_dlRxOutput << (uint32_t) params.m_mcs;
+  m_dlRxOutput << params.m_size;
+  m_dlRxOutput << (uint32_t) params.m_rv;
+  m_dlRxOutput << (uint32_t) params.m_ndi;
+  m_dlRxOutput << (uint32_t) params.m_correctness;
+  m_dlRxOutput << (uint32_t) params.m_ccId;
+  m_dlRxOutput.EndRow ();
 }
 
 void
@@ -178,42 +161,25 @@ cv2x_PhyRxStatsCalculator::UlPhyReception (cv2x_PhyReceptionStatParameters param
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write UL Rx Phy Stats in " << GetUlRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_ulRxFirstWrite == true )
+  if (!m_ulRxOutput.IsOpen ()
+      && !OpenOutputFile (m_ulRxOutput, GetUlRxOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId"))
     {
-      outFile.open (GetUlRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlRxOutputFilename ().c_str ());
-          return;
-        }
-      m_ulRxFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tcorrect\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetUlRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlRxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  outFile << (uint32_t) params.m_layer << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_size << "\t";
-  outFile << (uint32_t) params.m_rv << "\t";
-  outFile << (uint32_t) params.m_ndi << "\t";
-  outFile << (uint32_t) params.m_correctness << "\t";
-  outFile << (uint32_t) params.m_ccId <<std::endl;
-  outFile.close ();
+//   m_ulRxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_ulRxOutput << params.m_timestamp;
+  m_ulRxOutput << (uint32_t) params.m_cellId;
+  m_ulRxOutput << params.m_imsi;
+  m_ulRxOutput << params.m_rnti;
+  m_ulRxOutput << (uint32_t) params.m_layer;
+  m_ulRxOutput << (uint32_t) params.m_mcs;
+  m_ulRxOutput << params.m_size;
+  m_ulRxOutput << (uint32_t) params.m_rv;
+  m_ulRxOutput << (uint32_t) params.m_ndi;
+  m_ulRxOutput << (uint32_t) params.m_correctness;
+  m_ulRxOutput << (uint32_t) params.m_ccId;
+  m_ulRxOutput.EndRow ();
 }
 
 void
@@ -244,43 +210,24 @@ cv2x_PhyRxStatsCalculator::SlPscchReception (cv2x_PhyReceptionStatParameters par
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi << params.m_correctness);
   NS_LOG_INFO ("Write SL Rx PSCCH Stats in " << GetSlPscchRxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_slPscchRxFirstWrite == true )
-    {
-      outFile.open (GetSlPscchRxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlPscchRxOutputFilename ().c_str ());
-          return;
-        }
-      m_slPscchRxFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tcorrect";
-      //outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trbStart\trbLen\tcorrect";
-
-      outFile << std::endl;
-    }
-  else
+  if (!m_slPscchRxOutput.IsOpen ()
+      && !OpenOutputFile (m_slPscchRxOutput, GetSlPscchRxOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tlayer\tcorrect"))
     {
-      outFile.open (GetSlPscchRxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlPscchRxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  outFile << (uint32_t) params.m_layer << "\t";
-  //outFile << (uint32_t) params.m_mcs << "\t";
-  //outFile << params.m_size << "\t";
-  //outFile << (uint32_t) params.m_rv << "\t"; // This is used for the rbStart
-  //outFile << (uint32_t) params.m_ndi << "\t";// This is used for the rbLen
-  outFile << (uint32_t) params.m_correctness << std::endl;
-  outFile.close ();
+//   m_slPscchRxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_slPscchRxOutput << params.m_timestamp;
+  m_slPscchRxOutput << (uint32_t) params.m_cellId;
+  m_slPscchRxOutput << params.m_imsi;
+  m_slPscchRxOutput << params.m_rnti;
+  m_slPscchRxOutput << (uint32_t) params.m_layer;
+  //m_slPscchRxOutput << (uint32_t) params.m_mcs;
+  //m_slPscchRxOutput << params.m_size;
+  //m_slPscchRxOutput << (uint32_t) params.m_rv; // This is used for the rbStart
+  //m_slPscchRxOutput << (uint32_t) params.m_ndi;// This is used for the rbLen
+  m_slPscchRxOutput << (uint32_t) params.m_correctness;
+  m_slPscchRxOutput.EndRow ();
 }
 
 void
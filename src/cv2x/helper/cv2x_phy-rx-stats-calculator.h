@@ -187,20 +187,14 @@ public:
 private:
 
   /**
-   * When writing DL RX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the DL RX PHY statistics
    */
-  bool m_dlRxFirstWrite;
+  cv2x_StatsOutputFile m_dlRxOutput;
 
   /**
-   * When writing UL RX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the UL RX PHY statistics
    */
-  bool m_ulRxFirstWrite;
+  cv2x_StatsOutputFile m_ulRxOutput;
 
   /**
    * When writing SL RX PHY statistics first time to file,
@@ -211,12 +205,9 @@ private:
   bool m_slRxFirstWrite;
   
   /**
-   * When writing SL RX PSCCH statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the SL RX PSCCH statistics
    */
-  bool m_slPscchRxFirstWrite;
+  cv2x_StatsOutputFile m_slPscchRxOutput;
 
 };
 
@@ -31,9 +31,9 @@ NS_LOG_COMPONENT_DEFINE ("cv2x_PhyStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (cv2x_PhyStatsCalculator);
 
 cv2x_PhyStatsCalculator::cv2x_PhyStatsCalculator ()
-  :  m_RsrpSinrFirstWrite (true),
-    m_UeSinrFirstWrite (true),
-    m_InterferenceFirstWrite (true)
+  :  m_RsrpSinrOutput (),
+    m_UeSinrOutput (),
+    m_InterferenceOutput ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -115,37 +115,20 @@ cv2x_PhyStatsCalculator::ReportCurrentCellRsrpSinr (uint16_t cellId, uint64_t im
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << rsrp << sinr);
   NS_LOG_INFO ("Write RSRP/SINR Phy Stats in " << GetCurrentCellRsrpSinrFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_RsrpSinrFirstWrite == true )
+  if (!m_RsrpSinrOutput.IsOpen ()
+      && !OpenOutputFile (m_RsrpSinrOutput, GetCurrentCellRsrpSinrFilename (), "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId"))
     {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
-          return;
-        }
-      m_RsrpSinrFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\trsrp\tsinr\tComponentCarrierId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetCurrentCellRsrpSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetCurrentCellRsrpSinrFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << rnti << "\t";
-  outFile << rsrp << "\t";
-  outFile << sinr << "\t";
-  outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
+  m_RsrpSinrOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_RsrpSinrOutput << cellId;
+  m_RsrpSinrOutput << imsi;
+  m_RsrpSinrOutput << rnti;
+  m_RsrpSinrOutput << rsrp;
+  m_RsrpSinrOutput << sinr;
+  m_RsrpSinrOutput << (uint32_t)componentCarrierId;
+  m_RsrpSinrOutput.EndRow ();
 }
 
 void
@@ -154,36 +137,19 @@ cv2x_PhyStatsCalculator::ReportUeSinr (uint16_t cellId, uint64_t imsi, uint16_t
   NS_LOG_FUNCTION (this << cellId <<  imsi << rnti  << sinrLinear);
   NS_LOG_INFO ("Write SINR Linear Phy Stats in " << GetUeSinrFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_UeSinrFirstWrite == true )
+  if (!m_UeSinrOutput.IsOpen ()
+      && !OpenOutputFile (m_UeSinrOutput, GetUeSinrFilename (), "% time\tcellId\tIMSI\tRNTI\tsinrLinear\tcomponentCarrierId"))
     {
-      outFile.open (GetUeSinrFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
-          return;
-        }
-      m_UeSinrFirstWrite = false;
-      outFile << "% time\tcellId\tIMSI\tRNTI\tsinrLinear\tcomponentCarrierId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetUeSinrFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUeSinrFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << cellId << "\t";
-  outFile << imsi << "\t";
-  outFile << rnti << "\t";
-  outFile << sinrLinear << "\t";
-  outFile << (uint32_t)componentCarrierId << std::endl;
-  outFile.close ();
+  m_UeSinrOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_UeSinrOutput << cellId;
+  m_UeSinrOutput << imsi;
+  m_UeSinrOutput << rnti;
+  m_UeSinrOutput << sinrLinear;
+  m_UeSinrOutput << (uint32_t)componentCarrierId;
+  m_UeSinrOutput.EndRow ();
 }
 
 void
@@ -192,33 +158,16 @@ cv2x_PhyStatsCalculator::ReportInterference (uint16_t cellId, Ptr<SpectrumValue>
   NS_LOG_FUNCTION (this << cellId <<  interference);
   NS_LOG_INFO ("Write Interference Phy Stats in " << GetInterferenceFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_InterferenceFirstWrite == true )
-    {
-      outFile.open (GetInterferenceFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
-          return;
-        }
-      m_InterferenceFirstWrite = false;
-      outFile << "% time\tcellId\tInterference";
-      outFile << std::endl;
-    }
-  else
+  if (!m_InterferenceOutput.IsOpen ()
+      && !OpenOutputFile (m_InterferenceOutput, GetInterferenceFilename (), "% time\tcellId\tInterference"))
     {
-      outFile.open (GetInterferenceFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetInterferenceFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << cellId << "\t";
-  outFile << *interference;
-  outFile.close ();
+  m_InterferenceOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_InterferenceOutput << cellId;
+  m_InterferenceOutput << *interference;
+  m_InterferenceOutput.EndRow ();
 }
 
 
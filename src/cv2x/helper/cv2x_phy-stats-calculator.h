@@ -183,28 +183,19 @@ public:
 
 private:
   /**
-   * When writing RSRP SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the RSRP SINR statistics
    */
-  bool m_RsrpSinrFirstWrite;
+  cv2x_StatsOutputFile m_RsrpSinrOutput;
 
   /**
-   * When writing UE SINR statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the UE SINR statistics
    */
-  bool m_UeSinrFirstWrite;
+  cv2x_StatsOutputFile m_UeSinrOutput;
 
   /**
-   * When writing interference statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the interference statistics
    */
-  bool m_InterferenceFirstWrite;
+  cv2x_StatsOutputFile m_InterferenceOutput;
 
   /**
    * Name of the file where the RSRP/SINR statistics will be saved
@@ -33,9 +33,9 @@ NS_LOG_COMPONENT_DEFINE ("cv2x_PhyTxStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED (cv2x_PhyTxStatsCalculator);
 
 cv2x_PhyTxStatsCalculator::cv2x_PhyTxStatsCalculator ()
-  : m_dlTxFirstWrite (true),
-    m_ulTxFirstWrite (true),
-    m_slTxFirstWrite (true)
+  : m_dlTxOutput (),
+    m_ulTxOutput (),
+    m_slTxOutput ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -114,43 +114,25 @@ cv2x_PhyTxStatsCalculator::DlPhyTransmission (cv2x_PhyTransmissionStatParameters
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi);
   NS_LOG_INFO ("Write DL Tx Phy Stats in " << GetDlTxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_dlTxFirstWrite == true )
+  if (!m_dlTxOutput.IsOpen ()
+      && !OpenOutputFile (m_dlTxOutput, GetDlOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId"))
     {
-      outFile.open (GetDlOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlTxOutputFilename ().c_str ());
-          return;
-        }
-      m_dlTxFirstWrite = false;
-      //outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi"; // txMode is not available at dl tx side
-      outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetDlTxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlTxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  //outFile << (uint32_t) params.m_txMode << "\t"; // txMode is not available at dl tx side
-  outFile << (uint32_t) params.m_layer << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_size << "\t";
-  outFile << (uint32_t) params.m_rv << "\t";
-  outFile << (uint32_t) params.m_ndi << "\t";
-  outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
+//   m_dlTxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_dlTxOutput << params.m_timestamp;
+  m_dlTxOutput << (uint32_t) params.m_cellId;
+  m_dlTxOutput << params.m_imsi;
+  m_dlTxOutput << params.m_rnti;
+  //m_dlTxOutput << (uint32_t) params.m_txMode; // txMode is not available at dl tx side
+  m_dlTxOutput << (uint32_t) params.m_layer;
+  m_dlTxOutput << (uint32_t) params.m_mcs;
+  m_dlTxOutput << params.m_size;
+  m_dlTxOutput << (uint32_t) params.m_rv;
+  m_dlTxOutput << (uint32_t) params.m_ndi;
+  m_dlTxOutput << (uint32_t) params.m_ccId;
+  m_dlTxOutput.EndRow ();
 }
 
 void
@@ -159,43 +141,25 @@ cv2x_PhyTxStatsCalculator::UlPhyTransmission (cv2x_PhyTransmissionStatParameters
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi);
   NS_LOG_INFO ("Write UL Tx Phy Stats in " << GetUlTxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_ulTxFirstWrite == true )
+  if (!m_ulTxOutput.IsOpen ()
+      && !OpenOutputFile (m_ulTxOutput, GetUlTxOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId"))
     {
-      outFile.open (GetUlTxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlTxOutputFilename ().c_str ());
-          return;
-        }
-      m_ulTxFirstWrite = false;
-//       outFile << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi";
-      outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi\tccId";
-      outFile << std::endl;
-    }
-  else
-    {
-      outFile.open (GetUlTxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlTxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  //outFile << (uint32_t) params.m_txMode << "\t";
-  outFile << (uint32_t) params.m_layer << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_size << "\t";
-  outFile << (uint32_t) params.m_rv << "\t";
-  outFile << (uint32_t) params.m_ndi << "\t";
-  outFile << (uint32_t) params.m_ccId << std::endl;
-  outFile.close ();
+//   m_ulTxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_ulTxOutput << params.m_timestamp;
+  m_ulTxOutput << (uint32_t) params.m_cellId;
+  m_ulTxOutput << params.m_imsi;
+  m_ulTxOutput << params.m_rnti;
+  //m_ulTxOutput << (uint32_t) params.m_txMode;
+  m_ulTxOutput << (uint32_t) params.m_layer;
+  m_ulTxOutput << (uint32_t) params.m_mcs;
+  m_ulTxOutput << params.m_size;
+  m_ulTxOutput << (uint32_t) params.m_rv;
+  m_ulTxOutput << (uint32_t) params.m_ndi;
+  m_ulTxOutput << (uint32_t) params.m_ccId;
+  m_ulTxOutput.EndRow ();
 }
 
 void
@@ -204,42 +168,24 @@ cv2x_PhyTxStatsCalculator::SlPhyTransmission (cv2x_PhyTransmissionStatParameters
   NS_LOG_FUNCTION (this << params.m_cellId << params.m_imsi << params.m_timestamp << params.m_rnti << params.m_layer << params.m_mcs << params.m_size << params.m_rv << params.m_ndi);
   NS_LOG_INFO ("Write SL Tx Phy Stats in " << GetSlTxOutputFilename ().c_str ());
 
-  std::ofstream outFile;
-  if ( m_slTxFirstWrite == true )
-    {
-      outFile.open (GetSlTxOutputFilename ().c_str ());
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlTxOutputFilename ().c_str ());
-          return;
-        }
-      m_slTxFirstWrite = false;
-//       outFile << "% time\tcellId\tIMSI\tRNTI\ttxMode\tlayer\tmcs\tsize\trv\tndi";
-      outFile << "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi";
-      outFile << std::endl;
-    }
-  else
+  if (!m_slTxOutput.IsOpen ()
+      && !OpenOutputFile (m_slTxOutput, GetSlTxOutputFilename (), "% time\tcellId\tIMSI\tRNTI\tlayer\tmcs\tsize\trv\tndi"))
     {
-      outFile.open (GetSlTxOutputFilename ().c_str (),  std::ios_base::app);
-      if (!outFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetSlTxOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-//   outFile << Simulator::Now ().GetNanoSeconds () / (double) 1e9 << "\t";
-  outFile << params.m_timestamp << "\t";
-  outFile << (uint32_t) params.m_cellId << "\t";
-  outFile << params.m_imsi << "\t";
-  outFile << params.m_rnti << "\t";
-  //outFile << (uint32_t) params.m_txMode << "\t";
-  outFile << (uint32_t) params.m_layer << "\t";
-  outFile << (uint32_t) params.m_mcs << "\t";
-  outFile << params.m_size << "\t";
-  outFile << (uint32_t) params.m_rv << "\t";
-  outFile << (uint32_t) params.m_ndi << std::endl;
-  outFile.close ();
+//   m_slTxOutput << Simulator::Now ().GetNanoSeconds () / (double) 1e9;
+  m_slTxOutput << params.m_timestamp;
+  m_slTxOutput << (uint32_t) params.m_cellId;
+  m_slTxOutput << params.m_imsi;
+  m_slTxOutput << params.m_rnti;
+  //m_slTxOutput << (uint32_t) params.m_txMode;
+  m_slTxOutput << (uint32_t) params.m_layer;
+  m_slTxOutput << (uint32_t) params.m_mcs;
+  m_slTxOutput << params.m_size;
+  m_slTxOutput << (uint32_t) params.m_rv;
+  m_slTxOutput << (uint32_t) params.m_ndi;
+  m_slTxOutput.EndRow ();
 }
 
 void
@@ -159,28 +159,19 @@ public:
 
 private:
   /**
-   * When writing DL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the DL TX PHY statistics
    */
-  bool m_dlTxFirstWrite;
+  cv2x_StatsOutputFile m_dlTxOutput;
 
   /**
-   * When writing UL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the UL TX PHY statistics
    */
-  bool m_ulTxFirstWrite;
+  cv2x_StatsOutputFile m_ulTxOutput;
 
   /**
-   * When writing SL TX PHY statistics first time to file,
-   * columns description is added. Then next lines are
-   * appended to file. This value is true if output
-   * files have not been opened yet
+   * Output file of the SL TX PHY statistics
    */
-  bool m_slTxFirstWrite;
+  cv2x_StatsOutputFile m_slTxOutput;
 
 };
 
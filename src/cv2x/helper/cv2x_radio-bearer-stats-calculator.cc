@@ -33,7 +33,8 @@ NS_LOG_COMPONENT_DEFINE ("cv2x_RadioBearerStatsCalculator");
 NS_OBJECT_ENSURE_REGISTERED ( cv2x_RadioBearerStatsCalculator);
 
 cv2x_RadioBearerStatsCalculator::cv2x_RadioBearerStatsCalculator ()
-  : m_firstWrite (true),
+  : m_ulOutput (),
+    m_dlOutput (),
     m_pendingOutput (false), 
     m_protocolType ("RLC")
 {
@@ -41,7 +42,8 @@ cv2x_RadioBearerStatsCalculator::cv2x_RadioBearerStatsCalculator ()
 }
 
 cv2x_RadioBearerStatsCalculator::cv2x_RadioBearerStatsCalculator (std::string protocolType)
-  : m_firstWrite (true),
+  : m_ulOutput (),
+    m_dlOutput (),
     m_pendingOutput (false)
 {
   NS_LOG_FUNCTION (this);
@@ -216,59 +218,28 @@ cv2x_RadioBearerStatsCalculator::ShowResults (void)
   NS_LOG_FUNCTION (this << GetUlOutputFilename ().c_str () << GetDlOutputFilename ().c_str ());
   NS_LOG_INFO ("Write Rlc Stats in " << GetUlOutputFilename ().c_str () << " and in " << GetDlOutputFilename ().c_str ());
 
-  std::ofstream ulOutFile;
-  std::ofstream dlOutFile;
-
-  if (m_firstWrite == true)
+  std::string header = "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t"
+                       "delay\tstdDev\tmin\tmax\t"
+                       "PduSize\tstdDev\tmin\tmax";
+  if (!m_ulOutput.IsOpen ()
+      && !OpenOutputFile (m_ulOutput, GetUlOutputFilename (), header))
     {
-      ulOutFile.open (GetUlOutputFilename ().c_str ());
-      if (!ulOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-
-      dlOutFile.open (GetDlOutputFilename ().c_str ());
-      if (!dlOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
-      m_firstWrite = false;
-      ulOutFile << "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t";
-      ulOutFile << "delay\tstdDev\tmin\tmax\t";
-      ulOutFile << "PduSize\tstdDev\tmin\tmax";
-      ulOutFile << std::endl;
-      dlOutFile << "% start\tend\tCellId\tIMSI\tRNTI\tLCID\tnTxPDUs\tTxBytes\tnRxPDUs\tRxBytes\t";
-      dlOutFile << "delay\tstdDev\tmin\tmax\t";
-      dlOutFile << "PduSize\tstdDev\tmin\tmax";
-      dlOutFile << std::endl;
+      return;
     }
-  else
+  if (!m_dlOutput.IsOpen ()
+      && !OpenOutputFile (m_dlOutput, GetDlOutputFilename (), header))
     {
-      ulOutFile.open (GetUlOutputFilename ().c_str (), std::ios_base::app);
-      if (!ulOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetUlOutputFilename ().c_str ());
-          return;
-        }
-
-      dlOutFile.open (GetDlOutputFilename ().c_str (), std::ios_base::app);
-      if (!dlOutFile.is_open ())
-        {
-          NS_LOG_ERROR ("Can't open file " << GetDlOutputFilename ().c_str ());
-          return;
-        }
+      return;
     }
 
-  WriteUlResults (ulOutFile);
-  WriteDlResults (dlOutFile);
+  WriteUlResults (m_ulOutput);
+  WriteDlResults (m_dlOutput);
   m_pendingOutput = false;
 
 }
 
 void
-cv2x_RadioBearerStatsCalculator::WriteUlResults (std::ofstream& outFile)
+cv2x_RadioBearerStatsCalculator::WriteUlResults (cv2x_StatsOutputFile& outFile)
 {
   NS_LOG_FUNCTION (this);
 
@@ -302,34 +273,32 @@ cv2x_RadioBearerStatsCalculator::WriteUlResults (std::ofstream& outFile)
       cv2x_LteFlowId_t flowId = flowIdIt->second;
       NS_ASSERT_MSG (flowId.m_lcId == p.m_lcId, "lcid mismatch");
 
-      outFile << m_startTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << endTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << GetUlCellId (p.m_imsi, p.m_lcId) << "\t";
-      outFile << p.m_imsi << "\t";
-      outFile << flowId.m_rnti << "\t";
-      outFile << (uint32_t) flowId.m_lcId << "\t";
-      outFile << GetUlTxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlTxData (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlRxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetUlRxData (p.m_imsi, p.m_lcId) << "\t";
+      outFile << m_startTime.GetNanoSeconds () / 1.0e9;
+      outFile << endTime.GetNanoSeconds () / 1.0e9;
+      outFile << GetUlCellId (p.m_imsi, p.m_lcId);
+      outFile << p.m_imsi;
+      outFile << flowId.m_rnti;
+      outFile << (uint32_t) flowId.m_lcId;
+      outFile << GetUlTxPackets (p.m_imsi, p.m_lcId);
+      outFile << GetUlTxData (p.m_imsi, p.m_lcId);
+      outFile << GetUlRxPackets (p.m_imsi, p.m_lcId);
+      outFile << GetUlRxData (p.m_imsi, p.m_lcId);
       std::vector<double> stats = GetUlDelayStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) * 1e-9 << "\t";
+          outFile << (*it) * 1e-9;
         }
       stats = GetUlPduSizeStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) << "\t";
+          outFile << (*it);
         }
-      outFile << std::endl;
+      outFile.EndRow ();
     }
-
-  outFile.close ();
 }
 
 void
-cv2x_RadioBearerStatsCalculator::WriteDlResults (std::ofstream& outFile)
+cv2x_RadioBearerStatsCalculator::WriteDlResults (cv2x_StatsOutputFile& outFile)
 {
   NS_LOG_FUNCTION (this);
 
@@ -363,30 +332,28 @@ cv2x_RadioBearerStatsCalculator::WriteDlResults (std::ofstream& outFile)
       cv2x_LteFlowId_t flowId = flowIdIt->second;
       NS_ASSERT_MSG (flowId.m_lcId == p.m_lcId, "lcid mismatch");
 
-      outFile << m_startTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << endTime.GetNanoSeconds () / 1.0e9 << "\t";
-      outFile << GetDlCellId (p.m_imsi, p.m_lcId) << "\t";
-      outFile << p.m_imsi << "\t";
-      outFile << flowId.m_rnti << "\t";
-      outFile << (uint32_t) flowId.m_lcId << "\t";
-      outFile << GetDlTxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlTxData (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlRxPackets (p.m_imsi, p.m_lcId) << "\t";
-      outFile << GetDlRxData (p.m_imsi, p.m_lcId) << "\t";
+      outFile << m_startTime.GetNanoSeconds () / 1.0e9;
+      outFile << endTime.GetNanoSeconds () / 1.0e9;
+      outFile << GetDlCellId (p.m_imsi, p.m_lcId);
+      outFile << p.m_imsi;
+      outFile << flowId.m_rnti;
+      outFile << (uint32_t) flowId.m_lcId;
+      outFile << GetDlTxPackets (p.m_imsi, p.m_lcId);
+      outFile << GetDlTxData (p.m_imsi, p.m_lcId);
+      outFile << GetDlRxPackets (p.m_imsi, p.m_lcId);
+      outFile << GetDlRxData (p.m_imsi, p.m_lcId);
       std::vector<double> stats = GetDlDelayStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) * 1e-9 << "\t";
+          outFile << (*it) * 1e-9;
         }
       stats = GetDlPduSizeStats (p.m_imsi, p.m_lcId);
       for (std::vector<double>::iterator it = stats.begin (); it != stats.end (); ++it)
         {
-          outFile << (*it) << "\t";
+          outFile << (*it);
         }
-      outFile << std::endl;
+      outFile.EndRow ();
     }
-
-  outFile.close ();
 }
 
 void
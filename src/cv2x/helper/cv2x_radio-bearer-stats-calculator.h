@@ -359,20 +359,18 @@ private:
   ShowResults (void);
 
   /**
-   * Writes collected statistics to UL output file and
-   * closes UL output file.
-   * @param outFile ofstream for UL statistics
+   * Writes collected statistics to UL output file.
+   * @param outFile UL output file
    */
   void
-  WriteUlResults (std::ofstream& outFile);
+  WriteUlResults (cv2x_StatsOutputFile& outFile);
 
   /**
-   * Writes collected statistics to DL output file and
-   * closes DL output file.
-   * @param outFile ofstream for DL statistics
+   * Writes collected statistics to DL output file.
+   * @param outFile DL output file
    */
   void
-  WriteDlResults (std::ofstream& outFile);
+  WriteDlResults (cv2x_StatsOutputFile& outFile);
 
   /**
    * Erases collected statistics
@@ -424,9 +422,14 @@ private:
   Time m_epochDuration;
 
   /**
-   * true if output files have not been opened yet
+   * UL output file
    */
-  bool m_firstWrite;
+  cv2x_StatsOutputFile m_ulOutput;
+
+  /**
+   * DL output file
+   */
+  cv2x_StatsOutputFile m_dlOutput;
 
   /**
    * true if any output is pending
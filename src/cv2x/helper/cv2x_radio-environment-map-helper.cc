@@ -336,7 +336,7 @@ cv2x_RadioEnvironmentMapHelper::PrintAndReset ()
                 << pos.y << "\t" 
                 << pos.z << "\t" 
                 << it->phy->GetSinr (m_noisePower)
-                << std::endl;
+                << '\n';
       it->phy->Reset ();
     }
 }
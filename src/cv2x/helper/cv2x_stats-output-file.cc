@@ -0,0 +1,140 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "cv2x_stats-output-file.h"
+#include <ns3/simulator.h>
+#include <ns3/log.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_StatsOutputFile");
+
+cv2x_StatsOutputFile::cv2x_StatsOutputFile ()
+  : m_binary (false),
+    m_opened (false),
+    m_rowStarted (false),
+    m_firstRow (true)
+{
+}
+
+cv2x_StatsOutputFile::~cv2x_StatsOutputFile ()
+{
+  Close ();
+}
+
+bool
+cv2x_StatsOutputFile::Open (const std::string &fileName, const std::string &header, bool binary, uint32_t bufferSize)
+{
+  NS_LOG_FUNCTION (this << fileName << binary << bufferSize);
+  NS_ASSERT (!m_file.is_open ());
+
+  // the buffer must be set before opening the file
+  m_buffer.resize (bufferSize);
+  if (bufferSize > 0)
+    {
+      m_file.rdbuf ()->pubsetbuf (m_buffer.data (), m_buffer.size ());
+    }
+
+  std::ios_base::openmode mode = std::ios_base::out;
+  if (binary)
+    {
+      mode |= std::ios_base::binary;
+    }
+  mode |= m_opened ? std::ios_base::app : std::ios_base::trunc;
+  m_file.open (fileName.c_str (), mode);
+  if (!m_file.is_open ())
+    {
+      NS_LOG_ERROR ("Can't open file " << fileName.c_str ());
+      return false;
+    }
+
+  if (!m_opened)
+    {
+      m_header = header;
+      m_binary = binary;
+      m_file << m_header << '\n';
+    }
+  m_opened = true;
+  m_rowStarted = false;
+  m_closeEvent = Simulator::ScheduleDestroy (&cv2x_StatsOutputFile::Close, this);
+  return true;
+}
+
+bool
+cv2x_StatsOutputFile::IsOpen (void) const
+{
+  return m_file.is_open ();
+}
+
+void
+cv2x_StatsOutputFile::Put (const char *data, std::size_t size)
+{
+  if (m_firstRow)
+    {
+      m_pendingRow.append (data, size);
+    }
+  else
+    {
+      m_file.write (data, size);
+    }
+}
+
+void
+cv2x_StatsOutputFile::AddFieldType (const std::string &type)
+{
+  m_fieldTypes += "\t" + type;
+}
+
+void
+cv2x_StatsOutputFile::EndRow (void)
+{
+  if (!m_binary)
+    {
+      m_file << '\n';
+    }
+  else if (m_firstRow)
+    {
+      m_file << "% types" << m_fieldTypes << '\n';
+      m_file.write (m_pendingRow.data (), m_pendingRow.size ());
+      m_pendingRow.clear ();
+      m_firstRow = false;
+    }
+  m_rowStarted = false;
+}
+
+void
+cv2x_StatsOutputFile::Flush (void)
+{
+  if (m_file.is_open ())
+    {
+      m_file.flush ();
+    }
+}
+
+void
+cv2x_StatsOutputFile::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_file.is_open ())
+    {
+      m_file.close ();
+    }
+  // the file may be closed before the simulation is destroyed
+  Simulator::Cancel (m_closeEvent);
+  m_closeEvent = EventId ();
+}
+
+} // namespace ns3
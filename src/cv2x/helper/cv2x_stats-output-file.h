@@ -0,0 +1,196 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef CV2X_STATS_OUTPUT_FILE_H_
+#define CV2X_STATS_OUTPUT_FILE_H_
+
+#include <ns3/event-id.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup lte
+ *
+ * Output file of a statistics calculator. The file is kept open and
+ * written through a large buffer, and it is closed (hence flushed) when
+ * the simulation is destroyed.
+ *
+ * The rows are written field by field, and terminated with EndRow ().
+ * In text mode, the fields are separated by tabs and the rows by new
+ * lines, after the header line. In both modes the header line is
+ * written when the file is opened. In binary mode, it is followed by a
+ * line with the type of each field of the first row ("% types" and then
+ * u8..u64, i8..i64, f32, f64 or s, separated by tabs), written together
+ * with the first row, and then by the rows, with the numeric fields in
+ * native byte order and the other fields as strings (uint32_t length and
+ * then the characters of their text representation).
+ *
+ * If the file is opened again after having been closed, e.g., in a new
+ * simulation, the rows are appended to it.
+ */
+class cv2x_StatsOutputFile
+{
+public:
+  cv2x_StatsOutputFile ();
+  ~cv2x_StatsOutputFile ();
+
+  /**
+   * Open the file and write the header
+   *
+   * \param fileName the name of the file
+   * \param header the header line (without new line)
+   * \param binary true to write the rows in binary format
+   * \param bufferSize the size of the write buffer in bytes
+   * \return true if the file was opened
+   */
+  bool Open (const std::string &fileName, const std::string &header, bool binary, uint32_t bufferSize);
+
+  /**
+   * \return true if the file is open
+   */
+  bool IsOpen (void) const;
+
+  /**
+   * Write a field of the current row
+   *
+   * \param value the value of the field
+   * \return this file
+   */
+  template <class T>
+  cv2x_StatsOutputFile &operator<< (const T &value);
+
+  /**
+   * End the current row
+   */
+  void EndRow (void);
+
+  /**
+   * Write the buffered rows to the file
+   */
+  void Flush (void);
+
+  /**
+   * Flush and close the file
+   */
+  void Close (void);
+
+private:
+  /**
+   * Write raw bytes to the file, or to the first row if it is not
+   * complete yet in binary mode
+   *
+   * \param data the bytes
+   * \param size the number of bytes
+   */
+  void Put (const char *data, std::size_t size);
+
+  /**
+   * Write a numeric field in binary format
+   *
+   * \param value the value of the field
+   */
+  template <class T>
+  void WriteBinary (const T &value, std::true_type);
+
+  /**
+   * Write a non-numeric field in binary format, as a string
+   *
+   * \param value the value of the field
+   */
+  template <class T>
+  void WriteBinary (const T &value, std::false_type);
+
+  /**
+   * Add the type of a field of the first row
+   *
+   * \param type the type of the field
+   */
+  void AddFieldType (const std::string &type);
+
+  std::ofstream m_file; ///< the output file
+  std::vector<char> m_buffer; ///< the write buffer of the file
+  std::string m_header; ///< the header line
+  bool m_binary; ///< binary format
+  bool m_opened; ///< the file has already been opened once
+  bool m_rowStarted; ///< a field of the current row has been written
+  bool m_firstRow; ///< the first row has not been completed yet
+  std::string m_fieldTypes; ///< the field types of the first row, in binary format
+  std::string m_pendingRow; ///< the first row, in binary format
+  EventId m_closeEvent; ///< the event closing the file when the simulation is destroyed
+};
+
+template <class T>
+cv2x_StatsOutputFile &
+cv2x_StatsOutputFile::operator<< (const T &value)
+{
+  if (m_binary)
+    {
+      WriteBinary (value, std::is_arithmetic<T> ());
+    }
+  else
+    {
+      if (m_rowStarted)
+        {
+          m_file << '\t';
+        }
+      m_file << value;
+    }
+  m_rowStarted = true;
+  return *this;
+}
+
+template <class T>
+void
+cv2x_StatsOutputFile::WriteBinary (const T &value, std::true_type)
+{
+  if (m_firstRow)
+    {
+      if (std::is_floating_point<T>::value)
+        {
+          AddFieldType ("f" + std::to_string (8 * sizeof (T)));
+        }
+      else
+        {
+          AddFieldType ((std::is_signed<T>::value ? "i" : "u") + std::to_string (8 * sizeof (T)));
+        }
+    }
+  Put (reinterpret_cast<const char *> (&value), sizeof (T));
+}
+
+template <class T>
+void
+cv2x_StatsOutputFile::WriteBinary (const T &value, std::false_type)
+{
+  if (m_firstRow)
+    {
+      AddFieldType ("s");
+    }
+  std::ostringstream oss;
+  oss << value;
+  std::string str = oss.str ();
+  uint32_t length = str.size ();
+  Put (reinterpret_cast<const char *> (&length), sizeof (length));
+  Put (str.data (), length);
+}
+
+} // namespace ns3
+
+#endif /* CV2X_STATS_OUTPUT_FILE_H_ */
@@ -22,6 +22,8 @@
 #include "ns3/log.h"
 #include "ns3/double.h"
 #include "ns3/enum.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
 #include "ns3/mobility-model.h"
 #include <cmath>
 #include "cv2x_cni-urbanmicrocell-propagation-loss-model.h"
@@ -44,6 +46,24 @@ cv2x_CniUrbanmicrocellPropagationLossModel::GetTypeId (void)
                     DoubleValue (5900e6),
                     MakeDoubleAccessor (&cv2x_CniUrbanmicrocellPropagationLossModel::m_frequency),
                     MakeDoubleChecker<double> ())
+    .AddAttribute ("CacheEnabled",
+                    "Whether the deterministic part of the loss is cached for each pair of nodes (the cache holds one "
+                    "entry per ordered pair of nodes which exchanged a packet, and it is never shrunk)",
+                    BooleanValue (false),
+                    MakeBooleanAccessor (&cv2x_CniUrbanmicrocellPropagationLossModel::m_cacheEnabled),
+                    MakeBooleanChecker ())
+    .AddAttribute ("CacheDistanceThreshold",
+                    "Movement in meters of any of the two nodes above which the cached loss of a pair is recomputed "
+                    "(with 0, the loss is recomputed whenever the position of one of the two nodes changes)",
+                    DoubleValue (0.0),
+                    MakeDoubleAccessor (&cv2x_CniUrbanmicrocellPropagationLossModel::m_cacheDistanceThreshold),
+                    MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("CoherenceTime",
+                    "Time after which the random number selecting LOS or NLOS for a pair of nodes is drawn again "
+                    "(with 0, it is kept for the whole simulation)",
+                    TimeValue (Seconds (0)),
+                    MakeTimeAccessor (&cv2x_CniUrbanmicrocellPropagationLossModel::m_coherenceTime),
+                    MakeTimeChecker ())
     ;
 
   return tid;
@@ -57,7 +77,11 @@ cv2x_CniUrbanmicrocellPropagationLossModel::SetFrequency (double freq)
 
 
 cv2x_CniUrbanmicrocellPropagationLossModel::cv2x_CniUrbanmicrocellPropagationLossModel ()
-  : PropagationLossModel ()
+  : PropagationLossModel (),
+    m_isLosEnabled (false),
+    m_cacheEpoch (0),
+    m_cacheHits (0),
+    m_cacheMisses (0)
 { 
   m_rand = CreateObject<UniformRandomVariable> ();
 }
@@ -66,19 +90,43 @@ cv2x_CniUrbanmicrocellPropagationLossModel::~cv2x_CniUrbanmicrocellPropagationLo
 {
 }
 
-double
-cv2x_CniUrbanmicrocellPropagationLossModel::GetLoss (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+void
+cv2x_CniUrbanmicrocellPropagationLossModel::DoDispose (void)
+{
+  m_lossCache.clear ();
+  m_randomMap.clear ();
+  PropagationLossModel::DoDispose ();
+}
+
+void
+cv2x_CniUrbanmicrocellPropagationLossModel::InvalidateCache (void)
+{
+  m_cacheEpoch++;
+}
+
+uint64_t
+cv2x_CniUrbanmicrocellPropagationLossModel::GetCacheHits (void) const
+{
+  return m_cacheHits;
+}
+
+uint64_t
+cv2x_CniUrbanmicrocellPropagationLossModel::GetCacheMisses (void) const
+{
+  return m_cacheMisses;
+}
+
+void
+cv2x_CniUrbanmicrocellPropagationLossModel::ComputeLoss (const Vector &posA, const Vector &posB, PairLoss &pl) const
 {
-  // Pathloss
-  double loss = 0.0;
   // Frequency in GHz
   double fc = m_frequency / 1e9;
   // Distance between the two nodes in meter
-  double dist = a->GetDistanceFrom (b);
+  double dist = CalculateDistance (posA, posB);
 
   // Actual antenna heights (1.5m for UEs)
-  double hms = a->GetPosition().z;
-  double hbs = b->GetPosition().z;
+  double hms = posA.z;
+  double hbs = posB.z;
 
   // Effective antenna heights
   double hbs1 = hbs - 1;
@@ -94,68 +142,130 @@ cv2x_CniUrbanmicrocellPropagationLossModel::GetLoss (Ptr<MobilityModel> a, Ptr<M
 
   // Calculate the LOS probability based on 3GPP specifications 
   // https://www.cept.org/files/8339/winner2%20-%20final%20report.pdf Table 4-7
-  double plos = std::min ((18 / dist), 1.0) * (1 - std::exp (-dist / 36)) + std::exp (-dist / 36);
+  pl.plos = std::min ((18 / dist), 1.0) * (1 - std::exp (-dist / 36)) + std::exp (-dist / 36);
 
   // Freespace pathloss
-  double loss_free  = 20*std::log10 (dist) + 46.4 + 20*std::log10(fc/5.0); 
-  NS_LOG_INFO (this << "Outdoor , the free space loss = " << loss_free);
+  pl.freeLoss = 20*std::log10 (dist) + 46.4 + 20*std::log10(fc/5.0); 
+  NS_LOG_INFO (this << "Outdoor , the free space loss = " << pl.freeLoss);
+
+  // Compute the pathloss based on 3GPP specifications
+  // This model is only valid to a minimum distance of 3 meters 
+  pl.losLoss = 0.0;
+  pl.nlosLoss = 0.0;
+  if (dist >= 3)
+  {
+    // LOS
+    if (dist <= d_bp)
+    {
+      pl.losLoss = 22.7 * std::log10 (dist) + 27.0 + 20.0 * std::log10 (fc);
+      NS_LOG_INFO (this << "Urban microcell LOS (Distance <= " << d_bp << ") : the pathloss = " << pl.losLoss);
+    }
+    else
+    {
+      pl.losLoss = 40.0 * std::log10 (dist) + 7.56 - 17.3 * std::log10 (hbs1) - 17.3 * std::log10 (hms1) + 2.7 * std::log10 (fc);
+      NS_LOG_INFO (this << "Urban microcell LOS (Distance > " << d_bp << ") : the pathloss = " << pl.losLoss);
+    }
 
+    // NLOS
+    pl.nlosLoss = (44.9 - 6.55 * std::log10 (hbs)) * std::log10 (dist) + 5.83 * std::log10 (hbs) + 18.38 + 23 * std::log10 (fc) + nlos;
+    NS_LOG_INFO (this << "Urban microcell NLOS, the pathloss = " << pl.nlosLoss);
+  }
+
+  pl.posA = posA;
+  pl.posB = posB;
+  pl.epoch = m_cacheEpoch;
+}
+
+cv2x_CniUrbanmicrocellPropagationLossModel::PairDraw *
+cv2x_CniUrbanmicrocellPropagationLossModel::GetDraw (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
   // Generate a random number between 0 and 1 (if it doesn't already exist) to evaluate the LOS/NLOS situation
-  double r = 0.0;
-   
   MobilityDuo couple;
   couple.a = a;
   couple.b = b;
-  std::map<MobilityDuo, double>::iterator it_a = m_randomMap.find (couple);
+  auto it_a = m_randomMap.find (couple);
   if (it_a != m_randomMap.end ())
   {
-    r = it_a->second;
+    return &it_a->second;
   }
-  else
+
+  couple.a = b;
+  couple.b = a;
+  auto it_b = m_randomMap.find (couple);
+  if (it_b != m_randomMap.end ())
   {
-    couple.a = b;
-    couple.b = a;
-    std::map<MobilityDuo, double>::iterator it_b = m_randomMap.find (couple);
-    if (it_b != m_randomMap.end ())
-    {
-      r = it_b->second;
-    }
-    else
-    {
-      m_randomMap[couple] = m_rand->GetValue (0,1);
-      r = m_randomMap[couple];
-    }
+    return &it_b->second;
   }
 
-  // Compute the pathloss based on 3GPP specifications
-  // This model is only valid to a minimum distance of 3 meters 
-  if (dist >= 3)
+  PairDraw &draw = m_randomMap[couple];
+  draw.value = m_rand->GetValue (0,1);
+  draw.drawTime = Simulator::Now ();
+  return &draw;
+}
+
+double
+cv2x_CniUrbanmicrocellPropagationLossModel::GetDrawValue (PairDraw *draw) const
+{
+  if (m_coherenceTime.IsStrictlyPositive () && Simulator::Now () - draw->drawTime >= m_coherenceTime)
   {
-    if ((r <= plos) or (m_isLosEnabled)) 
-    { 
-      // LOS
-      if (dist <= d_bp)
-      {
-        loss = 22.7 * std::log10 (dist) + 27.0 + 20.0 * std::log10 (fc);
-        NS_LOG_INFO (this << "Urban microcell LOS (Distance <= " << d_bp << ") : the pathloss = " << loss);
-      }
-      else
-      {
-        loss = 40.0 * std::log10 (dist) + 7.56 - 17.3 * std::log10 (hbs1) - 17.3 * std::log10 (hms1) + 2.7 * std::log10 (fc);
-        NS_LOG_INFO (this << "Urban microcell LOS (Distance > " << d_bp << ") : the pathloss = " << loss);
-      }
-    }
-    else 
-    { 
-      // NLOS
-      loss = (44.9 - 6.55 * std::log10 (hbs)) * std::log10 (dist) + 5.83 * std::log10 (hbs) + 18.38 + 23 * std::log10 (fc) + nlos;
-      NS_LOG_INFO (this << "Urban microcell NLOS, the pathloss = " << loss);
-    }  
+    draw->value = m_rand->GetValue (0,1);
+    draw->drawTime = Simulator::Now ();
   }
-  loss = std::max (loss_free, loss);  
+  return draw->value;
+}
+
+double
+cv2x_CniUrbanmicrocellPropagationLossModel::CombineLoss (const PairLoss &pl, double r) const
+{
+  double loss = ((r <= pl.plos) or (m_isLosEnabled)) ? pl.losLoss : pl.nlosLoss;
+  loss = std::max (pl.freeLoss, loss);  
   return std::max (0.0, loss);
 }
 
+double
+cv2x_CniUrbanmicrocellPropagationLossModel::GetLoss (Ptr<MobilityModel> a, Ptr<MobilityModel> b) const
+{
+  Vector posA = a->GetPosition ();
+  Vector posB = b->GetPosition ();
+
+  if (!m_cacheEnabled)
+  {
+    PairLoss pl;
+    ComputeLoss (posA, posB, pl);
+    m_cacheMisses++;
+    return CombineLoss (pl, GetDrawValue (GetDraw (a, b)));
+  }
+
+  MobilityDuo couple;
+  couple.a = a;
+  couple.b = b;
+  auto it = m_lossCache.find (couple);
+  if (it == m_lossCache.end ())
+  {
+    PairLoss &pl = m_lossCache[couple];
+    ComputeLoss (posA, posB, pl);
+    pl.draw = GetDraw (a, b);
+    m_cacheMisses++;
+    return CombineLoss (pl, GetDrawValue (pl.draw));
+  }
+
+  // The loss is recomputed only if one of the two nodes has moved by more than the threshold
+  PairLoss &pl = it->second;
+  double threshold2 = m_cacheDistanceThreshold * m_cacheDistanceThreshold;
+  if (pl.epoch != m_cacheEpoch
+      || CalculateDistanceSquared (posA, pl.posA) > threshold2
+      || CalculateDistanceSquared (posB, pl.posB) > threshold2)
+  {
+    ComputeLoss (posA, posB, pl);
+    m_cacheMisses++;
+  }
+  else
+  {
+    m_cacheHits++;
+  }
+  return CombineLoss (pl, GetDrawValue (pl.draw));
+}
+
 double 
 cv2x_CniUrbanmicrocellPropagationLossModel::DoCalcRxPower (double txPowerDbm,
                                                       Ptr<MobilityModel> a,
@@ -167,7 +277,8 @@ cv2x_CniUrbanmicrocellPropagationLossModel::DoCalcRxPower (double txPowerDbm,
 int64_t
 cv2x_CniUrbanmicrocellPropagationLossModel::DoAssignStreams (int64_t stream)
 {
-  return 0;
+  m_rand->SetStream (stream);
+  return 1;
 }
 
 } // namespace ns3
@@ -31,6 +31,8 @@
 
 #include <list>
 #include <vector>
+#include <unordered_map>
+#include <algorithm>
 #include <ns3/log.h>
 #include <ns3/pointer.h>
 #include <stdint.h>
@@ -38,6 +40,11 @@
 #include "stdlib.h"
 #include <ns3/cv2x_lte-mi-error-model.h>
 
+#if (defined (__x86_64__) || defined (__i386__)) && (defined (__GNUC__) || defined (__clang__))
+#define CV2X_MI_X86 1
+#include <immintrin.h>
+#endif
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("cv2x_LteMiErrorModel");
@@ -331,86 +338,324 @@ static const double cEcrTable [9][38] = {
 };
 
 
-double 
-cv2x_LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs)
+/// SINR to MI table of a modulation, sampled on a uniform SINR grid
+typedef struct _miTable {
+  const double *mi;   ///< MI of the grid points
+  uint16_t size;      ///< number of grid points
+  double axis0;       ///< SINR of the first grid point
+  double axisMax;     ///< SINR of the last grid point
+  double scale;       ///< grid points per unit of SINR
+} miTable_t;
+
+static const miTable_t g_miTableQpsk = {MI_map_qpsk, MI_MAP_QPSK_SIZE, MI_map_qpsk_axis[0], MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1],
+                                        (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0])};
+static const miTable_t g_miTable16qam = {MI_map_16qam, MI_MAP_16QAM_SIZE, MI_map_16qam_axis[0], MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1],
+                                         (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0])};
+static const miTable_t g_miTable64qam = {MI_map_64qam, MI_MAP_64QAM_SIZE, MI_map_64qam_axis[0], MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1],
+                                         (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0])};
+
+static const miTable_t &
+GetMiTable (uint8_t mcs)
 {
-  NS_LOG_FUNCTION (sinr << &map << (uint32_t) mcs);
-  
-  double MI;
-  double MIsum = 0.0;
-  SpectrumValue sinrCopy = sinr;
-  
-  for (uint32_t i = 0; i < map.size (); i++)
+  if (mcs <= MI_QPSK_MAX_ID)
+    {
+      return g_miTableQpsk;
+    }
+  if (mcs <= MI_16QAM_MAX_ID)
+    {
+      return g_miTable16qam;
+    }
+  return g_miTable64qam;
+}
+
+/// Compute the MI of n sinrs
+typedef void (*MiKernel) (const miTable_t &table, const double *sinr, double *mi, size_t n);
+
+// The index of the original model, i.e., floor ((sinr - axis0) * scale + 1); the
+// sinrs above the last grid point have MI 1
+static void
+MiStepScalar (const miTable_t &table, const double *sinr, double *mi, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      if (sinr[i] > table.axisMax)
+        {
+          mi[i] = 1;
+        }
+      else
+        {
+          double sinrIndexDouble = (sinr[i] - table.axis0) * table.scale + 1;
+          double sinrIndex = std::min (std::max (0.0, std::floor (sinrIndexDouble)), table.size - 1.0);
+          mi[i] = table.mi[static_cast<uint32_t> (sinrIndex)];
+        }
+    }
+}
+
+static void
+MiInterpolatedScalar (const miTable_t &table, const double *sinr, double *mi, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
     {
-      double sinrLin = sinrCopy[map.at (i)];
-      if (mcs <= MI_QPSK_MAX_ID) // QPSK
+      if (sinr[i] > table.axisMax)
         {
+          mi[i] = 1;
+        }
+      else
+        {
+          double pos = std::min (std::max (0.0, (sinr[i] - table.axis0) * table.scale), table.size - 1.0);
+          double index = std::min (std::floor (pos), table.size - 2.0);
+          uint32_t j = static_cast<uint32_t> (index);
+          mi[i] = table.mi[j] + (pos - index) * (table.mi[j + 1] - table.mi[j]);
+        }
+    }
+}
 
-          if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1])
+#ifdef CV2X_MI_X86
+
+// Same operations as the scalar kernels, on 4 RBs at each iteration
+__attribute__ ((target ("avx2"))) static void
+MiStepAvx2 (const miTable_t &table, const double *sinr, double *mi, size_t n)
+{
+  const __m256d axis0 = _mm256_set1_pd (table.axis0);
+  const __m256d axisMax = _mm256_set1_pd (table.axisMax);
+  const __m256d scale = _mm256_set1_pd (table.scale);
+  const __m256d one = _mm256_set1_pd (1.0);
+  const __m256d zero = _mm256_setzero_pd ();
+  const __m256d last = _mm256_set1_pd (table.size - 1.0);
+  const __m256d all = _mm256_cmp_pd (zero, zero, _CMP_EQ_OQ);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d s = _mm256_loadu_pd (sinr + i);
+      __m256d index = _mm256_add_pd (_mm256_mul_pd (_mm256_sub_pd (s, axis0), scale), one);
+      index = _mm256_min_pd (_mm256_max_pd (_mm256_floor_pd (index), zero), last);
+      __m256d v = _mm256_mask_i32gather_pd (zero, table.mi, _mm256_cvttpd_epi32 (index), all, 8);
+      _mm256_storeu_pd (mi + i, _mm256_blendv_pd (v, one, _mm256_cmp_pd (s, axisMax, _CMP_GT_OQ)));
+    }
+  MiStepScalar (table, sinr + i, mi + i, n - i);
+}
+
+__attribute__ ((target ("avx2"))) static void
+MiInterpolatedAvx2 (const miTable_t &table, const double *sinr, double *mi, size_t n)
+{
+  const __m256d axis0 = _mm256_set1_pd (table.axis0);
+  const __m256d axisMax = _mm256_set1_pd (table.axisMax);
+  const __m256d scale = _mm256_set1_pd (table.scale);
+  const __m256d one = _mm256_set1_pd (1.0);
+  const __m256d zero = _mm256_setzero_pd ();
+  const __m256d last = _mm256_set1_pd (table.size - 1.0);
+  const __m256d beforeLast = _mm256_set1_pd (table.size - 2.0);
+  const __m256d all = _mm256_cmp_pd (zero, zero, _CMP_EQ_OQ);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    {
+      __m256d s = _mm256_loadu_pd (sinr + i);
+      __m256d pos = _mm256_mul_pd (_mm256_sub_pd (s, axis0), scale);
+      pos = _mm256_min_pd (_mm256_max_pd (pos, zero), last);
+      __m256d index = _mm256_min_pd (_mm256_floor_pd (pos), beforeLast);
+      __m128i j = _mm256_cvttpd_epi32 (index);
+      __m256d lo = _mm256_mask_i32gather_pd (zero, table.mi, j, all, 8);
+      __m256d hi = _mm256_mask_i32gather_pd (zero, table.mi + 1, j, all, 8);
+      __m256d v = _mm256_add_pd (lo, _mm256_mul_pd (_mm256_sub_pd (pos, index), _mm256_sub_pd (hi, lo)));
+      _mm256_storeu_pd (mi + i, _mm256_blendv_pd (v, one, _mm256_cmp_pd (s, axisMax, _CMP_GT_OQ)));
+    }
+  MiInterpolatedScalar (table, sinr + i, mi + i, n - i);
+}
+#endif
+
+static bool g_miInterpolation = false;
+
+static bool
+HasAvx2 (void)
+{
+  static const bool avx2 = [] () {
+#ifdef CV2X_MI_X86
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ("avx2") != 0;
+#else
+    return false;
+#endif
+  } ();
+  return avx2;
+}
+
+// Whether the AVX2 kernels are in use: by default, when the CPU supports them
+static bool g_miAvx2 = HasAvx2 ();
+
+static MiKernel
+GetMiKernel (void)
+{
+#ifdef CV2X_MI_X86
+  if (g_miAvx2)
+    {
+      return g_miInterpolation ? MiInterpolatedAvx2 : MiStepAvx2;
+    }
+#endif
+  return g_miInterpolation ? MiInterpolatedScalar : MiStepScalar;
+}
+
+// Average MI of n sinrs. The MIs are summed in order, so that the result does
+// not depend on the kernel in use
+static double
+MeanMi (const miTable_t &table, const double *sinr, size_t n)
+{
+  static thread_local std::vector<double> mi;
+  mi.resize (n);
+  GetMiKernel () (table, sinr, mi.data (), n);
+  double miSum = 0.0;
+  for (size_t i = 0; i < n; i++)
+    {
+      miSum += mi[i];
+    }
+  return miSum / n;
+}
+
+/// Code block segmentation of a TB (sec 5.1.2 of TS 36.212)
+typedef struct _cbSegmentation {
+  uint32_t B;       ///< TB size in bits
+  uint32_t B1;      ///< TB size including the CB CRCs
+  uint32_t C;       ///< no. of codeblocks
+  uint32_t Cplus;   ///< no. of codeblocks with size K+
+  uint32_t Kplus;   ///< size K+
+  uint32_t Cminus;  ///< no. of codeblocks with size K-
+  uint32_t Kminus;  ///< size K-
+} cbSegmentation_t;
+
+static cbSegmentation_t
+ComputeCbSegmentation (uint16_t size)
+{
+  cbSegmentation_t seg;
+  // estimate CB size (according to sec 5.1.2 of TS 36.212)
+  uint16_t Z = 6144; // max size of a codeblock (including CRC)
+  uint32_t B = size * 8;
+//   B = 1234;
+  uint32_t C = 0; // no. of codeblocks
+  uint32_t Cplus = 0; // no. of codeblocks with size K+
+  uint32_t Kplus = 0; // no. of codeblocks with size K+
+  uint32_t Cminus = 0; // no. of codeblocks with size K+
+  uint32_t Kminus = 0; // no. of codeblocks with size K+
+  uint32_t B1 = 0;
+  uint32_t deltaK = 0;
+  if (B <= Z)
+    {
+      // only one codeblock
+      //L = 0;
+      C = 1;
+      B1 = B;
+    }
+  else
+    {
+      uint32_t L = 24;
+      C = ceil ((double)B / ((double)(Z-L)));
+      B1 = B + C * L;
+    }
+  // first segmentation: K+ = minimum K in table such that C * K >= B1
+//   uint i = 0;
+//   while (B1 > cbSizeTable[i] * C)
+//     {
+// //       NS_LOG_INFO (" K+ " << cbSizeTable[i] << " means " << cbSizeTable[i] * C);
+//       i++;
+//     }
+//   uint16_t KplusId = i;
+//   Kplus = cbSizeTable[i];
+
+  // implement a modified binary search
+  int min = 0;
+  int max = 187;
+  int mid = 0;
+  do
+    {
+      mid = (min+max) / 2;
+      if (B1 > cbSizeTable[mid]*C)
+        {
+          if (B1 < cbSizeTable[mid+1]*C)
             {
-              MI = 1;
+              break;
             }
-          else 
-            { 
-              // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-              // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-              // the scaling coefficient is always the same, so we use a static const
-              // to speed up the calculation
-              static const double scalingCoeffQpsk = 
-                (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
-              double sinrIndexDouble = (sinrLin -  MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-              uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-              NS_ASSERT_MSG (sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-              MI = MI_map_qpsk[sinrIndex];
+          else
+            {
+              min = mid + 1;
             }
         }
       else
         {
-          if (mcs > MI_QPSK_MAX_ID && mcs <= MI_16QAM_MAX_ID )	// 16-QAM
+          if (B1 > cbSizeTable[mid-1]*C)
             {
-              if (sinrLin > MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1])
-                {
-                  MI = 1;
-                }
-              else 
-                {
-                  // since the values in MI_map_16QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff16qam = 
-                    (MI_MAP_16QAM_SIZE - 1) / (MI_map_16qam_axis[MI_MAP_16QAM_SIZE-1] - MI_map_16qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_16qam_axis[0]) * scalingCoeff16qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_16QAM_SIZE, "MI map out of data");
-                  MI = MI_map_16qam[sinrIndex];
-                }
+              break;
             }
-          else // 64-QAM
+          else
             {
-              if (sinrLin > MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1])
-                {
-                  MI = 1;
-                }
-              else
-                {
-                  // since the values in MI_map_64QAM_axis are uniformly spaced, we have
-                  // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-                  // the scaling coefficient is always the same, so we use a static const
-                  // to speed up the calculation
-                  static const double scalingCoeff64qam = 
-                    (MI_MAP_64QAM_SIZE - 1) / (MI_map_64qam_axis[MI_MAP_64QAM_SIZE-1] - MI_map_64qam_axis[0]);
-                  double sinrIndexDouble = (sinrLin -  MI_map_64qam_axis[0]) * scalingCoeff64qam + 1;
-                  uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-                  NS_ASSERT_MSG (sinrIndex < MI_MAP_64QAM_SIZE, "MI map out of data");
-                  MI = MI_map_64qam[sinrIndex];
-                }
+              max = mid - 1;
             }
         }
-      NS_LOG_LOGIC (" RB " << map.at (i) << "Minimum SNR = " << 10 * std::log10 (sinrLin) << " dB, " << sinrLin << " V, MCS = " << (uint16_t)mcs << ", MI = " << MI);
-      MIsum += MI;
+  } while ((cbSizeTable[mid]*C != B1) && (min < max));
+  // adjust binary search to the largest integer value of K containing B1
+  if (B1 > cbSizeTable[mid]*C)
+    {
+      mid ++;
+    }
+
+  uint16_t KplusId = mid;
+  Kplus = cbSizeTable[mid];
+
+
+  if (C==1)
+    {
+      Cplus = 1;
+      Cminus = 0;
+      Kminus = 0;
+    }
+  else
+    {
+      // second segmentation size: K- = maximum K in table such that K < K+
+      // -fstrict-overflow sensitive, see bug 1868
+      Kminus = cbSizeTable[ KplusId > 1 ? KplusId - 1 : 0];
+      deltaK = Kplus - Kminus;
+      Cminus = floor ((((double) C * Kplus) - (double)B1) / (double)deltaK);
+      Cplus = C - Cminus;
+    }
+  seg.B = B;
+  seg.B1 = B1;
+  seg.C = C;
+  seg.Cplus = Cplus;
+  seg.Kplus = Kplus;
+  seg.Cminus = Cminus;
+  seg.Kminus = Kminus;
+  return seg;
+}
+
+// The segmentation only depends on the TB size, which is the same for all the
+// (re)transmissions of a TB, so it is computed once per size
+static const cbSegmentation_t &
+GetCbSegmentation (uint16_t size)
+{
+  static thread_local std::unordered_map<uint16_t, cbSegmentation_t> cache;
+  auto it = cache.find (size);
+  if (it == cache.end ())
+    {
+      it = cache.emplace (size, ComputeCbSegmentation (size)).first;
+    }
+  return it->second;
+}
+
+
+double 
+cv2x_LteMiErrorModel::Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs, double sinrGain)
+{
+  NS_LOG_FUNCTION (sinr << &map << (uint32_t) mcs << sinrGain);
+
+  // gather the sinrs of the RBs of the TB
+  static thread_local std::vector<double> sinrRb;
+  sinrRb.resize (map.size ());
+  Values::const_iterator sinrIt = sinr.ConstValuesBegin ();
+  for (uint32_t i = 0; i < map.size (); i++)
+    {
+      NS_ASSERT (map[i] >= 0 && static_cast<std::size_t> (map[i]) < sinr.GetValuesN ());
+      sinrRb[i] = sinrIt[map[i]] * sinrGain;
+      NS_LOG_LOGIC (" RB " << map[i] << "Minimum SNR = " << 10 * std::log10 (sinrRb[i]) << " dB, " << sinrRb[i] << " V, MCS = " << (uint16_t)mcs);
     }
-  MI = MIsum / map.size ();
+
+  double MI = MeanMi (GetMiTable (mcs), sinrRb.data (), sinrRb.size ());
   NS_LOG_LOGIC (" MI = " << MI);
   return MI;
 }
@@ -466,37 +711,8 @@ double
 cv2x_LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
 {
   NS_LOG_FUNCTION (sinr);
-  double MI;
-  double MIsum = 0.0;
-  SpectrumValue sinrCopy = sinr;
-  Values::iterator sinrIt = sinrCopy.ValuesBegin ();
-  uint16_t rb = 0;
-  NS_ASSERT (sinrIt!=sinrCopy.ValuesEnd ());
-  while (sinrIt!=sinrCopy.ValuesEnd ())
-    {
-      double sinrLin = *sinrIt;
-      if (sinrLin > MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1])
-        {
-          MI = 1;
-        }
-      else 
-        { 
-          // since the values in MI_map_qpsk_axis are uniformly spaced, we have
-          // index = ((sinrLin - value[0]) / (value[SIZE-1] - value[0])) * (SIZE-1)
-              // the scaling coefficient is always the same, so we use a static const
-              // to speed up the calculation
-          static const double scalingCoeffQpsk = 
-            (MI_MAP_QPSK_SIZE - 1) / (MI_map_qpsk_axis[MI_MAP_QPSK_SIZE-1] - MI_map_qpsk_axis[0]);
-          double sinrIndexDouble = (sinrLin -  MI_map_qpsk_axis[0]) * scalingCoeffQpsk + 1;
-          uint32_t sinrIndex = std::max(0.0, std::floor (sinrIndexDouble));
-          NS_ASSERT_MSG (sinrIndex < MI_MAP_QPSK_SIZE, "MI map out of data");
-          MI = MI_map_qpsk[sinrIndex];
-        }
-      MIsum += MI;
-      sinrIt++;
-      rb++;
-    }
-  MI = MIsum / rb;
+  NS_ASSERT (sinr.GetValuesN () > 0);
+  double MI = MeanMi (g_miTableQpsk, &(*sinr.ConstValuesBegin ()), sinr.GetValuesN ());
   // return to the effective SINR value
   int j = 0;
   double esinr = 0.0;
@@ -554,11 +770,11 @@ cv2x_LteMiErrorModel::GetPcfichPdcchError (const SpectrumValue& sinr)
 
 
 cv2x_TbStats_t
-cv2x_LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, HarqProcessInfoList_t miHistory)
+cv2x_LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, const HarqProcessInfoList_t& miHistory, double sinrGain)
 {
-  NS_LOG_FUNCTION (sinr << &map << (uint32_t) size << (uint32_t) mcs);
+  NS_LOG_FUNCTION (sinr << &map << (uint32_t) size << (uint32_t) mcs << sinrGain);
 
-  double tbMi = Mib(sinr, map, mcs);
+  double tbMi = Mib (sinr, map, mcs, sinrGain);
   double MI = 0.0;
   double Reff = 0.0;
   NS_ASSERT (mcs < 29);
@@ -583,95 +799,14 @@ cv2x_LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const
       MI = tbMi;
     }
   NS_LOG_DEBUG (" MI " << MI << " Reff " << Reff << " HARQ " << miHistory.size ());
-  // estimate CB size (according to sec 5.1.2 of TS 36.212)
-  uint16_t Z = 6144; // max size of a codeblock (including CRC)
-  uint32_t B = size * 8;
-//   B = 1234;
-  uint32_t C = 0; // no. of codeblocks
-  uint32_t Cplus = 0; // no. of codeblocks with size K+
-  uint32_t Kplus = 0; // no. of codeblocks with size K+
-  uint32_t Cminus = 0; // no. of codeblocks with size K+
-  uint32_t Kminus = 0; // no. of codeblocks with size K+
-  uint32_t B1 = 0;
-  uint32_t deltaK = 0;
-  if (B <= Z)
-    {
-      // only one codeblock
-      //L = 0;
-      C = 1;
-      B1 = B;
-    }
-  else
-    {
-      uint32_t L = 24;
-      C = ceil ((double)B / ((double)(Z-L)));
-      B1 = B + C * L;
-    }
-  // first segmentation: K+ = minimum K in table such that C * K >= B1
-//   uint i = 0;
-//   while (B1 > cbSizeTable[i] * C)
-//     {
-// //       NS_LOG_INFO (" K+ " << cbSizeTable[i] << " means " << cbSizeTable[i] * C);
-//       i++;
-//     }
-//   uint16_t KplusId = i;
-//   Kplus = cbSizeTable[i];
-
-  // implement a modified binary search
-  int min = 0;
-  int max = 187;
-  int mid = 0;
-  do
-    {
-      mid = (min+max) / 2;
-      if (B1 > cbSizeTable[mid]*C)
-        {
-          if (B1 < cbSizeTable[mid+1]*C)
-            {
-              break;
-            }
-          else
-            {
-              min = mid + 1;
-            }
-        }
-      else
-        {
-          if (B1 > cbSizeTable[mid-1]*C)
-            {
-              break;
-            }
-          else
-            {
-              max = mid - 1;
-            }
-        }
-  } while ((cbSizeTable[mid]*C != B1) && (min < max));
-  // adjust binary search to the largest integer value of K containing B1
-  if (B1 > cbSizeTable[mid]*C)
-    {
-      mid ++;
-    }
-
-  uint16_t KplusId = mid;
-  Kplus = cbSizeTable[mid];
-
-
-  if (C==1)
-    {
-      Cplus = 1;
-      Cminus = 0;
-      Kminus = 0;
-    }
-  else
-    {
-      // second segmentation size: K- = maximum K in table such that K < K+
-      // -fstrict-overflow sensitive, see bug 1868
-      Kminus = cbSizeTable[ KplusId > 1 ? KplusId - 1 : 0];
-      deltaK = Kplus - Kminus;
-      Cminus = floor ((((double) C * Kplus) - (double)B1) / (double)deltaK);
-      Cplus = C - Cminus;
-    }
+  const cbSegmentation_t &seg = GetCbSegmentation (size);
+  uint32_t B = seg.B;
+  uint32_t B1 = seg.B1;
+  uint32_t C = seg.C;
+  uint32_t Cplus = seg.Cplus;
+  uint32_t Kplus = seg.Kplus;
+  uint32_t Cminus = seg.Cminus;
+  uint32_t Kminus = seg.Kminus;
   NS_LOG_INFO ("--------------------cv2x_LteMiErrorModel: TB size of " << B << " needs of " << B1 << " bits reparted in " << C << " CBs as "<< Cplus << " block(s) of " << Kplus << " and " << Cminus << " of " << Kminus);
 
   double errorRate = 1.0;
@@ -739,8 +874,52 @@ cv2x_LteMiErrorModel::GetTbDecodificationStats (const SpectrumValue& sinr, const
   return ret;
 }
 
+void
+cv2x_LteMiErrorModel::SetMiInterpolation (bool interpolate)
+{
+  NS_LOG_FUNCTION (interpolate);
+  g_miInterpolation = interpolate;
+}
 
-  
+bool
+cv2x_LteMiErrorModel::GetMiInterpolation (void)
+{
+  return g_miInterpolation;
+}
 
-} // namespace ns3
+std::string
+cv2x_LteMiErrorModel::GetImplementation (void)
+{
+  return g_miAvx2 ? "avx2" : "scalar";
+}
+
+std::vector<std::string>
+cv2x_LteMiErrorModel::GetAvailableImplementations (void)
+{
+  std::vector<std::string> names;
+  if (HasAvx2 ())
+    {
+      names.push_back ("avx2");
+    }
+  names.push_back ("scalar");
+  return names;
+}
 
+bool
+cv2x_LteMiErrorModel::SetImplementation (const std::string &name)
+{
+  NS_LOG_FUNCTION (name);
+  if (name == "avx2" && HasAvx2 ())
+    {
+      g_miAvx2 = true;
+      return true;
+    }
+  if (name == "scalar")
+    {
+      g_miAvx2 = false;
+      return true;
+    }
+  return false;
+}
+
+} // namespace ns3
@@ -34,6 +34,7 @@
 
 
 #include <list>
+#include <string>
 #include <vector>
 #include <ns3/ptr.h>
 #include <stdint.h>
@@ -77,6 +78,13 @@ struct cv2x_TbStats_t
 
 /**
  * This class provides the BLER estimation based on mutual information metrics
+ *
+ * The SINR to MI conversion uses the MI tables of each modulation, which are
+ * sampled on a uniform SINR grid: the table index of each RB is computed
+ * directly from its SINR, for all the RBs of the TB at once (with AVX2 when the
+ * CPU supports it). By default the MI of the grid point is taken as in the
+ * original model; linear interpolation between the grid points can be
+ * enabled with SetMiInterpolation ().
  */
 class cv2x_LteMiErrorModel
 {
@@ -88,9 +96,10 @@ public:
    * \param sinr the perceived sinrs in the whole bandwidth
    * \param map the actives RBs for the TB
    * \param mcs the MCS of the TB
+   * \param sinrGain linear gain applied to the sinrs (e.g. the SIMO gain)
    * \return the mmib
    */
-  static double Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs);
+  static double Mib (const SpectrumValue& sinr, const std::vector<int>& map, uint8_t mcs, double sinrGain = 1.0);
   /** 
    * \brief map the mmib (mean mutual information per bit) for different MCS
    * \param mib mean mutual information per bit of a code-block
@@ -107,9 +116,10 @@ public:
    * \param size the size in bytes of the TB
    * \param mcs the MCS of the TB
    * \param miHistory  MI of past transmissions (in case of retx)
+   * \param sinrGain linear gain applied to the sinrs (e.g. the SIMO gain)
    * \return the TB error rate and MI
    */
-  static cv2x_TbStats_t GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, HarqProcessInfoList_t miHistory);
+  static cv2x_TbStats_t GetTbDecodificationStats (const SpectrumValue& sinr, const std::vector<int>& map, uint16_t size, uint8_t mcs, const HarqProcessInfoList_t& miHistory, double sinrGain = 1.0);
   
   /** 
   * \brief run the error-model algorithm for the specified PCFICH+PDCCH channels
@@ -118,6 +128,34 @@ public:
   */  
   static double GetPcfichPdcchError (const SpectrumValue& sinr);
 
+  /**
+   * \brief enable or disable the linear interpolation of the MI tables
+   * \param interpolate true to interpolate between the SINR grid points
+   */
+  static void SetMiInterpolation (bool interpolate);
+
+  /**
+   * \return true if the MI tables are linearly interpolated
+   */
+  static bool GetMiInterpolation (void);
+
+  /**
+   * \return the name of the SINR to MI implementation in use ("avx2" or "scalar")
+   */
+  static std::string GetImplementation (void);
+
+  /**
+   * \return the names of the SINR to MI implementations supported by the CPU, from the one selected by default
+   */
+  static std::vector<std::string> GetAvailableImplementations (void);
+
+  /**
+   * \brief force the SINR to MI implementation (e.g. to compare them in the tests)
+   * \param name "avx2" or "scalar"
+   * \return false if the implementation is not supported by the CPU, in which case the current one is kept
+   */
+  static bool SetImplementation (const std::string &name);
+
 
 //private:
 
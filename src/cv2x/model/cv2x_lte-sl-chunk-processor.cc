@@ -24,6 +24,7 @@
 
 #include <ns3/log.h>
 #include <ns3/spectrum-value.h>
+#include "cv2x_spectrum-value-kernels.h"
 #include "cv2x_lte-sl-chunk-processor.h"
 
 namespace ns3 {
@@ -73,7 +74,7 @@ cv2x_LteSlChunkProcessor::EvaluateChunk (uint32_t index, const SpectrumValue& si
     {
       m_chunkValues[index].m_sumValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
     }
-  *(m_chunkValues[index].m_sumValues) += sinr * duration.GetSeconds ();
+  cv2x_SpectrumValueKernels::AddScaled (*(m_chunkValues[index].m_sumValues), sinr, duration.GetSeconds ());
   m_chunkValues[index].m_totDuration += duration;
 }
 
@@ -85,10 +86,12 @@ cv2x_LteSlChunkProcessor::End ()
   if (m_chunkValues[0].m_totDuration.GetSeconds () > 0)
     {
       std::vector<SpectrumValue> values;
+      values.reserve (m_chunkValues.size ());
       std::vector<cv2x_LteSlChunkValue>::iterator itValues;
       for (itValues = m_chunkValues.begin() ; itValues != m_chunkValues.end () ; itValues++)
         {
-          values.push_back (*((*itValues).m_sumValues) / (*itValues).m_totDuration.GetSeconds ());
+          values.push_back (*((*itValues).m_sumValues));
+          cv2x_SpectrumValueKernels::DivideByScalar (values.back (), (*itValues).m_totDuration.GetSeconds ());
         }
 
       std::vector<cv2x_LteSlChunkProcessorCallback>::iterator it;
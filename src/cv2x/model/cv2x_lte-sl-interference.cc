@@ -22,6 +22,7 @@
 
 #include "cv2x_lte-sl-interference.h"
 #include "cv2x_lte-sl-chunk-processor.h"
+#include "cv2x_spectrum-value-kernels.h"
 
 #include <ns3/simulator.h>
 #include <ns3/log.h>
@@ -54,6 +55,8 @@ cv2x_LteSlInterference::DoDispose ()
   m_rxSignal.clear();
   m_allSignals = 0;
   m_noise = 0;
+  m_interf = 0;
+  m_sinr = 0;
   Object::DoDispose ();
 } 
 
@@ -154,7 +157,7 @@ cv2x_LteSlInterference::DoAddSignal  (Ptr<const SpectrumValue> spd)
 { 
   NS_LOG_FUNCTION (this << *spd);
   ConditionallyEvaluateChunk ();
-  (*m_allSignals) += (*spd);
+  cv2x_SpectrumValueKernels::Add (*m_allSignals, *spd);
 }
 
 void
@@ -165,7 +168,7 @@ cv2x_LteSlInterference::DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_
   int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
   if (deltaSignalId > 0)
     {   
-      (*m_allSignals) -= (*spd);
+      cv2x_SpectrumValueKernels::Subtract (*m_allSignals, *spd);
     }
   else
     {
@@ -190,9 +193,10 @@ cv2x_LteSlInterference::ConditionallyEvaluateChunk ()
         {
           NS_LOG_LOGIC (this << " signal = " << *(m_rxSignal[index]) << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
           
-          SpectrumValue interf =  (*m_allSignals) - (*(m_rxSignal[index])) + (*m_noise);
-          
-          SpectrumValue sinr = (*(m_rxSignal[index])) / interf;
+          // interf = allSignals - rxSignal + noise, sinr = rxSignal / interf, computed without temporaries
+          cv2x_SpectrumValueKernels::InterferenceAndSinr (*m_interf, *m_sinr, *m_allSignals, *(m_rxSignal[index]), *m_noise);
+          const SpectrumValue &interf = *m_interf;
+          const SpectrumValue &sinr = *m_sinr;
           Time duration = Now () - m_lastChangeTime;
           for (std::list<Ptr<cv2x_LteSlChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
             {
@@ -220,6 +224,8 @@ cv2x_LteSlInterference::SetNoisePowerSpectralDensity (Ptr<const SpectrumValue> n
   // reset m_allSignals (will reset if already set previously)
   // this is needed since this method can potentially change the SpectrumModel
   m_allSignals = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_interf = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_sinr = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
   if (m_receiving == true)
     {
       // abort rx
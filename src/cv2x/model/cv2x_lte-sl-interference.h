@@ -130,6 +130,9 @@ private:
 
   Ptr<const SpectrumValue> m_noise;
 
+  Ptr<SpectrumValue> m_interf; //!< interference plus noise of the last evaluated chunk, reused at each chunk
+  Ptr<SpectrumValue> m_sinr; //!< SINR of the last evaluated chunk, reused at each chunk
+
   Time m_lastChangeTime;     /**< the time of the last change in
                                 m_TotalPower */
 
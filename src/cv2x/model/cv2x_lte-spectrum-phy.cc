@@ -264,6 +264,7 @@ void cv2x_LteSpectrumPhy::DoDispose ()
   m_ltePhyUlHarqFeedbackCallback = MakeNullCallback< void, cv2x_UlInfoListElement_s > ();
   m_ltePhyRxPssCallback = MakeNullCallback< void, uint16_t, Ptr<SpectrumValue> > ();
   m_ltePhyRxSlssCallback = MakeNullCallback< void, uint16_t, Ptr<SpectrumValue> > ();
+  m_ltePhyRxSlStartCallback = MakeNullCallback< void > ();
   SpectrumPhy::DoDispose ();
 } 
 
@@ -362,6 +363,15 @@ cv2x_LteSpectrumPhy::GetTypeId (void)
                    EnumValue (cv2x_LtePhyErrorModel::AWGN),
                    MakeEnumAccessor (&cv2x_LteSpectrumPhy::m_fadingModel),
                    MakeEnumChecker (cv2x_LtePhyErrorModel::AWGN, "AWGN"))                
+    .AddAttribute ("SlCbrRssiThreshold",
+                   "Received power per RB (in dBm) above which a sidelink RB is considered busy, for the SlChannelOccupancy trace",
+                   DoubleValue (-94.0),
+                   MakeDoubleAccessor (&cv2x_LteSpectrumPhy::m_slCbrRssiThresholdDbm),
+                   MakeDoubleChecker<double> ())
+    .AddTraceSource ("SlChannelOccupancy",
+                     "Duration and fraction of the RBs occupied by each received sidelink signal, for Channel Busy Ratio measurements",
+                     MakeTraceSourceAccessor (&cv2x_LteSpectrumPhy::m_slChannelOccupancyTrace),
+                     "ns3::cv2x_LteSpectrumPhy::SlChannelOccupancyTracedCallback")
     .AddTraceSource ("DlPhyReception",
                      "DL reception PHY layer statistics.",
                      MakeTraceSourceAccessor (&cv2x_LteSpectrumPhy::m_dlPhyReception),
@@ -906,6 +916,10 @@ cv2x_LteSpectrumPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
     {
       m_interferenceSl->AddSignal (rxPsd, duration); 
       m_interferenceData->AddSignal (rxPsd, duration); //to compute UL/SL interference
+      if (!m_slChannelOccupancyTrace.IsEmpty ())
+        {
+          TraceSlChannelOccupancy (rxPsd, duration);
+        }
       if(m_ctrlFullDuplexEnabled && lteSlRxParams->ctrlMsgList.size () > 0) 
       { 
         StartRxSlData (lteSlRxParams);
@@ -934,6 +948,25 @@ cv2x_LteSpectrumPhy::StartRx (Ptr<SpectrumSignalParameters> spectrumRxParams)
     }    
 }
 
+void
+cv2x_LteSpectrumPhy::TraceSlChannelOccupancy (Ptr<const SpectrumValue> rxPsd, Time duration)
+{
+  // Fraction of the RBs whose received power exceeds the S-RSSI threshold (3GPP TS 36.214 [5.1.30])
+  double thresholdW = std::pow (10.0, (m_slCbrRssiThresholdDbm - 30.0) / 10.0);
+  uint32_t busyRbs = 0;
+  Bands::const_iterator bandIt = rxPsd->ConstBandsBegin ();
+
+  for (Values::const_iterator it = rxPsd->ConstValuesBegin (); it != rxPsd->ConstValuesEnd (); it++, bandIt++)
+    {
+      if ((*it) * (bandIt->fh - bandIt->fl) > thresholdW)
+        {
+          busyRbs++;
+        }
+    }
+
+  m_slChannelOccupancyTrace (duration, (double) busyRbs / rxPsd->GetSpectrumModel ()->GetNumBands ());
+}
+
 void
 cv2x_LteSpectrumPhy::StartRxData (Ptr<cv2x_LteSpectrumSignalParametersDataFrame> params)
 {
@@ -1017,6 +1050,11 @@ cv2x_LteSpectrumPhy::StartRxSlData (Ptr<cv2x_LteSpectrumSignalParametersSlFrame>
   NS_LOG_FUNCTION (this);
   NS_LOG_LOGIC (this << " ID:" << GetDevice()->GetNode()->GetId() << " state: " << m_state);
 
+  if (!m_ltePhyRxSlStartCallback.IsNull ())
+    {
+      m_ltePhyRxSlStartCallback ();
+    }
+
   switch (m_state)
   {
     case TX_DATA:
@@ -1858,7 +1896,7 @@ cv2x_LteSpectrumPhy::EndRxSlData ()
 
           if (!m_nistErrorModelEnabled)
             {
-              cv2x_TbStats_t tbStats = cv2x_LteMiErrorModel::GetTbDecodificationStats (m_slSinrPerceived[(*itSinr).second]*4 /* Average gain for SIMO based on [CatreuxMIMO] */, (*itTb).second.rbBitmap, (*itTb).second.size, (*itTb).second.mcs, harqInfoList);
+              cv2x_TbStats_t tbStats = cv2x_LteMiErrorModel::GetTbDecodificationStats (m_slSinrPerceived[(*itSinr).second], (*itTb).second.rbBitmap, (*itTb).second.size, (*itTb).second.mcs, harqInfoList, 4 /* Average gain for SIMO based on [CatreuxMIMO] */);
               (*itTb).second.mi = tbStats.mi;
                 if(m_slBlerEnabled)
                   {
@@ -1948,7 +1986,7 @@ cv2x_LteSpectrumPhy::EndRxSlData ()
           if (!m_nistErrorModelEnabled)
           {
             NS_LOG_LOGIC (this << " nist error model not enabled");
-            cv2x_TbStats_t tbStats = cv2x_LteMiErrorModel::GetTbDecodificationStats (m_slSinrPerceived[(*itSinrV2x).second]*4 /* Average gain for SIMO based on [CatreuxMIMO] */, (*itTbV2x).second.rbBitmap, (*itTbV2x).second.size, (*itTbV2x).second.mcs, harqInfoList);
+            cv2x_TbStats_t tbStats = cv2x_LteMiErrorModel::GetTbDecodificationStats (m_slSinrPerceived[(*itSinrV2x).second], (*itTbV2x).second.rbBitmap, (*itTbV2x).second.size, (*itTbV2x).second.mcs, harqInfoList, 4 /* Average gain for SIMO based on [CatreuxMIMO] */);
             (*itTbV2x).second.mi = tbStats.mi;
               if(m_slBlerEnabled)
                 {
@@ -2877,6 +2915,13 @@ cv2x_LteSpectrumPhy::SetLtePhyRxSlssCallback (cv2x_LtePhyRxSlssCallback c)
   m_ltePhyRxSlssCallback = c;
 }
 
+void
+cv2x_LteSpectrumPhy::SetLtePhyRxSlStartCallback (cv2x_LtePhyRxSlStartCallback c)
+{
+  NS_LOG_FUNCTION (this);
+  m_ltePhyRxSlStartCallback = c;
+}
+
 void 
 cv2x_LteSpectrumPhy::SetRxPool (Ptr<SidelinkDiscResourcePool> newpool)
 {
@@ -243,6 +243,12 @@ typedef Callback< void, uint16_t, Ptr<SpectrumValue> > cv2x_LtePhyRxPssCallback;
 */
 typedef Callback< void, uint16_t, Ptr<SpectrumValue> > cv2x_LtePhyRxSlssCallback;
 
+/**
+* This method is used by the cv2x_LteSpectrumPhy to notify the UE PHY that a
+* sidelink signal is starting to be received
+*/
+typedef Callback< void > cv2x_LtePhyRxSlStartCallback;
+
 /**
 * This method is used by the cv2x_LteSpectrumPhy to notify the PHY about
 * the status of a certain DL HARQ process
@@ -313,6 +319,13 @@ public:
    * \param params Ptr<cv2x_LteSpectrumSignalParametersSlFrame>
    */
   void StartRxSlData (Ptr<cv2x_LteSpectrumSignalParametersSlFrame> params);
+  /**
+   * TracedCallback signature for the sidelink channel occupancy
+   *
+   * \param [in] duration Duration of the received signal
+   * \param [in] fraction Fraction of the RBs whose received power exceeds the S-RSSI threshold
+   */
+  typedef void (* SlChannelOccupancyTracedCallback)(Time duration, double fraction);
   /**
    * \brief Start receive UL SRS function
    * \param lteUlSrsRxParams Ptr<cv2x_LteSpectrumSignalParametersUlSrsFrame>
@@ -686,6 +699,14 @@ public:
     */
   void SetLtePhyRxSlssCallback (cv2x_LtePhyRxSlssCallback c);
 
+   /**
+    * set the callback for the start of the reception of a sidelink signal as
+    * part of the interconnections between the cv2x_LteSpectrumPhy and the UE PHY
+    *
+    * @param c the callback
+    */
+  void SetLtePhyRxSlStartCallback (cv2x_LtePhyRxSlStartCallback c);
+
   /// allow cv2x_LteUePhy class friend access
   friend class cv2x_LteUePhy;
   
@@ -856,6 +877,20 @@ private:
    */
   TracedCallback<cv2x_PhyReceptionStatParameters> m_slPscchReception;
 
+  /**
+   * Trace fired for each received sidelink signal, with its duration and the fraction of busy RBs, for Channel
+   * Busy Ratio measurements
+   */
+  TracedCallback<Time, double> m_slChannelOccupancyTrace;
+  double m_slCbrRssiThresholdDbm; ///< S-RSSI threshold (dBm per RB) for the channel occupancy
+
+  /**
+   * \brief Fire the SlChannelOccupancy trace for a received sidelink signal
+   * \param rxPsd the received PSD
+   * \param duration the signal duration
+   */
+  void TraceSlChannelOccupancy (Ptr<const SpectrumValue> rxPsd, Time duration);
+
   EventId m_endTxEvent; ///< end transmit event
   EventId m_endRxDataEvent; ///< end receive data event
   EventId m_endRxDlCtrlEvent; ///< end receive DL control event
@@ -869,6 +904,10 @@ private:
    * Callback used to notify the PHY about the reception of a SLSS
    */
   cv2x_LtePhyRxSlssCallback  m_ltePhyRxSlssCallback;
+  /**
+   * Callback used to notify the PHY about the start of a sidelink reception
+   */
+  cv2x_LtePhyRxSlStartCallback m_ltePhyRxSlStartCallback;
 
 };
 
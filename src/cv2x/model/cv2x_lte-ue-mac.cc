@@ -43,6 +43,8 @@
 #include <ns3/boolean.h>
 #include <bitset>
 #include <algorithm>
+#include <limits>
+#include <unordered_map>
 
 
 #include "ns3/cv2x_lte-rlc-tag.h"
@@ -309,6 +311,8 @@ public:
   virtual void ReceiveLteControlMessage (Ptr<cv2x_LteControlMessage> msg);
   virtual void NotifyChangeOfTiming (uint32_t frameNo, uint32_t subframeNo);
   virtual void PassSensingData(uint32_t frameNo, uint32_t subframeNo, uint16_t pRsvp, uint8_t rbStart, uint8_t rbLen, uint8_t prio, double slRsrp, double slRssi); 
+  virtual uint32_t GetIdleSubframes ();
+  virtual void SkipSubframe (uint32_t frameNo, uint32_t subframeNo);
 
 private:
   cv2x_LteUeMac* m_mac; ///< the UE MAC
@@ -349,6 +353,18 @@ cv2x_UeMemberLteUePhySapUser::PassSensingData(uint32_t frameNo, uint32_t subfram
 	m_mac->DoPassSensingData (frameNo, subframeNo, pRsvp, rbStart, rbLen, prio, slRsrp, slRssi);
 }
 
+uint32_t
+cv2x_UeMemberLteUePhySapUser::GetIdleSubframes ()
+{
+	return m_mac->DoGetIdleSubframes ();
+}
+
+void
+cv2x_UeMemberLteUePhySapUser::SkipSubframe (uint32_t frameNo, uint32_t subframeNo)
+{
+	m_mac->DoSkipSubframe (frameNo, subframeNo);
+}
+
 
 
 //////////////////////////////////////////////////////////
@@ -449,6 +465,16 @@ cv2x_LteUeMac::GetTypeId (void)
 					BooleanValue(false),
                    	MakeBooleanAccessor (&cv2x_LteUeMac::m_partialSensing),
                    	MakeBooleanChecker ())
+	.AddAttribute ("PartialSensingMinNumCandidateSf",
+					"Minimum number of candidate subframes in the selection window with partial sensing (default 20)",
+					UintegerValue(20),
+					MakeUintegerAccessor (&cv2x_LteUeMac::m_minNumCandidateSf),
+					MakeUintegerChecker<uint16_t> (1, 101))
+	.AddAttribute ("PartialSensingGapCandidateSensing",
+					"Bitmap of the monitored subframes with partial sensing: if bit k-1 is set, the subframes y-k*100 of the candidate subframes y are monitored (default 1)",
+					UintegerValue(1),
+					MakeUintegerAccessor (&cv2x_LteUeMac::m_gapCandidateSensing),
+					MakeUintegerChecker<uint16_t> (0, 1023))
 	.AddTraceSource ("SlUeScheduling",
 				     "Information regarding SL UE scheduling",
 				     MakeTraceSourceAccessor (&cv2x_LteUeMac::m_slUeScheduling),
@@ -595,6 +621,7 @@ void
 cv2x_LteUeMac::DoTransmitPdu (cv2x_LteMacSapProvider::TransmitPduParameters params)
 {
 	NS_LOG_FUNCTION (this);
+	m_uePhySapProvider->ResumeSubframeIndication ();
 	NS_ASSERT_MSG (m_rnti == params.rnti, "RNTI mismatch between RLC and MAC");
 	if (params.srcL2Id == 0)
 	{
@@ -636,6 +663,7 @@ void
 cv2x_LteUeMac::DoReportBufferStatus (cv2x_LteMacSapProvider::ReportBufferStatusParameters params)
 {
   NS_LOG_FUNCTION (this << (uint32_t) params.lcid);
+  m_uePhySapProvider->ResumeSubframeIndication ();
   
   
 	if (params.srcL2Id == 0) 
@@ -1087,6 +1115,7 @@ void
 cv2x_LteUeMac::DoStartContentionBasedRandomAccessProcedure ()
 {
   NS_LOG_FUNCTION (this);
+  m_uePhySapProvider->ResumeSubframeIndication ();
 
   // 3GPP 36.321 5.1.1
   NS_ASSERT_MSG (m_rachConfigured, "RACH not configured");
@@ -1107,6 +1136,7 @@ void
 cv2x_LteUeMac::DoStartNonContentionBasedRandomAccessProcedure (uint16_t rnti, uint8_t preambleId, uint8_t prachMask)
 {
   NS_LOG_FUNCTION (this << " rnti" << rnti);
+  m_uePhySapProvider->ResumeSubframeIndication ();
   NS_ASSERT_MSG (prachMask == 0, "requested PRACH MASK = " << (uint32_t) prachMask << ", but only PRACH MASK = 0 is supported");
   m_rnti = rnti;
   m_raPreambleId = preambleId;
@@ -1197,6 +1227,7 @@ void
 cv2x_LteUeMac::DoReset ()
 {
   NS_LOG_FUNCTION (this);
+  m_uePhySapProvider->ResumeSubframeIndication ();
   std::map <uint8_t, LcInfo>::iterator it = m_lcInfoMap.begin ();
   while (it != m_lcInfoMap.end ())
     {
@@ -1221,6 +1252,7 @@ cv2x_LteUeMac::DoReset ()
 void
 cv2x_LteUeMac::DoAddSlTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 {
+  m_uePhySapProvider->ResumeSubframeIndication ();
   //NS_ASSERT_MSG (m_discTxPools.m_pool != NULL, "Cannot add discovery transmission pool for " << m_rnti << ". Pool already exist for destination");
   DiscPoolInfo info;
   info.m_pool = pool;
@@ -1238,6 +1270,7 @@ cv2x_LteUeMac::DoAddSlTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 void
 cv2x_LteUeMac::DoRemoveSlTxPool ()
 {
+  m_uePhySapProvider->ResumeSubframeIndication ();
   m_discTxPools.m_pool = NULL;
 }
 
@@ -1264,6 +1297,7 @@ cv2x_LteUeMac::DoModifyDiscRxApps (std::list<uint32_t> apps)
 void
 cv2x_LteUeMac::DoAddSlTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePool> pool)
 {
+	m_uePhySapProvider->ResumeSubframeIndication ();
 	std::map <uint32_t, PoolInfo >::iterator it;
 	it = m_sidelinkTxPoolsMap.find (dstL2Id);
 	NS_ASSERT_MSG (it == m_sidelinkTxPoolsMap.end (), "Cannot add sidelink transmission pool for " << dstL2Id << ". Pool already exist for destination");
@@ -1284,6 +1318,7 @@ cv2x_LteUeMac::DoAddSlTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePool>
 void
 cv2x_LteUeMac::DoAddSlV2xTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePoolV2x> pool)
 {
+	m_uePhySapProvider->ResumeSubframeIndication ();
 	std::map <uint32_t, PoolInfoV2x>::iterator it;
 	it = m_sidelinkTxPoolsMapV2x.find(dstL2Id);
 	NS_ASSERT_MSG (it == m_sidelinkTxPoolsMapV2x.end (), "Cannot add sidelink transmission pool for " << dstL2Id << ". Pool already exist for destination");
@@ -1299,6 +1334,7 @@ cv2x_LteUeMac::DoAddSlV2xTxPool (uint32_t dstL2Id, Ptr<SidelinkTxCommResourcePoo
 void
 cv2x_LteUeMac::DoRemoveSlTxPool (uint32_t dstL2Id)
 {
+	m_uePhySapProvider->ResumeSubframeIndication ();
 	std::map <uint32_t, PoolInfo >::iterator it;
 	it = m_sidelinkTxPoolsMap.find (dstL2Id);
 	NS_ASSERT_MSG (it != m_sidelinkTxPoolsMap.end (), "Cannot remove sidelink transmission pool for " << dstL2Id << ". Unknown destination");
@@ -1308,6 +1344,7 @@ cv2x_LteUeMac::DoRemoveSlTxPool (uint32_t dstL2Id)
 void 
 cv2x_LteUeMac::DoRemoveSlV2xTxPool (uint32_t dstL2Id)
 {
+	m_uePhySapProvider->ResumeSubframeIndication ();
 	std::map <uint32_t, PoolInfoV2x>::iterator it;
 	it = m_sidelinkTxPoolsMapV2x.find (dstL2Id);
 	NS_ASSERT_MSG (it != m_sidelinkTxPoolsMapV2x.end (), "Cannot remove sidelink transmission pool for " << dstL2Id << ". Unknown destination");
@@ -3120,10 +3157,103 @@ cv2x_LteUeMac::UpdateSensingWindow(SidelinkCommResourcePoolV2x::SubframeInfo sub
 	}
 }
 
+/**
+ * \param from the reference subframe
+ * \param to the target subframe
+ * \return the number of subframes from one subframe to the next occurrence
+ * of the other one, in the range 1..10240
+ */
+static uint32_t
+SubframeDistance (const SidelinkCommResourcePoolV2x::SubframeInfo &from, const SidelinkCommResourcePoolV2x::SubframeInfo &to)
+{
+	uint32_t fromIdx = (from.frameNo - 1) * 10 + from.subframeNo - 1;
+	uint32_t toIdx = (to.frameNo - 1) * 10 + to.subframeNo - 1;
+	uint32_t distance = (toIdx + 10240 - fromIdx) % 10240;
+	return distance == 0 ? 10240 : distance;
+}
+
+uint32_t
+cv2x_LteUeMac::DoGetIdleSubframes ()
+{
+	NS_LOG_FUNCTION (this);
+	if (m_freshUlBsr || m_freshSlBsr || m_waitingForRaResponse || !m_sidelinkTxPoolsMap.empty () || m_discTxPools.m_pool)
+	{
+		return 0;
+	}
+
+	uint32_t idle = 10240;
+	if (m_sidelinkTxPoolsMapV2x.empty ())
+	{
+		return idle;
+	}
+
+	// the reselection is triggered in the subframe in which rndmStart reaches 0
+	if (m_reselCtr == 0)
+	{
+		idle = rndmStart > 1 ? rndmStart - 1 : 0;
+	}
+
+	SidelinkCommResourcePoolV2x::SubframeInfo current;
+	current.frameNo = m_frameNo;
+	current.subframeNo = m_subframeNo + 4;
+	if (current.subframeNo > 10)
+	{
+		++current.frameNo;
+		if (current.frameNo > 1024)
+		{
+			current.frameNo = 1;
+		}
+		current.subframeNo -= 10;
+	}
+
+	std::map<uint32_t, PoolInfoV2x>::iterator poolIt;
+	for (poolIt = m_sidelinkTxPoolsMapV2x.begin (); poolIt != m_sidelinkTxPoolsMapV2x.end (); poolIt++)
+	{
+		if (!poolIt->second.m_pscchTx.empty ())
+		{
+			idle = std::min (idle, SubframeDistance (current, poolIt->second.m_pscchTx.front ().subframe) - 1);
+		}
+		if (!poolIt->second.m_psschTx.empty ())
+		{
+			idle = std::min (idle, SubframeDistance (current, poolIt->second.m_psschTx.front ().subframe) - 1);
+		}
+	}
+	return idle;
+}
+
+void
+cv2x_LteUeMac::DoSkipSubframe (uint32_t frameNo, uint32_t subframeNo)
+{
+	NS_LOG_FUNCTION (this << " Frame no. " << frameNo << " subframe no. " << subframeNo);
+	m_frameNo = frameNo;
+	m_subframeNo = subframeNo;
+
+	subframeNo += 4;
+	if (subframeNo > 10)
+	{
+		++frameNo;
+		if (frameNo > 1024)
+		{
+			frameNo = 1;
+		}
+		subframeNo -= 10;
+	}
+
+	SidelinkCommResourcePoolV2x::SubframeInfo tmp;
+	tmp.frameNo = frameNo;
+	tmp.subframeNo = subframeNo;
+	UpdateSensingWindow (tmp);
+
+	if (rndmStart != 0)
+	{
+		rndmStart--;
+	}
+}
+
 std::list<cv2x_LteUeMac::SidelinkTransmissionInfoExtended>
-cv2x_LteUeMac::GetReTxResources(SidelinkCommResourcePoolV2x::SubframeInfo initialTx, std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> txOpps)
+cv2x_LteUeMac::GetReTxResources(SidelinkCommResourcePoolV2x::SubframeInfo initialTx, const std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &txOpps)
 {
-	std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::iterator it;
+	std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::const_iterator it;
 	std::list<SidelinkTransmissionInfoExtended>::iterator it2;
 
 
@@ -3205,237 +3335,324 @@ cv2x_LteUeMac::GetReTxResources(SidelinkCommResourcePoolV2x::SubframeInfo initia
 	return reTxOpps; 
 }
 
+namespace {
+
+// Number of subframes of the frame numbering (1024 frames of 10 subframes)
+const uint32_t SPS_NUM_SUBFRAMES = 10240;
+
+// Frame number 'offset' frames after 'frameNo', wrapped as in the original SPS implementation
+inline uint32_t
+SpsFrameAfter (uint32_t frameNo, uint32_t offset)
+{
+	uint32_t f = frameNo + offset;
+	if (f > 2048) {
+		f -= 2048;
+	}
+	else if (f > 1024) {
+		f -= 1024;
+	}
+	return f;
+}
+
+// Index of a subframe in [0, SPS_NUM_SUBFRAMES)
+inline uint32_t
+SpsSubframeIndex (uint32_t frameNo, uint32_t subframeNo)
+{
+	return (frameNo - 1) * 10 + subframeNo - 1;
+}
+
+} // unnamed namespace
+
 std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>
-cv2x_LteUeMac::GetTxResources(SidelinkCommResourcePoolV2x::SubframeInfo subframe, PoolInfoV2x pool)
+cv2x_LteUeMac::GetTxResources(SidelinkCommResourcePoolV2x::SubframeInfo subframe, const PoolInfoV2x &pool)
 { 		
 	NS_LOG_INFO (this << "Start Resource Allocation - Semi Persistent Scheduling"); 
-	std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> csrA, csrB, copyCsrA; 
-	std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::iterator csrIt;
-	std::list<CandidateResource>::iterator sortedCsrIt; 
-	std::list<SensingData>::iterator sensingIt;  
 
-	uint16_t numCsr; // number of all Candidate Resources
-	int threshRsrp; 
-	bool erase; 
+	SidelinkCommResourcePoolV2x::CandidateResourceView allCsr = pool.m_pool->GetCandidateResourceView(subframe, m_t1, m_t2, m_subchLen); // SA = {ALL CSRs}
+	std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> csr;
+	std::vector<const SensingData*> sensed; 
+	csr.reserve (allCsr.size ());
+	sensed.reserve (m_sensingData.size ());
 
 	if(m_partialSensing) 
 	{		
-		// Partial Sensing not implemented yet 
+		// the candidate subframes (Y) are selected among the ones of the selection window,
+		// and only the subframes y-k*100 with the k-th bit of gapCandidateSensing set are monitored
+		std::vector<uint32_t> windowSf;
+		for (const SidelinkCommResourcePoolV2x::CandidateResource* csrIt = allCsr.begin(); csrIt != allCsr.end(); csrIt++)
+		{
+			if (csrIt == allCsr.begin() || (csrIt - 1)->sfOffset != csrIt->sfOffset) {
+				SidelinkCommResourcePoolV2x::SubframeInfo sf = allCsr.GetSubframe (csrIt->sfOffset);
+				windowSf.push_back (SpsSubframeIndex (sf.frameNo, sf.subframeNo));
+			}
+		}
+
+		std::vector<bool> candidateSf;
+		std::vector<bool> monitoredSf;
+		SelectPartialSensingSubframes (windowSf, candidateSf, monitoredSf); 
+
+		for (const SidelinkCommResourcePoolV2x::CandidateResource* csrIt = allCsr.begin(); csrIt != allCsr.end(); csrIt++)
+		{
+			SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo info = allCsr.GetTransmissionInfo (*csrIt);
+			if (candidateSf[SpsSubframeIndex (info.subframe.frameNo, info.subframe.subframeNo)]) {
+				csr.push_back (info);
+			}
+		}
+		for (std::list<SensingData>::iterator sensingIt = m_sensingData.begin(); sensingIt != m_sensingData.end(); sensingIt++)
+		{
+			if (monitoredSf[SpsSubframeIndex (sensingIt->m_rxInfo.subframe.frameNo, sensingIt->m_rxInfo.subframe.subframeNo)]) {
+				sensed.push_back (&(*sensingIt));
+			}
+		}
 	} // endif m_partialSensing
 	else  
-    {				
-		// init
-		csrA = pool.m_pool->GetCandidateResources(subframe, m_t1, m_t2, m_subchLen); // SA = {ALL CSRs}
-		numCsr = csrA.size();
-		copyCsrA = csrA; 
-		//std::cout << "---------------" << std::endl; 
+	{
+		for (const SidelinkCommResourcePoolV2x::CandidateResource* csrIt = allCsr.begin(); csrIt != allCsr.end(); csrIt++)
+		{
+			csr.push_back (allCsr.GetTransmissionInfo (*csrIt));
+		}
+		for (std::list<SensingData>::iterator sensingIt = m_sensingData.begin(); sensingIt != m_sensingData.end(); sensingIt++)
+		{
+			sensed.push_back (&(*sensingIt));
+		}
+	}
 
-		//std::cout << subframe.frameNo << "/" << subframe.subframeNo <<"\t NumCsr=" << (int) csrA.size() << std::endl; 
-		threshRsrp = -110;
+	return SelectTxResources (csr, sensed); 
+}
 
-		/*for (csrIt = csrA.begin(); csrIt != csrA.end(); ++csrIt)
+void
+cv2x_LteUeMac::SelectPartialSensingSubframes(std::vector<uint32_t> windowSf, std::vector<bool> &candidateSf, std::vector<bool> &monitoredSf)
+{
+	candidateSf.assign (SPS_NUM_SUBFRAMES, false);
+	monitoredSf.assign (SPS_NUM_SUBFRAMES, false);
+	uint32_t numSf = std::min<uint32_t> (std::max<uint16_t> (m_minNumCandidateSf, 1), windowSf.size ());
+	for (uint32_t i = 0; i < numSf; i++)
+	{
+		// partial Fisher-Yates shuffle: the first numSf subframes are a random subset of the window
+		if (numSf < windowSf.size ()) {
+			std::swap (windowSf[i], windowSf[m_ueSelectedUniformVariable->GetInteger (i, windowSf.size () - 1)]);
+		}
+		candidateSf[windowSf[i]] = true; 
+		for (uint8_t k = 1; k <= 10; k++)
 		{
-			std::cout << " " << csrIt->subframe.frameNo << "/" << csrIt->subframe.subframeNo << "\t rbStart=" << (int) csrIt->rbStart << "\t rbLen=" << (int) csrIt->rbLen << std::endl; 
-		}*/
+			if (m_gapCandidateSensing & (1 << (k - 1))) {
+				monitoredSf[(windowSf[i] + SPS_NUM_SUBFRAMES - k * 100) % SPS_NUM_SUBFRAMES] = true; 
+			}
+		}
+	}
+	NS_LOG_DEBUG (this << " Partial sensing: " << numSf << " candidate subframes out of " << windowSf.size ());
+}
 
-		/*std::cout << "Sensed Data" << std::endl; 
-		for (sensingIt = m_sensingData.begin(); sensingIt != m_sensingData.end(); ++sensingIt)
-		{
-			std::cout << " " << sensingIt->m_rxInfo.subframe.frameNo << "/" << sensingIt->m_rxInfo.subframe.subframeNo << "\t rbStart=" << (int) sensingIt->m_rxInfo.rbStart << "\t rbLen=" << (int) sensingIt->m_rxInfo.rbLen << std::endl; 
-		}*/
+std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>
+cv2x_LteUeMac::SelectTxResources(const std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &csr, const std::vector<const SensingData*> &sensed)
+{
+	std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> csrB; 
+	std::list<CandidateResource>::iterator sortedCsrIt; 
+	uint32_t numCsr = csr.size(); // number of all Candidate Resources
+	std::list <CandidateResource> m_csr = ExcludeTxResources (csr, sensed); 
 
-		do
-		{	
-			csrA = copyCsrA; 	
-
-			// iterate over all Candidate Resources 	
-			csrIt = csrA.begin();	
-			while (csrIt != csrA.end())
-			{	
-				erase = false; 
-
-				// calculate all proposed transmissions of current candidate resource
-				SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo csrTransmission; 
-				csrTransmission.subframe.subframeNo = csrIt->subframe.subframeNo;
-				csrTransmission.rbStart = csrIt->rbStart;
-				csrTransmission.rbLen = csrIt->rbLen;
-
-				std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> csrTx;
-				for (uint8_t ctr = 0; ctr < m_reselCtr; ctr++)
-				{
-					csrTransmission.subframe.frameNo = csrIt->subframe.frameNo + ctr*m_pRsvp/10;
-					if (csrTransmission.subframe.frameNo > 2048) {
-						csrTransmission.subframe.frameNo -= 2048; 
-					}
-					else if (csrTransmission.subframe.frameNo > 1024) {
-						csrTransmission.subframe.frameNo -= 1024; 
-					}
-					csrTx.push_back (csrTransmission);
-				}
+	// mix values in m_csr otherwise only the first resources in 
+	// selection window will be choosen 
+	std::list<CandidateResource> copy = m_csr; 
+	m_csr.clear(); 
 
-				// check all sensed data
-				for (sensingIt = m_sensingData.begin(); sensingIt != m_sensingData.end(); sensingIt++)
-				{	
-					// calculate all possible transmissions of sensed data
-					SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo sensTransmission;
-					sensTransmission.subframe.subframeNo = sensingIt->m_rxInfo.subframe.subframeNo; 
-					sensTransmission.rbStart = sensingIt->m_rxInfo.rbStart;
-					sensTransmission.rbLen = sensingIt->m_rxInfo.rbLen; 
-
-					std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> sensTx; 
-					for(uint8_t ctr = 1; ctr <= 15; ctr++)
-					{
-						sensTransmission.subframe.frameNo = sensingIt->m_rxInfo.subframe.frameNo + ctr*sensingIt->m_pRsvpRx/10; 
-						if (sensTransmission.subframe.frameNo > 2048) {
-							sensTransmission.subframe.frameNo -= 2048; 
-						}
-						else if (sensTransmission.subframe.frameNo > 1024) {
-							sensTransmission.subframe.frameNo -= 1024; 
-						}
-						sensTx.push_back (sensTransmission); 
-					}
+	while (copy.size() != 0)
+	{	
+		std::list<CandidateResource>::iterator it = copy.begin(); 
+		std::advance(it, m_ueSelectedUniformVariable->GetInteger (0, copy.size()-1));
+		m_csr.push_back((*it)); 
+		copy.erase(it); 
+	}
 
-					// for all proposed transmissions of current candidate resource
-					std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::iterator csrTxIt; 
-					for (csrTxIt = csrTx.begin(); csrTxIt != csrTx.end(); csrTxIt++)
-					{
-						NS_ASSERT (csrTxIt->subframe.frameNo > 0 && csrTxIt->subframe.frameNo <= 1024 && csrTxIt->subframe.subframeNo > 0 && csrTxIt->subframe.subframeNo <= 10);
-				
-						std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::iterator sensTxIt; 
-						for (sensTxIt = sensTx.begin(); sensTxIt != sensTx.end(); sensTxIt++)
-						{
-							// check if candidate resource transmission and possible transmission
-							// of sensed data occur in the same subframe
-							if(csrTxIt->subframe.frameNo == sensTxIt->subframe.frameNo && csrTxIt->subframe.subframeNo == sensTxIt->subframe.subframeNo)
-							{	
-								// check if the utilizied RBs overlaps with candidate resource RBs
-								for (int i = csrTxIt->rbStart; i < csrTxIt->rbStart+csrTxIt->rbLen; i++)
-								{
-									for(int j = sensTxIt->rbStart; j < sensTxIt->rbStart+sensTxIt->rbLen; j++)
-									{
-										if (i == j && sensingIt->m_slRsrp > threshRsrp) {
-											erase = true; 
-											break;
-										}	
-									}
-									if (erase) break;
-								}			
-							}
-							if (erase) break;
-						}
-					} // end for all proposed transmission of current candidate resource
-					if (erase) break;
-				} // end for all sensed data
-				if (erase) {
-					//std::cout << "erase \t" << csrIt->subframe.frameNo << "/" << csrIt->subframe.subframeNo << "\t rbStart=" << (int) csrIt->rbStart << "\t rbLen=" << (int) csrIt->rbLen << std::endl; 
-					csrIt = csrA.erase(csrIt);
-				}
-				else {
-					csrIt++; 
-				}	
-			} // end while
-			threshRsrp += 3; 
-		} // end do 
-		while(csrA.size() < 0.2*numCsr); // Step 7: Repeat until the size of the resulting CSR-list is greater than the 20% of the size of all CSR
-		
-		/*std::cout << "remaining csrs " << (int) csrA.size() << std::endl; 
-		for (csrIt = csrA.begin(); csrIt != csrA.end(); csrIt++)
+	// Step 9: Select CSRs with smallest metric until the size of SB is greater than or equal to 20% of the size of all CSRs 
+	// sort by average RSSI
+	if (m_csr.size() != 0)
+	{
+		m_csr.sort([](const CandidateResource & a, const CandidateResource & b){return a.m_avg_rssi < b.m_avg_rssi;}); 
+	}
+	
+	for(sortedCsrIt = m_csr.begin(); sortedCsrIt != m_csr.end(); sortedCsrIt++)
+	{
+		if(csrB.size() >= 0.2*numCsr) {
+			break;
+		}
+		else {
+			csrB.push_back((sortedCsrIt->m_txInfo)); 
+		}
+	}
+
+	/*std::cout << "remaining csrs " << (int) csrB.size() << std::endl; 
+	for (csrIt = csrB.begin(); csrIt != csrB.end(); csrIt++)
+	{
+		std::cout << " " << csrIt->subframe.frameNo << "/" << csrIt->subframe.subframeNo << "\t rbStart=" << (int) csrIt->rbStart << "\t rbLen=" << (int) csrIt->rbLen << std::endl; 
+	}*/
+	return csrB; 
+}
+
+std::list<cv2x_LteUeMac::CandidateResource>
+cv2x_LteUeMac::ExcludeTxResources(const std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &csr, const std::vector<const SensingData*> &sensed)
+{
+	uint32_t numCsr = csr.size(); // number of all Candidate Resources
+
+	// Steps 5-7: a candidate is excluded if any of its m_reselCtr transmissions overlaps with one of the
+	// next 15 reservations of a sensed transmission whose RSRP is above the threshold.
+	// The reservations of the sensed transmissions are projected once on a matrix with a row for each
+	// subframe in which the candidates can transmit and a column for each RB, holding the highest RSRP
+	// of the reservations of that RB. The exclusion threshold then only needs to be compared with the
+	// highest RSRP on the transmissions of each candidate.
+	uint32_t numRb = 0; 
+	for (uint32_t c = 0; c < numCsr; c++)
+	{
+		numRb = std::max<uint32_t> (numRb, csr[c].rbStart + csr[c].rbLen);
+	}
+	for (uint32_t s = 0; s < sensed.size (); s++)
+	{
+		numRb = std::max<uint32_t> (numRb, sensed[s]->m_rxInfo.rbStart + sensed[s]->m_rxInfo.rbLen);
+	}
+
+	std::vector<int32_t> txRow (SPS_NUM_SUBFRAMES, -1); // row of the RSRP matrix of each subframe
+	std::vector<int32_t> csrRow (numCsr); // row of the candidate transmissions of each candidate
+	std::vector<std::vector<int32_t> > csrTxRows; // rows of the transmissions of each candidate subframe
+	uint32_t numTxRows = 0; 
+	for (uint32_t c = 0; c < numCsr; c++)
+	{
+		if (c > 0 && csr[c].subframe.frameNo == csr[c-1].subframe.frameNo && csr[c].subframe.subframeNo == csr[c-1].subframe.subframeNo) {
+			csrRow[c] = csrRow[c-1]; 
+			continue; 
+		}
+		NS_ASSERT (csr[c].subframe.frameNo > 0 && csr[c].subframe.frameNo <= 1024 && csr[c].subframe.subframeNo > 0 && csr[c].subframe.subframeNo <= 10);
+		csrRow[c] = csrTxRows.size(); 
+		csrTxRows.push_back (std::vector<int32_t> ());
+		for (uint8_t ctr = 0; ctr < m_reselCtr; ctr++)
 		{
-			std::cout << " " << csrIt->subframe.frameNo << "/" << csrIt->subframe.subframeNo << "\t rbStart=" << (int) csrIt->rbStart << "\t rbLen=" << (int) csrIt->rbLen << std::endl; 
-		}*/
+			uint32_t sf = SpsSubframeIndex (SpsFrameAfter (csr[c].subframe.frameNo, ctr*m_pRsvp/10), csr[c].subframe.subframeNo); 
+			if (txRow[sf] < 0) {
+				txRow[sf] = numTxRows++; 
+			}
+			csrTxRows.back ().push_back (txRow[sf]);
+		}
+	}
 
-		// Step 8: Calculate metric E defined as the linear average of S-RSSI
-		std::list <CandidateResource> m_csr; 
-		for(csrIt = csrA.begin(); csrIt != csrA.end(); csrIt++) // for all remaining CSRs
+	std::vector<double> txRsrp (numTxRows * numRb, -std::numeric_limits<double>::infinity ()); 
+	for (uint32_t s = 0; s < sensed.size (); s++)
+	{
+		const SensingData *data = sensed[s]; 
+		for(uint8_t ctr = 1; ctr <= 15; ctr++)
 		{
-			double avg_rssi = 0; 
-			uint8_t nbTx = 0; 
-			
-			// Calculate the first transmission of current CSR frameNo/subframeNo in the sensing Window 
-			SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo sensingWindowTransmission; 
-			sensingWindowTransmission.subframe.subframeNo = csrIt->subframe.subframeNo;
-			sensingWindowTransmission.rbStart = csrIt->rbStart;
-			sensingWindowTransmission.rbLen = csrIt->rbLen;  
-
-			if (csrIt->subframe.frameNo <= 100) {
-				uint8_t diff = 100 - csrIt->subframe.frameNo; 
-				sensingWindowTransmission.subframe.frameNo = 1024 - diff; 
+			uint32_t sf = SpsSubframeIndex (SpsFrameAfter (data->m_rxInfo.subframe.frameNo, ctr*data->m_pRsvpRx/10), data->m_rxInfo.subframe.subframeNo); 
+			if (txRow[sf] < 0) {
+				continue; // no candidate transmits in this subframe
 			}
-			else {
-				sensingWindowTransmission.subframe.frameNo = csrIt->subframe.frameNo - 100;
+			double *rsrp = &txRsrp[txRow[sf] * numRb]; 
+			for (uint32_t rb = data->m_rxInfo.rbStart; rb < (uint32_t) data->m_rxInfo.rbStart + data->m_rxInfo.rbLen; rb++)
+			{
+				rsrp[rb] = std::max (rsrp[rb], data->m_slRsrp);
 			}
+		}
+	}
 
-			// For the last 10 transmissions on CSR frameNo/subframeNo calculate
-			// the average S-RSSI 
-			for (uint8_t i = 0; i < 10; i++)
+	// highest RSRP on the transmissions of each candidate subframe, then of each candidate
+	std::vector<double> sfRsrp (csrTxRows.size () * numRb, -std::numeric_limits<double>::infinity ());
+	for (uint32_t r = 0; r < csrTxRows.size (); r++)
+	{
+		double *rsrp = &sfRsrp[r * numRb]; 
+		for (uint32_t t = 0; t < csrTxRows[r].size (); t++)
+		{
+			const double *tx = &txRsrp[csrTxRows[r][t] * numRb]; 
+			for (uint32_t rb = 0; rb < numRb; rb++)
 			{
-				sensingWindowTransmission.subframe.frameNo +=  10; 
-				if(sensingWindowTransmission.subframe.frameNo > 1024) {
-					sensingWindowTransmission.subframe.frameNo -= 1024; 
-				} 
-				// check if we received data on the frameNo/subframeNo and same subchannel
-				for (sensingIt = m_sensingData.begin(); sensingIt != m_sensingData.end(); sensingIt++)
-				{
-					//if (sensingWindowTransmission.subframe.frameNo == sensingIt->m_rxInfo.subframe.frameNo && sensingWindowTransmission.subframe.subframeNo == sensingIt->m_rxInfo.subframe.subframeNo)
-					if (sensingWindowTransmission.subframe.frameNo == sensingIt->m_rxInfo.subframe.frameNo && sensingWindowTransmission.subframe.subframeNo == sensingIt->m_rxInfo.subframe.subframeNo && sensingWindowTransmission.rbStart == sensingIt->m_rxInfo.rbStart)
-					{
-						nbTx++;
-						avg_rssi += sensingIt->m_slRssi; 
-						break; // if we find frameNo/subframeNo we can skip to next transmission 
-					}
-				}
+				rsrp[rb] = std::max (rsrp[rb], tx[rb]);
 			}
+		}
+	}
+	std::vector<double> csrRsrp (numCsr, -std::numeric_limits<double>::infinity ()); 
+	for (uint32_t c = 0; c < numCsr; c++)
+	{
+		const double *rsrp = &sfRsrp[csrRow[c] * numRb]; 
+		for (uint32_t rb = csr[c].rbStart; rb < (uint32_t) csr[c].rbStart + csr[c].rbLen; rb++)
+		{
+			csrRsrp[c] = std::max (csrRsrp[c], rsrp[rb]);
+		}
+	}
 
-			if(nbTx != 0) {
-				avg_rssi = avg_rssi / nbTx; 
-			}
-			else {
-				avg_rssi = -200.0; // assumend that nothing is received
+	// Step 7: raise the threshold by 3 dB until at least 20% of the candidates remain
+	int threshRsrp = -110; 
+	uint32_t numRemaining; 
+	do
+	{
+		numRemaining = 0; 
+		for (uint32_t c = 0; c < numCsr; c++)
+		{
+			if (!(csrRsrp[c] > threshRsrp)) {
+				numRemaining++;
 			}
+		}
+		threshRsrp += 3; 
+	} 
+	while (numRemaining < 0.2*numCsr); 
+	threshRsrp -= 3; 
+
+	// Step 8: Calculate metric E defined as the linear average of S-RSSI
+	// S-RSSI of the first sensed transmission of each subframe and start RB
+	std::unordered_map<uint32_t, double> sensedRssi; 
+	sensedRssi.reserve (sensed.size ());
+	for (uint32_t s = 0; s < sensed.size (); s++)
+	{
+		uint32_t key = SpsSubframeIndex (sensed[s]->m_rxInfo.subframe.frameNo, sensed[s]->m_rxInfo.subframe.subframeNo) << 8 | sensed[s]->m_rxInfo.rbStart; 
+		sensedRssi.emplace (key, sensed[s]->m_slRssi);
+	}
 
-			CandidateResource csr; 
-			csr.m_txInfo = *csrIt;
-			csr.m_avg_rssi = avg_rssi; 			
-			m_csr.push_back(csr);
+	std::list <CandidateResource> m_csr; 
+	for (uint32_t c = 0; c < numCsr; c++) // for all remaining CSRs
+	{
+		if (csrRsrp[c] > threshRsrp) {
+			continue; 
 		}
 
-		// mix values in m_csr otherwise only the first resources in 
-		// selection window will be choosen 
-		std::list<CandidateResource> copy = m_csr; 
-		m_csr.clear(); 
+		double avg_rssi = 0; 
+		uint8_t nbTx = 0; 
 
-		while (copy.size() != 0)
-		{	
-			std::list<CandidateResource>::iterator it = copy.begin(); 
-			std::advance(it, m_ueSelectedUniformVariable->GetInteger (0, copy.size()-1));
-			m_csr.push_back((*it)); 
-			copy.erase(it); 
+		// Calculate the first transmission of current CSR frameNo/subframeNo in the sensing Window 
+		uint32_t frameNo; 
+		if (csr[c].subframe.frameNo <= 100) {
+			uint8_t diff = 100 - csr[c].subframe.frameNo; 
+			frameNo = 1024 - diff; 
 		}
-
-		// Step 9: Select CSRs with smallest metric until the size of SB is greater than or equal to 20% of the size of all CSRs 
-		// sort by average RSSI
-		if (m_csr.size() != 0)
-		{
-			m_csr.sort([](const CandidateResource & a, const CandidateResource & b){return a.m_avg_rssi < b.m_avg_rssi;}); 
+		else {
+			frameNo = csr[c].subframe.frameNo - 100;
 		}
-		
-		for(sortedCsrIt = m_csr.begin(); sortedCsrIt != m_csr.end(); sortedCsrIt++)
+
+		// For the last 10 transmissions on CSR frameNo/subframeNo calculate
+		// the average S-RSSI 
+		for (uint8_t i = 0; i < 10; i++)
 		{
-			if(csrB.size() >= 0.2*numCsr) {
-				break;
-			}
-			else {
-				csrB.push_back((sortedCsrIt->m_txInfo)); 
+			frameNo += 10; 
+			if(frameNo > 1024) {
+				frameNo -= 1024; 
+			} 
+			// check if we received data on the frameNo/subframeNo and same subchannel
+			std::unordered_map<uint32_t, double>::const_iterator rssiIt = sensedRssi.find (SpsSubframeIndex (frameNo, csr[c].subframe.subframeNo) << 8 | csr[c].rbStart);
+			if (rssiIt != sensedRssi.end ())
+			{
+				nbTx++;
+				avg_rssi += rssiIt->second; 
 			}
 		}
+
+		if(nbTx != 0) {
+			avg_rssi = avg_rssi / nbTx; 
+		}
+		else {
+			avg_rssi = -200.0; // assumend that nothing is received
+		}
+
+		CandidateResource candidate; 
+		candidate.m_txInfo = csr[c];
+		candidate.m_avg_rssi = avg_rssi; 			
+		m_csr.push_back(candidate);
 	}
 
-	/*std::cout << "remaining csrs " << (int) csrB.size() << std::endl; 
-	for (csrIt = csrB.begin(); csrIt != csrB.end(); csrIt++)
-	{
-		std::cout << " " << csrIt->subframe.frameNo << "/" << csrIt->subframe.subframeNo << "\t rbStart=" << (int) csrIt->rbStart << "\t rbLen=" << (int) csrIt->rbLen << std::endl; 
-	}*/
-	return csrB; 
+	return m_csr; 
 }
 
 
@@ -4016,8 +4233,7 @@ cv2x_LteUeMac::DoSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
 					subframe.subframeNo = subframeNo; 
 
 					std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>::iterator txOppsIt; // iterator for tx opportunities
-					PoolInfoV2x pool = poolIt2->second;
-					txOpps = GetTxResources(subframe, pool); 
+					txOpps = GetTxResources(subframe, poolIt2->second); 
 					txOppsIt = txOpps.begin(); 
 					
 					// Walk through list until the random element is reached 
@@ -46,9 +46,12 @@
 namespace ns3 {
 
 class UniformRandomVariable;
+class cv2x_LteUeMacSpsSelectionTestCase;
 
 class cv2x_LteUeMac :   public Object
 {
+  /// allow cv2x_LteUeMacSpsSelectionTestCase class friend access, to check the SPS resource selection
+  friend class cv2x_LteUeMacSpsSelectionTestCase;
   /// allow cv2x_UeMemberLteUeCmacSapProvider class friend access
   friend class cv2x_UeMemberLteUeCmacSapProvider;
   /// allow cv2x_UeMemberLteMacSapProvider class friend access
@@ -421,6 +424,8 @@ private:
   bool m_v2xHarqEnabled; ///< harq enabled?
   bool m_adjacency; ///< adjacent PSCCH+PSSCH scheme enabled
   bool m_partialSensing; ///< partial sensing enabled
+  uint16_t m_minNumCandidateSf; ///< minimum number of candidate subframes with partial sensing
+  uint16_t m_gapCandidateSensing; ///< subframes monitored with partial sensing (bit k-1 set: y-k*100)
   double m_probResourceKeep; ///< probability for selecting the previous resource again 
   uint8_t m_t1; ///< defining the size of the selection window
   uint8_t m_t2; ///< defining the size of the selection window
@@ -623,6 +628,19 @@ private:
   // The PHY pass the sensing data for SPS to MAC
  void DoPassSensingData (uint32_t frameNo, uint32_t subframeNo, uint16_t pRsvp, uint8_t rbStart, uint8_t rbLen, uint8_t prio, double slRsrp, double slRssi); 
   
+  /**
+   * Get the number of subframes following the current one in which the
+   * MAC only updates the sensing window and the random start counter
+   * \return the number of idle subframes (0 if the next subframe must be processed)
+   */
+  uint32_t DoGetIdleSubframes ();
+  /**
+   * Do the bookkeeping of an idle subframe skipped by the PHY
+   * \param frameNo the PHY frame number
+   * \param subframeNo the PHY subframe number
+   */
+  void DoSkipSubframe (uint32_t frameNo, uint32_t subframeNo);
+
   /**
    * Update the sensing window (1000 ms) 
    */
@@ -630,11 +648,32 @@ private:
    /**
    * \brief See 36.213 section 14.1.1.7 V15.0.0
    */
-  std::list<SidelinkTransmissionInfoExtended> GetReTxResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> txOpps);
+  std::list<SidelinkTransmissionInfoExtended> GetReTxResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, const std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &txOpps);
    /**
    * \brief See 36.213 section 14.1.1.6 V15.0.0
    */
-  std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> GetTxResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, PoolInfoV2x pool);
+  std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> GetTxResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, const PoolInfoV2x &pool);
+  /**
+   * \brief Steps 5-9 of 36.213 section 14.1.1.6 V15.0.0
+   * \param csr the candidate single-subframe resources, ordered by subframe
+   * \param sensed the sensed transmissions to consider
+   * \return the candidates reported to the higher layers
+   */
+  std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> SelectTxResources (const std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &csr, const std::vector<const SensingData*> &sensed);
+  /**
+   * \brief Steps 5-8 of 36.213 section 14.1.1.6 V15.0.0
+   * \param csr the candidate single-subframe resources, ordered by subframe
+   * \param sensed the sensed transmissions to consider
+   * \return the candidates which are not excluded, in the order of csr, with their S-RSSI metric
+   */
+  std::list<CandidateResource> ExcludeTxResources (const std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> &csr, const std::vector<const SensingData*> &sensed);
+  /**
+   * \brief Selection of the candidate subframes (Y) and of the monitored subframes with partial sensing
+   * \param windowSf the indexes (0..10239) of the subframes of the selection window
+   * \param candidateSf set to true for the index of each candidate subframe
+   * \param monitoredSf set to true for the index of each subframe whose sensed transmissions are considered
+   */
+  void SelectPartialSensingSubframes (std::vector<uint32_t> windowSf, std::vector<bool> &candidateSf, std::vector<bool> &monitoredSf);
   /**
    * \brief See 36.321 section 5.14.1.1 V15.0.0
    */
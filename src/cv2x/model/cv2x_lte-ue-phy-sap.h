@@ -64,6 +64,13 @@ public:
    */
   virtual void SendRachPreamble (uint32_t prachId, uint32_t raRnti) = 0;
 
+  /**
+   * Notify the PHY that the MAC has new work to do, so that the subframes
+   * skipped while the UE was idle are caught up and the subframe
+   * indications are resumed
+   */
+  virtual void ResumeSubframeIndication () = 0;
+
 };
 
 
@@ -116,6 +123,20 @@ public:
    * \param rsrpVal the measured RSRP value over the used resource blocks
    */
   virtual void PassSensingData (uint32_t frameNo, uint32_t subframeNo, uint16_t pRsvp, uint8_t rbStart, uint8_t rbLen, uint8_t prio, double slRsrp, double slRssi) = 0;
+
+  /**
+   * Get the number of subframes following the current one in which the MAC
+   * has nothing to do but the bookkeeping done by SkipSubframe
+   * \return the number of idle subframes
+   */
+  virtual uint32_t GetIdleSubframes () = 0;
+
+  /**
+   * Replace the subframe indication of an idle subframe
+   * \param frameNo the skipped PHY frame number
+   * \param subframeNo the skipped PHY subframe number
+   */
+  virtual void SkipSubframe (uint32_t frameNo, uint32_t subframeNo) = 0;
 };
 
 
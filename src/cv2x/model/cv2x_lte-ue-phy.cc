@@ -46,6 +46,8 @@
 #include "cv2x_lte-radio-bearer-tag.h"
 #include <ns3/node.h>
 #include <fstream>
+#include <algorithm>
+#include <map>
 
 namespace ns3 {
 
@@ -90,6 +92,7 @@ public:
   virtual void SendMacPdu (Ptr<Packet> p);
   virtual void SendLteControlMessage (Ptr<cv2x_LteControlMessage> msg);
   virtual void SendRachPreamble (uint32_t prachId, uint32_t raRnti);
+  virtual void ResumeSubframeIndication ();
 
 private:
   cv2x_LteUePhy* m_phy; ///< the Phy
@@ -118,6 +121,242 @@ cv2x_UeMemberLteUePhySapProvider::SendRachPreamble (uint32_t prachId, uint32_t r
   m_phy->DoSendRachPreamble (prachId, raRnti);
 }
 
+void
+cv2x_UeMemberLteUePhySapProvider::ResumeSubframeIndication ()
+{
+  m_phy->ResumeSubframeIndication ();
+}
+
+
+////////////////////////////////////////
+// subframe scheduler
+////////////////////////////////////////
+
+/**
+ * Single chain of subframe events for all the UEs skipping their idle
+ * subframes.
+ *
+ * Each UE registers the start time of its next subframe to process. The
+ * scheduler only ticks at the earliest registered start time, and starts
+ * the subframes due at each tick in the order in which the UEs registered
+ * the first time, which is the order in which the UEs would process the
+ * subframe with one subframe event per UE and per TTI. A tick more than
+ * one TTI ahead is scheduled one TTI before it, as the subframe events of
+ * the UEs are, so that it keeps its place among the other events of the
+ * same time.
+ */
+class cv2x_UeSubframeScheduler
+{
+public:
+  /**
+   * \return the scheduler shared by all the UEs
+   */
+  static cv2x_UeSubframeScheduler* Get ();
+
+  /**
+   * Register the next subframe of a UE
+   * \param phy the UE PHY
+   * \param t the start time of the subframe
+   * \return false if the subframe is not aligned with the subframes of the
+   * UEs already registered, in which case it is not registered
+   */
+  bool Add (cv2x_LteUePhy* phy, Time t);
+  /**
+   * Move the registered subframe of a UE
+   * \param phy the UE PHY
+   * \param from the start time of the subframe registered
+   * \param to the new start time of the subframe
+   */
+  void Move (cv2x_LteUePhy* phy, Time from, Time to);
+  /**
+   * Remove the registered subframe of a UE, if any
+   * \param phy the UE PHY
+   */
+  void Remove (cv2x_LteUePhy* phy);
+  /**
+   * \param t the time
+   * \return true if the subframes starting at the given time were already started
+   */
+  bool IsStarted (Time t) const;
+
+private:
+  cv2x_UeSubframeScheduler ();
+  /// Start the subframes due now and schedule the next tick
+  void Tick ();
+  /// Schedule the tick due in one TTI
+  void Arm ();
+  /// Schedule the tick of the earliest registered subframe, if not already scheduled
+  void ScheduleTick ();
+  /// Drop all the registrations, at the end of a simulation
+  void Reset ();
+
+  std::map<Time, std::map<uint32_t, cv2x_LteUePhy*> > m_pending; ///< UEs by subframe start time and registration index
+  EventId m_event; ///< next tick, or the event scheduling it one TTI before
+  Time m_nextTick; ///< time of the next tick
+  Time m_tti; ///< TTI of the registered UEs
+  Time m_origin; ///< start time of a subframe, to check the alignment
+  Time m_lastTick; ///< time of the last tick
+  bool m_inTick; ///< true while the due subframes are started
+  bool m_destroyScheduled; ///< true if Reset is scheduled at the simulator destruction
+  uint32_t m_nextIndex; ///< last registration index given
+};
+
+cv2x_UeSubframeScheduler*
+cv2x_UeSubframeScheduler::Get ()
+{
+  static cv2x_UeSubframeScheduler scheduler;
+  return &scheduler;
+}
+
+cv2x_UeSubframeScheduler::cv2x_UeSubframeScheduler ()
+  : m_lastTick (Seconds (-1)),
+    m_inTick (false),
+    m_destroyScheduled (false),
+    m_nextIndex (0)
+{
+}
+
+bool
+cv2x_UeSubframeScheduler::Add (cv2x_LteUePhy* phy, Time t)
+{
+  bool running = m_inTick || m_event.IsRunning ();
+  if (!running)
+    {
+      m_pending.clear ();
+      m_tti = Seconds (phy->GetTti ());
+      m_origin = t;
+      if (!m_destroyScheduled)
+        {
+          Simulator::ScheduleDestroy (&cv2x_UeSubframeScheduler::Reset, this);
+          m_destroyScheduled = true;
+        }
+    }
+  else if ((t - m_origin).GetTimeStep () % m_tti.GetTimeStep () != 0)
+    {
+      return false;
+    }
+
+  if (phy->m_subframeSchedulerIndex == 0)
+    {
+      phy->m_subframeSchedulerIndex = ++m_nextIndex;
+    }
+  m_pending[t][phy->m_subframeSchedulerIndex] = phy;
+  ScheduleTick ();
+  return true;
+}
+
+void
+cv2x_UeSubframeScheduler::Move (cv2x_LteUePhy* phy, Time from, Time to)
+{
+  if (from == to)
+    {
+      return;
+    }
+  std::map<Time, std::map<uint32_t, cv2x_LteUePhy*> >::iterator it = m_pending.find (from);
+  if (it != m_pending.end ())
+    {
+      it->second.erase (phy->m_subframeSchedulerIndex);
+      if (it->second.empty ())
+        {
+          m_pending.erase (it);
+        }
+    }
+  m_pending[to][phy->m_subframeSchedulerIndex] = phy;
+  ScheduleTick ();
+}
+
+void
+cv2x_UeSubframeScheduler::Remove (cv2x_LteUePhy* phy)
+{
+  std::map<Time, std::map<uint32_t, cv2x_LteUePhy*> >::iterator it = m_pending.begin ();
+  while (it != m_pending.end ())
+    {
+      it->second.erase (phy->m_subframeSchedulerIndex);
+      if (it->second.empty ())
+        {
+          m_pending.erase (it++);
+        }
+      else
+        {
+          it++;
+        }
+    }
+  ScheduleTick ();
+}
+
+bool
+cv2x_UeSubframeScheduler::IsStarted (Time t) const
+{
+  return m_lastTick == t;
+}
+
+void
+cv2x_UeSubframeScheduler::Tick ()
+{
+  m_inTick = true;
+  m_event = EventId ();
+  m_lastTick = Simulator::Now ();
+  std::map<Time, std::map<uint32_t, cv2x_LteUePhy*> >::iterator it = m_pending.find (m_lastTick);
+  if (it != m_pending.end ())
+    {
+      std::map<uint32_t, cv2x_LteUePhy*> due;
+      due.swap (it->second);
+      m_pending.erase (it);
+      for (std::map<uint32_t, cv2x_LteUePhy*>::iterator phyIt = due.begin (); phyIt != due.end (); phyIt++)
+        {
+          phyIt->second->DispatchSubframeIndication ();
+        }
+    }
+  m_inTick = false;
+  ScheduleTick ();
+}
+
+void
+cv2x_UeSubframeScheduler::Arm ()
+{
+  m_event = Simulator::Schedule (m_tti, &cv2x_UeSubframeScheduler::Tick, this);
+}
+
+void
+cv2x_UeSubframeScheduler::ScheduleTick ()
+{
+  if (m_inTick)
+    {
+      return; // scheduled at the end of the tick
+    }
+  if (m_pending.empty ())
+    {
+      m_event.Cancel ();
+      return;
+    }
+  Time next = m_pending.begin ()->first;
+  if (m_event.IsRunning () && next == m_nextTick)
+    {
+      return;
+    }
+  m_event.Cancel ();
+  m_nextTick = next;
+  if (next - Simulator::Now () > m_tti)
+    {
+      m_event = Simulator::Schedule (next - m_tti - Simulator::Now (), &cv2x_UeSubframeScheduler::Arm, this);
+    }
+  else
+    {
+      m_event = Simulator::Schedule (next - Simulator::Now (), &cv2x_UeSubframeScheduler::Tick, this);
+    }
+}
+
+void
+cv2x_UeSubframeScheduler::Reset ()
+{
+  m_pending.clear ();
+  m_event = EventId ();
+  m_lastTick = Seconds (-1);
+  m_inTick = false;
+  m_destroyScheduled = false;
+  m_nextIndex = 0;
+}
+
 
 ////////////////////////////////////////
 // cv2x_LteUePhy methods
@@ -171,7 +410,13 @@ cv2x_LteUePhy::cv2x_LteUePhy (Ptr<cv2x_LteSpectrumPhy> dlPhy, Ptr<cv2x_LteSpectr
     m_currFrameNo(0),
     m_currSubframeNo(0),
     m_resyncRequested(false),
-    m_waitingNextScPeriod(false)
+    m_waitingNextScPeriod(false),
+    m_skipIdleSubframes (false),
+    m_slssUsed (false),
+    m_subframeSchedulerIndex (0),
+    m_nextFrameNo (0),
+    m_nextSubframeNo (0),
+    m_skippedSubframes (0)
 {
   m_amc = CreateObject <cv2x_LteAmc> ();
   m_powerControl = CreateObject <cv2x_LteUePowerControl> ();
@@ -220,6 +465,8 @@ void
 cv2x_LteUePhy::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
+  cv2x_UeSubframeScheduler::Get ()->Remove (this);
+  m_skippedSubframes = 0;
   delete m_uePhySapProvider;
   delete m_ueCphySapProvider;
   if (m_sidelinkSpectrumPhy)
@@ -407,6 +654,14 @@ cv2x_LteUePhy::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&cv2x_LteUePhy::m_v2xEnabled),
                    MakeBooleanChecker ())
+    .AddAttribute ("SkipIdleSubframes",
+                   "If true, the subframes in which neither the PHY nor the MAC has anything to do "
+                   "are not scheduled: their frame and subframe numbers are derived, and their "
+                   "bookkeeping is done when the next subframe is processed. It does not apply "
+                   "to UEs using SLSS or a random initial subframe indication.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&cv2x_LteUePhy::m_skipIdleSubframes),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -536,6 +791,7 @@ void
 cv2x_LteUePhy::DoSendMacPdu (Ptr<Packet> p)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
 
   SetMacPdu (p);
 }
@@ -543,6 +799,7 @@ cv2x_LteUePhy::DoSendMacPdu (Ptr<Packet> p)
 void
 cv2x_LteUePhy::PhyPduReceived (Ptr<Packet> p)
 {
+  ResumeSubframeIndication ();
   m_uePhySapUser->ReceivePhyPdu (p);
 }
 
@@ -592,6 +849,7 @@ void
 cv2x_LteUePhy::GenerateCtrlCqiReport (const SpectrumValue& sinr)
 {
   NS_LOG_FUNCTION (this);
+  CatchUpSubframeIndication ();
   
   GenerateCqiRsrpRsrq (sinr);
 }
@@ -778,6 +1036,7 @@ void
 cv2x_LteUePhy::ReportInterference (const SpectrumValue& interf)
 {
   NS_LOG_FUNCTION (this << interf);
+  CatchUpSubframeIndication ();
   m_rsInterferencePowerUpdated = true;
   m_rsInterferencePower = interf;
 }
@@ -786,6 +1045,7 @@ void
 cv2x_LteUePhy::ReportDataInterference (const SpectrumValue& interf)
 {
   NS_LOG_FUNCTION (this << interf);
+  CatchUpSubframeIndication ();
 
   m_dataInterferencePowerUpdated = true;
   m_dataInterferencePower = interf;
@@ -795,6 +1055,7 @@ void
 cv2x_LteUePhy::ReportRsReceivedPower (const SpectrumValue& power)
 {
   NS_LOG_FUNCTION (this << power);
+  CatchUpSubframeIndication ();
   m_rsReceivedPowerUpdated = true;
   m_rsReceivedPower = power;
 
@@ -965,6 +1226,7 @@ void
 cv2x_LteUePhy::DoSendLteControlMessage (Ptr<cv2x_LteControlMessage> msg)
 {
   NS_LOG_FUNCTION (this << msg);
+  ResumeSubframeIndication ();
 
   SetControlMessages (msg);
 }
@@ -973,6 +1235,7 @@ void
 cv2x_LteUePhy::DoSendRachPreamble (uint32_t raPreambleId, uint32_t raRnti)
 {
   NS_LOG_FUNCTION (this << raPreambleId);
+  ResumeSubframeIndication ();
 
   // unlike other control messages, RACH preamble is sent ASAP
   Ptr<cv2x_RachPreambleLteControlMessage> msg = Create<cv2x_RachPreambleLteControlMessage> ();
@@ -987,6 +1250,7 @@ void
 cv2x_LteUePhy::ReceiveLteControlMessageList (std::list<Ptr<cv2x_LteControlMessage> > msgList)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
 
   std::list<Ptr<cv2x_LteControlMessage> >::iterator it;
   NS_LOG_DEBUG (this << " I am rnti = " << m_rnti << " and I received msgs " << (uint16_t) msgList.size ());
@@ -1255,6 +1519,7 @@ void
 cv2x_LteUePhy::ReceivePss (uint16_t cellId, Ptr<SpectrumValue> p)
 {
   NS_LOG_FUNCTION (this << cellId << (*p));
+  CatchUpSubframeIndication ();
 
   double sum = 0.0;
   uint16_t nRB = 0;
@@ -2176,7 +2441,156 @@ cv2x_LteUePhy::SubframeIndication (uint32_t frameNo, uint32_t subframeNo)
     }
 
   // schedule next subframe indication
-  Simulator::Schedule (Seconds (GetTti ()), &cv2x_LteUePhy::SubframeIndication, this, frameNo, subframeNo);
+  ScheduleNextSubframeIndication (frameNo, subframeNo);
+}
+
+void
+cv2x_LteUePhy::ScheduleNextSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
+{
+  Time tti = Seconds (GetTti ());
+  if (m_skipIdleSubframes && !m_slssUsed)
+    {
+      m_nextFrameNo = frameNo;
+      m_nextSubframeNo = subframeNo;
+      m_nextSubframeTime = Simulator::Now () + tti;
+      m_skippedSubframes = GetIdleSubframes ();
+      if (cv2x_UeSubframeScheduler::Get ()->Add (this, m_nextSubframeTime + tti * m_skippedSubframes))
+        {
+          NS_LOG_LOGIC (this << " skipping " << m_skippedSubframes << " idle subframes");
+          return;
+        }
+      m_skippedSubframes = 0;
+    }
+  Simulator::Schedule (tti, &cv2x_LteUePhy::SubframeIndication, this, frameNo, subframeNo);
+}
+
+uint32_t
+cv2x_LteUePhy::GetIdleSubframes ()
+{
+  if (m_dlConfigured || m_cellId != 0 || m_srsConfigured || m_resyncRequested
+      || m_ueSlssScanningInProgress || !m_ueSlssMeasurementsSched.empty ()
+      || m_slTxPoolInfo.m_pool || m_discTxPools.m_pool || !m_sidelinkRxPools.empty () || !m_discRxPools.empty ()
+      || !m_slTxPoolInfoV2x.m_currentGrants.empty () || !m_subChannelsForTransmission.empty ()
+      || m_sidelinkSpectrumPhy->GetState () != cv2x_LteSpectrumPhy::IDLE)
+    {
+      return 0;
+    }
+  for (uint32_t i = 0; i < m_subChannelsForTransmissionQueue.size (); i++)
+    {
+      if (!m_subChannelsForTransmissionQueue.at (i).empty ())
+        {
+          return 0;
+        }
+    }
+  for (uint32_t i = 0; i < m_packetBurstQueue.size (); i++)
+    {
+      if (m_packetBurstQueue.at (i)->GetSize () > 0)
+        {
+          return 0;
+        }
+    }
+  for (uint32_t i = 0; i < m_controlMessagesQueue.size (); i++)
+    {
+      if (!m_controlMessagesQueue.at (i).empty ())
+        {
+          return 0;
+        }
+    }
+
+  uint32_t idle = std::min<uint32_t> (m_uePhySapUser->GetIdleSubframes (), 10240);
+  // the next expected PSSCH reception of each V2X grant is removed in its subframe
+  uint32_t nextIdx = (m_nextFrameNo - 1) * 10 + m_nextSubframeNo - 1;
+  std::list <PoolInfoV2x>::iterator poolIt;
+  for (poolIt = m_sidelinkRxPoolsV2x.begin (); poolIt != m_sidelinkRxPoolsV2x.end () && idle > 0; poolIt++)
+    {
+      std::map <uint16_t, SidelinkGrantInfoV2x>::iterator grantIt;
+      for (grantIt = poolIt->m_currentGrants.begin (); grantIt != poolIt->m_currentGrants.end (); grantIt++)
+        {
+          if (grantIt->second.m_grant_received)
+            {
+              return 0;
+            }
+          if (!grantIt->second.m_psschTx.empty ())
+            {
+              const SidelinkCommResourcePoolV2x::SubframeInfo &rx = grantIt->second.m_psschTx.front ().subframe;
+              uint32_t rxIdx = (rx.frameNo - 1) * 10 + rx.subframeNo - 1;
+              idle = std::min (idle, (rxIdx + 10240 - nextIdx) % 10240);
+            }
+        }
+    }
+  return idle;
+}
+
+void
+cv2x_LteUePhy::CatchUpSkippedSubframes (uint32_t nSubframes)
+{
+  NS_ASSERT (nSubframes <= m_skippedSubframes);
+  Time tti = Seconds (GetTti ());
+  for (uint32_t i = 0; i < nSubframes; i++)
+    {
+      m_rsReceivedPowerUpdated = false;
+      m_rsInterferencePowerUpdated = false;
+      m_pssReceived = false;
+      m_sidelinkSpectrumPhy->ClearExpectedSlTb ();
+      m_sidelinkSpectrumPhy->ClearExpectedSlV2xTb ();
+      m_ueCphySapUser->ReportSubframeIndication (m_nextFrameNo, m_nextSubframeNo);
+      m_uePhySapUser->SkipSubframe (m_nextFrameNo, m_nextSubframeNo);
+
+      m_subframeNo = m_nextSubframeNo;
+      ++m_nextSubframeNo;
+      if (m_nextSubframeNo > 10)
+        {
+          ++m_nextFrameNo;
+          if (m_nextFrameNo > 1024)
+            {
+              m_nextFrameNo = 1;
+            }
+          m_nextSubframeNo = 1;
+        }
+      m_nextSubframeTime += tti;
+    }
+  m_skippedSubframes -= nSubframes;
+}
+
+void
+cv2x_LteUePhy::CatchUpSubframeIndication ()
+{
+  if (m_skippedSubframes == 0 || Simulator::Now () < m_nextSubframeTime)
+    {
+      return;
+    }
+  // skipped subframes already started, including the one starting now if
+  // the subframes of the other UEs starting now were already started
+  int64_t tti = Seconds (GetTti ()).GetTimeStep ();
+  int64_t elapsed = (Simulator::Now () - m_nextSubframeTime).GetTimeStep ();
+  uint64_t started = elapsed / tti + 1;
+  if (elapsed % tti == 0 && !cv2x_UeSubframeScheduler::Get ()->IsStarted (Simulator::Now ()))
+    {
+      started--;
+    }
+  CatchUpSkippedSubframes (std::min<uint64_t> (started, m_skippedSubframes));
+}
+
+void
+cv2x_LteUePhy::ResumeSubframeIndication ()
+{
+  if (m_skippedSubframes == 0)
+    {
+      return;
+    }
+  NS_LOG_FUNCTION (this);
+  Time tti = Seconds (GetTti ());
+  Time pending = m_nextSubframeTime + tti * m_skippedSubframes;
+  CatchUpSubframeIndication ();
+  cv2x_UeSubframeScheduler::Get ()->Move (this, pending, m_nextSubframeTime);
+  m_skippedSubframes = 0;
+}
+
+void
+cv2x_LteUePhy::DispatchSubframeIndication ()
+{
+  CatchUpSkippedSubframes (m_skippedSubframes);
+  SubframeIndication (m_nextFrameNo, m_nextSubframeNo);
 }
 
 
@@ -2206,6 +2620,7 @@ void
 cv2x_LteUePhy::DoReset ()
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
 
   m_rnti = 0;
   m_transmissionMode = 0;
@@ -2243,6 +2658,7 @@ void
 cv2x_LteUePhy::DoStartCellSearch (uint32_t dlEarfcn)
 {
   NS_LOG_FUNCTION (this << dlEarfcn);
+  ResumeSubframeIndication ();
   m_dlEarfcn = dlEarfcn;
   DoSetDlBandwidth (6); // configure DL for receiving PSS
   SwitchToState (CELL_SEARCH);
@@ -2252,6 +2668,7 @@ void
 cv2x_LteUePhy::DoSynchronizeWithEnb (uint16_t cellId, uint32_t dlEarfcn)
 {
   NS_LOG_FUNCTION (this << cellId << dlEarfcn);
+  ResumeSubframeIndication ();
   m_dlEarfcn = dlEarfcn;
   DoSynchronizeWithEnb (cellId);
 }
@@ -2260,6 +2677,7 @@ void
 cv2x_LteUePhy::DoSynchronizeWithEnb (uint16_t cellId)
 {
   NS_LOG_FUNCTION (this << cellId);
+  ResumeSubframeIndication ();
 
   if (cellId == 0)
     {
@@ -2283,6 +2701,7 @@ void
 cv2x_LteUePhy::DoSetDlBandwidth (uint8_t dlBandwidth)
 {
   NS_LOG_FUNCTION (this << (uint32_t) dlBandwidth);
+  ResumeSubframeIndication ();
   if (m_dlBandwidth != dlBandwidth or !m_dlConfigured)
     {
       m_dlBandwidth = dlBandwidth;
@@ -2314,6 +2733,7 @@ void
 cv2x_LteUePhy::DoConfigureUplink (uint32_t ulEarfcn, uint8_t ulBandwidth)
 {
   NS_LOG_FUNCTION (this << ulEarfcn << (uint16_t) ulBandwidth);
+  ResumeSubframeIndication ();
   m_ulEarfcn = ulEarfcn;
   m_ulBandwidth = ulBandwidth;
   m_ulConfigured = true;
@@ -2331,6 +2751,7 @@ void
 cv2x_LteUePhy::DoConfigureReferenceSignalPower (int8_t referenceSignalPower)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
   m_powerControl->ConfigureReferenceSignalPower (referenceSignalPower);
 }
  
@@ -2338,6 +2759,7 @@ void
 cv2x_LteUePhy::DoSetRnti (uint16_t rnti)
 {
   NS_LOG_FUNCTION (this << " ID:" << m_uplinkSpectrumPhy->GetDevice()->GetNode()->GetId() << " RNTI: " << rnti);
+  ResumeSubframeIndication ();
   m_rnti = rnti;
 
   m_powerControl->SetCellId (m_cellId);
@@ -2348,6 +2770,7 @@ void
 cv2x_LteUePhy::DoSetTransmissionMode (uint8_t txMode)
 {
   NS_LOG_FUNCTION (this << (uint16_t)txMode);
+  ResumeSubframeIndication ();
   m_transmissionMode = txMode;
   m_downlinkSpectrumPhy->SetTransmissionMode (txMode);
 }
@@ -2356,6 +2779,7 @@ void
 cv2x_LteUePhy::DoSetSrsConfigurationIndex (uint16_t srcCi)
 {
   NS_LOG_FUNCTION (this << srcCi);
+  ResumeSubframeIndication ();
   m_srsPeriodicity = GetSrsPeriodicity (srcCi);
   m_srsSubframeOffset = GetSrsSubframeOffset (srcCi);
   m_srsConfigured = true;
@@ -2370,12 +2794,14 @@ void
 cv2x_LteUePhy::DoSetPa (double pa)
 {
   NS_LOG_FUNCTION (this << pa);
+  ResumeSubframeIndication ();
   m_paLinear = pow (10,(pa/10));
 }
 
 void
 cv2x_LteUePhy::DoSetSlTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 {
+  ResumeSubframeIndication ();
   m_discTxPools.m_pool = pool;
   m_discTxPools.m_npsdch = pool->GetNPsdch ();
   m_discTxPools.m_currentGrants.clear ();  
@@ -2388,6 +2814,7 @@ cv2x_LteUePhy::DoSetSlTxPool (Ptr<SidelinkTxDiscResourcePool> pool)
 void
 cv2x_LteUePhy::DoRemoveSlTxPool (bool disc)
 {
+  ResumeSubframeIndication ();
   m_discTxPools.m_pool = NULL;
   m_discTxPools.m_npsdch = 0;
   m_discTxPools.m_currentGrants.clear ();
@@ -2397,6 +2824,7 @@ cv2x_LteUePhy::DoRemoveSlTxPool (bool disc)
 void
 cv2x_LteUePhy::DoSetSlRxPools (std::list<Ptr<SidelinkRxDiscResourcePool> > pools)
 {
+  ResumeSubframeIndication ();
   
   std::list<Ptr<SidelinkRxDiscResourcePool> >::iterator poolIt;
   for (poolIt = pools.begin (); poolIt != pools.end(); poolIt++)
@@ -2427,12 +2855,14 @@ cv2x_LteUePhy::DoSetSlRxPools (std::list<Ptr<SidelinkRxDiscResourcePool> > pools
 void
 cv2x_LteUePhy::DoSetDiscGrantInfo (uint8_t resPsdch)
 {
+  ResumeSubframeIndication ();
   m_discResPsdch = resPsdch;
 }
 
 void 
 cv2x_LteUePhy::DoAddDiscTxApps (std::list<uint32_t> apps)
 {
+  ResumeSubframeIndication ();
   m_discTxApps = apps;
   m_sidelinkSpectrumPhy->AddDiscTxApps (apps);
 }
@@ -2440,6 +2870,7 @@ cv2x_LteUePhy::DoAddDiscTxApps (std::list<uint32_t> apps)
 void 
 cv2x_LteUePhy::DoAddDiscRxApps (std::list<uint32_t> apps)
 {
+  ResumeSubframeIndication ();
   m_discRxApps = apps;
   m_sidelinkSpectrumPhy->AddDiscRxApps (apps);
 }
@@ -2447,6 +2878,7 @@ cv2x_LteUePhy::DoAddDiscRxApps (std::list<uint32_t> apps)
 void
 cv2x_LteUePhy::DoSetSlTxPool (Ptr<SidelinkTxCommResourcePool> pool)
 {
+  ResumeSubframeIndication ();
   m_slTxPoolInfo.m_pool = pool;
   m_slTxPoolInfo.m_npscch = pool->GetNPscch();
   m_slTxPoolInfo.m_currentGrants.clear();
@@ -2457,6 +2889,7 @@ cv2x_LteUePhy::DoSetSlTxPool (Ptr<SidelinkTxCommResourcePool> pool)
 void 
 cv2x_LteUePhy::DoSetSlV2xTxPool (Ptr<SidelinkTxCommResourcePoolV2x> pool)
 {
+  ResumeSubframeIndication ();
   m_slTxPoolInfoV2x.m_pool = pool;
   m_slTxPoolInfoV2x.m_currentGrants.clear();
   m_slTxPoolInfoV2x.m_currentFrameInfo.frameNo = 0; //init to 0 to make it invalid
@@ -2466,6 +2899,7 @@ cv2x_LteUePhy::DoSetSlV2xTxPool (Ptr<SidelinkTxCommResourcePoolV2x> pool)
 void
 cv2x_LteUePhy::DoRemoveSlTxPool ()
 {
+  ResumeSubframeIndication ();
   m_slTxPoolInfo.m_pool = NULL;
   m_slTxPoolInfo.m_npscch = 0;
   m_slTxPoolInfo.m_currentGrants.clear();
@@ -2474,6 +2908,7 @@ cv2x_LteUePhy::DoRemoveSlTxPool ()
 void
 cv2x_LteUePhy::DoRemoveSlV2xTxPool ()
 {
+  ResumeSubframeIndication ();
   m_slTxPoolInfoV2x.m_pool = NULL;
   m_slTxPoolInfoV2x.m_currentGrants.clear(); 
 }
@@ -2481,6 +2916,7 @@ cv2x_LteUePhy::DoRemoveSlV2xTxPool ()
 void
 cv2x_LteUePhy::DoSetSlRxPools (std::list<Ptr<SidelinkRxCommResourcePool> > pools)
 {
+  ResumeSubframeIndication ();
   //update the pools that have changed
   std::list<Ptr<SidelinkRxCommResourcePool> >::iterator poolIt;
   for (poolIt = pools.begin (); poolIt != pools.end(); poolIt++)
@@ -2512,6 +2948,7 @@ cv2x_LteUePhy::DoSetSlRxPools (std::list<Ptr<SidelinkRxCommResourcePool> > pools
 void 
 cv2x_LteUePhy::DoSetSlV2xRxPools (std::list<Ptr<SidelinkRxCommResourcePoolV2x> > pools)
 {
+  ResumeSubframeIndication ();
   std::list<Ptr<SidelinkRxCommResourcePoolV2x> >::iterator poolIt;
   for (poolIt = pools.begin(); poolIt != pools.end(); poolIt++)
   {
@@ -2539,6 +2976,7 @@ cv2x_LteUePhy::DoSetSlV2xRxPools (std::list<Ptr<SidelinkRxCommResourcePoolV2x> >
 void
 cv2x_LteUePhy::DoAddSlDestination (uint32_t destination)
 {
+  ResumeSubframeIndication ();
   std::list <uint32_t>::iterator it;
   for (it = m_destinations.begin (); it != m_destinations.end ();it++) {
     if ((*it) == destination) {
@@ -2559,6 +2997,7 @@ cv2x_LteUePhy::DoAddSlDestination (uint32_t destination)
 void
 cv2x_LteUePhy::DoRemoveSlDestination (uint32_t destination)
 {
+  ResumeSubframeIndication ();
   std::list <uint32_t>::iterator it = m_destinations.begin ();
   while (it != m_destinations.end ()) {
     if ((*it) == destination) {
@@ -2684,6 +3123,8 @@ cv2x_LteUePhy::SwitchToState (State newState)
 
 void cv2x_LteUePhy::SetFirstScanningTime(Time t){
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
+  m_slssUsed = true;
   m_tFirstScanning = t;
   Simulator::Schedule(m_tFirstScanning,&cv2x_LteUePhy::StartSlssScanning, this);
 }
@@ -2770,6 +3211,8 @@ double cv2x_LteUePhy::GetSidelinkRssi (std::vector<SpectrumValue> sig, std::vect
 void cv2x_LteUePhy::ReceiveSlss(uint16_t slssid, Ptr<SpectrumValue> p)
 {
   NS_LOG_FUNCTION(this << slssid);
+  ResumeSubframeIndication ();
+  m_slssUsed = true;
 
   if (m_ueSlssScanningInProgress || m_ueSlssMeasurementInProgress)
     {
@@ -2862,6 +3305,7 @@ void cv2x_LteUePhy::SetInitialSubFrameIndication(bool rdm)
   if (rdm)
     {
       NS_LOG_LOGIC (this << " Random initial frame/subframe indication");
+      m_slssUsed = true;
 
       Ptr<UniformRandomVariable> frameRdm = CreateObject<UniformRandomVariable> ();
       Ptr<UniformRandomVariable> subframeRdm = CreateObject<UniformRandomVariable> ();
@@ -3286,6 +3730,7 @@ cv2x_LteUePhy::ChangeOfTiming(uint32_t frameNo, uint32_t subframeNo)
 void cv2x_LteUePhy::DoSetSlssId(uint64_t slssid)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
   m_uplinkSpectrumPhy->SetSlssid(slssid);
   m_sidelinkSpectrumPhy->SetSlssid(slssid);
 }
@@ -3293,6 +3738,8 @@ void cv2x_LteUePhy::DoSetSlssId(uint64_t slssid)
 void cv2x_LteUePhy::DoSendSlss(cv2x_LteRrcSap::MasterInformationBlockSL mibSl)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
+  m_slssUsed = true;
   Ptr<cv2x_MibSLLteControlMessage> msg = Create<cv2x_MibSLLteControlMessage> ();
   msg->SetMibSL(mibSl);
   NS_LOG_LOGIC(this << " Adding a MIB-SL to the queue of control messages to be send ");
@@ -3308,6 +3755,8 @@ void cv2x_LteUePhy::DoSendSlss(cv2x_LteRrcSap::MasterInformationBlockSL mibSl)
 void cv2x_LteUePhy::DoSynchronizeToSyncRef(cv2x_LteRrcSap::MasterInformationBlockSL mibSl)
 {
   NS_LOG_FUNCTION (this);
+  ResumeSubframeIndication ();
+  m_slssUsed = true;
 
   //Estimate the current timing (frame/subframe indication) of the SyncRef
   //using the information in the MIB-SL and the creation and reception timestamps
@@ -59,6 +59,8 @@ class cv2x_LteUePhy : public cv2x_LtePhy
   friend class cv2x_UeMemberLteUePhySapProvider;
   /// allow cv2x_MemberLteUeCphySapProvider<cv2x_LteUePhy> class friend access
   friend class cv2x_MemberLteUeCphySapProvider<cv2x_LteUePhy>;
+  /// allow cv2x_UeSubframeScheduler class friend access
+  friend class cv2x_UeSubframeScheduler;
 
 public:
   /**
@@ -256,6 +258,16 @@ public:
   */
   void SubframeIndication (uint32_t frameNo, uint32_t subframeNo);
 
+  /**
+   * \brief Resume the subframe indications of a UE that is skipping idle
+   * subframes, because an input (reception, MAC or RRC request) may have
+   * given it something to do
+   *
+   * The subframes skipped so far are caught up, and the next subframe
+   * indication is scheduled at the first subframe boundary not yet passed.
+   */
+  void ResumeSubframeIndication ();
+
 
   /**
    * \brief Send the SRS signal in the last symbols of the frame
@@ -1087,6 +1099,48 @@ private:
   // The RRC instructs the PHY to synchronize to a given SyncRef and apply the corresponding change of timing
   void DoSynchronizeToSyncRef (cv2x_LteRrcSap::MasterInformationBlockSL mibSl);
 
+  /**
+   * Get the number of subframes following the current one that are idle, i.e.,
+   * in which the PHY and the MAC would do nothing but advancing the frame and
+   * subframe counters, updating the MAC sensing window and random start
+   * counter, and reporting the subframe indication to the RRC
+   * \return the number of idle subframes (0 if the next subframe must be processed)
+   */
+  uint32_t GetIdleSubframes ();
+  /**
+   * Schedule the subframe indication following the current one, skipping the
+   * idle subframes if enabled
+   * \param frameNo the frame number of the next subframe
+   * \param subframeNo the subframe number of the next subframe
+   */
+  void ScheduleNextSubframeIndication (uint32_t frameNo, uint32_t subframeNo);
+  /**
+   * Do the bookkeeping of the first skipped subframes
+   * \param nSubframes the number of skipped subframes to catch up
+   */
+  void CatchUpSkippedSubframes (uint32_t nSubframes);
+  /**
+   * Catch up the skipped subframes that already started, without changing
+   * the time of the pending subframe indication
+   */
+  void CatchUpSubframeIndication ();
+  /**
+   * Catch up the skipped subframes and start the pending subframe indication
+   */
+  void DispatchSubframeIndication ();
+
+  bool m_skipIdleSubframes; ///< true if the idle subframes are skipped
+  /**
+   * True if the UE uses the sidelink synchronization (SLSS) or a random
+   * initial timing, which disables the skipping of the idle subframes
+   */
+  bool m_slssUsed;
+  uint32_t m_subframeSchedulerIndex; ///< index of the UE in the subframe scheduler (0 if not registered)
+  uint32_t m_nextFrameNo; ///< frame number of the first subframe not processed yet
+  uint32_t m_nextSubframeNo; ///< subframe number of the first subframe not processed yet
+  Time m_nextSubframeTime; ///< start time of the first subframe not processed yet
+  uint32_t m_skippedSubframes; ///< number of skipped subframes before the pending subframe indication
+
 }; // end of `class cv2x_LteUePhy`
 
 
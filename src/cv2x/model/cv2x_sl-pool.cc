@@ -21,6 +21,7 @@
  */
 
 #include "cv2x_sl-pool.h"
+#include <tuple>
 
 namespace ns3 {
   /**
@@ -680,9 +681,15 @@ namespace ns3 {
     ///// SidelinkV2XResourcePool ///// 
     ///////////////////////////////////
 
+  /**
+   * Largest T2 value of the selection window, i.e. largest subframe offset of a candidate resource
+   */
+  static const uint16_t SL_V2X_MAX_T2 = 100;
+
   SidelinkCommResourcePoolV2x::SidelinkCommResourcePoolV2x (void) : m_type (SidelinkCommResourcePoolV2x::UNKNOWN)
   {
     m_preconfigured = false; 
+    m_candidateResources = 0;
   }
 
   SidelinkCommResourcePoolV2x::~SidelinkCommResourcePoolV2x (void)
@@ -749,6 +756,7 @@ namespace ns3 {
   {
     ComputeNumberOfPscchResources ();
     ComputeNumberOfPsschResources ();
+    ComputeCandidateResources ();
   }
 
   SidelinkCommResourcePoolV2x::SlPoolType
@@ -810,66 +818,41 @@ namespace ns3 {
     m_rbpssch = m_rbpsschVector.size();
   }
 
-  std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>
-  SidelinkCommResourcePoolV2x::GetCandidateResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, uint16_t t1, uint16_t t2, uint16_t subchLen)
-  { 
-    NS_ASSERT (subframe.frameNo > 0 && subframe.frameNo <= 1024 && subframe.subframeNo > 0 && subframe.subframeNo <= 10);
-    NS_ASSERT (t1 >= 0 && t1 <= 4 && t2 >= 20 && t2 <= 100);
-
+  void
+  SidelinkCommResourcePoolV2x::ComputeCandidateResources ()
+  {
     bool adjacency = cv2x_LteRrcSap::adjacencyAsBool(m_adjacencyPscchPssch);
     uint16_t sizeSubch = cv2x_LteRrcSap::sizeSubchannelAsInt(m_sizeSubchannel); 
     uint16_t numSubch = cv2x_LteRrcSap::numSubchannelAsInt(m_numSubchannel);
     uint16_t startRbSubch = cv2x_LteRrcSap::startRbSubchannelAsInt(m_startRbSubchannel);
-    uint16_t lenSelectionWindow = t2-t1; 
 
-    std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> txInfo;
-    SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo info;   
+    // the candidate resources only depend on the subchannels of the pool, so all the pools
+    // (i.e., all the UEs) with the same subchannel configuration share the same table
+    typedef std::tuple<bool, uint16_t, uint16_t, uint16_t> CandidateResourcesKey;
+    static std::map<CandidateResourcesKey, std::vector<std::vector<CandidateResource> > > tables;
 
-    info.subframe.subframeNo = subframe.subframeNo + t1 - 1;
-    info.subframe.frameNo = subframe.frameNo; 
- 
-    if(info.subframe.subframeNo > 10)
-    {
-      ++info.subframe.frameNo;
-      if(info.subframe.frameNo > 1024) 
-      {
-        info.subframe.frameNo = 1; 
-      }
-      info.subframe.subframeNo -= 10; 
-    }
- 
-    if(adjacency) 
+    CandidateResourcesKey key (adjacency, sizeSubch, numSubch, startRbSubch);
+    std::map<CandidateResourcesKey, std::vector<std::vector<CandidateResource> > >::iterator it = tables.find (key);
+    if (it == tables.end ())
     {
-      info.rbLen = subchLen*sizeSubch-2;
-    }
-    else 
-    {
-      info.rbLen = subchLen*sizeSubch;
-    }
-
-    for(uint16_t sfCtr = 0; sfCtr <= lenSelectionWindow; sfCtr++) 
+      std::vector<std::vector<CandidateResource> > table (numSubch);
+      for (uint16_t subchLen = 1; subchLen <= numSubch; subchLen++)
       {
-        // due to half duplex the UE doesn't receive SCIs in the subframes in which it transmits itself
-        // so it should not choose the last transmission subframe as candidate resource
-        if(t2 == 100 && sfCtr == lenSelectionWindow-1) 
+        CandidateResource info;
+        if(adjacency) 
         {
-          continue; 
+          info.rbLen = subchLen*sizeSubch-2;
         }
-
-        ++info.subframe.subframeNo;  
-        if (info.subframe.subframeNo > 10) 
+        else 
         {
-          ++info.subframe.frameNo; 
-          if (info.subframe.frameNo > 1024) 
-          {
-            info.subframe.frameNo = 1; 
-          }
-          info.subframe.subframeNo -= 10;
+          info.rbLen = subchLen*sizeSubch;
         }
 
-        for(uint16_t subchCtr = 0; subchCtr < numSubch; subchCtr++)
+        std::vector<CandidateResource>& resources = table[subchLen - 1];
+        resources.reserve ((SL_V2X_MAX_T2 + 1) * (numSubch - subchLen + 1));
+        for (info.sfOffset = 0; info.sfOffset <= SL_V2X_MAX_T2; info.sfOffset++)
         {
-          if((subchCtr+subchLen) <= numSubch)
+          for(uint16_t subchCtr = 0; subchCtr + subchLen <= numSubch; subchCtr++)
           {
             if(adjacency)
             {
@@ -879,13 +862,82 @@ namespace ns3 {
             {
               info.rbStart = startRbSubch + subchCtr*sizeSubch;
             }
-            txInfo.push_back(info); 
+            resources.push_back (info);
           }
         }
       }
+      it = tables.insert (std::make_pair (key, table)).first;
+    }
+    m_candidateResources = &it->second;
+  }
+
+  SidelinkCommResourcePoolV2x::CandidateResourceView
+  SidelinkCommResourcePoolV2x::GetCandidateResourceView (SidelinkCommResourcePoolV2x::SubframeInfo subframe, uint16_t t1, uint16_t t2, uint16_t subchLen) const
+  { 
+    NS_ASSERT (subframe.frameNo > 0 && subframe.frameNo <= 1024 && subframe.subframeNo > 0 && subframe.subframeNo <= 10);
+    NS_ASSERT (t1 >= 0 && t1 <= 4 && t2 >= 20 && t2 <= SL_V2X_MAX_T2);
+    NS_ASSERT_MSG (m_candidateResources != 0, "The pool is not configured");
+
+    if (subchLen == 0 || subchLen > m_candidateResources->size ())
+    {
+      return CandidateResourceView (subframe, 0, 0);
+    }
+
+    // due to half duplex the UE doesn't receive SCIs in the subframes in which it transmits itself
+    // so it should not choose the last transmission subframe as candidate resource
+    uint16_t lastSfOffset = (t2 == SL_V2X_MAX_T2) ? t2 - 1 : t2;
+
+    const std::vector<CandidateResource>& resources = (*m_candidateResources)[subchLen - 1];
+    size_t resourcesPerSf = resources.size () / (SL_V2X_MAX_T2 + 1);
+    return CandidateResourceView (subframe, resources.data () + t1 * resourcesPerSf, resources.data () + (lastSfOffset + 1) * resourcesPerSf);
+  }
+
+  std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>
+  SidelinkCommResourcePoolV2x::GetCandidateResources (SidelinkCommResourcePoolV2x::SubframeInfo subframe, uint16_t t1, uint16_t t2, uint16_t subchLen)
+  { 
+    CandidateResourceView view = GetCandidateResourceView (subframe, t1, t2, subchLen);
+    std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> txInfo;
+    for (const CandidateResource* it = view.begin (); it != view.end (); it++)
+    {
+      txInfo.push_back (view.GetTransmissionInfo (*it));
+    }
     return txInfo;
   }
 
+  SidelinkCommResourcePoolV2x::CandidateResourceView::CandidateResourceView (void)
+    : m_sfIndex (0),
+      m_begin (0),
+      m_end (0)
+  {
+  }
+
+  SidelinkCommResourcePoolV2x::CandidateResourceView::CandidateResourceView (SidelinkCommResourcePoolV2x::SubframeInfo subframe, const CandidateResource* begin, const CandidateResource* end)
+    : m_sfIndex (((subframe.frameNo - 1) * 10 + subframe.subframeNo - 1) % 10240),
+      m_begin (begin),
+      m_end (end)
+  {
+  }
+
+  SidelinkCommResourcePoolV2x::SubframeInfo
+  SidelinkCommResourcePoolV2x::CandidateResourceView::GetSubframe (uint16_t sfOffset) const
+  {
+    uint32_t sfIndex = (m_sfIndex + sfOffset) % 10240;
+    SidelinkCommResourcePoolV2x::SubframeInfo res;
+    res.frameNo = sfIndex / 10 + 1;
+    res.subframeNo = sfIndex % 10 + 1;
+    return res;
+  }
+
+  SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo
+  SidelinkCommResourcePoolV2x::CandidateResourceView::GetTransmissionInfo (const CandidateResource& resource) const
+  {
+    SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo info;
+    info.subframe = GetSubframe (resource.sfOffset);
+    info.rbStart = resource.rbStart;
+    info.rbLen = resource.rbLen;
+    return info;
+  }
+
   std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo>
   SidelinkCommResourcePoolV2x::GetPscchTransmissions (SidelinkCommResourcePoolV2x::SubframeInfo subframe, uint8_t riv, uint16_t pRsvp, uint8_t sfGap, uint8_t reTxIdx, uint8_t pscchResource, uint8_t reselCtr)
   { 
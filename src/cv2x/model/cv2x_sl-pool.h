@@ -24,6 +24,7 @@
 #define CV2X_SL_POOL_H
 
 #include <map>
+#include <vector>
 #include "cv2x_lte-rrc-sap.h"
 
 namespace ns3 {
@@ -392,6 +393,56 @@ namespace ns3 {
       uint16_t rbLen; //!<The number of RBs used by the transmission 
     };
 
+    /** A candidate single-subframe resource, located relatively to the subframe of the resource selection */
+    struct CandidateResource {
+      uint16_t sfOffset; //!<The offset of the subframe from the subframe of the resource selection
+      uint16_t rbStart; //!<The index of the first RB of the resource
+      uint16_t rbLen; //!<The number of RBs of the resource
+    };
+
+    /**
+     * Read-only view over the precomputed candidate resources of a selection window.
+     * The view does not own the resources, which are stored in tables shared by all the
+     * pools with the same configuration and never released.
+     */
+    class CandidateResourceView {
+    public:
+      CandidateResourceView (void);
+      /**
+       * \param subframe The subframe of the resource selection
+       * \param begin The first candidate resource of the window
+       * \param end Past the last candidate resource of the window
+       */
+      CandidateResourceView (SubframeInfo subframe, const CandidateResource* begin, const CandidateResource* end);
+
+      /** \return the first candidate resource of the window */
+      const CandidateResource* begin (void) const { return m_begin; }
+      /** \return past the last candidate resource of the window */
+      const CandidateResource* end (void) const { return m_end; }
+      /** \return the number of candidate resources of the window */
+      size_t size (void) const { return m_end - m_begin; }
+      /** \return true if the window does not contain any candidate resource */
+      bool empty (void) const { return m_begin == m_end; }
+
+      /**
+       * Returns the absolute location of a subframe of the window
+       * \param sfOffset The offset of the subframe from the subframe of the resource selection
+       * \return the absolute location of the subframe
+       */
+      SubframeInfo GetSubframe (uint16_t sfOffset) const;
+      /**
+       * Returns the absolute location of a candidate resource
+       * \param resource A candidate resource of the window
+       * \return the location of the resource in time and frequency
+       */
+      SidelinkTransmissionInfo GetTransmissionInfo (const CandidateResource& resource) const;
+
+    private:
+      uint32_t m_sfIndex; //!<The index (0..10239) of the subframe of the resource selection
+      const CandidateResource* m_begin; //!<The first candidate resource of the window
+      const CandidateResource* m_end; //!<Past the last candidate resource of the window
+    };
+
     SidelinkCommResourcePoolV2x (void);
     virtual ~SidelinkCommResourcePoolV2x (void);
     static TypeId GetTypeId (void);
@@ -431,6 +482,17 @@ namespace ns3 {
      */
     std::list<SidelinkTransmissionInfo> GetCandidateResources (SubframeInfo startSelectionWindow, uint16_t t1, uint16_t t2, uint16_t subchLen);
 
+    /**
+     * Returns a view over the candidate resources for SPS, without copying them.
+     * The resources are ordered by subframe and then by first subchannel, as the ones returned by GetCandidateResources
+     * \param startSelectionWindow The actual subframe
+     * \param t1 T1 value for defining the selection window
+     * \param t2 T2 value for defining the selection window
+     * \param subchLen The length of allocated subchannels for transmission
+     * \return the view over the candidate resources for SPS
+     */
+    CandidateResourceView GetCandidateResourceView (SubframeInfo startSelectionWindow, uint16_t t1, uint16_t t2, uint16_t subchLen) const;
+
      /**
      * Returns the subframes and RBs associated with the transmission on PSSCH
      * \param subframe The actual subframe
@@ -497,6 +559,11 @@ namespace ns3 {
      * Compute the frame/RBS that are part of the PSSCH pool
      */
     void ComputeNumberOfPsschResources ();
+    /**
+     * Get the table of the candidate resources of the pool configuration, computing it if no
+     * pool with the same configuration did it before
+     */
+    void ComputeCandidateResources ();
 
     /**
      * \brief See 36.213 section 14.2.1 V15.0.0  
@@ -517,6 +584,12 @@ namespace ns3 {
 
     bool m_preconfigured; // indicates if the pool is preconfigured
 
+    /**
+     * Candidate resources for each subchannel length (index subchLen - 1), for the subframe offsets 0 to 100,
+     * ordered by subframe offset and then by first subchannel
+     */
+    const std::vector<std::vector<CandidateResource> >* m_candidateResources;
+
   }; 
 
   /**
@@ -0,0 +1,327 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "cv2x_spectrum-value-kernels.h"
+#include <ns3/spectrum-value.h>
+#include <ns3/log.h>
+#include <cstddef>
+#include <vector>
+
+#if (defined (__x86_64__) || defined (__i386__)) && (defined (__GNUC__) || defined (__clang__))
+#define CV2X_SVK_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_SpectrumValueKernels");
+
+namespace {
+
+typedef void (*BinaryKernel) (double *dst, const double *src, size_t n);
+typedef void (*ScaledKernel) (double *dst, const double *src, double k, size_t n);
+typedef void (*ScalarKernel) (double *dst, double k, size_t n);
+typedef void (*SinrKernel) (double *interf, double *sinr, const double *all, const double *rx, const double *noise, size_t n);
+
+typedef struct _kernelSet {
+  BinaryKernel add;
+  BinaryKernel sub;
+  BinaryKernel mul;
+  BinaryKernel div;
+  ScaledKernel addScaled;
+  ScalarKernel divScalar;
+  SinrKernel sinr;
+  const char *name;
+} kernelSet_t;
+
+// Scalar implementation, also used for the tails of the vectorized ones
+#define CV2X_SVK_SCALAR_BINARY(name, op) \
+  void name (double *dst, const double *src, size_t n) \
+  { \
+    for (size_t i = 0; i < n; i++) \
+      { \
+        dst[i] = dst[i] op src[i]; \
+      } \
+  }
+
+CV2X_SVK_SCALAR_BINARY (AddScalar, +)
+CV2X_SVK_SCALAR_BINARY (SubScalar, -)
+CV2X_SVK_SCALAR_BINARY (MulScalar, *)
+CV2X_SVK_SCALAR_BINARY (DivScalar, /)
+
+void
+AddScaledScalar (double *dst, const double *src, double k, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      double scaled = src[i] * k;
+      dst[i] = dst[i] + scaled;
+    }
+}
+
+void
+DivByScalarScalar (double *dst, double k, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      dst[i] = dst[i] / k;
+    }
+}
+
+void
+SinrScalar (double *interf, double *sinr, const double *all, const double *rx, const double *noise, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    {
+      interf[i] = (all[i] - rx[i]) + noise[i];
+      sinr[i] = rx[i] / interf[i];
+    }
+}
+
+const kernelSet_t g_scalarKernels = {AddScalar, SubScalar, MulScalar, DivScalar,
+                                     AddScaledScalar, DivByScalarScalar, SinrScalar, "scalar"};
+
+#ifdef CV2X_SVK_X86
+// Vectorized implementations: 'width' doubles are processed at each iteration, the remaining ones with the scalar code
+#define CV2X_SVK_VECTOR_KERNELS(suffix, isa, vec, width, load, store, add, sub, mul, div, set1) \
+  __attribute__ ((target (isa))) void \
+  Add ## suffix (double *dst, const double *src, size_t n) \
+  { \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, add (load (dst + i), load (src + i))); \
+      } \
+    AddScalar (dst + i, src + i, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  Sub ## suffix (double *dst, const double *src, size_t n) \
+  { \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, sub (load (dst + i), load (src + i))); \
+      } \
+    SubScalar (dst + i, src + i, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  Mul ## suffix (double *dst, const double *src, size_t n) \
+  { \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, mul (load (dst + i), load (src + i))); \
+      } \
+    MulScalar (dst + i, src + i, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  Div ## suffix (double *dst, const double *src, size_t n) \
+  { \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, div (load (dst + i), load (src + i))); \
+      } \
+    DivScalar (dst + i, src + i, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  AddScaled ## suffix (double *dst, const double *src, double k, size_t n) \
+  { \
+    vec kv = set1 (k); \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, add (load (dst + i), mul (load (src + i), kv))); \
+      } \
+    AddScaledScalar (dst + i, src + i, k, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  DivByScalar ## suffix (double *dst, double k, size_t n) \
+  { \
+    vec kv = set1 (k); \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        store (dst + i, div (load (dst + i), kv)); \
+      } \
+    DivByScalarScalar (dst + i, k, n - i); \
+  } \
+  __attribute__ ((target (isa))) void \
+  Sinr ## suffix (double *interf, double *sinr, const double *all, const double *rx, const double *noise, size_t n) \
+  { \
+    size_t i = 0; \
+    for (; i + width <= n; i += width) \
+      { \
+        vec r = load (rx + i); \
+        vec in = add (sub (load (all + i), r), load (noise + i)); \
+        store (interf + i, in); \
+        store (sinr + i, div (r, in)); \
+      } \
+    SinrScalar (interf + i, sinr + i, all + i, rx + i, noise + i, n - i); \
+  }
+
+CV2X_SVK_VECTOR_KERNELS (Sse2, "sse2", __m128d, 2, _mm_loadu_pd, _mm_storeu_pd,
+                         _mm_add_pd, _mm_sub_pd, _mm_mul_pd, _mm_div_pd, _mm_set1_pd)
+CV2X_SVK_VECTOR_KERNELS (Avx2, "avx2", __m256d, 4, _mm256_loadu_pd, _mm256_storeu_pd,
+                         _mm256_add_pd, _mm256_sub_pd, _mm256_mul_pd, _mm256_div_pd, _mm256_set1_pd)
+
+const kernelSet_t g_sse2Kernels = {AddSse2, SubSse2, MulSse2, DivSse2,
+                                   AddScaledSse2, DivByScalarSse2, SinrSse2, "sse2"};
+const kernelSet_t g_avx2Kernels = {AddAvx2, SubAvx2, MulAvx2, DivAvx2,
+                                   AddScaledAvx2, DivByScalarAvx2, SinrAvx2, "avx2"};
+#endif
+
+// Implementations supported by the CPU, from the fastest one
+std::vector<const kernelSet_t *>
+DetectKernels (void)
+{
+  std::vector<const kernelSet_t *> available;
+#ifdef CV2X_SVK_X86
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    {
+      available.push_back (&g_avx2Kernels);
+    }
+  if (__builtin_cpu_supports ("sse2"))
+    {
+      available.push_back (&g_sse2Kernels);
+    }
+#endif
+  available.push_back (&g_scalarKernels);
+  return available;
+}
+
+const std::vector<const kernelSet_t *> &
+AvailableKernels (void)
+{
+  static const std::vector<const kernelSet_t *> available = DetectKernels ();
+  return available;
+}
+
+const kernelSet_t *&
+ActiveKernels (void)
+{
+  static const kernelSet_t *kernels = AvailableKernels ().front ();
+  return kernels;
+}
+
+inline const kernelSet_t &
+GetKernels (void)
+{
+  return *ActiveKernels ();
+}
+
+// The kernels never access the data of a SpectrumValue without bands
+inline double *
+Data (SpectrumValue &v)
+{
+  return v.GetValuesN () > 0 ? &(*v.ValuesBegin ()) : nullptr;
+}
+
+inline const double *
+Data (const SpectrumValue &v)
+{
+  return v.GetValuesN () > 0 ? &(*v.ConstValuesBegin ()) : nullptr;
+}
+
+} // unnamed namespace
+
+void
+cv2x_SpectrumValueKernels::Add (SpectrumValue &dst, const SpectrumValue &src)
+{
+  NS_ASSERT (dst.GetSpectrumModelUid () == src.GetSpectrumModelUid ());
+  GetKernels ().add (Data (dst), Data (src), dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::Subtract (SpectrumValue &dst, const SpectrumValue &src)
+{
+  NS_ASSERT (dst.GetSpectrumModelUid () == src.GetSpectrumModelUid ());
+  GetKernels ().sub (Data (dst), Data (src), dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::Multiply (SpectrumValue &dst, const SpectrumValue &src)
+{
+  NS_ASSERT (dst.GetSpectrumModelUid () == src.GetSpectrumModelUid ());
+  GetKernels ().mul (Data (dst), Data (src), dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::Divide (SpectrumValue &dst, const SpectrumValue &src)
+{
+  NS_ASSERT (dst.GetSpectrumModelUid () == src.GetSpectrumModelUid ());
+  GetKernels ().div (Data (dst), Data (src), dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::AddScaled (SpectrumValue &dst, const SpectrumValue &src, double k)
+{
+  NS_ASSERT (dst.GetSpectrumModelUid () == src.GetSpectrumModelUid ());
+  GetKernels ().addScaled (Data (dst), Data (src), k, dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::DivideByScalar (SpectrumValue &dst, double k)
+{
+  GetKernels ().divScalar (Data (dst), k, dst.GetValuesN ());
+}
+
+void
+cv2x_SpectrumValueKernels::InterferenceAndSinr (SpectrumValue &interf, SpectrumValue &sinr,
+                                                const SpectrumValue &allSignals, const SpectrumValue &rx,
+                                                const SpectrumValue &noise)
+{
+  NS_ASSERT (interf.GetSpectrumModelUid () == rx.GetSpectrumModelUid ());
+  NS_ASSERT (sinr.GetSpectrumModelUid () == rx.GetSpectrumModelUid ());
+  NS_ASSERT (allSignals.GetSpectrumModelUid () == rx.GetSpectrumModelUid ());
+  NS_ASSERT (noise.GetSpectrumModelUid () == rx.GetSpectrumModelUid ());
+  GetKernels ().sinr (Data (interf), Data (sinr), Data (allSignals), Data (rx), Data (noise), rx.GetValuesN ());
+}
+
+std::string
+cv2x_SpectrumValueKernels::GetImplementation (void)
+{
+  return GetKernels ().name;
+}
+
+std::vector<std::string>
+cv2x_SpectrumValueKernels::GetAvailableImplementations (void)
+{
+  std::vector<std::string> names;
+  for (const kernelSet_t *kernels : AvailableKernels ())
+    {
+      names.push_back (kernels->name);
+    }
+  return names;
+}
+
+bool
+cv2x_SpectrumValueKernels::SetImplementation (const std::string &name)
+{
+  for (const kernelSet_t *kernels : AvailableKernels ())
+    {
+      if (name == kernels->name)
+        {
+          NS_LOG_INFO ("Using the " << name << " implementation of the kernels");
+          ActiveKernels () = kernels;
+          return true;
+        }
+    }
+  return false;
+}
+
+} // namespace ns3
@@ -28,6 +28,7 @@
 #include <ns3/double.h>
 #include "ns3/uinteger.h"
 #include <fstream>
+#include <tuple>
 #include <ns3/simulator.h>
 
 namespace ns3 {
@@ -39,18 +40,19 @@ NS_OBJECT_ENSURE_REGISTERED (cv2x_TraceFadingLossModel);
 
 
 cv2x_TraceFadingLossModel::cv2x_TraceFadingLossModel ()
-  : m_streamsAssigned (false)
+  : m_windowEpoch (0),
+    m_streamsAssigned (false)
 {
   NS_LOG_FUNCTION (this);
   SetNext (NULL);
+  m_startVariable = CreateObject<UniformRandomVariable> ();
 }
 
 
 cv2x_TraceFadingLossModel::~cv2x_TraceFadingLossModel ()
 {
-  m_fadingTrace.clear ();
+  m_fadingTrace.reset ();
   m_windowOffsetsMap.clear ();
-  m_startVariableMap.clear ();
 }
 
 
@@ -87,7 +89,7 @@ cv2x_TraceFadingLossModel::GetTypeId (void)
                    MakeUintegerAccessor (&cv2x_TraceFadingLossModel::m_rbNum),
                    MakeUintegerChecker<uint8_t> ())
     .AddAttribute ("RngStreamSetSize",
-                    "The number of RNG streams reserved for the fading model. The maximum number of streams that are needed for an LTE FDD scenario is 2 * numUEs * numeNBs.",
+                    "The number of RNG streams reserved for the fading model. All the channel realizations share the first stream.",
                     UintegerValue (200000),
                    MakeUintegerAccessor (&cv2x_TraceFadingLossModel::m_streamSetSize),
                    MakeUintegerChecker<uint64_t> ())
@@ -116,34 +118,49 @@ cv2x_TraceFadingLossModel::DoInitialize ()
 }
 
 
-void
-cv2x_TraceFadingLossModel::LoadTrace ()
+std::shared_ptr<const cv2x_TraceFadingLossModel::FadingTrace>
+cv2x_TraceFadingLossModel::GetSharedTrace (const std::string &fileName, uint8_t rbNum, uint32_t samplesNum)
 {
-  NS_LOG_FUNCTION (this << "Loading Fading Trace " << m_traceFile);
+  static std::map<std::tuple<std::string, uint8_t, uint32_t>, std::shared_ptr<const FadingTrace> > traces;
+
+  auto key = std::make_tuple (fileName, rbNum, samplesNum);
+  auto it = traces.find (key);
+  if (it != traces.end ())
+    {
+      return it->second;
+    }
+
+  NS_LOG_INFO ("Loading Fading Trace " << fileName);
   std::ifstream ifTraceFile;
-  ifTraceFile.open (m_traceFile.c_str (), std::ifstream::in);
-  m_fadingTrace.clear ();
+  ifTraceFile.open (fileName.c_str (), std::ifstream::in);
   if (!ifTraceFile.good ())
     {
-      NS_LOG_INFO (this << " File: " << m_traceFile);
+      NS_LOG_INFO (" File: " << fileName);
       NS_ASSERT_MSG(ifTraceFile.good (), " Fading trace file not found");
     }
 
-//   NS_LOG_INFO (this << " length " << m_traceLength.GetSeconds ());
-//   NS_LOG_INFO (this << " RB " << (uint32_t)m_rbNum << " samples " << m_samplesNum);
-  for (uint32_t i = 0; i < m_rbNum; i++)
+  std::shared_ptr<FadingTrace> trace = std::make_shared<FadingTrace> ();
+  trace->reserve (static_cast<std::size_t> (rbNum) * samplesNum);
+  for (uint32_t i = 0; i < static_cast<uint32_t> (rbNum) * samplesNum; i++)
     {
-      FadingTraceSample rbTimeFadingTrace;
-      for (uint32_t j = 0; j < m_samplesNum; j++)
-        {
-          double sample;
-          ifTraceFile >> sample;
-          rbTimeFadingTrace.push_back (sample);
-        }
-      m_fadingTrace.push_back (rbTimeFadingTrace);
+      double sample;
+      ifTraceFile >> sample;
+      trace->push_back (sample);
     }
+  traces.emplace (key, trace);
+  return trace;
+}
+
+void
+cv2x_TraceFadingLossModel::LoadTrace ()
+{
+  NS_LOG_FUNCTION (this << "Loading Fading Trace " << m_traceFile);
+  m_fadingTrace = GetSharedTrace (m_traceFile, m_rbNum, m_samplesNum);
+  m_startVariable->SetAttribute ("Min", DoubleValue (1.0));
+  m_startVariable->SetAttribute ("Max", DoubleValue ((m_traceLength.GetSeconds () - m_windowSize.GetSeconds ()) * 1000.0));
   m_timeGranularity = m_traceLength.GetMilliSeconds () / m_samplesNum;
   m_lastWindowUpdate = Simulator::Now ();
+  m_windowEpoch = 0;
 }
 
 
@@ -155,40 +172,31 @@ cv2x_TraceFadingLossModel::DoCalcRxPowerSpectralDensity (
 {
   NS_LOG_FUNCTION (this << *txPsd << a << b);
   
-  std::map <ChannelRealizationId_t, int >::iterator itOff;
   ChannelRealizationId_t mobilityPair = std::make_pair (a,b);
-  itOff = m_windowOffsetsMap.find (mobilityPair);
+  auto itOff = m_windowOffsetsMap.find (mobilityPair);
   if (itOff!=m_windowOffsetsMap.end ())
     {
       if (Simulator::Now ().GetSeconds () >= m_lastWindowUpdate.GetSeconds () + m_windowSize.GetSeconds ())
         {
-          // update all the offsets
+          // the offsets of all the realizations expire, each one is renewed
+          // the next time it is used
           NS_LOG_INFO ("Fading Windows Updated");
-          std::map <ChannelRealizationId_t, int >::iterator itOff2;
-          for (itOff2 = m_windowOffsetsMap.begin (); itOff2 != m_windowOffsetsMap.end (); itOff2++)
-            {
-              std::map <ChannelRealizationId_t, Ptr<UniformRandomVariable> >::iterator itVar;
-              itVar = m_startVariableMap.find ((*itOff2).first);
-              (*itOff2).second = (*itVar).second->GetValue ();
-            }
+          ++m_windowEpoch;
           m_lastWindowUpdate = Simulator::Now ();
         }
+      if (itOff->second.m_epoch != m_windowEpoch)
+        {
+          itOff->second.m_offset = m_startVariable->GetValue ();
+          itOff->second.m_epoch = m_windowEpoch;
+        }
     }
   else
     {
       NS_LOG_LOGIC (this << "insert new channel realization, m_windowOffsetMap.size () = " << m_windowOffsetsMap.size ());
-      Ptr<UniformRandomVariable> startV = CreateObject<UniformRandomVariable> ();
-      startV->SetAttribute ("Min", DoubleValue (1.0));
-      startV->SetAttribute ("Max", DoubleValue ((m_traceLength.GetSeconds () - m_windowSize.GetSeconds ()) * 1000.0));
-      if (m_streamsAssigned)
-        {
-          NS_ASSERT_MSG (m_currentStream <= m_lastStream, "not enough streams, consider increasing the StreamSetSize attribute");
-          startV->SetStream (m_currentStream);
-          m_currentStream += 1;
-        }
-      ChannelRealizationId_t mobilityPair = std::make_pair (a,b);
-      m_startVariableMap.insert (std::pair<ChannelRealizationId_t,Ptr<UniformRandomVariable> > (mobilityPair, startV));
-      itOff = m_windowOffsetsMap.insert (std::pair<ChannelRealizationId_t,int> (mobilityPair, startV->GetValue ())).first;
+      WindowOffset offset;
+      offset.m_offset = m_startVariable->GetValue ();
+      offset.m_epoch = m_windowEpoch;
+      itOff = m_windowOffsetsMap.emplace (mobilityPair, offset).first;
     }
 
   
@@ -201,18 +209,18 @@ cv2x_TraceFadingLossModel::DoCalcRxPowerSpectralDensity (
   //double speed = std::sqrt (std::pow (aSpeedVector.x-bSpeedVector.x,2) + std::pow (aSpeedVector.y-bSpeedVector.y,2));
 
   NS_LOG_LOGIC (this << *rxPsd);
-  NS_ASSERT (!m_fadingTrace.empty ());
+  NS_ASSERT (m_fadingTrace && !m_fadingTrace->empty ());
   int now_ms = static_cast<int> (Simulator::Now ().GetMilliSeconds () * m_timeGranularity);
   int lastUpdate_ms = static_cast<int> (m_lastWindowUpdate.GetMilliSeconds () * m_timeGranularity);
-  int index = ((*itOff).second + now_ms - lastUpdate_ms) % m_samplesNum;
+  int index = (itOff->second.m_offset + now_ms - lastUpdate_ms) % m_samplesNum;
   int subChannel = 0;
   while (vit != rxPsd->ValuesEnd ())
     {
-      NS_ASSERT (subChannel < 100);
+      NS_ASSERT (subChannel < m_rbNum);
       if (*vit != 0.)
         {
-          double fading = m_fadingTrace.at (subChannel).at (index);
-          NS_LOG_INFO (this << " FADING now " << now_ms << " offset " << (*itOff).second << " id " << index << " fading " << fading);
+          double fading = (*m_fadingTrace)[static_cast<std::size_t> (subChannel) * m_samplesNum + index];
+          NS_LOG_INFO (this << " FADING now " << now_ms << " offset " << itOff->second.m_offset << " id " << index << " fading " << fading);
           double power = *vit; // in Watt/Hz
           power = 10 * std::log10 (180000 * power); // in dB
 
@@ -239,18 +247,7 @@ cv2x_TraceFadingLossModel::AssignStreams (int64_t stream)
   NS_LOG_FUNCTION (this << stream);
   NS_ASSERT (m_streamsAssigned == false);  
   m_streamsAssigned = true;
-  m_currentStream = stream;
-  m_lastStream = stream + m_streamSetSize - 1;
-  std::map <ChannelRealizationId_t, Ptr<UniformRandomVariable> >::iterator itVar;
-  itVar = m_startVariableMap.begin ();
-  // the following loop is for eventually pre-existing ChannelRealization instances
-  // note that more instances are expected to be created at run time
-  while (itVar!=m_startVariableMap.end ())
-    {
-      NS_ASSERT_MSG (m_currentStream <= m_lastStream, "not enough streams, consider increasing the StreamSetSize attribute");
-      (*itVar).second->SetStream (m_currentStream);
-      m_currentStream += 1;
-    }
+  m_startVariable->SetStream (stream);
   return m_streamSetSize;
 }
 
@@ -27,6 +27,9 @@
 #include <ns3/object.h>
 #include <ns3/spectrum-propagation-loss-model.h>
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 #include "ns3/random-variable-stream.h"
 #include <ns3/nstime.h>
 
@@ -60,6 +63,19 @@ public:
    */
   typedef std::pair<Ptr<const MobilityModel>, Ptr<const MobilityModel> > ChannelRealizationId_t;
 
+  /**
+   * hash function for ChannelRealizationId_t
+   */
+  struct ChannelRealizationIdHash
+  {
+    std::size_t operator() (const ChannelRealizationId_t& id) const
+    {
+      std::size_t ha = std::hash<const MobilityModel*> () (PeekPointer (id.first));
+      std::size_t hb = std::hash<const MobilityModel*> () (PeekPointer (id.second));
+      return ha ^ (hb + 0x9e3779b97f4a7c15ULL + (ha << 6) + (ha >> 2));
+    }
+  };
+
  /**
   * Assign a fixed random variable stream number to the random variables
   * used by this model.  Return the number of streams (possibly zero) that
@@ -72,6 +88,9 @@ public:
 
   
 private:
+  /// allow cv2x_LteTraceFadingLossModelTestCase class friend access
+  friend class cv2x_LteTraceFadingLossModelTestCase;
+
   /**
    * \param txPsd set of values vs frequency representing the
    *              transmission power. See SpectrumChannel for details.
@@ -106,26 +125,43 @@ private:
   /// Load trace function
   void LoadTrace ();
 
+  /**
+   * Fading samples of all the RBs, stored RB after RB (the sample j of
+   * the RB i is at index i * samplesNum + j)
+   */
+  typedef std::vector<double> FadingTrace;
 
-   
-  mutable std::map <ChannelRealizationId_t, int > m_windowOffsetsMap; ///< windows offsets map
-  
-  mutable std::map <ChannelRealizationId_t, Ptr<UniformRandomVariable> > m_startVariableMap; ///< start variable map
-  
   /**
-   * Vector with fading samples in time domain (for a fixed RB)
+   * \brief Get the fading trace read from a file
+   *
+   * Each trace file is read only once per process, and the trace is shared
+   * (read-only) by all the models using it.
+   *
+   * \param fileName the trace file
+   * \param rbNum the number of RBs of the trace
+   * \param samplesNum the number of samples per RB
+   * \return the fading trace
    */
-  typedef std::vector<double> FadingTraceSample;
+  static std::shared_ptr<const FadingTrace> GetSharedTrace (const std::string &fileName,
+                                                            uint8_t rbNum, uint32_t samplesNum);
+
   /**
-   * Vector collecting the time fading traces in the frequency domain (per RB)
+   * Window offset of a channel realization, valid in the window epoch in
+   * which it was drawn
    */
-  typedef std::vector<FadingTraceSample> FadingTrace;
+  struct WindowOffset
+  {
+    int m_offset;     ///< offset in the fading trace
+    uint64_t m_epoch; ///< window epoch of the offset
+  };
 
+  mutable std::unordered_map <ChannelRealizationId_t, WindowOffset, ChannelRealizationIdHash> m_windowOffsetsMap; ///< windows offsets map
+
+  Ptr<UniformRandomVariable> m_startVariable; ///< window offset random variable, shared by all the channel realizations
 
-  
   std::string m_traceFile; ///< the trace file name
   
-  FadingTrace m_fadingTrace; ///< fading trace
+  std::shared_ptr<const FadingTrace> m_fadingTrace; ///< fading trace
 
   
   Time m_traceLength; ///< the trace time
@@ -133,11 +169,10 @@ private:
   Time m_windowSize; ///< window size
   uint8_t m_rbNum; ///< RB number
   mutable Time m_lastWindowUpdate; ///< time of last window update
+  mutable uint64_t m_windowEpoch; ///< number of window updates
   uint8_t m_timeGranularity; ///< time granularity
-  mutable uint64_t m_currentStream; ///< the current stream
-  mutable uint64_t m_lastStream; ///< the last stream
   uint64_t m_streamSetSize; ///< stream set size
-  mutable bool m_streamsAssigned; ///< is streams assigned?
+  bool m_streamsAssigned; ///< is streams assigned?
   
 };
 
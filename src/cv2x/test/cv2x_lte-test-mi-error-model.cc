@@ -0,0 +1,211 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/spectrum-model.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/cv2x_lte-mi-error-model.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteMiErrorModelTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks that one SINR to MI implementation of cv2x_LteMiErrorModel
+ * (AVX2 or scalar) gives exactly the same MI and TBLER as the scalar one, for
+ * a table of MCSs, RB sets and SINRs, with and without the interpolation of
+ * the MI tables, the SIMO gain and a HARQ history.
+ */
+class cv2x_LteMiErrorModelImplementationTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param implementation the name of the implementation to be tested
+   */
+  cv2x_LteMiErrorModelImplementationTestCase (std::string implementation);
+  virtual ~cv2x_LteMiErrorModelImplementationTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  /// A TB of the table
+  typedef struct _tbCase {
+    uint8_t mcs;        ///< MCS
+    uint16_t size;      ///< TB size in bytes
+    int firstRb;        ///< first RB of the TB
+    int numRbs;         ///< number of RBs of the TB
+    int rbStep;         ///< distance between two consecutive RBs of the TB
+    double sinrDb;      ///< SINR of the first RB, in dB
+    double slopeDb;     ///< SINR increment from one RB of the TB to the next one, in dB
+  } tbCase_t;
+
+  std::string m_implementation; ///< the implementation to be tested
+  std::string m_defaultImplementation; ///< the implementation selected by default, restored at the end of the test
+  bool m_defaultInterpolation; ///< the interpolation setting, restored at the end of the test
+};
+
+cv2x_LteMiErrorModelImplementationTestCase::cv2x_LteMiErrorModelImplementationTestCase (std::string implementation)
+  : TestCase ("MI error model, " + implementation + " SINR to MI implementation"),
+    m_implementation (implementation),
+    m_defaultInterpolation (false)
+{
+}
+
+cv2x_LteMiErrorModelImplementationTestCase::~cv2x_LteMiErrorModelImplementationTestCase ()
+{
+}
+
+void
+cv2x_LteMiErrorModelImplementationTestCase::DoRun (void)
+{
+  m_defaultImplementation = cv2x_LteMiErrorModel::GetImplementation ();
+  m_defaultInterpolation = cv2x_LteMiErrorModel::GetMiInterpolation ();
+
+  const int numRbs = 50;
+  std::vector<double> freqs;
+  for (int i = 0; i < numRbs; i++)
+    {
+      freqs.push_back (5.9e9 + i * 180e3);
+    }
+  Ptr<SpectrumModel> model = Create<SpectrumModel> (freqs);
+
+  // One modulation per group of rows, with SINRs below, inside and above the range of its MI table, and RB sets
+  // covering the 4-RB vector loop and its scalar tail (1, 2, 3, 5, 7 RBs), non contiguous RBs and the whole band
+  const tbCase_t cases[] = {
+    {0, 20, 0, 1, 1, -15.0, 0.0},
+    {2, 40, 3, 3, 1, -3.0, 1.5},
+    {5, 100, 10, 5, 2, 0.0, 0.7},
+    {9, 300, 0, 16, 3, 4.0, -0.4},
+    {9, 800, 0, numRbs, 1, 25.0, 0.0},
+    {10, 150, 7, 7, 1, 5.0, 0.3},
+    {13, 400, 20, 10, 2, 8.0, 0.5},
+    {16, 1000, 0, numRbs, 1, 10.0, 0.2},
+    {17, 200, 1, 2, 4, 12.0, 1.0},
+    {20, 700, 5, 20, 2, 15.0, -0.3},
+    {24, 1500, 0, numRbs, 1, 18.0, 0.1},
+    {28, 2000, 12, 13, 1, 22.0, 0.8},
+    {28, 3000, 0, numRbs, 1, 40.0, 0.0}
+  };
+
+  // Same random SINR fluctuations on the RBs for all the implementations
+  std::mt19937 gen (1);
+  std::normal_distribution<double> fluctuationDb (0.0, 2.0);
+
+  for (bool interpolation : {false, true})
+    {
+      for (const tbCase_t &tb : cases)
+        {
+          SpectrumValue sinr (model);
+          std::vector<int> map;
+          for (int i = 0; i < numRbs; i++)
+            {
+              sinr[i] = std::pow (10.0, (tb.sinrDb + fluctuationDb (gen)) / 10.0);
+            }
+          for (int i = 0; i < tb.numRbs && tb.firstRb + i * tb.rbStep < numRbs; i++)
+            {
+              int rb = tb.firstRb + i * tb.rbStep;
+              sinr[rb] = std::pow (10.0, (tb.sinrDb + i * tb.slopeDb) / 10.0);
+              map.push_back (rb);
+            }
+
+          // A previous transmission of the TB, with a lower MI
+          HarqProcessInfoList_t harq;
+          cv2x_HarqProcessInfoElement_t el;
+          el.m_mi = 0.4;
+          el.m_rv = 0;
+          el.m_infoBits = tb.size * 8;
+          el.m_codeBits = tb.size * 8 * 2;
+          harq.push_back (el);
+
+          for (double sinrGain : {1.0, 2.0})
+            {
+              for (const HarqProcessInfoList_t &history : {HarqProcessInfoList_t (), harq})
+                {
+                  cv2x_LteMiErrorModel::SetMiInterpolation (interpolation);
+
+                  cv2x_LteMiErrorModel::SetImplementation ("scalar");
+                  double expectedMib = cv2x_LteMiErrorModel::Mib (sinr, map, tb.mcs, sinrGain);
+                  cv2x_TbStats_t expected = cv2x_LteMiErrorModel::GetTbDecodificationStats (sinr, map, tb.size, tb.mcs,
+                                                                                            history, sinrGain);
+
+                  NS_TEST_ASSERT_MSG_EQ (cv2x_LteMiErrorModel::SetImplementation (m_implementation), true,
+                                         "Cannot select the " << m_implementation << " implementation");
+                  double mib = cv2x_LteMiErrorModel::Mib (sinr, map, tb.mcs, sinrGain);
+                  cv2x_TbStats_t stats = cv2x_LteMiErrorModel::GetTbDecodificationStats (sinr, map, tb.size, tb.mcs,
+                                                                                         history, sinrGain);
+
+                  std::ostringstream desc;
+                  desc << "MCS " << +tb.mcs << ", " << map.size () << " RBs from " << tb.firstRb << " every "
+                       << tb.rbStep << ", SINR " << tb.sinrDb << " dB, gain " << sinrGain << ", "
+                       << history.size () << " past transmissions, interpolation " << interpolation;
+                  NS_TEST_ASSERT_MSG_EQ (mib, expectedMib, "Different Mib with the " << m_implementation
+                                         << " implementation: " << desc.str ());
+                  NS_TEST_ASSERT_MSG_EQ (stats.mi, expected.mi, "Different TB MI with the " << m_implementation
+                                         << " implementation: " << desc.str ());
+                  NS_TEST_ASSERT_MSG_EQ (stats.tbler, expected.tbler, "Different TBLER with the " << m_implementation
+                                         << " implementation: " << desc.str ());
+                }
+            }
+        }
+    }
+}
+
+void
+cv2x_LteMiErrorModelImplementationTestCase::DoTeardown (void)
+{
+  cv2x_LteMiErrorModel::SetImplementation (m_defaultImplementation);
+  cv2x_LteMiErrorModel::SetMiInterpolation (m_defaultInterpolation);
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the SINR to MI implementations of cv2x_LteMiErrorModel,
+ * with one test case for each implementation supported by the CPU running the
+ * test.
+ */
+class cv2x_LteMiErrorModelTestSuite : public TestSuite
+{
+public:
+  cv2x_LteMiErrorModelTestSuite ();
+};
+
+cv2x_LteMiErrorModelTestSuite::cv2x_LteMiErrorModelTestSuite ()
+  : TestSuite ("lte-mi-error-model", UNIT)
+{
+  for (const std::string &implementation : cv2x_LteMiErrorModel::GetAvailableImplementations ())
+    {
+      AddTestCase (new cv2x_LteMiErrorModelImplementationTestCase (implementation), TestCase::QUICK);
+    }
+}
+
+static cv2x_LteMiErrorModelTestSuite g_cv2xLteMiErrorModelTestSuite; ///< the test suite
+
+} // namespace ns3
@@ -0,0 +1,214 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/spectrum-model.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/cv2x_spectrum-value-kernels.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteSpectrumValueKernelsTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks that one implementation of cv2x_SpectrumValueKernels (scalar,
+ * SSE2 or AVX2) gives exactly the same bands as the SpectrumValue operators,
+ * for numbers of bands covering the vectorized loops and their scalar tails.
+ */
+class cv2x_LteSpectrumValueKernelsTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param implementation the name of the implementation to be tested
+   */
+  cv2x_LteSpectrumValueKernelsTestCase (std::string implementation);
+  virtual ~cv2x_LteSpectrumValueKernelsTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  /**
+   * Fill a SpectrumValue with random values
+   *
+   * \param v the SpectrumValue
+   * \param nonZero whether the values are used as divisors
+   */
+  void Fill (SpectrumValue &v, bool nonZero);
+
+  /**
+   * Check that the bands of two SpectrumValues are exactly the same
+   *
+   * \param actual the result of the kernel
+   * \param expected the result of the SpectrumValue operators
+   * \param op the name of the operation
+   */
+  void CheckEqual (const SpectrumValue &actual, const SpectrumValue &expected, std::string op);
+
+  std::string m_implementation; ///< the implementation to be tested
+  std::string m_defaultImplementation; ///< the implementation selected by default, restored at the end of the test
+  std::mt19937 m_gen; ///< random generator of the values
+};
+
+cv2x_LteSpectrumValueKernelsTestCase::cv2x_LteSpectrumValueKernelsTestCase (std::string implementation)
+  : TestCase ("SpectrumValue kernels, " + implementation + " implementation"),
+    m_implementation (implementation),
+    m_gen (12345)
+{
+}
+
+cv2x_LteSpectrumValueKernelsTestCase::~cv2x_LteSpectrumValueKernelsTestCase ()
+{
+}
+
+void
+cv2x_LteSpectrumValueKernelsTestCase::Fill (SpectrumValue &v, bool nonZero)
+{
+  // Values spanning several orders of magnitude, as the power spectral densities in W/Hz
+  std::uniform_real_distribution<double> mantissa (nonZero ? 0.1 : -1.0, 1.0);
+  std::uniform_int_distribution<int> exponent (-21, 3);
+  std::bernoulli_distribution negative (0.5);
+
+  for (Values::iterator it = v.ValuesBegin (); it != v.ValuesEnd (); it++)
+    {
+      *it = mantissa (m_gen) * std::pow (10.0, exponent (m_gen));
+      if (nonZero && negative (m_gen))
+        {
+          *it = -*it;
+        }
+    }
+}
+
+void
+cv2x_LteSpectrumValueKernelsTestCase::CheckEqual (const SpectrumValue &actual, const SpectrumValue &expected, std::string op)
+{
+  NS_TEST_ASSERT_MSG_EQ (actual.GetValuesN (), expected.GetValuesN (), op << ": wrong number of bands");
+  for (size_t i = 0; i < expected.GetValuesN (); i++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (actual[i], expected[i], op << " (" << m_implementation << ") differs from the "
+                             << "SpectrumValue operator in band " << i << " of " << expected.GetValuesN ());
+    }
+}
+
+void
+cv2x_LteSpectrumValueKernelsTestCase::DoRun (void)
+{
+  m_defaultImplementation = cv2x_SpectrumValueKernels::GetImplementation ();
+  NS_TEST_ASSERT_MSG_EQ (cv2x_SpectrumValueKernels::SetImplementation (m_implementation), true,
+                         "Cannot select the " << m_implementation << " implementation");
+  NS_TEST_ASSERT_MSG_EQ (cv2x_SpectrumValueKernels::GetImplementation (), m_implementation,
+                         "Wrong implementation in use");
+
+  // Numbers of bands around the vector widths (2 doubles for SSE2, 4 for AVX2), and the ones of the LTE bandwidths
+  std::vector<size_t> bands = {1, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 25, 50, 75, 100};
+  for (size_t n : bands)
+    {
+      std::vector<double> freqs;
+      for (size_t i = 0; i < n; i++)
+        {
+          freqs.push_back (5.9e9 + i * 180e3);
+        }
+      Ptr<SpectrumModel> model = Create<SpectrumModel> (freqs);
+
+      SpectrumValue a (model);
+      SpectrumValue b (model);
+      SpectrumValue c (model);
+      SpectrumValue d (model);
+      Fill (a, false);
+      Fill (b, false);
+      Fill (c, true);
+      Fill (d, false);
+      double k = 0.5 + std::uniform_real_distribution<double> (0.0, 1.0) (m_gen);
+
+      SpectrumValue dst = a;
+      cv2x_SpectrumValueKernels::Add (dst, b);
+      CheckEqual (dst, a + b, "Add");
+
+      dst = a;
+      cv2x_SpectrumValueKernels::Subtract (dst, b);
+      CheckEqual (dst, a - b, "Subtract");
+
+      dst = a;
+      cv2x_SpectrumValueKernels::Multiply (dst, b);
+      CheckEqual (dst, a * b, "Multiply");
+
+      dst = a;
+      cv2x_SpectrumValueKernels::Divide (dst, c);
+      CheckEqual (dst, a / c, "Divide");
+
+      dst = a;
+      cv2x_SpectrumValueKernels::AddScaled (dst, b, k);
+      CheckEqual (dst, a + b * k, "AddScaled");
+
+      dst = a;
+      cv2x_SpectrumValueKernels::DivideByScalar (dst, k);
+      CheckEqual (dst, a / k, "DivideByScalar");
+
+      // Received signal included in the sum of all the signals, as in cv2x_LteInterference
+      SpectrumValue rx = b;
+      SpectrumValue allSignals = a + rx;
+      SpectrumValue noise = d * d;
+      SpectrumValue interf (model);
+      SpectrumValue sinr (model);
+      cv2x_SpectrumValueKernels::InterferenceAndSinr (interf, sinr, allSignals, rx, noise);
+      SpectrumValue expectedInterf = (allSignals - rx) + noise;
+      CheckEqual (interf, expectedInterf, "InterferenceAndSinr (interference)");
+      CheckEqual (sinr, rx / expectedInterf, "InterferenceAndSinr (SINR)");
+    }
+}
+
+void
+cv2x_LteSpectrumValueKernelsTestCase::DoTeardown (void)
+{
+  cv2x_SpectrumValueKernels::SetImplementation (m_defaultImplementation);
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of cv2x_SpectrumValueKernels, with one test case for each
+ * implementation supported by the CPU running the test.
+ */
+class cv2x_LteSpectrumValueKernelsTestSuite : public TestSuite
+{
+public:
+  cv2x_LteSpectrumValueKernelsTestSuite ();
+};
+
+cv2x_LteSpectrumValueKernelsTestSuite::cv2x_LteSpectrumValueKernelsTestSuite ()
+  : TestSuite ("lte-spectrum-value-kernels", UNIT)
+{
+  for (const std::string &implementation : cv2x_SpectrumValueKernels::GetAvailableImplementations ())
+    {
+      AddTestCase (new cv2x_LteSpectrumValueKernelsTestCase (implementation), TestCase::QUICK);
+    }
+}
+
+static cv2x_LteSpectrumValueKernelsTestSuite g_cv2xLteSpectrumValueKernelsTestSuite; ///< the test suite
+
+} // namespace ns3
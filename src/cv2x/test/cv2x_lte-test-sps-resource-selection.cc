@@ -0,0 +1,505 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <bitset>
+#include <list>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/cv2x_lte-ue-mac.h>
+#include <ns3/cv2x_sl-pool.h>
+#include <ns3/cv2x_sl-v2x-preconfig-pool-factory.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteUeMacSpsSelectionTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks the sensing-based SPS resource selection of cv2x_LteUeMac
+ * (36.213 section 14.1.1.6) against a list-based implementation of the
+ * exclusion and S-RSSI ranking steps, which compares every transmission of
+ * every candidate with every reservation of every sensed transmission, for a
+ * fixed random sensing history. With partial sensing, it also checks the
+ * candidate subframes (Y) and the monitored subframes selected according to
+ * PartialSensingMinNumCandidateSf and PartialSensingGapCandidateSensing.
+ */
+class cv2x_LteUeMacSpsSelectionTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param subchLen the number of subchannels of the candidate resources
+   * \param frameNo the frame of the resource selection
+   * \param subframeNo the subframe of the resource selection
+   */
+  cv2x_LteUeMacSpsSelectionTestCase (uint8_t subchLen, uint32_t frameNo, uint32_t subframeNo);
+  virtual ~cv2x_LteUeMacSpsSelectionTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /// List of sidelink transmissions
+  typedef std::list<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> TxList_t;
+
+  /**
+   * Steps 5-8 of the selection, comparing all the transmissions one by one
+   *
+   * \param csrA all the candidate resources
+   * \param sensing the sensed transmissions to consider
+   * \returns the candidates which are not excluded, in the order of csrA, with their S-RSSI metric
+   */
+  std::list<cv2x_LteUeMac::CandidateResource> ListExcludeTxResources (TxList_t csrA,
+                                                                     const std::list<cv2x_LteUeMac::SensingData> &sensing);
+
+  /**
+   * Step 9 of the selection, drawing the random order of the candidates with equal metric
+   * from the random variable of the MAC
+   *
+   * \param remaining the candidates which are not excluded
+   * \param numCsr the number of all the candidate resources
+   * \returns the candidates reported to the higher layers
+   */
+  TxList_t RankTxResources (std::list<cv2x_LteUeMac::CandidateResource> remaining, uint32_t numCsr);
+
+  /**
+   * Check that two lists of transmissions are the same, in the same order
+   *
+   * \param actual the candidates of cv2x_LteUeMac
+   * \param expected the candidates of the list-based selection
+   * \param msg the description of the check
+   */
+  void CheckEqual (const TxList_t &actual, const TxList_t &expected, std::string msg);
+
+  /**
+   * \param frameNo the frame number (1..1024)
+   * \param subframeNo the subframe number (1..10)
+   * \returns the index of the subframe (0..10239)
+   */
+  static uint32_t SubframeIndex (uint32_t frameNo, uint32_t subframeNo);
+
+  uint8_t m_subchLen; ///< the number of subchannels of the candidate resources
+  SidelinkCommResourcePoolV2x::SubframeInfo m_subframe; ///< the subframe of the resource selection
+  Ptr<cv2x_LteUeMac> m_mac; ///< the MAC under test
+};
+
+cv2x_LteUeMacSpsSelectionTestCase::cv2x_LteUeMacSpsSelectionTestCase (uint8_t subchLen, uint32_t frameNo, uint32_t subframeNo)
+  : TestCase ("SPS resource selection, " + std::to_string (subchLen) + " subchannel(s), at " + std::to_string (frameNo)
+              + "/" + std::to_string (subframeNo)),
+    m_subchLen (subchLen)
+{
+  m_subframe.frameNo = frameNo;
+  m_subframe.subframeNo = subframeNo;
+}
+
+cv2x_LteUeMacSpsSelectionTestCase::~cv2x_LteUeMacSpsSelectionTestCase ()
+{
+}
+
+uint32_t
+cv2x_LteUeMacSpsSelectionTestCase::SubframeIndex (uint32_t frameNo, uint32_t subframeNo)
+{
+  return (frameNo - 1) * 10 + subframeNo - 1;
+}
+
+std::list<cv2x_LteUeMac::CandidateResource>
+cv2x_LteUeMacSpsSelectionTestCase::ListExcludeTxResources (TxList_t csrA,
+                                                           const std::list<cv2x_LteUeMac::SensingData> &sensing)
+{
+  uint32_t numCsr = csrA.size ();
+  TxList_t allCsr = csrA;
+  int threshRsrp = -110;
+
+  // Steps 5-7: exclude the candidates overlapping with the reservations of the sensed transmissions
+  // above the threshold, raising the threshold by 3 dB until at least 20% of the candidates remain
+  do
+    {
+      csrA = allCsr;
+      TxList_t::iterator csrIt = csrA.begin ();
+      while (csrIt != csrA.end ())
+        {
+          bool erase = false;
+
+          TxList_t csrTx;
+          SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo csrTransmission = *csrIt;
+          for (uint8_t ctr = 0; ctr < m_mac->m_reselCtr; ctr++)
+            {
+              csrTransmission.subframe.frameNo = csrIt->subframe.frameNo + ctr * m_mac->m_pRsvp / 10;
+              if (csrTransmission.subframe.frameNo > 2048)
+                {
+                  csrTransmission.subframe.frameNo -= 2048;
+                }
+              else if (csrTransmission.subframe.frameNo > 1024)
+                {
+                  csrTransmission.subframe.frameNo -= 1024;
+                }
+              csrTx.push_back (csrTransmission);
+            }
+
+          for (std::list<cv2x_LteUeMac::SensingData>::const_iterator sensingIt = sensing.begin ();
+               sensingIt != sensing.end () && !erase; sensingIt++)
+            {
+              TxList_t sensTx;
+              SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo sensTransmission = sensingIt->m_rxInfo;
+              for (uint8_t ctr = 1; ctr <= 15; ctr++)
+                {
+                  sensTransmission.subframe.frameNo = sensingIt->m_rxInfo.subframe.frameNo + ctr * sensingIt->m_pRsvpRx / 10;
+                  if (sensTransmission.subframe.frameNo > 2048)
+                    {
+                      sensTransmission.subframe.frameNo -= 2048;
+                    }
+                  else if (sensTransmission.subframe.frameNo > 1024)
+                    {
+                      sensTransmission.subframe.frameNo -= 1024;
+                    }
+                  sensTx.push_back (sensTransmission);
+                }
+
+              for (TxList_t::iterator csrTxIt = csrTx.begin (); csrTxIt != csrTx.end () && !erase; csrTxIt++)
+                {
+                  for (TxList_t::iterator sensTxIt = sensTx.begin (); sensTxIt != sensTx.end () && !erase; sensTxIt++)
+                    {
+                      if (csrTxIt->subframe.frameNo != sensTxIt->subframe.frameNo
+                          || csrTxIt->subframe.subframeNo != sensTxIt->subframe.subframeNo)
+                        {
+                          continue;
+                        }
+                      for (int i = csrTxIt->rbStart; i < csrTxIt->rbStart + csrTxIt->rbLen && !erase; i++)
+                        {
+                          for (int j = sensTxIt->rbStart; j < sensTxIt->rbStart + sensTxIt->rbLen && !erase; j++)
+                            {
+                              erase = (i == j && sensingIt->m_slRsrp > threshRsrp);
+                            }
+                        }
+                    }
+                }
+            }
+
+          if (erase)
+            {
+              csrIt = csrA.erase (csrIt);
+            }
+          else
+            {
+              csrIt++;
+            }
+        }
+      threshRsrp += 3;
+    }
+  while (csrA.size () < 0.2 * numCsr);
+
+  // Step 8: linear average of the S-RSSI of the first sensed transmission on the same subframe and
+  // first RB, 100 ms, 200 ms, ... 1000 ms before the candidate
+  std::list<cv2x_LteUeMac::CandidateResource> remaining;
+  for (TxList_t::iterator csrIt = csrA.begin (); csrIt != csrA.end (); csrIt++)
+    {
+      double avgRssi = 0;
+      uint8_t nbTx = 0;
+      uint32_t frameNo = csrIt->subframe.frameNo <= 100 ? 1024 - (100 - csrIt->subframe.frameNo) : csrIt->subframe.frameNo - 100;
+      for (uint8_t i = 0; i < 10; i++)
+        {
+          frameNo += 10;
+          if (frameNo > 1024)
+            {
+              frameNo -= 1024;
+            }
+          for (std::list<cv2x_LteUeMac::SensingData>::const_iterator sensingIt = sensing.begin (); sensingIt != sensing.end (); sensingIt++)
+            {
+              if (frameNo == sensingIt->m_rxInfo.subframe.frameNo && csrIt->subframe.subframeNo == sensingIt->m_rxInfo.subframe.subframeNo
+                  && csrIt->rbStart == sensingIt->m_rxInfo.rbStart)
+                {
+                  nbTx++;
+                  avgRssi += sensingIt->m_slRssi;
+                  break;
+                }
+            }
+        }
+
+      cv2x_LteUeMac::CandidateResource candidate;
+      candidate.m_txInfo = *csrIt;
+      candidate.m_avg_rssi = nbTx != 0 ? avgRssi / nbTx : -200.0;
+      remaining.push_back (candidate);
+    }
+  return remaining;
+}
+
+cv2x_LteUeMacSpsSelectionTestCase::TxList_t
+cv2x_LteUeMacSpsSelectionTestCase::RankTxResources (std::list<cv2x_LteUeMac::CandidateResource> remaining, uint32_t numCsr)
+{
+  std::list<cv2x_LteUeMac::CandidateResource> shuffled;
+  while (remaining.size () != 0)
+    {
+      std::list<cv2x_LteUeMac::CandidateResource>::iterator it = remaining.begin ();
+      std::advance (it, m_mac->m_ueSelectedUniformVariable->GetInteger (0, remaining.size () - 1));
+      shuffled.push_back (*it);
+      remaining.erase (it);
+    }
+  shuffled.sort ([] (const cv2x_LteUeMac::CandidateResource &a, const cv2x_LteUeMac::CandidateResource &b) {
+    return a.m_avg_rssi < b.m_avg_rssi;
+  });
+
+  TxList_t csrB;
+  for (std::list<cv2x_LteUeMac::CandidateResource>::iterator it = shuffled.begin (); it != shuffled.end () && csrB.size () < 0.2 * numCsr; it++)
+    {
+      csrB.push_back (it->m_txInfo);
+    }
+  return csrB;
+}
+
+void
+cv2x_LteUeMacSpsSelectionTestCase::CheckEqual (const TxList_t &actual, const TxList_t &expected, std::string msg)
+{
+  NS_TEST_ASSERT_MSG_EQ (actual.size (), expected.size (), msg << ": wrong number of candidates");
+  TxList_t::const_iterator expectedIt = expected.begin ();
+  for (TxList_t::const_iterator it = actual.begin (); it != actual.end (); it++, expectedIt++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (it->subframe.frameNo, expectedIt->subframe.frameNo, msg << ": wrong frame");
+      NS_TEST_ASSERT_MSG_EQ (it->subframe.subframeNo, expectedIt->subframe.subframeNo, msg << ": wrong subframe");
+      NS_TEST_ASSERT_MSG_EQ (it->rbStart, expectedIt->rbStart, msg << ": wrong first RB");
+      NS_TEST_ASSERT_MSG_EQ (it->rbLen, expectedIt->rbLen, msg << ": wrong number of RBs");
+    }
+}
+
+void
+cv2x_LteUeMacSpsSelectionTestCase::DoRun (void)
+{
+  // Same pool as the V2X scenarios: 3 subchannels of 10 RBs, PSCCH adjacent to the PSSCH
+  cv2x_SlV2xPreconfigPoolFactory pFactory;
+  pFactory.SetHaveUeSelectedResourceConfig (true);
+  pFactory.SetSlSubframe (std::bitset<20> (0xFFFFF));
+  pFactory.SetAdjacencyPscchPssch (true);
+  pFactory.SetSizeSubchannel (10);
+  pFactory.SetNumSubchannel (3);
+  pFactory.SetStartRbSubchannel (0);
+  pFactory.SetStartRbPscchPool (0);
+  pFactory.SetDataTxP0 (-4);
+  pFactory.SetDataTxAlpha (0.9);
+  Ptr<SidelinkCommResourcePoolV2x> pool = CreateObject<SidelinkCommResourcePoolV2x> ();
+  pool->SetPool (pFactory.CreatePool ());
+
+  m_mac = CreateObject<cv2x_LteUeMac> ();
+  m_mac->m_subchLen = m_subchLen;
+  m_mac->m_reselCtr = 5;
+  m_mac->m_pRsvp = 100;
+  cv2x_LteUeMac::PoolInfoV2x poolInfo;
+  poolInfo.m_pool = pool;
+
+  TxList_t allCsr = pool->GetCandidateResources (m_subframe, m_mac->m_t1, m_mac->m_t2, m_subchLen);
+  NS_TEST_ASSERT_MSG_GT (allCsr.size (), 0, "No candidate resources");
+  std::vector<std::pair<uint16_t, uint16_t> > rbs; // first RB and number of RBs of the candidates
+  for (TxList_t::iterator it = allCsr.begin (); it != allCsr.end (); it++)
+    {
+      if (std::find (rbs.begin (), rbs.end (), std::make_pair (it->rbStart, it->rbLen)) == rbs.end ())
+        {
+          rbs.push_back (std::make_pair (it->rbStart, it->rbLen));
+        }
+    }
+
+  // Sensing history of the 1000 subframes before the selection, with reservations of 20 ms to 1 s
+  // (some of them wrapping around the frame numbering), RSRPs around the exclusion thresholds, and
+  // some transmissions received twice on the same subframe and first RB
+  std::mt19937 gen (m_subframe.frameNo * 10 + m_subframe.subframeNo);
+  std::bernoulli_distribution received (0.15);
+  std::bernoulli_distribution duplicate (0.1);
+  std::uniform_int_distribution<size_t> rbIndex (0, rbs.size () - 1);
+  std::uniform_real_distribution<double> rsrp (-116.0, -90.0);
+  std::uniform_real_distribution<double> rssi (-100.0, -60.0);
+  const uint16_t pRsvps[] = {20, 50, 100, 200, 1000};
+  std::uniform_int_distribution<size_t> pRsvpIndex (0, sizeof (pRsvps) / sizeof (pRsvps[0]) - 1);
+  uint32_t selectionSf = SubframeIndex (m_subframe.frameNo, m_subframe.subframeNo);
+  m_mac->m_sensingData.clear ();
+  for (uint32_t d = 1000; d > 0; d--)
+    {
+      uint32_t sf = (selectionSf + 10240 - d) % 10240;
+      for (size_t r = 0; r < rbs.size (); r++)
+        {
+          if (!received (gen))
+            {
+              continue;
+            }
+          cv2x_LteUeMac::SensingData data;
+          data.m_rxInfo.subframe.frameNo = sf / 10 + 1;
+          data.m_rxInfo.subframe.subframeNo = sf % 10 + 1;
+          size_t rb = rbIndex (gen);
+          data.m_rxInfo.rbStart = rbs[rb].first;
+          data.m_rxInfo.rbLen = rbs[rb].second;
+          data.m_prioRx = 0;
+          data.m_pRsvpRx = pRsvps[pRsvpIndex (gen)];
+          data.m_slRsrp = rsrp (gen);
+          data.m_slRssi = rssi (gen);
+          m_mac->m_sensingData.push_back (data);
+          if (duplicate (gen))
+            {
+              data.m_slRsrp = rsrp (gen);
+              data.m_slRssi = rssi (gen);
+              m_mac->m_sensingData.push_back (data);
+            }
+        }
+    }
+
+  // Exclusion and S-RSSI metric of the matrix-based implementation, for all the sensed transmissions
+  std::vector<SidelinkCommResourcePoolV2x::SidelinkTransmissionInfo> csrVec (allCsr.begin (), allCsr.end ());
+  std::vector<const cv2x_LteUeMac::SensingData*> sensedPtrs;
+  for (std::list<cv2x_LteUeMac::SensingData>::iterator it = m_mac->m_sensingData.begin (); it != m_mac->m_sensingData.end (); it++)
+    {
+      sensedPtrs.push_back (&(*it));
+    }
+  std::list<cv2x_LteUeMac::CandidateResource> expectedRemaining = ListExcludeTxResources (allCsr, m_mac->m_sensingData);
+  std::list<cv2x_LteUeMac::CandidateResource> remaining = m_mac->ExcludeTxResources (csrVec, sensedPtrs);
+  NS_TEST_ASSERT_MSG_LT (expectedRemaining.size (), allCsr.size (), "No candidate excluded by the sensing history");
+  NS_TEST_ASSERT_MSG_EQ (remaining.size (), expectedRemaining.size (), "Wrong number of non excluded candidates");
+  std::list<cv2x_LteUeMac::CandidateResource>::iterator expectedIt = expectedRemaining.begin ();
+  for (std::list<cv2x_LteUeMac::CandidateResource>::iterator it = remaining.begin (); it != remaining.end (); it++, expectedIt++)
+    {
+      NS_TEST_ASSERT_MSG_EQ (it->m_txInfo.subframe.frameNo, expectedIt->m_txInfo.subframe.frameNo, "Wrong non excluded candidate");
+      NS_TEST_ASSERT_MSG_EQ (it->m_txInfo.subframe.subframeNo, expectedIt->m_txInfo.subframe.subframeNo, "Wrong non excluded candidate");
+      NS_TEST_ASSERT_MSG_EQ (it->m_txInfo.rbStart, expectedIt->m_txInfo.rbStart, "Wrong non excluded candidate");
+      NS_TEST_ASSERT_MSG_EQ (it->m_txInfo.rbLen, expectedIt->m_txInfo.rbLen, "Wrong non excluded candidate");
+      NS_TEST_ASSERT_MSG_EQ (it->m_avg_rssi, expectedIt->m_avg_rssi, "Wrong S-RSSI metric of candidate "
+                             << it->m_txInfo.subframe.frameNo << "/" << it->m_txInfo.subframe.subframeNo
+                             << " rbStart=" << it->m_txInfo.rbStart);
+    }
+
+  // Full sensing: same candidates reported, in the same order, for the same random draws
+  m_mac->m_partialSensing = false;
+  m_mac->m_ueSelectedUniformVariable->SetStream (1);
+  TxList_t expected = RankTxResources (expectedRemaining, allCsr.size ());
+  m_mac->m_ueSelectedUniformVariable->SetStream (1);
+  CheckEqual (m_mac->GetTxResources (m_subframe, poolInfo), expected, "Full sensing");
+
+  // Partial sensing, with fewer candidate subframes than the window (random subset), more of them
+  // (whole window) and different sets of monitored subframes
+  std::vector<uint32_t> windowSf;
+  for (TxList_t::iterator it = allCsr.begin (); it != allCsr.end (); it++)
+    {
+      uint32_t sf = SubframeIndex (it->subframe.frameNo, it->subframe.subframeNo);
+      if (windowSf.empty () || windowSf.back () != sf)
+        {
+          windowSf.push_back (sf);
+        }
+    }
+  const std::pair<uint16_t, uint16_t> partialCases[] = {{20, 0x1}, {20, 0x201}, {1, 0x3FF}, {50, 0x2}, {101, 0x1}, {20, 0x0}};
+  for (const std::pair<uint16_t, uint16_t> &partial : partialCases)
+    {
+      std::ostringstream desc;
+      desc << "Partial sensing with " << partial.first << " candidate subframes and gap 0x" << std::hex << partial.second;
+      m_mac->m_partialSensing = true;
+      m_mac->m_minNumCandidateSf = partial.first;
+      m_mac->m_gapCandidateSensing = partial.second;
+
+      m_mac->m_ueSelectedUniformVariable->SetStream (2);
+      std::vector<bool> candidateSf;
+      std::vector<bool> monitoredSf;
+      m_mac->SelectPartialSensingSubframes (windowSf, candidateSf, monitoredSf);
+
+      // Y: the configured number of distinct subframes of the window, or the whole window
+      uint32_t numY = 0;
+      for (uint32_t sf = 0; sf < candidateSf.size (); sf++)
+        {
+          if (candidateSf[sf])
+            {
+              numY++;
+              NS_TEST_ASSERT_MSG_EQ ((std::find (windowSf.begin (), windowSf.end (), sf) != windowSf.end ()), true,
+                                     desc.str () << ": candidate subframe " << sf << " out of the selection window");
+            }
+        }
+      NS_TEST_ASSERT_MSG_EQ (numY, std::min<uint32_t> (partial.first, windowSf.size ()), desc.str () << ": wrong number of candidate subframes");
+
+      // Monitored subframes: y-k*100 for each y in Y and each k-th bit set in gapCandidateSensing
+      std::vector<bool> expectedMonitoredSf (10240, false);
+      for (uint32_t sf = 0; sf < candidateSf.size (); sf++)
+        {
+          for (uint32_t k = 1; k <= 10 && candidateSf[sf]; k++)
+            {
+              if (partial.second & (1 << (k - 1)))
+                {
+                  expectedMonitoredSf[(sf + 10240 - k * 100) % 10240] = true;
+                }
+            }
+        }
+      NS_TEST_ASSERT_MSG_EQ ((monitoredSf == expectedMonitoredSf), true, desc.str () << ": wrong monitored subframes");
+
+      // Selection among the candidates of Y, with the sensed transmissions of the monitored subframes
+      TxList_t partialCsr;
+      for (TxList_t::iterator it = allCsr.begin (); it != allCsr.end (); it++)
+        {
+          if (candidateSf[SubframeIndex (it->subframe.frameNo, it->subframe.subframeNo)])
+            {
+              partialCsr.push_back (*it);
+            }
+        }
+      std::list<cv2x_LteUeMac::SensingData> partialSensing;
+      for (std::list<cv2x_LteUeMac::SensingData>::iterator it = m_mac->m_sensingData.begin (); it != m_mac->m_sensingData.end (); it++)
+        {
+          if (monitoredSf[SubframeIndex (it->m_rxInfo.subframe.frameNo, it->m_rxInfo.subframe.subframeNo)])
+            {
+              partialSensing.push_back (*it);
+            }
+        }
+      // The random draws continue from the ones of the subframe selection, as in GetTxResources
+      expected = RankTxResources (ListExcludeTxResources (partialCsr, partialSensing), partialCsr.size ());
+      for (TxList_t::iterator it = expected.begin (); it != expected.end (); it++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (candidateSf[SubframeIndex (it->subframe.frameNo, it->subframe.subframeNo)], true,
+                                 desc.str () << ": candidate selected out of the candidate subframes");
+        }
+
+      m_mac->m_ueSelectedUniformVariable->SetStream (2);
+      CheckEqual (m_mac->GetTxResources (m_subframe, poolInfo), expected, desc.str ());
+    }
+
+  m_mac->Dispose ();
+  m_mac = 0;
+  pool = 0;
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the sensing-based SPS resource selection of cv2x_LteUeMac
+ */
+class cv2x_LteUeMacSpsSelectionTestSuite : public TestSuite
+{
+public:
+  cv2x_LteUeMacSpsSelectionTestSuite ();
+};
+
+cv2x_LteUeMacSpsSelectionTestSuite::cv2x_LteUeMacSpsSelectionTestSuite ()
+  : TestSuite ("lte-sps-resource-selection", UNIT)
+{
+  // Selections whose window or sensing history wrap around the frame numbering
+  for (uint8_t subchLen : {1, 2})
+    {
+      AddTestCase (new cv2x_LteUeMacSpsSelectionTestCase (subchLen, 512, 3), TestCase::QUICK);
+      AddTestCase (new cv2x_LteUeMacSpsSelectionTestCase (subchLen, 1020, 7), TestCase::QUICK);
+      AddTestCase (new cv2x_LteUeMacSpsSelectionTestCase (subchLen, 50, 1), TestCase::QUICK);
+    }
+}
+
+static cv2x_LteUeMacSpsSelectionTestSuite g_cv2xLteUeMacSpsSelectionTestSuite; ///< the test suite
+
+} // namespace ns3
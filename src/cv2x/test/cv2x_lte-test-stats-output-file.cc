@@ -0,0 +1,297 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/cv2x_stats-output-file.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteStatsOutputFileTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Writes some rows with cv2x_StatsOutputFile in text mode, also
+ * after closing and opening again the file, and checks that the file is
+ * byte-identical to the one written by opening, appending to and closing
+ * the file for each row, as the stats calculators used to do.
+ */
+class cv2x_LteStatsOutputFileTextTestCase : public TestCase
+{
+public:
+  cv2x_LteStatsOutputFileTextTestCase ();
+  virtual ~cv2x_LteStatsOutputFileTextTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  /**
+   * Write a row of the reference file, opening and closing it
+   *
+   * \param i the index of the row
+   */
+  void WriteReferenceRow (uint32_t i);
+
+  std::string m_fileName; ///< the file written with cv2x_StatsOutputFile
+  std::string m_referenceFileName; ///< the file written row by row
+};
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Writes some rows with cv2x_StatsOutputFile in binary mode and
+ * reads them back, checking the header, written when the file is opened,
+ * the types line, written with the first row, and the values of the
+ * fields.
+ */
+class cv2x_LteStatsOutputFileBinaryTestCase : public TestCase
+{
+public:
+  cv2x_LteStatsOutputFileBinaryTestCase ();
+  virtual ~cv2x_LteStatsOutputFileBinaryTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  std::string m_fileName; ///< the file written with cv2x_StatsOutputFile
+};
+
+/// the header line of the test files
+static const std::string g_header = "% time\tcellId\tIMSI\tRNTI\tsinr\tinfo";
+
+/**
+ * Read a whole file
+ *
+ * \param fileName the name of the file
+ * \return the content of the file
+ */
+static std::string
+ReadFile (const std::string &fileName)
+{
+  std::ifstream file (fileName.c_str (), std::ios_base::binary);
+  return std::string (std::istreambuf_iterator<char> (file), std::istreambuf_iterator<char> ());
+}
+
+cv2x_LteStatsOutputFileTextTestCase::cv2x_LteStatsOutputFileTextTestCase ()
+  : TestCase ("Text output is identical to the one written row by row"),
+    m_fileName ("cv2x-stats-output-file-test.txt"),
+    m_referenceFileName ("cv2x-stats-output-file-test-reference.txt")
+{
+}
+
+cv2x_LteStatsOutputFileTextTestCase::~cv2x_LteStatsOutputFileTextTestCase ()
+{
+}
+
+void
+cv2x_LteStatsOutputFileTextTestCase::WriteReferenceRow (uint32_t i)
+{
+  std::ofstream outFile;
+  if (i == 0)
+    {
+      outFile.open (m_referenceFileName.c_str ());
+      outFile << g_header;
+      outFile << std::endl;
+    }
+  else
+    {
+      outFile.open (m_referenceFileName.c_str (), std::ios_base::app);
+    }
+  outFile << (i + 1) / (double) 1e3 << "\t";
+  outFile << (uint32_t) (i % 3) << "\t";
+  outFile << (uint64_t) 1000000007 * i << "\t";
+  outFile << (uint16_t) (i + 1) << "\t";
+  outFile << -10.0 + i * 0.37 << "\t";
+  outFile << "row" << i << std::endl;
+  outFile.close ();
+}
+
+void
+cv2x_LteStatsOutputFileTextTestCase::DoRun (void)
+{
+  const uint32_t numRows = 100;
+  const uint32_t reopenRow = 60;
+
+  // a small buffer, so that it is flushed while writing the rows
+  cv2x_StatsOutputFile output;
+  NS_TEST_ASSERT_MSG_EQ (output.Open (m_fileName, g_header, false, 256), true, "Can't open the file");
+  output.Flush ();
+  NS_TEST_ASSERT_MSG_EQ (ReadFile (m_fileName), g_header + "\n", "The header was not written when opening the file");
+
+  for (uint32_t i = 0; i < numRows; ++i)
+    {
+      if (i == reopenRow)
+        {
+          output.Close ();
+          NS_TEST_ASSERT_MSG_EQ (output.Open (m_fileName, g_header, false, 256), true, "Can't open the file again");
+        }
+      std::ostringstream info;
+      info << "row" << i;
+      output << (i + 1) / (double) 1e3;
+      output << (uint32_t) (i % 3);
+      output << (uint64_t) 1000000007 * i;
+      output << (uint16_t) (i + 1);
+      output << -10.0 + i * 0.37;
+      output << info.str ();
+      output.EndRow ();
+      WriteReferenceRow (i);
+    }
+  output.Close ();
+
+  std::string content = ReadFile (m_fileName);
+  std::string reference = ReadFile (m_referenceFileName);
+  NS_TEST_ASSERT_MSG_GT (reference.size (), g_header.size (), "The reference file is empty");
+  NS_TEST_ASSERT_MSG_EQ (content.size (), reference.size (), "The text output has a different size");
+  NS_TEST_ASSERT_MSG_EQ ((content == reference), true, "The text output differs from the one written row by row");
+
+  Simulator::Destroy ();
+}
+
+void
+cv2x_LteStatsOutputFileTextTestCase::DoTeardown (void)
+{
+  std::remove (m_fileName.c_str ());
+  std::remove (m_referenceFileName.c_str ());
+}
+
+cv2x_LteStatsOutputFileBinaryTestCase::cv2x_LteStatsOutputFileBinaryTestCase ()
+  : TestCase ("Binary output read back"),
+    m_fileName ("cv2x-stats-output-file-test.bin")
+{
+}
+
+cv2x_LteStatsOutputFileBinaryTestCase::~cv2x_LteStatsOutputFileBinaryTestCase ()
+{
+}
+
+void
+cv2x_LteStatsOutputFileBinaryTestCase::DoRun (void)
+{
+  const uint32_t numRows = 50;
+
+  {
+    cv2x_StatsOutputFile output;
+    NS_TEST_ASSERT_MSG_EQ (output.Open (m_fileName, g_header, true, 256), true, "Can't open the file");
+    output.Flush ();
+    NS_TEST_ASSERT_MSG_EQ (ReadFile (m_fileName), g_header + "\n", "The header was not written when opening the file");
+
+    for (uint32_t i = 0; i < numRows; ++i)
+      {
+        std::ostringstream info;
+        info << "row" << i;
+        output << (i + 1) / (double) 1e3;
+        output << (uint32_t) (i % 3);
+        output << (uint64_t) 1000000007 * i;
+        output << (int16_t) (100 - 7 * i);
+        output << (float) (-10.0 + i * 0.37);
+        output << info.str ();
+        if (i == 0)
+          {
+            // the types line is written only with the first row
+            output.Flush ();
+            NS_TEST_ASSERT_MSG_EQ (ReadFile (m_fileName), g_header + "\n", "The first row was written before being completed");
+          }
+        output.EndRow ();
+      }
+    // closed by the destructor
+  }
+
+  std::string content = ReadFile (m_fileName);
+  std::string types = "% types\tf64\tu32\tu64\ti16\tf32\ts\n";
+  NS_TEST_ASSERT_MSG_EQ (content.substr (0, g_header.size () + 1), g_header + "\n", "Wrong header line");
+  NS_TEST_ASSERT_MSG_EQ (content.substr (g_header.size () + 1, types.size ()), types, "Wrong types line");
+
+  std::size_t pos = g_header.size () + 1 + types.size ();
+  for (uint32_t i = 0; i < numRows; ++i)
+    {
+      double time;
+      uint32_t cellId;
+      uint64_t imsi;
+      int16_t rnti;
+      float sinr;
+      uint32_t length;
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (pos + 8 + 4 + 8 + 2 + 4 + 4, content.size (), "Row " << i << " is truncated");
+      std::memcpy (&time, content.data () + pos, sizeof (time));
+      pos += sizeof (time);
+      std::memcpy (&cellId, content.data () + pos, sizeof (cellId));
+      pos += sizeof (cellId);
+      std::memcpy (&imsi, content.data () + pos, sizeof (imsi));
+      pos += sizeof (imsi);
+      std::memcpy (&rnti, content.data () + pos, sizeof (rnti));
+      pos += sizeof (rnti);
+      std::memcpy (&sinr, content.data () + pos, sizeof (sinr));
+      pos += sizeof (sinr);
+      std::memcpy (&length, content.data () + pos, sizeof (length));
+      pos += sizeof (length);
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (pos + length, content.size (), "Row " << i << " is truncated");
+      std::string info = content.substr (pos, length);
+      pos += length;
+
+      std::ostringstream expectedInfo;
+      expectedInfo << "row" << i;
+      NS_TEST_ASSERT_MSG_EQ (time, (i + 1) / (double) 1e3, "Wrong time in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (cellId, i % 3, "Wrong cellId in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (imsi, (uint64_t) 1000000007 * i, "Wrong IMSI in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (rnti, (int16_t) (100 - 7 * i), "Wrong RNTI in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (sinr, (float) (-10.0 + i * 0.37), "Wrong SINR in row " << i);
+      NS_TEST_ASSERT_MSG_EQ (info, expectedInfo.str (), "Wrong info in row " << i);
+    }
+  NS_TEST_ASSERT_MSG_EQ (pos, content.size (), "Unexpected data after the last row");
+
+  Simulator::Destroy ();
+}
+
+void
+cv2x_LteStatsOutputFileBinaryTestCase::DoTeardown (void)
+{
+  std::remove (m_fileName.c_str ());
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the output files of the stats calculators
+ */
+class cv2x_LteStatsOutputFileTestSuite : public TestSuite
+{
+public:
+  cv2x_LteStatsOutputFileTestSuite ();
+};
+
+cv2x_LteStatsOutputFileTestSuite::cv2x_LteStatsOutputFileTestSuite ()
+  : TestSuite ("lte-stats-output-file", UNIT)
+{
+  AddTestCase (new cv2x_LteStatsOutputFileTextTestCase, TestCase::QUICK);
+  AddTestCase (new cv2x_LteStatsOutputFileBinaryTestCase, TestCase::QUICK);
+}
+
+static cv2x_LteStatsOutputFileTestSuite g_cv2xLteStatsOutputFileTestSuite; ///< the test suite
+
+} // namespace ns3
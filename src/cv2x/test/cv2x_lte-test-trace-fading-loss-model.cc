@@ -0,0 +1,272 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/double.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+#include <ns3/nstime.h>
+#include <ns3/random-variable-stream.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/spectrum-model.h>
+#include <ns3/spectrum-value.h>
+#include <ns3/cv2x_trace-fading-loss-model.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteTraceFadingLossModelTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks the fading trace and the window offsets of
+ * cv2x_TraceFadingLossModel, with a small trace written by the test:
+ * - two instances of the model share the same trace, read only once;
+ * - the flattened trace (sample j of the RB i at i * samplesNum + j), and
+ *   the fading applied to the PSD, are equal to the samples of the per-RB
+ *   vectors of the trace file;
+ * - the offset of a channel realization unused for several windows is
+ *   kept until its next use, when it is drawn again.
+ */
+class cv2x_LteTraceFadingLossModelTestCase : public TestCase
+{
+public:
+  cv2x_LteTraceFadingLossModelTestCase ();
+  virtual ~cv2x_LteTraceFadingLossModelTestCase ();
+
+private:
+  virtual void DoRun (void);
+  virtual void DoTeardown (void);
+
+  /**
+   * Create a fading model using the test trace
+   *
+   * \param stream the stream of the window offset random variable
+   * \return the fading model
+   */
+  Ptr<cv2x_TraceFadingLossModel> CreateModel (int64_t stream);
+
+  /**
+   * Apply the fading of a channel realization to the test PSD, and check
+   * it against the per-RB trace
+   *
+   * \param model the fading model
+   * \param a the sender mobility
+   * \param b the receiver mobility
+   */
+  void CheckFading (Ptr<cv2x_TraceFadingLossModel> model, Ptr<MobilityModel> a, Ptr<MobilityModel> b);
+
+  /**
+   * Check the window offset of a channel realization
+   *
+   * \param model the fading model
+   * \param a the sender mobility
+   * \param b the receiver mobility
+   * \param offset the expected offset
+   * \param epoch the expected window epoch of the offset
+   */
+  void CheckOffset (Ptr<cv2x_TraceFadingLossModel> model, Ptr<MobilityModel> a, Ptr<MobilityModel> b,
+                    int offset, uint64_t epoch);
+
+  static const uint8_t m_rbNum = 4; ///< the number of RBs of the trace
+  static const uint32_t m_samplesNum = 200; ///< the number of samples per RB of the trace (1 ms each)
+  std::string m_traceFile; ///< the trace file
+  std::vector<std::vector<double> > m_rbTraces; ///< the samples of each RB, as read by the model before flattening the trace
+  Ptr<SpectrumValue> m_txPsd; ///< the PSD the fading is applied to
+};
+
+cv2x_LteTraceFadingLossModelTestCase::cv2x_LteTraceFadingLossModelTestCase ()
+  : TestCase ("Trace fading loss model: shared trace, lookup and window offsets"),
+    m_traceFile ("cv2x-trace-fading-test.fad")
+{
+}
+
+cv2x_LteTraceFadingLossModelTestCase::~cv2x_LteTraceFadingLossModelTestCase ()
+{
+}
+
+Ptr<cv2x_TraceFadingLossModel>
+cv2x_LteTraceFadingLossModelTestCase::CreateModel (int64_t stream)
+{
+  Ptr<cv2x_TraceFadingLossModel> model = CreateObject<cv2x_TraceFadingLossModel> ();
+  model->SetAttribute ("TraceFilename", StringValue (m_traceFile));
+  model->SetAttribute ("TraceLength", TimeValue (MilliSeconds (m_samplesNum)));
+  model->SetAttribute ("SamplesNum", UintegerValue (m_samplesNum));
+  model->SetAttribute ("WindowSize", TimeValue (MilliSeconds (50)));
+  model->SetAttribute ("RbNum", UintegerValue (m_rbNum));
+  model->AssignStreams (stream);
+  model->Initialize ();
+  return model;
+}
+
+void
+cv2x_LteTraceFadingLossModelTestCase::CheckFading (Ptr<cv2x_TraceFadingLossModel> model,
+                                                   Ptr<MobilityModel> a, Ptr<MobilityModel> b)
+{
+  Ptr<SpectrumValue> rxPsd = model->CalcRxPowerSpectralDensity (m_txPsd, a, b);
+
+  auto it = model->m_windowOffsetsMap.find (std::make_pair (a, b));
+  NS_TEST_ASSERT_MSG_EQ ((it != model->m_windowOffsetsMap.end ()), true, "No window offset for the channel realization");
+  int index = (it->second.m_offset + Simulator::Now ().GetMilliSeconds () - model->m_lastWindowUpdate.GetMilliSeconds ()) % m_samplesNum;
+  for (uint8_t rb = 0; rb < m_rbNum; ++rb)
+    {
+      if ((*m_txPsd)[rb] == 0.)
+        {
+          NS_TEST_ASSERT_MSG_EQ ((*rxPsd)[rb], 0., "Fading applied to an unused RB");
+          continue;
+        }
+      double fadingDb = 10 * std::log10 ((*rxPsd)[rb] / (*m_txPsd)[rb]);
+      NS_TEST_ASSERT_MSG_EQ_TOL (fadingDb, m_rbTraces[rb][index], 1e-9,
+                                 "Wrong fading for RB " << (uint32_t) rb << " at " << Simulator::Now ().GetMilliSeconds () << " ms");
+    }
+}
+
+void
+cv2x_LteTraceFadingLossModelTestCase::CheckOffset (Ptr<cv2x_TraceFadingLossModel> model,
+                                                   Ptr<MobilityModel> a, Ptr<MobilityModel> b,
+                                                   int offset, uint64_t epoch)
+{
+  auto it = model->m_windowOffsetsMap.find (std::make_pair (a, b));
+  NS_TEST_ASSERT_MSG_EQ ((it != model->m_windowOffsetsMap.end ()), true, "No window offset for the channel realization");
+  NS_TEST_ASSERT_MSG_EQ (it->second.m_offset, offset, "Wrong window offset at " << Simulator::Now ().GetMilliSeconds () << " ms");
+  NS_TEST_ASSERT_MSG_EQ (it->second.m_epoch, epoch, "Wrong window epoch at " << Simulator::Now ().GetMilliSeconds () << " ms");
+}
+
+void
+cv2x_LteTraceFadingLossModelTestCase::DoRun (void)
+{
+  // a trace with a different value for each sample, one line per RB
+  std::ofstream traceFile (m_traceFile.c_str ());
+  for (uint32_t i = 0; i < m_rbNum; ++i)
+    {
+      for (uint32_t j = 0; j < m_samplesNum; ++j)
+        {
+          traceFile << -20.0 + 0.01 * (i * m_samplesNum + j) << " ";
+        }
+      traceFile << "\n";
+    }
+  traceFile.close ();
+
+  // the trace as it was stored before being flattened, one vector per RB
+  std::ifstream ifTraceFile (m_traceFile.c_str ());
+  for (uint32_t i = 0; i < m_rbNum; ++i)
+    {
+      std::vector<double> rbTrace;
+      for (uint32_t j = 0; j < m_samplesNum; ++j)
+        {
+          double sample;
+          ifTraceFile >> sample;
+          rbTrace.push_back (sample);
+        }
+      m_rbTraces.push_back (rbTrace);
+    }
+
+  Ptr<cv2x_TraceFadingLossModel> model = CreateModel (1);
+  Ptr<cv2x_TraceFadingLossModel> otherModel = CreateModel (2);
+
+  NS_TEST_ASSERT_MSG_EQ ((model->m_fadingTrace != nullptr), true, "The trace was not loaded");
+  NS_TEST_ASSERT_MSG_EQ ((model->m_fadingTrace == otherModel->m_fadingTrace), true, "The two models do not share the trace");
+  NS_TEST_ASSERT_MSG_EQ ((cv2x_TraceFadingLossModel::GetSharedTrace (m_traceFile, m_rbNum, m_samplesNum) == model->m_fadingTrace), true,
+                         "The trace was read again");
+  NS_TEST_ASSERT_MSG_EQ (model->m_fadingTrace->size (), (std::size_t) m_rbNum * m_samplesNum, "Wrong trace size");
+  for (uint32_t i = 0; i < m_rbNum; ++i)
+    {
+      for (uint32_t j = 0; j < m_samplesNum; ++j)
+        {
+          NS_TEST_ASSERT_MSG_EQ ((*model->m_fadingTrace)[i * m_samplesNum + j], m_rbTraces[i][j],
+                                 "Wrong sample " << j << " of RB " << i << " in the flattened trace");
+        }
+    }
+
+  std::vector<double> freqs;
+  for (uint8_t rb = 0; rb < m_rbNum; ++rb)
+    {
+      freqs.push_back (2.0e9 + rb * 180e3);
+    }
+  m_txPsd = Create<SpectrumValue> (Create<SpectrumModel> (freqs));
+  (*m_txPsd) = 1e-16;
+  (*m_txPsd)[2] = 0.;
+
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> c = CreateObject<ConstantPositionMobilityModel> ();
+  Ptr<MobilityModel> d = CreateObject<ConstantPositionMobilityModel> ();
+
+  // the offsets drawn by the model, in order
+  Ptr<UniformRandomVariable> startVariable = CreateObject<UniformRandomVariable> ();
+  startVariable->SetStream (1);
+  startVariable->SetAttribute ("Min", DoubleValue (1.0));
+  startVariable->SetAttribute ("Max", DoubleValue ((MilliSeconds (m_samplesNum).GetSeconds () - MilliSeconds (50).GetSeconds ()) * 1000.0));
+  std::vector<int> offsets;
+  for (uint32_t i = 0; i < 6; ++i)
+    {
+      offsets.push_back (startVariable->GetValue ());
+    }
+
+  // (a, b) is used only at the beginning and at the end, while (c, d) is
+  // used once per window, renewing the offsets of the realizations
+  Simulator::Schedule (MilliSeconds (0), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, a, b);
+  Simulator::Schedule (MilliSeconds (0), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, c, d);
+  Simulator::Schedule (MilliSeconds (20), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, a, b);
+  Simulator::Schedule (MilliSeconds (20), &cv2x_LteTraceFadingLossModelTestCase::CheckOffset, this, model, a, b, offsets[0], 0);
+  Simulator::Schedule (MilliSeconds (60), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, c, d);
+  Simulator::Schedule (MilliSeconds (120), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, c, d);
+  Simulator::Schedule (MilliSeconds (180), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, c, d);
+  Simulator::Schedule (MilliSeconds (180), &cv2x_LteTraceFadingLossModelTestCase::CheckOffset, this, model, c, d, offsets[4], 3);
+  Simulator::Schedule (MilliSeconds (180), &cv2x_LteTraceFadingLossModelTestCase::CheckOffset, this, model, a, b, offsets[0], 0);
+  Simulator::Schedule (MilliSeconds (190), &cv2x_LteTraceFadingLossModelTestCase::CheckFading, this, model, a, b);
+  Simulator::Schedule (MilliSeconds (190), &cv2x_LteTraceFadingLossModelTestCase::CheckOffset, this, model, a, b, offsets[5], 3);
+  Simulator::Schedule (MilliSeconds (190), &cv2x_LteTraceFadingLossModelTestCase::CheckOffset, this, model, c, d, offsets[4], 3);
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+void
+cv2x_LteTraceFadingLossModelTestCase::DoTeardown (void)
+{
+  std::remove (m_traceFile.c_str ());
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the trace fading loss model
+ */
+class cv2x_LteTraceFadingLossModelTestSuite : public TestSuite
+{
+public:
+  cv2x_LteTraceFadingLossModelTestSuite ();
+};
+
+cv2x_LteTraceFadingLossModelTestSuite::cv2x_LteTraceFadingLossModelTestSuite ()
+  : TestSuite ("lte-trace-fading-loss-model", UNIT)
+{
+  AddTestCase (new cv2x_LteTraceFadingLossModelTestCase, TestCase::QUICK);
+}
+
+static cv2x_LteTraceFadingLossModelTestSuite g_cv2xLteTraceFadingLossModelTestSuite; ///< the test suite
+
+} // namespace ns3
@@ -0,0 +1,321 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ns3/test.h>
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/config.h>
+#include <ns3/boolean.h>
+#include <ns3/double.h>
+#include <ns3/uinteger.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/constant-position-mobility-model.h>
+#include <ns3/network-module.h>
+#include <ns3/internet-module.h>
+#include <ns3/applications-module.h>
+#include <ns3/cv2x_lte-helper.h>
+#include <ns3/cv2x_lte-v2x-helper.h>
+#include <ns3/cv2x_point-to-point-epc-helper.h>
+#include <ns3/cv2x_lte-sl-tft.h>
+#include <ns3/cv2x_sl-v2x-preconfig-pool-factory.h>
+#include <ns3/cv2x_lte-ue-rrc.h>
+#include <ns3/cv2x_lte-common.h>
+
+NS_LOG_COMPONENT_DEFINE ("cv2x_LteV2xSkipIdleSubframesTest");
+
+namespace ns3 {
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks that an out-of-coverage V2X broadcast scenario produces the
+ * same sidelink scheduling decisions and receptions when the UE PHYs skip
+ * their idle subframes (cv2x_LteUePhy::SkipIdleSubframes) as when they
+ * process every subframe.
+ */
+class cv2x_LteV2xSkipIdleSubframesTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param nUes the number of UEs
+   * \param interval the interval between two packets of a UE
+   */
+  cv2x_LteV2xSkipIdleSubframesTestCase (uint32_t nUes, Time interval);
+  virtual ~cv2x_LteV2xSkipIdleSubframesTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Run the scenario and record the sidelink events
+   *
+   * \param skipIdleSubframes the value of the SkipIdleSubframes attribute
+   * \returns the recorded events, in order of occurrence
+   */
+  std::vector<std::string> RunScenario (bool skipIdleSubframes);
+
+  /**
+   * Trace sink for the SlUeSchedulingV2x and SlSharedChUeSchedulingV2x traces
+   *
+   * \param context the context
+   * \param params the scheduling parameters
+   */
+  void SlSchedulingV2x (std::string context, cv2x_SlUeMacStatParametersV2x params);
+  /**
+   * Trace sink for the SlPscchReception and SlPhyReception traces
+   *
+   * \param context the context
+   * \param params the reception parameters
+   */
+  void SlReception (std::string context, cv2x_PhyReceptionStatParameters params);
+
+  uint32_t m_nUes; ///< the number of UEs
+  Time m_interval; ///< the packet interval
+  std::vector<std::string> m_events; ///< the recorded events
+};
+
+cv2x_LteV2xSkipIdleSubframesTestCase::cv2x_LteV2xSkipIdleSubframesTestCase (uint32_t nUes, Time interval)
+  : TestCase ("V2X skip idle subframes, " + std::to_string (nUes) + " UEs, interval "
+              + std::to_string (interval.GetMilliSeconds ()) + " ms"),
+    m_nUes (nUes),
+    m_interval (interval)
+{
+}
+
+cv2x_LteV2xSkipIdleSubframesTestCase::~cv2x_LteV2xSkipIdleSubframesTestCase ()
+{
+}
+
+void
+cv2x_LteV2xSkipIdleSubframesTestCase::SlSchedulingV2x (std::string context, cv2x_SlUeMacStatParametersV2x params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " imsi " << params.m_imsi << " frame " << params.m_frameNo << "/" << params.m_subframeNo
+      << " mcs " << +params.m_mcs << " tb " << params.m_tbSize
+      << " pscch " << +params.m_resPscch << " tx " << params.m_txFrame << "/" << params.m_txSubframe
+      << " rb " << params.m_psschTxStartRB << "+" << params.m_psschTxLengthRB;
+  m_events.push_back (oss.str ());
+}
+
+void
+cv2x_LteV2xSkipIdleSubframesTestCase::SlReception (std::string context, cv2x_PhyReceptionStatParameters params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " imsi " << params.m_imsi << " rnti " << params.m_rnti
+      << " mcs " << +params.m_mcs << " size " << params.m_size
+      << " correct " << +params.m_correctness;
+  m_events.push_back (oss.str ());
+}
+
+std::vector<std::string>
+cv2x_LteV2xSkipIdleSubframesTestCase::RunScenario (bool skipIdleSubframes)
+{
+  m_events.clear ();
+
+  Config::Reset ();
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+  // the UE MAC draws part of its random values from rand ()
+  srand (1);
+  Ipv4AddressGenerator::Reset ();
+
+  uint32_t sizeSubchannel = 10;
+  uint32_t numSubchannel = 3;
+  uint32_t slBandwidth = sizeSubchannel * numSubchannel;
+
+  Config::SetDefault ("ns3::cv2x_LteUePhy::TxPower", DoubleValue (23.0));
+  Config::SetDefault ("ns3::cv2x_LteUePhy::RsrpUeMeasThreshold", DoubleValue (-10.0));
+  Config::SetDefault ("ns3::cv2x_LteUePhy::EnableV2x", BooleanValue (true));
+  Config::SetDefault ("ns3::cv2x_LteUePhy::SkipIdleSubframes", BooleanValue (skipIdleSubframes));
+  Config::SetDefault ("ns3::cv2x_LteUePowerControl::Pcmax", DoubleValue (23.0));
+  Config::SetDefault ("ns3::cv2x_LteUePowerControl::PsschTxPower", DoubleValue (23.0));
+  Config::SetDefault ("ns3::cv2x_LteUePowerControl::PscchTxPower", DoubleValue (23.0));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::UlBandwidth", UintegerValue (slBandwidth));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::EnableV2xHarq", BooleanValue (false));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::EnableAdjacencyPscchPssch", BooleanValue (true));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::EnablePartialSensing", BooleanValue (false));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlGrantMcs", UintegerValue (20));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlSubchannelSize", UintegerValue (sizeSubchannel));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlSubchannelNum", UintegerValue (numSubchannel));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlStartRbSubchannel", UintegerValue (0));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlPrsvp", UintegerValue (m_interval.GetMilliSeconds ()));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SlProbResourceKeep", DoubleValue (0.0));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SelectionWindowT1", UintegerValue (4));
+  Config::SetDefault ("ns3::cv2x_LteUeMac::SelectionWindowT2", UintegerValue (100));
+
+  Ptr<cv2x_PointToPointEpcHelper> epcHelper = CreateObject<cv2x_PointToPointEpcHelper> ();
+  Ptr<cv2x_LteHelper> lteHelper = CreateObject<cv2x_LteHelper> ();
+  lteHelper->SetEpcHelper (epcHelper);
+  // out of coverage
+  lteHelper->DisableNewEnbPhy ();
+
+  Ptr<cv2x_LteV2xHelper> lteV2xHelper = CreateObject<cv2x_LteV2xHelper> ();
+  lteV2xHelper->SetLteHelper (lteHelper);
+
+  NodeContainer enbNodes;
+  NodeContainer ueNodes;
+  enbNodes.Create (1);
+  ueNodes.Create (m_nUes);
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (enbNodes);
+  mobility.Install (ueNodes);
+  enbNodes.Get (0)->GetObject<MobilityModel> ()->SetPosition (Vector (0.0, 0.0, 20.0));
+  for (uint32_t i = 0; i < m_nUes; ++i)
+    {
+      ueNodes.Get (i)->GetObject<MobilityModel> ()->SetPosition (Vector (20.0 * i, 0.0, 1.5));
+    }
+
+  lteHelper->InstallEnbDevice (enbNodes);
+  lteHelper->SetAttribute ("UseSidelink", BooleanValue (true));
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+
+  InternetStackHelper internet;
+  internet.Install (ueNodes);
+  epcHelper->AssignUeIpv4Address (ueDevs);
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  for (uint32_t i = 0; i < m_nUes; ++i)
+    {
+      Ptr<Ipv4StaticRouting> ueStaticRouting = ipv4RoutingHelper.GetStaticRouting (ueNodes.Get (i)->GetObject<Ipv4> ());
+      ueStaticRouting->SetDefaultRoute (epcHelper->GetUeDefaultGatewayAddress (), 1);
+    }
+
+  std::vector<NetDeviceContainer> txGroups = lteV2xHelper->AssociateForV2xBroadcast (ueDevs, m_nUes);
+
+  uint32_t groupL2Address = 0x00;
+  Ipv4AddressGenerator::Init (Ipv4Address ("225.0.0.0"), Ipv4Mask ("255.0.0.0"));
+  Ipv4Address groupAddress = Ipv4AddressGenerator::NextAddress (Ipv4Mask ("255.0.0.0"));
+  uint16_t port = 8000;
+  ApplicationContainer clientApps;
+  for (uint32_t g = 0; g < txGroups.size (); ++g)
+    {
+      NetDeviceContainer txUe (txGroups.at (g).Get (0));
+      NetDeviceContainer rxUes = lteV2xHelper->RemoveNetDevice (txGroups.at (g), txUe.Get (0));
+      Ptr<cv2x_LteSlTft> tft = Create<cv2x_LteSlTft> (cv2x_LteSlTft::TRANSMIT, groupAddress, groupL2Address);
+      lteV2xHelper->ActivateSidelinkBearer (Seconds (0.0), txUe, tft);
+      tft = Create<cv2x_LteSlTft> (cv2x_LteSlTft::RECEIVE, groupAddress, groupL2Address);
+      lteV2xHelper->ActivateSidelinkBearer (Seconds (0.0), rxUes, tft);
+
+      UdpClientHelper client (groupAddress, port);
+      client.SetAttribute ("MaxPackets", UintegerValue (1000000));
+      client.SetAttribute ("Interval", TimeValue (m_interval));
+      client.SetAttribute ("PacketSize", UintegerValue (190));
+      ApplicationContainer app = client.Install (txUe.Get (0)->GetNode ());
+      // spread the first transmissions of the UEs over the packet interval
+      app.Start (Seconds (0.5) + MilliSeconds ((g * 37) % m_interval.GetMilliSeconds ()));
+      clientApps.Add (app);
+
+      groupL2Address++;
+      groupAddress = Ipv4AddressGenerator::NextAddress (Ipv4Mask ("255.0.0.0"));
+    }
+  clientApps.Stop (Seconds (2.5));
+
+  Ptr<cv2x_LteUeRrcSl> ueSidelinkConfiguration = CreateObject<cv2x_LteUeRrcSl> ();
+  ueSidelinkConfiguration->SetSlEnabled (true);
+  ueSidelinkConfiguration->SetV2xEnabled (true);
+
+  cv2x_LteRrcSap::SlV2xPreconfiguration preconfiguration;
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommPreconfigGeneral.carrierFreq = 54890;
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommPreconfigGeneral.slBandwidth = slBandwidth;
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommTxPoolList.nbPools = 1;
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommRxPoolList.nbPools = 1;
+
+  cv2x_SlV2xPreconfigPoolFactory pFactory;
+  pFactory.SetHaveUeSelectedResourceConfig (true);
+  pFactory.SetSlSubframe (std::bitset<20> (0xFFFFF));
+  pFactory.SetAdjacencyPscchPssch (true);
+  pFactory.SetSizeSubchannel (sizeSubchannel);
+  pFactory.SetNumSubchannel (numSubchannel);
+  pFactory.SetStartRbSubchannel (0);
+  pFactory.SetStartRbPscchPool (0);
+  pFactory.SetDataTxP0 (-4);
+  pFactory.SetDataTxAlpha (0.9);
+
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommTxPoolList.pools[0] = pFactory.CreatePool ();
+  preconfiguration.v2xPreconfigFreqList.freq[0].v2xCommRxPoolList.pools[0] = pFactory.CreatePool ();
+  ueSidelinkConfiguration->SetSlV2xPreconfiguration (preconfiguration);
+
+  lteHelper->InstallSidelinkV2xConfiguration (ueDevs, ueSidelinkConfiguration);
+
+  Config::Connect ("/NodeList/*/DeviceList/*/cv2x_ComponentCarrierMapUe/*/cv2x_LteUeMac/SlUeSchedulingV2x",
+                   MakeCallback (&cv2x_LteV2xSkipIdleSubframesTestCase::SlSchedulingV2x, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/cv2x_ComponentCarrierMapUe/*/cv2x_LteUeMac/SlSharedChUeSchedulingV2x",
+                   MakeCallback (&cv2x_LteV2xSkipIdleSubframesTestCase::SlSchedulingV2x, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/cv2x_ComponentCarrierMapUe/*/cv2x_LteUePhy/SlSpectrumPhy/SlPscchReception",
+                   MakeCallback (&cv2x_LteV2xSkipIdleSubframesTestCase::SlReception, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/cv2x_ComponentCarrierMapUe/*/cv2x_LteUePhy/SlSpectrumPhy/SlPhyReception",
+                   MakeCallback (&cv2x_LteV2xSkipIdleSubframesTestCase::SlReception, this));
+
+  Simulator::Stop (Seconds (3.0));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  return m_events;
+}
+
+void
+cv2x_LteV2xSkipIdleSubframesTestCase::DoRun (void)
+{
+  std::vector<std::string> reference = RunScenario (false);
+  std::vector<std::string> skipped = RunScenario (true);
+
+  NS_TEST_ASSERT_MSG_GT (reference.size (), 0, "no sidelink activity in the reference run");
+  NS_TEST_ASSERT_MSG_EQ (skipped.size (), reference.size (),
+                         "different number of sidelink events when skipping the idle subframes");
+  for (uint32_t i = 0; i < std::min (reference.size (), skipped.size ()); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (skipped.at (i), reference.at (i),
+                             "sidelink event " << i << " differs when skipping the idle subframes");
+    }
+
+  Config::Reset ();
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite for the skipping of the idle subframes of the V2X UEs
+ */
+class cv2x_LteV2xSkipIdleSubframesTestSuite : public TestSuite
+{
+public:
+  cv2x_LteV2xSkipIdleSubframesTestSuite ();
+};
+
+cv2x_LteV2xSkipIdleSubframesTestSuite::cv2x_LteV2xSkipIdleSubframesTestSuite ()
+  : TestSuite ("lte-v2x-skip-idle-subframes", SYSTEM)
+{
+  AddTestCase (new cv2x_LteV2xSkipIdleSubframesTestCase (3, MilliSeconds (100)), TestCase::QUICK);
+  AddTestCase (new cv2x_LteV2xSkipIdleSubframesTestCase (6, MilliSeconds (50)), TestCase::EXTENSIVE);
+}
+
+static cv2x_LteV2xSkipIdleSubframesTestSuite g_cv2xLteV2xSkipIdleSubframesTestSuite; ///< the test suite
+
+} // namespace ns3
@@ -48,6 +48,12 @@
  * - PSSCH TB corruption
  * and writes them in the same database where traces are written.
  *
+ * By default, the V2X KPIs are computed online, i.e., the traces are also fed
+ * to the KPI computation during the simulation, instead of being read back
+ * from the database at the end. In this case, writing the traces in the
+ * database can be disabled (see the "saveTraces" parameter) to only store the
+ * V2X KPIs.
+ *
  * Have a look at the possible parameters to know what you can configure
  * through the command line.
  *
@@ -108,12 +114,22 @@ void NotifySlPscchScheduling (UeMacPscchTxOutputStats *pscchStats, const SlPscch
  *        triggered upon the transmission of SCI format 2-A and data from UE MAC.
  *
  * \param psschStats Pointer to the UeMacPsschTxOutputStats class,
- *        which is responsible to write the trace source parameters to a database.
+ *        which is responsible to write the trace source parameters to a database
+ *        (nullptr if the trace is not written).
+ * \param v2xKpi Pointer to the V2xKpi class computing the KPIs online
+ *        (nullptr if the KPIs are not computed online).
  * \param psschStatsParams Parameters of the trace source.
  */
-void NotifySlPsschScheduling (UeMacPsschTxOutputStats *psschStats, const SlPsschUeMacStatParameters psschStatsParams)
+void NotifySlPsschScheduling (UeMacPsschTxOutputStats *psschStats, V2xKpi *v2xKpi, const SlPsschUeMacStatParameters psschStatsParams)
 {
-  psschStats->Save (psschStatsParams);
+  if (psschStats != nullptr)
+    {
+      psschStats->Save (psschStatsParams);
+    }
+  if (v2xKpi != nullptr)
+    {
+      v2xKpi->SavePsschTx (psschStatsParams);
+    }
 }
 
 /**
@@ -134,19 +150,32 @@ void NotifySlPscchRx (UePhyPscchRxOutputStats *pscchStats, const SlRxCtrlPacketT
  *        triggered upon the reception of SCI format 2-A and data.
  *
  * \param psschStats Pointer to the UePhyPsschRxOutputStats class,
- *        which is responsible to write the trace source parameters to a database.
+ *        which is responsible to write the trace source parameters to a database
+ *        (nullptr if the trace is not written).
+ * \param v2xKpi Pointer to the V2xKpi class computing the KPIs online
+ *        (nullptr if the KPIs are not computed online).
  * \param psschStatsParams Parameters of the trace source.
  */
-void NotifySlPsschRx (UePhyPsschRxOutputStats *psschStats, const SlRxDataPacketTraceParams psschStatsParams)
+void NotifySlPsschRx (UePhyPsschRxOutputStats *psschStats, V2xKpi *v2xKpi, const SlRxDataPacketTraceParams psschStatsParams)
 {
-  psschStats->Save (psschStatsParams);
+  if (psschStats != nullptr)
+    {
+      psschStats->Save (psschStatsParams);
+    }
+  if (v2xKpi != nullptr)
+    {
+      v2xKpi->SavePsschRx (psschStatsParams);
+    }
 }
 
 /**
  * \brief Method to listen the application level traces of type TxWithAddresses
  *        and RxWithAddresses.
  * \param stats Pointer to the UeToUePktTxRxOutputStats class,
- *        which is responsible to write the trace source parameters to a database.
+ *        which is responsible to write the trace source parameters to a database
+ *        (nullptr if the trace is not written).
+ * \param v2xKpi Pointer to the V2xKpi class computing the KPIs online
+ *        (nullptr if the KPIs are not computed online).
  * \param node The pointer to the TX or RX node
  * \param localAddrs The local IPV4 address of the node
  * \param txRx The string indicating the type of node, i.e., TX or RX
@@ -156,7 +185,7 @@ void NotifySlPsschRx (UePhyPsschRxOutputStats *psschStats, const SlRxDataPacketT
  * \param seqTsSizeHeader The SeqTsSizeHeader
  */
 void
-UePacketTraceDb (UeToUePktTxRxOutputStats *stats, Ptr<Node> node, const Address &localAddrs,
+UePacketTraceDb (UeToUePktTxRxOutputStats *stats, V2xKpi *v2xKpi, Ptr<Node> node, const Address &localAddrs,
                  std::string txRx, Ptr<const Packet> p, const Address &srcAddrs,
                  const Address &dstAddrs, const SeqTsSizeHeader &seqTsSizeHeader)
 {
@@ -165,7 +194,17 @@ UePacketTraceDb (UeToUePktTxRxOutputStats *stats, Ptr<Node> node, const Address
   uint32_t seq = seqTsSizeHeader.GetSeq ();
   uint32_t pktSize = p->GetSize () + seqTsSizeHeader.GetSerializedSize ();
 
-  stats->Save (txRx, localAddrs, nodeId, imsi, pktSize, srcAddrs, dstAddrs, seq);
+  if (stats != nullptr)
+    {
+      stats->Save (txRx, localAddrs, nodeId, imsi, pktSize, srcAddrs, dstAddrs, seq);
+    }
+  if (v2xKpi != nullptr)
+    {
+      std::string srcIp;
+      std::string dstIp;
+      UeToUePktTxRxOutputStats::GetIpAddrs (localAddrs, srcAddrs, dstAddrs, srcIp, dstIp);
+      v2xKpi->SavePktTxRx (txRx, nodeId, imsi, pktSize, srcIp, dstIp, seq);
+    }
 }
 
 /**
@@ -478,6 +517,10 @@ main (int argc, char *argv[])
   bool generateInitialPosGnuScript = false;
   bool generateGifGnuScript = false;
 
+  //flags to compute the V2X KPIs online and to write the traces in the database
+  bool onlineKpis = true;
+  bool saveTraces = true;
+
   // Where we will store the output files.
   std::string simTag = "default";
   std::string outputDir = "./";
@@ -603,6 +646,14 @@ main (int argc, char *argv[])
   cmd.AddValue ("generateGifGnuScript",
                 "generate gnuplot script to generate GIF to show UEs mobility",
                 generateGifGnuScript);
+  cmd.AddValue ("onlineKpis",
+                "compute the V2X KPIs during the simulation instead of reading "
+                "the traces back from the database",
+                onlineKpis);
+  cmd.AddValue ("saveTraces",
+                "write the RLC, MAC, PHY and application traces in the database "
+                "(required if onlineKpis is false)",
+                saveTraces);
 
 
   // Parse the command line
@@ -613,6 +664,7 @@ main (int argc, char *argv[])
    * If you need to add other checks, here is the best position to put them.
    */
   NS_ABORT_IF (centralFrequencyBandSl > 6e9);
+  NS_ABORT_MSG_IF (!onlineKpis && !saveTraces, "The traces must be written in the database to compute the V2X KPIs offline");
 
   /*
    * If the logging variable is set to true, enable the log of some components
@@ -1113,37 +1165,48 @@ main (int argc, char *argv[])
   //Datebase setup
   SQLiteOutput db (outputDir + exampleName + ".db");
 
-  UeMacPscchTxOutputStats pscchStats;
-  pscchStats.SetDb (&db, "pscchTxUeMac");
-  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPscchScheduling",
-                                 MakeBoundCallback (&NotifySlPscchScheduling, &pscchStats));
+  V2xKpi v2xKpi;
+  v2xKpi.SetDbPath (outputDir + exampleName);
+  v2xKpi.SetTxAppDuration (txAppDuration);
+  v2xKpi.SetOnlineKpis (onlineKpis);
+  V2xKpi *onlineV2xKpi = onlineKpis ? &v2xKpi : nullptr;
 
+  UeMacPscchTxOutputStats pscchStats;
   UeMacPsschTxOutputStats psschStats;
-  psschStats.SetDb (&db, "psschTxUeMac");
-  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPsschScheduling",
-                                 MakeBoundCallback (&NotifySlPsschScheduling, &psschStats));
+  UePhyPscchRxOutputStats pscchPhyStats;
+  UePhyPsschRxOutputStats psschPhyStats;
+  UeRlcRxOutputStats ueRlcRxStats;
+  UeToUePktTxRxOutputStats pktStats;
 
+  if (saveTraces)
+    {
+      pscchStats.SetDb (&db, "pscchTxUeMac");
+      Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPscchScheduling",
+                                     MakeBoundCallback (&NotifySlPscchScheduling, &pscchStats));
 
-  UePhyPscchRxOutputStats pscchPhyStats;
-  pscchPhyStats.SetDb (&db, "pscchRxUePhy");
-  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPscchTraceUe",
-                                 MakeBoundCallback (&NotifySlPscchRx, &pscchPhyStats));
+      psschStats.SetDb (&db, "psschTxUeMac");
 
-  UePhyPsschRxOutputStats psschPhyStats;
-  psschPhyStats.SetDb (&db, "psschRxUePhy");
-  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPsschTraceUe",
-                                 MakeBoundCallback (&NotifySlPsschRx, &psschPhyStats));
+      pscchPhyStats.SetDb (&db, "pscchRxUePhy");
+      Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPscchTraceUe",
+                                     MakeBoundCallback (&NotifySlPscchRx, &pscchPhyStats));
 
+      psschPhyStats.SetDb (&db, "psschRxUePhy");
 
-  UeRlcRxOutputStats ueRlcRxStats;
-  ueRlcRxStats.SetDb (&db, "rlcRx");
-  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/RxRlcPduWithTxRnti",
-                                 MakeBoundCallback (&NotifySlRlcPduRx, &ueRlcRxStats));
+      ueRlcRxStats.SetDb (&db, "rlcRx");
+      Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/RxRlcPduWithTxRnti",
+                                     MakeBoundCallback (&NotifySlRlcPduRx, &ueRlcRxStats));
 
+      pktStats.SetDb (&db, "pktTxRx");
+    }
 
+  UeMacPsschTxOutputStats *dbPsschStats = saveTraces ? &psschStats : nullptr;
+  UePhyPsschRxOutputStats *dbPsschPhyStats = saveTraces ? &psschPhyStats : nullptr;
+  UeToUePktTxRxOutputStats *dbPktStats = saveTraces ? &pktStats : nullptr;
 
-  UeToUePktTxRxOutputStats pktStats;
-  pktStats.SetDb (&db, "pktTxRx");
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPsschScheduling",
+                                 MakeBoundCallback (&NotifySlPsschScheduling, dbPsschStats, onlineV2xKpi));
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPsschTraceUe",
+                                 MakeBoundCallback (&NotifySlPsschRx, dbPsschPhyStats, onlineV2xKpi));
 
   if (!useIPv6)
     {
@@ -1152,7 +1215,7 @@ main (int argc, char *argv[])
         {
           Ipv4Address localAddrs =  clientApps.Get (ac)->GetNode ()->GetObject<Ipv4L3Protocol> ()->GetAddress (1,0).GetLocal ();
           std::cout << "Tx address: " << localAddrs << std::endl;
-          clientApps.Get (ac)->TraceConnect ("TxWithSeqTsSize", "tx", MakeBoundCallback (&UePacketTraceDb, &pktStats, clientApps.Get (ac)->GetNode (), localAddrs));
+          clientApps.Get (ac)->TraceConnect ("TxWithSeqTsSize", "tx", MakeBoundCallback (&UePacketTraceDb, dbPktStats, onlineV2xKpi, clientApps.Get (ac)->GetNode (), localAddrs));
         }
 
       // Set Rx traces
@@ -1160,7 +1223,7 @@ main (int argc, char *argv[])
         {
           Ipv4Address localAddrs =  serverApps.Get (ac)->GetNode ()->GetObject<Ipv4L3Protocol> ()->GetAddress (1,0).GetLocal ();
           std::cout << "Rx address: " << localAddrs << std::endl;
-          serverApps.Get (ac)->TraceConnect ("RxWithSeqTsSize", "rx", MakeBoundCallback (&UePacketTraceDb, &pktStats, serverApps.Get (ac)->GetNode (), localAddrs));
+          serverApps.Get (ac)->TraceConnect ("RxWithSeqTsSize", "rx", MakeBoundCallback (&UePacketTraceDb, dbPktStats, onlineV2xKpi, serverApps.Get (ac)->GetNode (), localAddrs));
         }
     }
   else
@@ -1171,7 +1234,7 @@ main (int argc, char *argv[])
           clientApps.Get (ac)->GetNode ()->GetObject<Ipv6L3Protocol> ()->AddMulticastAddress (groupAddress6);
           Ipv6Address localAddrs =  clientApps.Get (ac)->GetNode ()->GetObject<Ipv6L3Protocol> ()->GetAddress (1,1).GetAddress ();
           std::cout << "Tx address: " << localAddrs << std::endl;
-          clientApps.Get (ac)->TraceConnect ("TxWithSeqTsSize", "tx", MakeBoundCallback (&UePacketTraceDb, &pktStats, clientApps.Get (ac)->GetNode (), localAddrs));
+          clientApps.Get (ac)->TraceConnect ("TxWithSeqTsSize", "tx", MakeBoundCallback (&UePacketTraceDb, dbPktStats, onlineV2xKpi, clientApps.Get (ac)->GetNode (), localAddrs));
         }
 
       // Set Rx traces
@@ -1180,13 +1243,10 @@ main (int argc, char *argv[])
           serverApps.Get (ac)->GetNode ()->GetObject<Ipv6L3Protocol> ()->AddMulticastAddress (groupAddress6);
           Ipv6Address localAddrs =  serverApps.Get (ac)->GetNode ()->GetObject<Ipv6L3Protocol> ()->GetAddress (1,1).GetAddress ();
           std::cout << "Rx address: " << localAddrs << std::endl;
-          serverApps.Get (ac)->TraceConnect ("RxWithSeqTsSize", "rx", MakeBoundCallback (&UePacketTraceDb, &pktStats, serverApps.Get (ac)->GetNode (), localAddrs));
+          serverApps.Get (ac)->TraceConnect ("RxWithSeqTsSize", "rx", MakeBoundCallback (&UePacketTraceDb, dbPktStats, onlineV2xKpi, serverApps.Get (ac)->GetNode (), localAddrs));
         }
     }
 
-  V2xKpi v2xKpi;
-  v2xKpi.SetDbPath (outputDir + exampleName);
-  v2xKpi.SetTxAppDuration (txAppDuration);
   SavePositionPerIP (&v2xKpi);
   v2xKpi.SetRangeForV2xKpis (200);
 
@@ -1214,12 +1274,15 @@ main (int argc, char *argv[])
    * VERY IMPORTANT: Do not forget to empty the database cache, which would
    * dump the data store towards the end of the simulation in to a database.
    */
-  pktStats.EmptyCache ();
-  pscchStats.EmptyCache ();
-  psschStats.EmptyCache ();
-  pscchPhyStats.EmptyCache ();
-  psschPhyStats.EmptyCache ();
-  ueRlcRxStats.EmptyCache ();
+  if (saveTraces)
+    {
+      pktStats.EmptyCache ();
+      pscchStats.EmptyCache ();
+      psschStats.EmptyCache ();
+      pscchPhyStats.EmptyCache ();
+      psschPhyStats.EmptyCache ();
+      ueRlcRxStats.EmptyCache ();
+    }
   v2xKpi.WriteKpis ();
 
   //GtkConfigStore config;
@@ -85,7 +85,6 @@ void
 UeToUePktTxRxOutputStats::WriteCache ()
 {
   bool ret = m_db->SpinExec ("BEGIN TRANSACTION;");
-  std::ostringstream oss;
 
   for (const auto & v : m_pktCache)
     {
@@ -93,7 +92,6 @@ UeToUePktTxRxOutputStats::WriteCache ()
       std::string dstStr;
       sqlite3_stmt *stmt;
       m_db->SpinPrepare (&stmt, "INSERT INTO " + m_tableName + " VALUES (?,?,?,?,?,?,?,?,?,?,?,?);");
-      oss.str ("");
       ret = m_db->Bind (stmt, 1, v.timeSec);
       NS_ABORT_UNLESS (ret);
       ret = m_db->Bind (stmt, 2, v.txRx);
@@ -104,150 +102,27 @@ UeToUePktTxRxOutputStats::WriteCache ()
       NS_ABORT_UNLESS (ret);
       ret = m_db->Bind (stmt, 5, v.pktSize);
       NS_ABORT_UNLESS (ret);
+      GetIpAddrs (v.localAddrs, v.srcAddrs, v.dstAddrs, srcStr, dstStr);
+      ret = m_db->Bind (stmt, 6, srcStr);
+      NS_ABORT_UNLESS (ret);
       if (InetSocketAddress::IsMatchingType (v.srcAddrs))
         {
-          oss << InetSocketAddress::ConvertFrom (v.srcAddrs).GetIpv4 ();
-          if (!oss.str ().compare ("0.0.0.0"))
-            {
-              // srcAddr is not set (is "0.0.0.0")-- most likely a TX packet
-              std::ostringstream ip;
-              ip << Ipv4Address::ConvertFrom (v.localAddrs);
-              srcStr = ip.str ();
-              ret = m_db->Bind (stmt, 6, srcStr);
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 7, InetSocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-              NS_ABORT_UNLESS (ret);
-              ip.str ("");
-              ip << InetSocketAddress::ConvertFrom (v.dstAddrs).GetIpv4 ();
-              dstStr = ip.str ();
-              ret = m_db->Bind (stmt, 8, dstStr);
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 9, InetSocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 10, v.seq);
-              NS_ABORT_UNLESS (ret);
-            }
-          else
-            {
-              oss.str ("");
-              oss << InetSocketAddress::ConvertFrom (v.dstAddrs).GetIpv4 ();
-              if (!oss.str ().compare ("0.0.0.0"))
-                {
-                  // dstAddr is not set (is "0.0.0.0")
-                  std::ostringstream ip;
-                  ip << InetSocketAddress::ConvertFrom (v.srcAddrs).GetIpv4 ();
-                  srcStr = ip.str ();
-                  ret = m_db->Bind (stmt, 6, srcStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 7, InetSocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ip.str ("");
-                  ip << Ipv4Address::ConvertFrom (v.localAddrs);
-                  dstStr = ip.str ();
-                  ret = m_db->Bind (stmt, 8, dstStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 9, InetSocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 10, v.seq);
-                  NS_ABORT_UNLESS (ret);
-                }
-              else
-                {
-                  std::ostringstream ip;
-                  ip << InetSocketAddress::ConvertFrom (v.srcAddrs).GetIpv4 ();
-                  srcStr = ip.str ();
-                  ret = m_db->Bind (stmt, 6, srcStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 7, InetSocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  Ipv4Address dstIpv4Address = InetSocketAddress::ConvertFrom (v.dstAddrs).GetIpv4 ();
-                  if (dstIpv4Address.IsMulticast () || dstIpv4Address.IsBroadcast ())
-                    {
-                      // Use local address as destination address
-                      dstIpv4Address = Ipv4Address::ConvertFrom (v.localAddrs);
-                    }
-                  ip.str ("");
-                  ip << dstIpv4Address;
-                  dstStr = ip.str ();
-                  ret = m_db->Bind (stmt, 8, dstStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 9, InetSocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 10, v.seq);
-                  NS_ABORT_UNLESS (ret);
-                }
-            }
-        }
-      else if (Inet6SocketAddress::IsMatchingType (v.srcAddrs))
-        {
-          oss << Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetIpv6 ();
-          if (!oss.str ().compare ("::"))   //srcAddrs not set
-            {
-              std::ostringstream ip;
-              ip << Ipv6Address::ConvertFrom (v.localAddrs);
-              srcStr = ip.str ();
-              ret = m_db->Bind (stmt, 6, srcStr);
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 7, Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-              NS_ABORT_UNLESS (ret);
-              ip.str ("");
-              ip << Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetIpv6 ();
-              dstStr =  ip.str ();
-              ret = m_db->Bind (stmt, 8, dstStr);
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 9, Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-              NS_ABORT_UNLESS (ret);
-              ret = m_db->Bind (stmt, 10, v.seq);
-              NS_ABORT_UNLESS (ret);
-            }
-          else
-            {
-              oss.str ("");
-              oss << Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetIpv6 ();
-              if (!oss.str ().compare ("::"))   //dstAddrs not set
-                {
-                  std::ostringstream ip;
-                  ip << Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetIpv6 ();
-                  srcStr = ip.str ();
-                  ret = m_db->Bind (stmt, 6, srcStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 7, Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ip.str ("");
-                  ip << Ipv6Address::ConvertFrom (v.localAddrs);
-                  dstStr =  ip.str ();
-                  ret = m_db->Bind (stmt, 8, dstStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 9, Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 10, v.seq);
-                  NS_ABORT_UNLESS (ret);
-                }
-              else
-                {
-                  std::ostringstream ip;
-                  ip << Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetIpv6 ();
-                  srcStr = ip.str ();
-                  ret = m_db->Bind (stmt, 6, srcStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 7, Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ip.str ("");
-                  ip << Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetIpv6 ();
-                  dstStr =  ip.str ();
-                  ret = m_db->Bind (stmt, 8, dstStr);
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 9, Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
-                  NS_ABORT_UNLESS (ret);
-                  ret = m_db->Bind (stmt, 10, v.seq);
-                  NS_ABORT_UNLESS (ret);
-                }
-            }
+          ret = m_db->Bind (stmt, 7, InetSocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
+          NS_ABORT_UNLESS (ret);
+          ret = m_db->Bind (stmt, 9, InetSocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
+          NS_ABORT_UNLESS (ret);
         }
       else
         {
-          NS_FATAL_ERROR ("Unknown address type!");
+          ret = m_db->Bind (stmt, 7, Inet6SocketAddress::ConvertFrom (v.srcAddrs).GetPort ());
+          NS_ABORT_UNLESS (ret);
+          ret = m_db->Bind (stmt, 9, Inet6SocketAddress::ConvertFrom (v.dstAddrs).GetPort ());
+          NS_ABORT_UNLESS (ret);
         }
+      ret = m_db->Bind (stmt, 8, dstStr);
+      NS_ABORT_UNLESS (ret);
+      ret = m_db->Bind (stmt, 10, v.seq);
+      NS_ABORT_UNLESS (ret);
 
       ret = m_db->Bind (stmt, 11, RngSeedManager::GetSeed ());
       NS_ABORT_UNLESS (ret);
@@ -263,6 +138,56 @@ UeToUePktTxRxOutputStats::WriteCache ()
   NS_ABORT_UNLESS (ret);
 }
 
+void
+UeToUePktTxRxOutputStats::GetIpAddrs (const Address &localAddrs, const Address &srcAddrs,
+                                      const Address &dstAddrs, std::string &srcIp, std::string &dstIp)
+{
+  std::ostringstream src;
+  std::ostringstream dst;
+  if (InetSocketAddress::IsMatchingType (srcAddrs))
+    {
+      Ipv4Address srcIpv4Address = InetSocketAddress::ConvertFrom (srcAddrs).GetIpv4 ();
+      Ipv4Address dstIpv4Address = InetSocketAddress::ConvertFrom (dstAddrs).GetIpv4 ();
+      if (srcIpv4Address == Ipv4Address::GetAny ())
+        {
+          // srcAddr is not set (is "0.0.0.0")-- most likely a TX packet
+          srcIpv4Address = Ipv4Address::ConvertFrom (localAddrs);
+        }
+      else if (dstIpv4Address == Ipv4Address::GetAny ()
+               || dstIpv4Address.IsMulticast () || dstIpv4Address.IsBroadcast ())
+        {
+          // dstAddr is not set (is "0.0.0.0") or it is a group address,
+          // use local address as destination address
+          dstIpv4Address = Ipv4Address::ConvertFrom (localAddrs);
+        }
+      src << srcIpv4Address;
+      dst << dstIpv4Address;
+    }
+  else if (Inet6SocketAddress::IsMatchingType (srcAddrs))
+    {
+      Ipv6Address srcIpv6Address = Inet6SocketAddress::ConvertFrom (srcAddrs).GetIpv6 ();
+      Ipv6Address dstIpv6Address = Inet6SocketAddress::ConvertFrom (dstAddrs).GetIpv6 ();
+      if (srcIpv6Address == Ipv6Address::GetAny ())
+        {
+          //srcAddrs not set
+          srcIpv6Address = Ipv6Address::ConvertFrom (localAddrs);
+        }
+      else if (dstIpv6Address == Ipv6Address::GetAny ())
+        {
+          //dstAddrs not set
+          dstIpv6Address = Ipv6Address::ConvertFrom (localAddrs);
+        }
+      src << srcIpv6Address;
+      dst << dstIpv6Address;
+    }
+  else
+    {
+      NS_FATAL_ERROR ("Unknown address type!");
+    }
+  srcIp = src.str ();
+  dstIp = dst.str ();
+}
+
 void
 UeToUePktTxRxOutputStats::DeleteWhere (SQLiteOutput *p, uint32_t seed,
                                        uint32_t run, const std::string &table)
@@ -96,6 +96,22 @@ public:
    */
   void EmptyCache ();
 
+  /**
+   * \brief Get the source and destination IP addresses of a packet, as they
+   *        are written in the database.
+   *
+   * The local address replaces the source address if it is not set (TX
+   * packet), or the destination address if it is not set or it is a
+   * multicast or broadcast address (RX packet).
+   *
+   * \param localAddrs The local IP address of the node
+   * \param srcAddrs The source address from the trace
+   * \param dstAddrs The destination address from the trace
+   * \param srcIp The source IP address (output)
+   * \param dstIp The destination IP address (output)
+   */
+  static void GetIpAddrs (const Address &localAddrs, const Address &srcAddrs, const Address &dstAddrs, std::string &srcIp, std::string &dstIp);
+
 private:
   /**
    * \ingroup nr
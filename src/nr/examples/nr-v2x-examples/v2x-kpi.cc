@@ -67,8 +67,17 @@ V2xKpi::SetTxAppDuration (double duration)
 void
 V2xKpi::WriteKpis ()
 {
-  SavePktTxData ();
-  SavePktRxData ();
+  int rc;
+  rc = sqlite3_open (m_dbPath.c_str (), &m_db);
+  NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error open DB. Db error: " << sqlite3_errmsg (m_db));
+
+  if (!m_onlineKpis)
+    {
+      SavePktTxData ();
+      SavePktRxData ();
+      SavePsschTxData ();
+      SavePsschRxData ();
+    }
   SaveAvrgPir ();
   SaveThput ();
   ComputePsschTxStats ();
@@ -95,13 +104,150 @@ V2xKpi::FillPosPerIpMap (std::string ip, Vector pos)
   NS_ABORT_MSG_IF (insertStatus == false, "Insert Error: Pos of the ip " << ip << " already exist in the map");
 }
 
+void
+V2xKpi::SetOnlineKpis (bool online)
+{
+  m_onlineKpis = online;
+}
+
+void
+V2xKpi::SavePktTxRx (std::string txRx, uint32_t nodeId, uint64_t imsi, uint32_t pktSize, std::string srcIp, std::string dstIp, uint32_t pktSeq)
+{
+  AddPktTxRxData (Simulator::Now ().GetNanoSeconds () / (double) 1e9,
+                  txRx, nodeId, imsi, pktSize, srcIp, dstIp, pktSeq);
+}
+
+void
+V2xKpi::SavePsschTx (const SlPsschUeMacStatParameters &psschStatsParams)
+{
+  AddPsschTxData (PsschTxData (psschStatsParams.frameNum,
+                               psschStatsParams.subframeNum,
+                               psschStatsParams.slotNum,
+                               psschStatsParams.symStart,
+                               psschStatsParams.symLength,
+                               psschStatsParams.rbStart,
+                               psschStatsParams.rbLength));
+}
+
+void
+V2xKpi::SavePsschRx (const SlRxDataPacketTraceParams &psschStatsParams)
+{
+  AddPsschRxData (psschStatsParams.m_corrupt, psschStatsParams.m_sci2Corrupted);
+}
+
+void
+V2xKpi::AddPktTxRxData (double time, const std::string &txRx, uint32_t nodeId, uint64_t imsi, uint32_t pktSize, const std::string &srcIp, const std::string &dstIp, uint32_t pktSeq)
+{
+  if (txRx == "tx")
+    {
+      PktTxData &txData = m_txDataMap[nodeId];
+      if (txData.numTxPkts == 0)
+        {
+          txData.txRx = txRx;
+          txData.nodeId = nodeId;
+          txData.imsi = imsi;
+          txData.ipAddrs = srcIp;
+        }
+      txData.numTxPkts++;
+      return;
+    }
+
+  NS_ASSERT_MSG (txRx == "rx", "Unknown packet trace type " << txRx);
+  PktRxData &rxData = m_rxDataMap[nodeId][srcIp];
+  if (rxData.numRxPkts == 0)
+    {
+      rxData.txRx = txRx;
+      rxData.nodeId = nodeId;
+      rxData.imsi = imsi;
+      rxData.ipAddrs = dstIp;
+    }
+
+  if (rxData.pirCounter == 0 && rxData.lastPktRxTime == 0.0)
+    {
+      //this is the first packet, just store the time
+      rxData.lastPktRxTime = time;
+    }
+  else
+    {
+      rxData.pirSum += time - rxData.lastPktRxTime;
+      rxData.lastPktRxTime = time;
+      rxData.pirCounter++;
+    }
+
+  rxData.numRxPkts++;
+  rxData.rxBytes += pktSize;
+
+  if (pktSeq >= rxData.rxPktSeqs.size ())
+    {
+      rxData.rxPktSeqs.resize (std::max<std::size_t> (static_cast<std::size_t> (pktSeq) + 1, 2 * rxData.rxPktSeqs.size ()), false);
+    }
+  if (!rxData.rxPktSeqs[pktSeq])
+    {
+      rxData.rxPktSeqs[pktSeq] = true;
+      rxData.numRxPktSeqs++;
+    }
+}
+
+void
+V2xKpi::AddPsschTxData (const PsschTxData &data)
+{
+  m_totalPsschTx++;
+
+  //Only the transmissions of the same frame, subframe and slot can overlap
+  uint64_t key = (static_cast<uint64_t> (data.frame) << 32) | (static_cast<uint64_t> (data.subFrame) << 16) | data.slot;
+  PsschTxPerSlot &slotTx = m_psschTxPerSlot[key];
+
+  auto it = std::find (slotTx.nonOverLapPsschTx.begin (), slotTx.nonOverLapPsschTx.end (), data);
+  if (it != slotTx.nonOverLapPsschTx.end ())
+    {
+      slotTx.overLapPsschTx.push_back (data);
+      slotTx.overLapPsschTx.push_back (*it);
+      slotTx.nonOverLapPsschTx.erase (it);
+    }
+  else
+    {
+      auto it = std::find (slotTx.overLapPsschTx.begin (), slotTx.overLapPsschTx.end (), data);
+      if (it != slotTx.overLapPsschTx.end ())
+        {
+          slotTx.overLapPsschTx.push_back (data);
+        }
+      else
+        {
+          slotTx.nonOverLapPsschTx.push_back (data);
+        }
+    }
+}
+
+void
+V2xKpi::AddPsschRxData (bool psschCorrupt, bool sci2Corrupt)
+{
+  m_totalPsschTbRx++;
+
+  if (!psschCorrupt)
+    {
+      ++m_psschSuccessCount;
+    }
+
+  if (!sci2Corrupt)
+    {
+      ++m_sci2SuccessCount;
+    }
+}
+
+double
+V2xKpi::GetTxRxDistance (const std::string &txIp, const std::string &rxIp) const
+{
+  auto itRxIpPos = m_posPerIp.find (rxIp);
+  NS_ABORT_MSG_IF (itRxIpPos == m_posPerIp.end (), "Unable to find the position of RX IP " << rxIp);
+  auto itTxIpPos = m_posPerIp.find (txIp);
+  NS_ABORT_MSG_IF (itTxIpPos == m_posPerIp.end (), "Unable to find the position of TX IP " << txIp);
+  return CalculateDistance (itRxIpPos->second, itTxIpPos->second);
+}
+
 void
 V2xKpi::SavePktRxData ()
 {
   int rc;
-  rc = sqlite3_open (m_dbPath.c_str (), &m_db);
-  NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error open DB. Db error: " << sqlite3_errmsg (m_db));
-
   sqlite3_stmt *stmt;
   std::string sql ("SELECT * FROM pktTxRx WHERE txRx = 'rx' AND txRx IS NOT NULL AND SEED = ? AND RUN = ?;");
   rc = sqlite3_prepare_v2 (m_db, sql.c_str (), static_cast<int> (sql.size ()), &stmt, nullptr);
@@ -111,57 +257,14 @@ V2xKpi::SavePktRxData ()
 
   while ((rc = sqlite3_step (stmt)) == SQLITE_ROW)
     {
-      uint32_t nodeId = sqlite3_column_int (stmt, 2);
-      auto nodeIt = m_rxDataMap.find (nodeId);
-      if (nodeIt == m_rxDataMap.end ())
-        {
-          //NS_LOG_UNCOND ("nodeId = " << nodeId << " not found creating new entry");
-          std::map <std::string, std::vector <PktTxRxData> > secondMap;
-          std::string srcIp = std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5)));
-          std::vector <PktTxRxData> data;
-          PktTxRxData result (sqlite3_column_double (stmt, 0),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
-                              sqlite3_column_int (stmt, 2),
-                              sqlite3_column_int (stmt, 3),
-                              sqlite3_column_int (stmt, 4),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 7))),
-                              sqlite3_column_int (stmt, 9));
-          data.push_back (result);
-          secondMap.insert (std::make_pair (srcIp, data));
-          m_rxDataMap.insert (std::make_pair (nodeId, secondMap));
-        }
-      else
-        {
-          //NS_LOG_UNCOND ("nodeId = " << nodeId << " found");
-          std::string srcIp = std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5)));
-          auto txIt = nodeIt->second.find (srcIp);
-          if (txIt == nodeIt->second.end ())
-            {
-              //NS_LOG_UNCOND ("srcIp = " << srcIp << " not found creating new entry");
-              std::vector <PktTxRxData> data;
-              PktTxRxData result (sqlite3_column_double (stmt, 0),
-                                  std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
-                                  sqlite3_column_int (stmt, 2),
-                                  sqlite3_column_int (stmt, 3),
-                                  sqlite3_column_int (stmt, 4),
-                                  std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 7))),
-                                  sqlite3_column_int (stmt, 9));
-              data.push_back (result);
-              nodeIt->second.insert (std::make_pair (srcIp, data));
-            }
-          else
-            {
-              //NS_LOG_UNCOND ("srcIp = " << srcIp << " found");
-              PktTxRxData result (sqlite3_column_double (stmt, 0),
-                                  std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
-                                  sqlite3_column_int (stmt, 2),
-                                  sqlite3_column_int (stmt, 3),
-                                  sqlite3_column_int (stmt, 4),
-                                  std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 7))),
-                                  sqlite3_column_int (stmt, 9));
-              txIt->second.push_back (result);
-            }
-        }
+      AddPktTxRxData (sqlite3_column_double (stmt, 0),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
+                      sqlite3_column_int (stmt, 2),
+                      sqlite3_column_int (stmt, 3),
+                      sqlite3_column_int (stmt, 4),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5))),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 7))),
+                      sqlite3_column_int (stmt, 9));
     }
 
   NS_ABORT_MSG_UNLESS (rc == SQLITE_DONE, "Error not DONE. Db error: " << sqlite3_errmsg (m_db));
@@ -195,7 +298,7 @@ V2xKpi::SaveAvrgPir ()
     {
       for (const auto &it2:it.second)
         {
-          double avrgPir = ComputeAvrgPir (it2.first.c_str (), it2.second);
+          double avrgPir = ComputeAvrgPir (it2.first, it2.second);
           if (avrgPir == -1.0)
             {
               //It may happen that a node would rxed only one pkt from a
@@ -204,7 +307,7 @@ V2xKpi::SaveAvrgPir ()
               continue;
             }
           //NS_LOG_UNCOND ("Avrg PIR " << avrgPir);
-          PktTxRxData data = it2.second.at (0);
+          const PktRxData &data = it2.second;
           sqlite3_stmt *stmt;
           std::string cmd = "INSERT INTO " + tableName + " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);";
           rc = sqlite3_prepare_v2 (m_db, cmd.c_str (), static_cast<int> (cmd.size ()), &stmt, nullptr);
@@ -229,23 +332,11 @@ V2xKpi::SaveAvrgPir ()
     }
 }
 double
-V2xKpi::ComputeAvrgPir (std::string ipTx, std::vector <PktTxRxData> data)
+V2xKpi::ComputeAvrgPir (const std::string &ipTx, const PktRxData &data)
 {
-  uint64_t pirCounter = 0;
-  double lastPktRxTime = 0.0;
-  double pir = 0.0;
-
-  //NS_LOG_UNCOND ("Packet Vector size " << data.size () << " to compute average PIR");
   if (m_range > 0)
     {
-      PktTxRxData dataIpRx = data.at (0);
-      auto itRxIpPos = m_posPerIp.find (dataIpRx.ipAddrs);
-      NS_ABORT_MSG_IF (itRxIpPos == m_posPerIp.end (), "Unable to find the position of RX IP " << dataIpRx.ipAddrs);
-      Vector rxIpPos = itRxIpPos->second;
-      auto itTxIpPos = m_posPerIp.find (ipTx);
-      NS_ABORT_MSG_IF (itTxIpPos == m_posPerIp.end (), "Unable to find the position of TX IP " << ipTx);
-      Vector txIpPos = itTxIpPos->second;
-      double distance = CalculateDistance (rxIpPos, txIpPos);
+      double distance = GetTxRxDistance (ipTx, data.ipAddrs);
       m_interTxRxDistance = distance;
       if (distance > m_range)
         {
@@ -253,31 +344,16 @@ V2xKpi::ComputeAvrgPir (std::string ipTx, std::vector <PktTxRxData> data)
         }
     }
 
-  for (const auto &it:data)
-    {
-      if (pirCounter == 0 && lastPktRxTime == 0.0)
-        {
-          //this is the first packet, just store the time and get out
-          lastPktRxTime = it.time;
-          continue;
-        }
-
-      // NS_LOG_UNCOND ("it.time - lastPktRxTime " << it.time - lastPktRxTime);
-      pir = pir + (it.time - lastPktRxTime);
-      lastPktRxTime = it.time;
-      pirCounter++;
-    }
   double avrgPir = 0.0;
-  if (pirCounter == 0)
+  if (data.pirCounter == 0)
     {
       //It may happen that a node would rxed only one pkt from a
       //particular tx node. In that case, PIR can not be computed.
-      //assert added just to check range based
       avrgPir = -1.0;
     }
   else
     {
-      avrgPir = pir / pirCounter;
+      avrgPir = data.pirSum / data.pirCounter;
     }
   return avrgPir;
 }
@@ -304,11 +380,10 @@ V2xKpi::SaveAvrgPrr ()
 
   DeleteWhere (RngSeedManager::GetSeed (), RngSeedManager::GetRun (), tableName);
 
-  std::map <uint32_t, std::vector <PktTxRxData> >::const_iterator it;
-  for (it = m_txDataMap.cbegin (); it != m_txDataMap.cend (); it++)
+  for (const auto &it:m_txDataMap)
     {
       uint32_t numNeib = 0;
-      double avrgPrr = ComputeAvrgPrr (it, numNeib);
+      double avrgPrr = ComputeAvrgPrr (it.second, numNeib);
       if (avrgPrr == -1.0)
         {
           continue;
@@ -318,10 +393,10 @@ V2xKpi::SaveAvrgPrr ()
       rc = sqlite3_prepare_v2 (m_db, cmd.c_str (), static_cast<int> (cmd.size ()), &stmt, nullptr);
       NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error INSERT. Db error: " << sqlite3_errmsg (m_db));
 
-      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 1, it->second.at (0).txRx.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
-      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 2, it->second.at (0).nodeId) == SQLITE_OK);
-      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 3, it->second.at (0).imsi) == SQLITE_OK);
-      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 4,it->second.at (0).ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
+      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 1, it.second.txRx.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
+      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 2, it.second.nodeId) == SQLITE_OK);
+      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 3, it.second.imsi) == SQLITE_OK);
+      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 4,it.second.ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
       NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 5, m_range) == SQLITE_OK);
       NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 6, numNeib) == SQLITE_OK);
       NS_ABORT_UNLESS (sqlite3_bind_double (stmt, 7, avrgPrr) == SQLITE_OK);
@@ -337,92 +412,48 @@ V2xKpi::SaveAvrgPrr ()
 }
 
 double
-V2xKpi::ComputeAvrgPrr (std::map <uint32_t, std::vector <PktTxRxData> >::const_iterator &txIt, uint32_t &numNeib)
+V2xKpi::ComputeAvrgPrr (const PktTxData &txData, uint32_t &numNeib)
 {
-  std::string txIp = txIt->second.at (0).ipAddrs;
-  auto txIpPosIt = m_posPerIp.find (txIp);
-  Vector txIpPos = txIpPosIt->second;
-  //std::cout << "Tx IP " << txIp << " pos " << txIpPos << std::endl;
-
-  std::map<std::string, std::vector<uint32_t> > pktSeqPerRx;
+  const std::string &txIp = txData.ipAddrs;
+  numNeib = 0;
+  double pktRxCount = 0;
 
   for (const auto &it:m_rxDataMap)
     {
-      //we can read the RX IP from any PktTxRxData of any TX
-      std::string rxIp = it.second.begin ()->second.at (0).ipAddrs;
-      auto rxIpPosIt = m_posPerIp.find (rxIp);
-      Vector rxIpPos = rxIpPosIt->second;
-      double txRxDist = CalculateDistance (rxIpPos, txIpPos);
+      //we can read the RX IP from any PktRxData of any TX
+      const std::string &rxIp = it.second.begin ()->second.ipAddrs;
       //go to the next RX IP if the current RX IP is out of range AND m_range is non-zero
       //the condition m_range > 0.0 is to ignore range based PRR and consider
       //all rx nodes as potential receivers.
-      if (txRxDist > m_range && m_range > 0.0)
+      if (m_range > 0.0 && GetTxRxDistance (txIp, rxIp) > m_range)
         {
-          //std::cout << "Rx IP " << rxIp << " at " <<  rxIpPos << " is out of range" << std::endl;
           continue;
         }
-      else
+      //if with in range Rx IP did not rxed any packet from Tx IP
+      //we still need to consider it as valid neighbor.
+      numNeib++;
+      auto txIt = it.second.find (txIp);
+      if (txIt != it.second.end ())
         {
-          std::vector<uint32_t> seqVec;
-          //RX IP is in range. Lets find out if this RX IP rexed any pkt from
-          //Tx IP
-          auto txIt = it.second.find (txIp);
-          if (txIt == it.second.end ())
-            {
-              //if with in range Rx IP did not rxed any packet from Tx IP
-              //we still need to consider it as valid neighbor. Therefore,
-              //I am inserting it in the neighbor vector which received
-              //a bit unrealistic packet seq of 2^32
-              seqVec.push_back (std::numeric_limits <uint32_t>::max ());
-              bool insertStatus = pktSeqPerRx.emplace (std::make_pair (rxIp,seqVec)).second;
-              NS_ASSERT_MSG (insertStatus == true, "Rx IP " << rxIp << " already present in pktSeqPerRx map");
-              //now continue to next RX IP
-              continue;
-            }
-          for (const auto &pktVectIt:txIt->second)
-            {
-              //push all the pkt seq number this receiver received from the TX IP
-              seqVec.push_back (pktVectIt.pktSeq);
-            }
-          bool insertStatus = pktSeqPerRx.emplace (std::make_pair (rxIp,seqVec)).second;
-          NS_ASSERT_MSG (insertStatus == true, "Rx IP " << rxIp << " already present in pktSeqPerRx map");
+          //each distinct packet seq this receiver received from the TX IP
+          //corresponds to one packet transmitted by the TX IP
+          pktRxCount += txIt->second.numRxPktSeqs;
         }
     }
 
-  numNeib = pktSeqPerRx.size ();
-
-  //std::cout << "IP " << txIp << " has " << pktSeqPerRx.size () << " neighbors" << std::endl;
-  //std::cout << "IP " << txIp << " has txed " << txIt->second.size ()<< " packets" << std::endl;
-
   //if none of the rx nodes is in range do not log such PRR
-  if (pktSeqPerRx.size () == 0)
+  if (numNeib == 0)
     {
       return -1.0;
     }
 
-  double pktRxCount = 0;
-
-  for (const auto &itPktData:txIt->second)
-    {
-      //iterating over each pkt tx by the transmitter
-      for (const auto &itRx:pktSeqPerRx)
-        {
-          if (std::find (itRx.second.begin(), itRx.second.end(), itPktData.pktSeq) != itRx.second.end())
-          {
-              pktRxCount++;
-          }
-        }
-    }
-
   //if none of the rx nodes in range received any packet return 0
   if (pktRxCount == 0)
     {
       return 0.0;
     }
 
-  double avrgPrr = pktRxCount / (txIt->second.size () * pktSeqPerRx.size ());
-
-  //std::cout << "Tx IP " << txIp << " has average PRR of " << avrgPrr << std::endl;
+  double avrgPrr = pktRxCount / (txData.numTxPkts * numNeib);
 
   return avrgPrr;
 }
@@ -456,7 +487,7 @@ V2xKpi::SaveThput ()
         {
           double thput = ComputeThput (it2.second);
           //NS_LOG_UNCOND ("thput " << thput << " kbps");
-          PktTxRxData data = it2.second.at (0);
+          const PktRxData &data = it2.second;
           sqlite3_stmt *stmt;
           std::string cmd = "INSERT INTO " + tableName + " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
           rc = sqlite3_prepare_v2 (m_db, cmd.c_str (), static_cast<int> (cmd.size ()), &stmt, nullptr);
@@ -468,7 +499,7 @@ V2xKpi::SaveThput ()
           NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 4, it2.first.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
           NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 5, GetTotalTxPkts (it2.first)) == SQLITE_OK);
           NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 6, data.ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
-          NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 7, static_cast <uint64_t> (it2.second.size ())) == SQLITE_OK);
+          NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 7, it2.second.numRxPkts) == SQLITE_OK);
           NS_ABORT_UNLESS (sqlite3_bind_double (stmt, 8, thput) == SQLITE_OK);
           NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 9, RngSeedManager::GetSeed ()) == SQLITE_OK);
           NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 10, RngSeedManager::GetRun ()) == SQLITE_OK);
@@ -486,7 +517,7 @@ V2xKpi::SaveThput ()
       NS_LOG_DEBUG ("Total number of transmitters " << m_txDataMap.size ());
       //Lets read the first entry of our m_rxDataMap just to read some info of
       //the RX node.
-      PktTxRxData data = it.second.begin ()->second.at (0);
+      const PktRxData &data = it.second.begin ()->second;
       uint32_t numTx = 0;
       auto itToRxNode = m_txDataMap.find (data.nodeId);
       if (itToRxNode != m_txDataMap.end ())
@@ -507,11 +538,11 @@ V2xKpi::SaveThput ()
         {
           for (const auto &itTx:m_txDataMap)
             {
-              if (it.second.find (itTx.second.at (0).ipAddrs) == it.second.end ())
+              if (it.second.find (itTx.second.ipAddrs) == it.second.end ())
                 {
                   //we didnt find the TX in our m_rxDataMap.
                   //avoid my own IP
-                  if (itTx.second.at (0).ipAddrs != data.ipAddrs)
+                  if (itTx.second.ipAddrs != data.ipAddrs)
                     {
                       sqlite3_stmt *stmt;
                       std::string cmd = "INSERT INTO " + tableName + " VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
@@ -521,8 +552,8 @@ V2xKpi::SaveThput ()
                       NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 1, data.txRx.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
                       NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 2, data.nodeId) == SQLITE_OK);
                       NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 3, data.imsi) == SQLITE_OK);
-                      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 4, itTx.second.at (0).ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
-                      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 5, GetTotalTxPkts (itTx.second.at (0).ipAddrs)) == SQLITE_OK);
+                      NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 4, itTx.second.ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
+                      NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 5, itTx.second.numTxPkts) == SQLITE_OK);
                       NS_ABORT_UNLESS (sqlite3_bind_text (stmt, 6, data.ipAddrs.c_str (), -1, SQLITE_STATIC) == SQLITE_OK);
                       NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 7, 0) == SQLITE_OK); // zero rxed pkets
                       NS_ABORT_UNLESS (sqlite3_bind_double (stmt, 8, 0) == SQLITE_OK); // zero thput
@@ -541,19 +572,12 @@ V2xKpi::SaveThput ()
 }
 
 double
-V2xKpi::ComputeThput (std::vector <PktTxRxData> data)
+V2xKpi::ComputeThput (const PktRxData &data)
 {
   NS_ABORT_MSG_IF (m_txAppDuration == 0.0, "Can not compute throughput with " << m_txAppDuration << " duration");
-  uint64_t rxByteCounter = 0;
-
-  //NS_LOG_UNCOND ("Packet Vector size " << data.size () << " to throughput");
-  for (const auto &it:data)
-    {
-      rxByteCounter += it.pktSize;
-    }
 
   //thput in kpbs
-  double thput = (rxByteCounter * 8) / m_txAppDuration / 1000.0;
+  double thput = (data.rxBytes * 8) / m_txAppDuration / 1000.0;
   return thput;
 }
 
@@ -561,9 +585,6 @@ void
 V2xKpi::SavePktTxData ()
 {
   int rc;
-  rc = sqlite3_open (m_dbPath.c_str (), &m_db);
-  NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error open DB. Db error: " << sqlite3_errmsg (m_db));
-
   sqlite3_stmt *stmt;
   std::string sql ("SELECT * FROM pktTxRx WHERE txRx = 'tx' AND txRx IS NOT NULL AND SEED = ? AND RUN = ?;");
   rc = sqlite3_prepare_v2 (m_db, sql.c_str (), static_cast<int> (sql.size ()), &stmt, nullptr);
@@ -573,33 +594,14 @@ V2xKpi::SavePktTxData ()
 
   while ((rc = sqlite3_step (stmt)) == SQLITE_ROW)
     {
-      uint32_t nodeId = sqlite3_column_int (stmt, 2);
-      auto nodeIt = m_txDataMap.find (nodeId);
-      if (nodeIt == m_txDataMap.end ())
-        {
-          //NS_LOG_UNCOND ("nodeId = " << nodeId << " not found creating new entry");
-          PktTxRxData result (sqlite3_column_double (stmt, 0),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
-                              sqlite3_column_int (stmt, 2),
-                              sqlite3_column_int (stmt, 3),
-                              sqlite3_column_int (stmt, 4),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5))),
-                              sqlite3_column_int (stmt, 9));
-          std::vector <PktTxRxData> data;
-          data.push_back (result);
-          m_txDataMap.insert (std::make_pair (nodeId, data));
-        }
-      else
-        {
-          PktTxRxData result (sqlite3_column_double (stmt, 0),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
-                              sqlite3_column_int (stmt, 2),
-                              sqlite3_column_int (stmt, 3),
-                              sqlite3_column_int (stmt, 4),
-                              std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5))),
-                              sqlite3_column_int (stmt, 9));
-          nodeIt->second.push_back (result);
-        }
+      AddPktTxRxData (sqlite3_column_double (stmt, 0),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 1))),
+                      sqlite3_column_int (stmt, 2),
+                      sqlite3_column_int (stmt, 3),
+                      sqlite3_column_int (stmt, 4),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 5))),
+                      std::string (reinterpret_cast< const char* > (sqlite3_column_text (stmt, 7))),
+                      sqlite3_column_int (stmt, 9));
     }
 
   NS_ABORT_MSG_UNLESS (rc == SQLITE_DONE, "Error not DONE. Db error: " << sqlite3_errmsg (m_db));
@@ -614,9 +616,9 @@ V2xKpi::GetTotalTxPkts (std::string srcIpAddrs)
   uint64_t totalTxPkts = 0;
   for (const auto &it:m_txDataMap)
     {
-      if (it.second.at (0).ipAddrs == srcIpAddrs)
+      if (it.second.ipAddrs == srcIpAddrs)
         {
-          totalTxPkts = it.second.size ();
+          totalTxPkts = it.second.numTxPkts;
           break;
         }
     }
@@ -625,24 +627,17 @@ V2xKpi::GetTotalTxPkts (std::string srcIpAddrs)
 }
 
 void
-V2xKpi::ComputePsschTxStats ()
+V2xKpi::SavePsschTxData ()
 {
   int rc;
-  rc = sqlite3_open (m_dbPath.c_str (), &m_db);
-  NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error open DB. Db error: " << sqlite3_errmsg (m_db));
-
   sqlite3_stmt *stmt;
   std::string sql ("SELECT * FROM psschTxUeMac WHERE SEED = ? AND RUN = ?;");
   rc = sqlite3_prepare_v2 (m_db, sql.c_str (), static_cast<int> (sql.size ()), &stmt, nullptr);
   NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error SELECT. Db error: " << sqlite3_errmsg (m_db));
   NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 1, RngSeedManager::GetSeed ()) == SQLITE_OK);
   NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 2, RngSeedManager::GetRun ()) == SQLITE_OK);
-  uint32_t rowCount = 0;
-  std::vector <PsschTxData> nonOverLapPsschTx;
-  std::vector <PsschTxData> overLapPsschTx;
   while ((rc = sqlite3_step (stmt)) == SQLITE_ROW)
     {
-      rowCount++;
       PsschTxData result (sqlite3_column_int (stmt, 5),
                           sqlite3_column_int (stmt, 6),
                           sqlite3_column_int (stmt, 7),
@@ -650,45 +645,30 @@ V2xKpi::ComputePsschTxStats ()
                           sqlite3_column_int (stmt, 9),
                           sqlite3_column_int (stmt, 11),
                           sqlite3_column_int (stmt, 12));
-
-      if (nonOverLapPsschTx.size () == 0 && nonOverLapPsschTx.size () == 0)
-        {
-          nonOverLapPsschTx.push_back (result);
-        }
-      else
-        {
-          auto it = std::find (nonOverLapPsschTx.begin (), nonOverLapPsschTx.end (), result);
-          if (it != nonOverLapPsschTx.end ())
-            {
-              overLapPsschTx.push_back (result);
-              overLapPsschTx.push_back (*it);
-              nonOverLapPsschTx.erase (it);
-            }
-          else
-            {
-              auto it = std::find (overLapPsschTx.begin (), overLapPsschTx.end (), result);
-              if (it != overLapPsschTx.end ())
-                {
-                  overLapPsschTx.push_back (result);
-                }
-              else
-                {
-                  nonOverLapPsschTx.push_back (result);
-                }
-            }
-        }
+      AddPsschTxData (result);
     }
 
   NS_ABORT_MSG_UNLESS (rc == SQLITE_DONE, "Error not DONE. Db error: " << sqlite3_errmsg (m_db));
 
   rc = sqlite3_finalize (stmt);
   NS_ABORT_MSG_UNLESS (rc == SQLITE_OK || rc == SQLITE_DONE, "Could not correctly finalize the statement. Db error: " << sqlite3_errmsg (m_db));
+}
 
+void
+V2xKpi::ComputePsschTxStats ()
+{
+  uint32_t numNonOverLapPsschTx = 0;
+  uint32_t numOverLapPsschTx = 0;
+  for (const auto &it:m_psschTxPerSlot)
+    {
+      numNonOverLapPsschTx += it.second.nonOverLapPsschTx.size ();
+      numOverLapPsschTx += it.second.overLapPsschTx.size ();
+    }
 
-  //NS_LOG_UNCOND ("Non-overlapping Tx " << nonOverLapPsschTx.size ());
-  //NS_LOG_UNCOND ("overlapping Tx " << overLapPsschTx.size ());
-  //NS_LOG_UNCOND ("Total rows " << rowCount);
-  SaveSimultPsschTxStats (rowCount, nonOverLapPsschTx.size (), overLapPsschTx.size ());
+  //NS_LOG_UNCOND ("Non-overlapping Tx " << numNonOverLapPsschTx);
+  //NS_LOG_UNCOND ("overlapping Tx " << numOverLapPsschTx);
+  //NS_LOG_UNCOND ("Total rows " << m_totalPsschTx);
+  SaveSimultPsschTxStats (m_totalPsschTx, numNonOverLapPsschTx, numOverLapPsschTx);
 }
 
 void
@@ -727,50 +707,34 @@ V2xKpi::SaveSimultPsschTxStats (uint32_t totalPsschTx, uint32_t numNonOverLapPss
 }
 
 void
-V2xKpi::ComputePsschTbCorruptionStats ()
+V2xKpi::SavePsschRxData ()
 {
   int rc;
-  rc = sqlite3_open (m_dbPath.c_str (), &m_db);
-  NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error open DB. Db error: " << sqlite3_errmsg (m_db));
-
   sqlite3_stmt *stmt;
   std::string sql ("SELECT * FROM psschRxUePhy WHERE SEED = ? AND RUN = ?;");
   rc = sqlite3_prepare_v2 (m_db, sql.c_str (), static_cast<int> (sql.size ()), &stmt, nullptr);
   NS_ABORT_MSG_UNLESS (rc == SQLITE_OK, "Error SELECT. Db error: " << sqlite3_errmsg (m_db));
   NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 1, RngSeedManager::GetSeed ()) == SQLITE_OK);
   NS_ABORT_UNLESS (sqlite3_bind_int (stmt, 2, RngSeedManager::GetRun ()) == SQLITE_OK);
-  uint32_t rowCount = 0;
-  uint32_t psschSuccessCount = 0;
-  uint32_t sci2SuccessCount = 0;
-
 
   while ((rc = sqlite3_step (stmt)) == SQLITE_ROW)
     {
-      rowCount++;
-      uint8_t psschcorrupt = sqlite3_column_int (stmt, 21);
-      uint8_t sci2corrupt = sqlite3_column_int (stmt, 23);
-
-      if (!psschcorrupt)
-        {
-          ++psschSuccessCount;
-        }
-
-      if (!sci2corrupt)
-        {
-          ++sci2SuccessCount;
-        }
+      AddPsschRxData (sqlite3_column_int (stmt, 21), sqlite3_column_int (stmt, 23));
     }
 
   NS_ABORT_MSG_UNLESS (rc == SQLITE_DONE, "Error not DONE. Db error: " << sqlite3_errmsg (m_db));
 
   rc = sqlite3_finalize (stmt);
   NS_ABORT_MSG_UNLESS (rc == SQLITE_OK || rc == SQLITE_DONE, "Could not correctly finalize the statement. Db error: " << sqlite3_errmsg (m_db));
+}
 
-
-  //NS_LOG_UNCOND ("psschSuccessCount " << psschSuccessCount);
-  //NS_LOG_UNCOND ("sci2SuccessCount " << sci2SuccessCount);
-  //NS_LOG_UNCOND ("Total rows " << rowCount);
-  SavePsschTbCorruptionStats (rowCount, psschSuccessCount, sci2SuccessCount);
+void
+V2xKpi::ComputePsschTbCorruptionStats ()
+{
+  //NS_LOG_UNCOND ("psschSuccessCount " << m_psschSuccessCount);
+  //NS_LOG_UNCOND ("sci2SuccessCount " << m_sci2SuccessCount);
+  //NS_LOG_UNCOND ("Total rows " << m_totalPsschTbRx);
+  SavePsschTbCorruptionStats (m_totalPsschTbRx, m_psschSuccessCount, m_sci2SuccessCount);
 }
 
 void
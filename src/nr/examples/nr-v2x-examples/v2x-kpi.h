@@ -20,21 +20,33 @@
 #define V2X_KPI
 
 #include <ns3/core-module.h>
+#include <ns3/nr-sl-phy-mac-common.h>
 #include <inttypes.h>
+#include <unordered_map>
 #include <vector>
 #include <sqlite3.h>
 
 namespace ns3 {
 
 /**
- * \brief Class which reads the specific tables of a given DB to
- *        compute V2X KPIs. It could compute following KPIs:
+ * \brief Class which computes V2X KPIs from the traces of an NR V2X
+ *        simulation, and writes them in specific tables of a given DB.
+ *        It could compute following KPIs:
  *        - Average PIR
  *        - Average PRR
  *        - Throughput
  *        - Simultaneous Pssch Tx
  *        - Pssch TB Rx
  *
+ * The KPIs are computed by aggregating the traces per link, i.e., per
+ * (TX, RX) pair, without storing each packet. By default the traces are
+ * read, at the end of the simulation, from the tables written by
+ * UeToUePktTxRxOutputStats, UeMacPsschTxOutputStats and
+ * UePhyPsschRxOutputStats. If the online KPIs are enabled, the traces are
+ * instead fed to this class during the simulation, and the tables of the
+ * traces do not need to be written.
+ *
+ * \see SetOnlineKpis
  * \see SaveAvrgPir
  * \see SaveAvrgPrr
  * \see SaveThput
@@ -94,38 +106,77 @@ public:
    * \param range The inter-node-distance (2D) in meter
    */
   void SetRangeForV2xKpis (uint16_t range);
+  /**
+   * \brief Compute the KPIs from the traces fed during the simulation.
+   *
+   * If this flag is set, the methods SavePktTxRx, SavePsschTx and SavePsschRx
+   * must be connected to the respective traces, and WriteKpis does not read
+   * the tables of the traces from the DB.
+   *
+   * \param online Flag to compute the KPIs online
+   */
+  void SetOnlineKpis (bool online);
+  /**
+   * \brief Save a packet transmission or reception of the application layer
+   *        to compute the online KPIs.
+   *
+   * \param txRx The string indicating the type of node, i.e., TX or RX
+   * \param nodeId The node id
+   * \param imsi The IMSI
+   * \param pktSize The packet size
+   * \param srcIp The source IP address of the packet
+   * \param dstIp The destination IP address of the packet
+   * \param pktSeq The packet sequence number
+   *
+   * \see UeToUePktTxRxOutputStats::GetIpAddrs
+   */
+  void SavePktTxRx (std::string txRx, uint32_t nodeId, uint64_t imsi, uint32_t pktSize, std::string srcIp, std::string dstIp, uint32_t pktSeq);
+  /**
+   * \brief Save a PSSCH transmission of the SlPsschScheduling trace of
+   *        NrUeMac to compute the online KPIs.
+   * \param psschStatsParams The PSSCH stats parameters
+   */
+  void SavePsschTx (const SlPsschUeMacStatParameters &psschStatsParams);
+  /**
+   * \brief Save a PSSCH reception of the RxPsschTraceUe trace of
+   *        NrSpectrumPhy to compute the online KPIs.
+   * \param psschStatsParams The PSSCH RX stats parameters
+   */
+  void SavePsschRx (const SlRxDataPacketTraceParams &psschStatsParams);
 
 private:
   /**
    * \ingroup nr
-   * \brief PktTxRxData struct to store information read from a table in the
-   *        database storing the information communicated by TX/RX application
-   *        layer traces.
-   *
+   * \brief PktTxData struct to store the aggregated information communicated
+   *        by the TX application layer trace of a transmitting node.
    */
-  struct PktTxRxData
+  struct PktTxData
   {
-    /**
-     * \brief PktTxRxData constructor
-     * \param time The time value in the table
-     * \param txRx Nature of the trace, i.e., TX or RX
-     * \param nodeId The node id
-     * \param imsi The IMSI of the UE
-     * \param pktSize The packet size
-     * \param ipAddrs The IP address of the node
-     * \param pktSeq The packet sequence number
-     */
-    PktTxRxData (double time, std::string txRx, uint32_t nodeId, uint64_t imsi, uint32_t pktSize, std::string ipAddrs, uint32_t pktSeq)
-      : time (time), txRx (txRx), nodeId (nodeId), imsi (imsi), pktSize (pktSize), ipAddrs (ipAddrs), pktSeq (pktSeq)
-    {}
-
-    double time; //!< time
     std::string txRx {""}; //!< tx/rx indicator
-    uint32_t nodeId {std::numeric_limits <uint32_t>::max ()}; //!< node id of tx or rx node
-    uint64_t imsi {std::numeric_limits <uint64_t>::max ()}; //!< IMSI of the tx and rx node
-    uint32_t pktSize; //!< packet size
-    std::string ipAddrs; //!< The ip address of the node.
-    uint32_t pktSeq {std::numeric_limits <uint32_t>::max ()}; //!<< packet sequance number
+    uint32_t nodeId {std::numeric_limits <uint32_t>::max ()}; //!< node id of the tx node
+    uint64_t imsi {std::numeric_limits <uint64_t>::max ()}; //!< IMSI of the tx node
+    std::string ipAddrs {""}; //!< The ip address of the node.
+    uint64_t numTxPkts {0}; //!< The total number of transmitted packets
+  };
+  /**
+   * \ingroup nr
+   * \brief PktRxData struct to store the aggregated information communicated
+   *        by the RX application layer trace of a receiving node, for the
+   *        packets received from a particular transmitter.
+   */
+  struct PktRxData
+  {
+    std::string txRx {""}; //!< tx/rx indicator
+    uint32_t nodeId {std::numeric_limits <uint32_t>::max ()}; //!< node id of the rx node
+    uint64_t imsi {std::numeric_limits <uint64_t>::max ()}; //!< IMSI of the rx node
+    std::string ipAddrs {""}; //!< The ip address of the node.
+    uint64_t numRxPkts {0}; //!< The total number of received packets
+    uint64_t rxBytes {0}; //!< The total number of received bytes
+    double lastPktRxTime {0.0}; //!< The time of the last received packet
+    double pirSum {0.0}; //!< The sum of the packet inter-reception times
+    uint64_t pirCounter {0}; //!< The number of packet inter-reception times
+    std::vector<bool> rxPktSeqs; //!< The sequence numbers of the received packets
+    uint64_t numRxPktSeqs {0}; //!< The number of distinct received sequence numbers
   };
   /**
    * \ingroup nr
@@ -172,6 +223,16 @@ private:
              && ((this->rbStart <= r.rbStart + r.rbLen - 1) && (r.rbStart <= this->rbStart + this->rbLen - 1)));
     }
   };
+  /**
+   * \ingroup nr
+   * \brief PsschTxPerSlot struct to store the PSSCH transmissions of a slot,
+   *        split between non-overlapping and overlapping transmissions.
+   */
+  struct PsschTxPerSlot
+  {
+    std::vector <PsschTxData> nonOverLapPsschTx; //!< The non-overlapping PSSCH transmissions
+    std::vector <PsschTxData> overLapPsschTx; //!< The overlapping PSSCH transmissions
+  };
 
   /**
    * \brief Delete the table if it already exists with same seed and run number
@@ -194,6 +255,48 @@ private:
    * txRx column using tx key.
    */
   void SavePktTxData ();
+  /**
+   * \brief Save the PSSCH TX data from psschTxUeMac table.
+   */
+  void SavePsschTxData ();
+  /**
+   * \brief Save the PSSCH RX data from psschRxUePhy table.
+   */
+  void SavePsschRxData ();
+  /**
+   * \brief Aggregate a packet transmission or reception
+   * \param time The time of the transmission or reception in seconds
+   * \param txRx The string indicating the type of node, i.e., TX or RX
+   * \param nodeId The node id
+   * \param imsi The IMSI of the UE
+   * \param pktSize The packet size
+   * \param srcIp The source IP address of the packet
+   * \param dstIp The destination IP address of the packet
+   * \param pktSeq The packet sequence number
+   */
+  void AddPktTxRxData (double time, const std::string &txRx, uint32_t nodeId, uint64_t imsi, uint32_t pktSize, const std::string &srcIp, const std::string &dstIp, uint32_t pktSeq);
+  /**
+   * \brief Aggregate a PSSCH transmission
+   *
+   * The transmission is compared with the previous transmissions of the same
+   * frame, subframe and slot, to count the overlapping transmissions.
+   *
+   * \param data The PSSCH transmission
+   */
+  void AddPsschTxData (const PsschTxData &data);
+  /**
+   * \brief Aggregate a PSSCH TB reception
+   * \param psschCorrupt The flag indicating if the PSSCH TB is corrupted
+   * \param sci2Corrupt The flag indicating if the SCI stage 2 is corrupted
+   */
+  void AddPsschRxData (bool psschCorrupt, bool sci2Corrupt);
+  /**
+   * \brief Get the distance between a transmitter and a receiver
+   * \param txIp The IP of the transmitter
+   * \param rxIp The IP of the receiver
+   * \return The 2D distance between their initial positions
+   */
+  double GetTxRxDistance (const std::string &txIp, const std::string &rxIp) const;
   /**
    * \brief Save average PIR
    *
@@ -216,7 +319,7 @@ private:
    * \param data The data to be used to compute the average PIR
    * \return The average PIR
    */
-  double ComputeAvrgPir (std::string ipTx, std::vector <PktTxRxData> data);
+  double ComputeAvrgPir (const std::string &ipTx, const PktRxData &data);
   /**
    * \brief Save throughput
    *
@@ -236,7 +339,7 @@ private:
    *
    * \see SetTxAppDuration
    */
-  double ComputeThput (std::vector <PktTxRxData> data);
+  double ComputeThput (const PktRxData &data);
   /**
    * \brief Get the total transmitted packets by a transmitter
    * \param srcIpAddrs The IP of the transmitter
@@ -288,29 +391,38 @@ private:
   void SaveAvrgPrr ();
   /**
    * \brief Compute average PRR (Packet Reception Ratio)
-   * \param txIt An iterator of the m_txDataMap pointing to the transmitter
-   *        data for which PRR is to be computed
+   * \param txData The data of the transmitter for which PRR is to be computed
    * \param numNeib A variable where the total number of neighbors for a
    *        transmitter will be stored (note, it is passed as reference)
    * \return The average PRR value
    */
-  double ComputeAvrgPrr (std::map <uint32_t, std::vector <PktTxRxData> >::const_iterator &txIt, uint32_t &numNeib);
+  double ComputeAvrgPrr (const PktTxData &txData, uint32_t &numNeib);
 
   /*
    * Key 1 = Rx node id
    * Key 2 = IP address of the transmitter this RX node received pkts from
    * value of second map = data to compute KPIs or other stats, e.g., PIR, thput.
    */
-  std::map <uint32_t, std::map <std::string, std::vector <PktTxRxData> > > m_rxDataMap; //!< map to store the rx data of each node w.r.t its transmitters
+  std::map <uint32_t, std::map <std::string, PktRxData> > m_rxDataMap; //!< map to store the rx data of each node w.r.t its transmitters
   /*
    * Key = Tx node id
    * value = data to compute KPI or other stats, e.g., total txed packets by a tx node
    */
-  std::map <uint32_t, std::vector <PktTxRxData> > m_txDataMap; //!< map to store the tx data per transmitting node
+  std::map <uint32_t, PktTxData> m_txDataMap; //!< map to store the tx data per transmitting node
+  /*
+   * Key = frame, subframe and slot numbers of the transmissions
+   * value = the transmissions of the slot
+   */
+  std::unordered_map <uint64_t, PsschTxPerSlot> m_psschTxPerSlot; //!< map to store the PSSCH transmissions per slot
+  uint32_t m_totalPsschTx {0}; //!< The total number of PSSCH transmissions
+  uint32_t m_totalPsschTbRx {0}; //!< The total number of received PSSCH TBs
+  uint32_t m_psschSuccessCount {0}; //!< The count of successfully decoded PSSCH
+  uint32_t m_sci2SuccessCount {0}; //!< The count of successfully decoded SCI 2
   sqlite3* m_db {nullptr}; //!< DB pointer
   std::string m_dbPath {""}; //!< path to the DB to read
   double m_txAppDuration {0.0}; //!< The TX application duration to compute the throughput
   bool m_considerAllTx {true}; //!< Consider all TX flag for throughput computation
+  bool m_onlineKpis {false}; //!< Compute the KPIs from the traces fed during the simulation
   std::map <std::string, Vector> m_posPerIp; //!< Map to store position and IPs of the nodes
   std::uint16_t m_range {0}; //!< Range in meter to be used to compute PIR and PRR
   double m_interTxRxDistance {0.0}; //!< The inter-TX-RX distance logged for PIR
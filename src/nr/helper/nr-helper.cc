@@ -1234,6 +1234,20 @@ NrHelper::SetPathlossAttribute(const std::string &n, const AttributeValue &v)
   m_pathlossModelFactory.Set (n, v);
 }
 
+void
+NrHelper::SetSpectrumChannelTypeId (const TypeId &typeId)
+{
+  NS_LOG_FUNCTION (this);
+  m_channelFactory.SetTypeId (typeId);
+}
+
+void
+NrHelper::SetSpectrumChannelAttribute (const std::string &n, const AttributeValue &v)
+{
+  NS_LOG_FUNCTION (this);
+  m_channelFactory.Set (n, v);
+}
+
 void
 NrHelper::SetGnbDlAmcAttribute (const std::string &n, const AttributeValue &v)
 {
@@ -646,6 +646,22 @@ public:
    */
   void SetPathlossAttribute (const std::string &n, const AttributeValue &v);
 
+  /**
+   * Set the type of the spectrum channel of the bandwidth parts, before it is
+   * created (by default, a MultiModelSpectrumChannel).
+   *
+   * \param typeId the type of the spectrum channel
+   */
+  void SetSpectrumChannelTypeId (const TypeId &typeId);
+
+  /**
+   * Set an attribute for the spectrum channel, before it is created.
+   *
+   * \param n the name of the attribute
+   * \param v the value of the attribute
+   */
+  void SetSpectrumChannelAttribute (const std::string &n, const AttributeValue &v);
+
   /**
    * Set an attribute for the GNB DL AMC, before it is created.
    *
@@ -37,9 +37,17 @@
 #include <ns3/nr-spectrum-phy.h>
 #include "nr-spectrum-value-helper.h"
 #include <ns3/beamforming-vector.h>
+#include <algorithm>
 #include <ctime>
 #include <fstream>
 #include <limits>
+#include <thread>
+#include <new>
+#include <cerrno>
+#include <cstdio>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 namespace ns3 {
 
@@ -47,6 +55,9 @@ NS_LOG_COMPONENT_DEFINE ("NrRadioEnvironmentMapHelper");
 
 NS_OBJECT_ENSURE_REGISTERED (NrRadioEnvironmentMapHelper);
 
+/// First random stream of the REM points, when the RngStreamBase attribute is not set
+static const int64_t DEFAULT_REM_STREAM_BASE = int64_t (1) << 40;
+
 NrRadioEnvironmentMapHelper::NrRadioEnvironmentMapHelper ()
 {
   NS_LOG_FUNCTION (this);
@@ -159,6 +170,34 @@ NrRadioEnvironmentMapHelper::GetTypeId (void)
                                      TimeValue (MilliSeconds (100)),
                                      MakeTimeAccessor (&NrRadioEnvironmentMapHelper::SetInstallationDelay),
                                      MakeTimeChecker())
+                      .AddAttribute ("OutputFormat",
+                                     "The format of the REM output file: Text (nr-rem-${SimTag}.out, "
+                                     "one line per REM point) or Raster (nr-rem-${SimTag}.raster, "
+                                     "binary layers of SNR, SINR, IPSD and SIR values).",
+                                     EnumValue (NrRadioEnvironmentMapHelper::TEXT_FORMAT),
+                                     MakeEnumAccessor (&NrRadioEnvironmentMapHelper::m_outputFormat),
+                                     MakeEnumChecker (NrRadioEnvironmentMapHelper::TEXT_FORMAT, "Text",
+                                                      NrRadioEnvironmentMapHelper::RASTER_FORMAT, "Raster"))
+                      .AddAttribute ("NumWorkers",
+                                     "Number of worker processes that calculate the REM points in parallel. "
+                                     "If 0, one worker per available CPU is used.",
+                                     UintegerValue (1),
+                                     MakeUintegerAccessor (&NrRadioEnvironmentMapHelper::m_numWorkers),
+                                     MakeUintegerChecker<uint32_t> ())
+                      .AddAttribute ("TileSize",
+                                     "Number of REM points that a worker calculates at once.",
+                                     UintegerValue (64),
+                                     MakeUintegerAccessor (&NrRadioEnvironmentMapHelper::m_tileSize),
+                                     MakeUintegerChecker<uint32_t> (1, std::numeric_limits<uint32_t>::max ()))
+                      .AddAttribute ("RngStreamBase",
+                                     "First random stream of the propagation models created for the REM "
+                                     "points. Each REM point uses its own range of streams, so that the map "
+                                     "does not depend on NumWorkers and TileSize. If negative, the ranges "
+                                     "start from 2^40 and are used only when NumWorkers is not 1, while a "
+                                     "single worker uses the automatically assigned streams.",
+                                     IntegerValue (-1),
+                                     MakeIntegerAccessor (&NrRadioEnvironmentMapHelper::m_rngStreamBase),
+                                     MakeIntegerChecker<int64_t> (-1, int64_t (1) << 60))
     ;
   return tid;
 }
@@ -579,23 +618,15 @@ NrRadioEnvironmentMapHelper::DelayedInstall (const NetDeviceContainer &rtdNetDev
   ConfigureRrd (rrdDevice);
   ConfigureRtdList (rtdNetDev);
   CreateListOfRemPoints ();
-  if (m_remMode == COVERAGE_AREA)
-    {
-      CalcCoverageAreaRemMap ();
-    }
-  else if (m_remMode == BEAM_SHAPE)
+  CalcRemMap ();
+  if (m_outputFormat == RASTER_FORMAT)
     {
-      CalcBeamShapeRemMap ();
-    }
-  else if (m_remMode == UE_COVERAGE)
-    {
-      CalcUeCoverageRemMap ();
+      PrintRemToRasterFile ();
     }
   else
     {
-      NS_FATAL_ERROR ("Unknown REM mode");
+      PrintRemToFile ();
     }
-  PrintRemToFile ();
 
   std::ostringstream ossGnbs;
   ossGnbs << "nr-rem-" << m_simTag.c_str () << "-gnbs.txt";
@@ -621,8 +652,10 @@ NrRadioEnvironmentMapHelper::CreateListOfRemPoints ()
 
   NS_LOG_INFO ("m_xStep: " << m_xStep << " m_yStep: " << m_yStep);
 
+  m_xNumPoints = 0;
   for (double x = m_xMin; x < m_xMax + 0.5*m_xStep; x += m_xStep)
     {
+      m_yNumPoints = 0;
       for (double y = m_yMin; y < m_yMax + 0.5*m_yStep ; y += m_yStep)
         {
           //In case a REM Point is in the same position as a rtd, ignore this point
@@ -642,10 +675,14 @@ NrRadioEnvironmentMapHelper::CreateListOfRemPoints ()
             remPoint.pos.x = x;
             remPoint.pos.y = y;
             remPoint.pos.z = m_z;
+            remPoint.xIndex = m_xNumPoints;
+            remPoint.yIndex = m_yNumPoints;
 
             m_rem.push_back (remPoint);
           }
+          ++m_yNumPoints;
         }
+      ++m_xNumPoints;
     }
 }
 
@@ -671,7 +708,7 @@ NrRadioEnvironmentMapHelper::ConfigureDirectPathBfv (RemDevice& device,
 }
 
 Ptr<SpectrumValue>
-NrRadioEnvironmentMapHelper::CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice) const
+NrRadioEnvironmentMapHelper::CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice)
 {
   PropagationModels tempPropModels = CreateTemporalPropagationModels ();
 
@@ -868,76 +905,192 @@ NrRadioEnvironmentMapHelper::CalculateMaxSir (const std::list <Ptr<SpectrumValue
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcBeamShapeRemMap ()
+NrRadioEnvironmentMapHelper::CalcRemMap ()
 {
   NS_LOG_FUNCTION (this);
-  uint16_t calcRxPsdCounter = 0;
 
-  uint32_t remSizeNextReport = m_rem.size () / 100;
-  uint32_t remPointCounter = 0;
+  void (NrRadioEnvironmentMapHelper::*calcRemPoint) (RemPoint&) = nullptr;
+  if (m_remMode == COVERAGE_AREA)
+    {
+      calcRemPoint = &NrRadioEnvironmentMapHelper::CalcCoverageAreaRemPoint;
+    }
+  else if (m_remMode == BEAM_SHAPE)
+    {
+      calcRemPoint = &NrRadioEnvironmentMapHelper::CalcBeamShapeRemPoint;
+    }
+  else if (m_remMode == UE_COVERAGE)
+    {
+      calcRemPoint = &NrRadioEnvironmentMapHelper::CalcUeCoverageRemPoint;
+    }
+  else
+    {
+      NS_FATAL_ERROR ("Unknown REM mode");
+    }
+
+  uint32_t numTiles = (m_rem.size () + m_tileSize - 1) / m_tileSize;
+  uint32_t numWorkers = m_numWorkers;
+  if (numWorkers == 0)
+    {
+      numWorkers = std::max (std::thread::hardware_concurrency (), 1u);
+    }
+  numWorkers = std::min (numWorkers, numTiles);
+
+  // The automatic streams of the models of a REM point depend on the REM
+  // points calculated before by the same worker: with more workers, each REM
+  // point uses its own range of streams, sized for the calls to
+  // CalcRxPsdValue of any REM mode (at most IterForAverage * RTDs * (RTDs + 1))
+  m_remPointStreams = 0;
+  if (m_numWorkers != 1 || m_rngStreamBase >= 0)
+    {
+      m_remPointStreams = std::numeric_limits<int64_t>::max ();
+      m_remPointStream = 0;
+      m_remPointStreamEnd = std::numeric_limits<int64_t>::max ();
+      CreateTemporalPropagationModels ();
+      int64_t callsPerPoint = static_cast<int64_t> (m_numOfIterationsToAverage) * m_remDev.size () * (m_remDev.size () + 1);
+      m_remPointStreams = std::max<int64_t> (m_remPointStream * callsPerPoint, 1);
+      int64_t streamBase = m_rngStreamBase >= 0 ? m_rngStreamBase : DEFAULT_REM_STREAM_BASE;
+      NS_ABORT_MSG_IF (m_remPointStreams > (std::numeric_limits<int64_t>::max () - streamBase) / std::max<int64_t> (m_rem.size (), 1),
+                       "Too many random streams for the REM points, reduce RngStreamBase");
+    }
 
-  for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-      itRemPoint != m_rem.end ();
-      ++itRemPoint)
+  // The REM points and the tile state are in memory shared with the workers,
+  // which are forked from this process and hence have their own copy of the
+  // RTDs, RRD, antennas and propagation models (ns-3 objects cannot be used
+  // by concurrent threads).
+  std::size_t sharedSize = m_rem.size () * sizeof (RemPoint) + sizeof (RemTileState);
+  void *shared = mmap (nullptr, sharedSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  NS_ABORT_MSG_IF (shared == MAP_FAILED, "Can't allocate the memory shared with the REM workers");
+  RemPoint *remPoints = static_cast<RemPoint *> (shared);
+  std::copy (m_rem.begin (), m_rem.end (), remPoints);
+  RemTileState *tileState = new (remPoints + m_rem.size ()) RemTileState ();
+
+  // do not write twice the output buffered before the fork
+  std::cout.flush ();
+  std::fflush (nullptr);
+
+  std::vector<pid_t> workers;
+  for (uint32_t i = 1; i < numWorkers; ++i)
     {
-      //perform calculation m_numOfIterationsToAverage times and get the average value
-      double sumSnr = 0.0, sumSinr = 0.0;
-      double sumSir = 0.0;
-      std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
-      m_rrd.mob->SetPosition (itRemPoint->pos);
+      pid_t pid = fork ();
+      if (pid == 0)
+        {
+          RunRemWorker (calcRemPoint, remPoints, tileState, false);
+          _exit (0);
+        }
+      else if (pid < 0)
+        {
+          NS_LOG_WARN ("Can't create REM worker " << i << ", continuing with " << i << " workers");
+          break;
+        }
+      workers.push_back (pid);
+    }
+  NS_LOG_INFO ("Calculating " << m_rem.size () << " REM points in " << numTiles <<
+               " tiles with " << workers.size () + 1 << " workers");
 
-      Ptr <MobilityBuildingInfo> buildingInfo = m_rrd.mob->GetObject <MobilityBuildingInfo> ();
-      buildingInfo->MakeConsistent (m_rrd.mob);
-      NS_ASSERT_MSG (buildingInfo, "buildingInfo is null");
+  RunRemWorker (calcRemPoint, remPoints, tileState, true);
 
-      for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+  for (pid_t pid : workers)
+    {
+      int status = 0;
+      while (waitpid (pid, &status, 0) < 0 && errno == EINTR)
         {
-          std::list <Ptr<SpectrumValue>> receivedPowerList;// RTD node id, rxPsd of the singal coming from that node
+        }
+      NS_ABORT_MSG_IF (!WIFEXITED (status) || WEXITSTATUS (status) != 0,
+                       "REM worker " << pid << " failed");
+    }
 
-          for (std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
-               itRtd != m_remDev.end ();
-               ++itRtd)
-            {
-              calcRxPsdCounter++;
+  std::copy (remPoints, remPoints + m_rem.size (), m_rem.begin ());
+  tileState->~RemTileState ();
+  munmap (shared, sharedSize);
 
-               // calculate received power from the current RTD device
-              receivedPowerList.push_back (CalcRxPsdValue (*itRtd, m_rrd));
-            } //end for std::list<RemDev>::iterator  (RTDs)
+  auto remEndTime = std::chrono::system_clock::now ();
+  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
+  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
+                 remElapsedSeconds.count () / 60 << " minutes.");
+}
 
-          sumSnr += CalculateMaxSnr (receivedPowerList);
-          sumSinr += CalculateMaxSinr (receivedPowerList);
-          sumSir += CalculateMaxSir (receivedPowerList);
+void
+NrRadioEnvironmentMapHelper::RunRemWorker (void (NrRadioEnvironmentMapHelper::*calcRemPoint) (RemPoint&),
+                                           RemPoint *remPoints, RemTileState *tileState, bool reportProgress)
+{
+  NS_LOG_FUNCTION (this);
+  uint32_t remSize = m_rem.size ();
+  uint32_t remSizeNextReport = remSize / 100;
 
-          //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
-          rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (receivedPowerList));
+  uint32_t tile;
+  while ((tile = tileState->nextTile++) < (remSize + m_tileSize - 1) / m_tileSize)
+    {
+      uint32_t begin = tile * m_tileSize;
+      uint32_t end = std::min (begin + m_tileSize, remSize);
+      for (uint32_t i = begin; i < end; ++i)
+        {
+          if (m_remPointStreams > 0)
+            {
+              // the streams depend only on the REM point, not on the worker
+              m_remPointStream = (m_rngStreamBase >= 0 ? m_rngStreamBase : DEFAULT_REM_STREAM_BASE) + i * m_remPointStreams;
+              m_remPointStreamEnd = m_remPointStream + m_remPointStreams;
+            }
+          (this->*calcRemPoint) (remPoints[i]);
+        }
 
-          receivedPowerList.clear ();
-        }//end for m_numOfIterationsToAverage  (Average)
+      uint32_t remPointsDone = tileState->remPointsDone += end - begin;
+      while (reportProgress && remSizeNextReport > 0 && remPointsDone >= remSizeNextReport)
+        {
+          PrintProgressReport (&remSizeNextReport);
+        }
+    }
+}
 
-      //Sum the rxPower for all the Iterations (linear)
-      double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+void
+NrRadioEnvironmentMapHelper::CalcBeamShapeRemPoint (RemPoint& remPoint)
+{
+  NS_LOG_FUNCTION (this);
 
-      itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSirDb = sumSir / static_cast <double> (m_numOfIterationsToAverage);
-      //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
-      itRemPoint->avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+  //perform calculation m_numOfIterationsToAverage times and get the average value
+  double sumSnr = 0.0, sumSinr = 0.0;
+  double sumSir = 0.0;
+  std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
+  m_rrd.mob->SetPosition (remPoint.pos);
 
-      NS_LOG_INFO ("Avg snr value saved:" << itRemPoint->avgSnrDb);
-      NS_LOG_INFO ("Avg sinr value saved:" << itRemPoint->avgSinrDb);
-      NS_LOG_INFO ("Avg ipsd value saved (dBm):" << itRemPoint->avRxPowerDbm);
+  Ptr <MobilityBuildingInfo> buildingInfo = m_rrd.mob->GetObject <MobilityBuildingInfo> ();
+  buildingInfo->MakeConsistent (m_rrd.mob);
+  NS_ASSERT_MSG (buildingInfo, "buildingInfo is null");
 
-      if (++remPointCounter == remSizeNextReport)
+  for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+    {
+      std::list <Ptr<SpectrumValue>> receivedPowerList;// RTD node id, rxPsd of the singal coming from that node
+
+      for (std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
+           itRtd != m_remDev.end ();
+           ++itRtd)
         {
-          PrintProgressReport (&remSizeNextReport);
-        }
+           // calculate received power from the current RTD device
+          receivedPowerList.push_back (CalcRxPsdValue (*itRtd, m_rrd));
+        } //end for std::list<RemDev>::iterator  (RTDs)
 
-    } //end for std::list<RemPoint>::iterator  (RemPoints)
+      sumSnr += CalculateMaxSnr (receivedPowerList);
+      sumSinr += CalculateMaxSinr (receivedPowerList);
+      sumSir += CalculateMaxSir (receivedPowerList);
 
-  auto remEndTime = std::chrono::system_clock::now ();
-  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+      //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
+      rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (receivedPowerList));
+
+      receivedPowerList.clear ();
+    }//end for m_numOfIterationsToAverage  (Average)
+
+  //Sum the rxPower for all the Iterations (linear)
+  double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+
+  remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSirDb = sumSir / static_cast <double> (m_numOfIterationsToAverage);
+  //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
+  remPoint.avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+
+  NS_LOG_INFO ("Avg snr value saved:" << remPoint.avgSnrDb);
+  NS_LOG_INFO ("Avg sinr value saved:" << remPoint.avgSinrDb);
+  NS_LOG_INFO ("Avg ipsd value saved (dBm):" << remPoint.avRxPowerDbm);
 }
 
 double
@@ -991,121 +1144,96 @@ NrRadioEnvironmentMapHelper::SumListElements (const std::list<double>& listOfVal
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcCoverageAreaRemMap ()
+NrRadioEnvironmentMapHelper::CalcCoverageAreaRemPoint (RemPoint& remPoint)
 {
   NS_LOG_FUNCTION (this);
-  uint16_t calcRxPsdCounter = 0;
-  uint32_t remSizeNextReport = m_rem.size () / 100;
-  uint32_t remPointCounter = 0;
 
-  for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-      itRemPoint != m_rem.end ();
-      ++itRemPoint)
+  //perform calculation m_numOfIterationsToAverage times and get the average value
+  double sumSnr = 0.0, sumSinr = 0.0;
+  m_rrd.mob->SetPosition (remPoint.pos);
+
+  // all RTDs should point toward that RemPoint with DirectPah beam, this is definition of worst-case scenario
+  for (std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
+       itRtd != m_remDev.end ();
+       ++itRtd)
+    {
+      ConfigureDirectPathBfv (*itRtd, m_rrd, itRtd->antenna);
+    }
+
+  std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
+
+  for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
     {
-      //perform calculation m_numOfIterationsToAverage times and get the average value
-      double sumSnr = 0.0, sumSinr = 0.0;
-      m_rrd.mob->SetPosition (itRemPoint->pos);
-
-      // all RTDs should point toward that RemPoint with DirectPah beam, this is definition of worst-case scenario
-     for(std::list<RemDevice>::iterator itRtd = m_remDev.begin ();
-         itRtd != m_remDev.end ();
-                ++itRtd)
-        {
-          ConfigureDirectPathBfv (*itRtd, m_rrd, itRtd->antenna);
-        }
+      std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
+      std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
 
-      std::list<double> rxPsdsListPerIt; //list to save the summed rxPower in each RemPoint for each Iteration (linear)
+      std::list<Ptr<SpectrumValue>> rxPsdsList; //vector in which we will save the sum of rxPowers per remPoint (linear)
 
-      for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+      // For each beam configuration at RemPoint/RRD we should calculate SINR, there are as many beam configurations at RemPoint as many RTDs
+      for (std::list<RemDevice>::iterator itRtdBeam = m_remDev.begin (); itRtdBeam != m_remDev.end (); ++itRtdBeam)
         {
-          std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
-          std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
+          //configure RRD beam toward RTD
+          ConfigureDirectPathBfv (m_rrd, *itRtdBeam, m_rrd.antenna);
 
-          std::list<Ptr<SpectrumValue>> rxPsdsList; //vector in which we will save the sum of rxPowers per remPoint (linear)
+          //Calculate the received power from this RTD for this RemPoint
+          Ptr<SpectrumValue> receivedPowerFromRtd = CalcRxPsdValue (*itRtdBeam, m_rrd);
+          //and put it to the list of the received powers for this RemPoint (to sum all later)
+          rxPsdsList.push_back (receivedPowerFromRtd);
 
-          // For each beam configuration at RemPoint/RRD we should calculate SINR, there are as many beam configurations at RemPoint as many RTDs
-          for (std::list<RemDevice>::iterator itRtdBeam = m_remDev.begin (); itRtdBeam != m_remDev.end (); ++itRtdBeam)
-            {
-              //configure RRD beam toward RTD
-              ConfigureDirectPathBfv (m_rrd, *itRtdBeam, m_rrd.antenna);
+          NS_LOG_DEBUG ("beam node: " << itRtdBeam->dev->GetNode ()->GetId () <<
+                        " is Rxed in RemPoint with Rx Power in W: " << (Integral (*receivedPowerFromRtd)));
+          NS_LOG_DEBUG ("RxPower in dBm: " << WToDbm (Integral (*receivedPowerFromRtd)));
 
-              //Calculate the received power from this RTD for this RemPoint
-              Ptr<SpectrumValue> receivedPowerFromRtd = CalcRxPsdValue (*itRtdBeam, m_rrd);
-              //and put it to the list of the received powers for this RemPoint (to sum all later)
-              rxPsdsList.push_back (receivedPowerFromRtd);
+          std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
+          Ptr<SpectrumValue> usefulSignalRxPsd;
 
-              NS_LOG_DEBUG ("beam node: " << itRtdBeam->dev->GetNode ()->GetId () <<
-                            " is Rxed in RemPoint with Rx Power in W: " << (Integral (*receivedPowerFromRtd)));
-              NS_LOG_DEBUG ("RxPower in dBm: " << WToDbm (Integral (*receivedPowerFromRtd)));
+          // For this configuration of beam at RRD, we need to calculate RX PSD,
+          // and in order to be able to calculate SINR for that beam,
+          // we need to calculate received PSD for each RTD using this beam at RRD
+          for(std::list<RemDevice>::iterator itRtdCalc = m_remDev.begin (); itRtdCalc != m_remDev.end (); ++itRtdCalc)
+            {
+              // calculate received power from the current RTD device
+              Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdCalc, m_rrd);
 
-              std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
-              Ptr<SpectrumValue> usefulSignalRxPsd;
+              // is this received power useful signal (from RTD for which I configured my beam) or is interference signal
 
-              // For this configuration of beam at RRD, we need to calculate RX PSD,
-              // and in order to be able to calculate SINR for that beam,
-              // we need to calculate received PSD for each RTD using this beam at RRD
-              for(std::list<RemDevice>::iterator itRtdCalc = m_remDev.begin (); itRtdCalc != m_remDev.end (); ++itRtdCalc)
+              if (itRtdBeam->dev->GetNode ()->GetId () == itRtdCalc->dev->GetNode ()->GetId ())
                 {
-                  // increase counter de calcRXPsd calls
-                  calcRxPsdCounter++;
-                  // calculate received power from the current RTD device
-                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdCalc, m_rrd);
-
-                  // is this received power useful signal (from RTD for which I configured my beam) or is interference signal
-
-                  if (itRtdBeam->dev->GetNode ()->GetId () == itRtdCalc->dev->GetNode ()->GetId ())
+                  if (usefulSignalRxPsd != nullptr)
                     {
-                      if (usefulSignalRxPsd != nullptr)
-                        {
-                          NS_FATAL_ERROR ("Already assigned usefulSignal!");
-                        }
-                      usefulSignalRxPsd = receivedPower;
+                      NS_FATAL_ERROR ("Already assigned usefulSignal!");
                     }
-                  else
-                    {
-                      interferenceSignalsRxPsds.push_back (receivedPower);  //interference
-                    }
-
-                } //end for std::list<RemDev>::iterator itRtdCalc (RTDs)
-
-              sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
-              snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
-
-              NS_LOG_INFO ("Done:" <<
-                           (double)calcRxPsdCounter/(m_rem.size()*m_numOfIterationsToAverage*m_remDev.size ()*m_remDev.size()) * 100 <<
-                           " %."); // how many times will be called CalcRxPsdValues
-
-            } //end for std::list<RemDev>::iterator itRtdBeam (RTDs)
+                  usefulSignalRxPsd = receivedPower;
+                }
+              else
+                {
+                  interferenceSignalsRxPsds.push_back (receivedPower);  //interference
+                }
 
-          sumSnr += GetMaxValue (snrsPerBeam);
-          sumSinr += GetMaxValue (sinrsPerBeam);
+            } //end for std::list<RemDev>::iterator itRtdCalc (RTDs)
 
-          //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
-          rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (rxPsdsList));
+          sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
+          snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
 
-        }//end for m_numOfIterationsToAverage  (Average)
+        } //end for std::list<RemDev>::iterator itRtdBeam (RTDs)
 
-      //Sum the rxPower for all the Iterations (linear)
-      double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
+      sumSnr += GetMaxValue (snrsPerBeam);
+      sumSinr += GetMaxValue (sinrsPerBeam);
 
-      itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-      itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
-      //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
-      itRemPoint->avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
+      //Sum all the rxPowers (for this RemPoint) and put the result to the list for each Iteration (linear)
+      rxPsdsListPerIt.push_back (CalculateAggregatedIpsd (rxPsdsList));
 
-      if (++remPointCounter == remSizeNextReport)
-        {
-          PrintProgressReport (&remSizeNextReport);
-        }
+    }//end for m_numOfIterationsToAverage  (Average)
 
-      NS_LOG_DEBUG ("itRemPoint->avRxPowerDb  in dB: " << itRemPoint->avRxPowerDbm);
+  //Sum the rxPower for all the Iterations (linear)
+  double rxPsdsAllIt = SumListElements (rxPsdsListPerIt);
 
-    } //end for std::list<RemPoint>::iterator  (RemPoints)
+  remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+  remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+  //do the average (for the rxPowers in each RemPoint) in linear and then convert to dBm
+  remPoint.avRxPowerDbm = WToDbm (rxPsdsAllIt / static_cast <double> (m_numOfIterationsToAverage));
 
-  auto remEndTime = std::chrono::system_clock::now ();
-  std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-  NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+  NS_LOG_DEBUG ("remPoint.avRxPowerDb  in dB: " << remPoint.avRxPowerDbm);
 }
 
 void
@@ -1128,94 +1256,75 @@ NrRadioEnvironmentMapHelper::PrintProgressReport (uint32_t* remSizeNextReport)
 }
 
 void
-NrRadioEnvironmentMapHelper::CalcUeCoverageRemMap ()
+NrRadioEnvironmentMapHelper::CalcUeCoverageRemPoint (RemPoint& remPoint)
 {
     NS_LOG_FUNCTION (this);
 
-    uint32_t remSizeNextReport = m_rem.size () / 100;
-    uint32_t remPointCounter = 0;
+    //perform calculation m_numOfIterationsToAverage times and get the average value
+    double sumSnr = 0.0, sumSinr = 0.0;
+    m_rrd.mob->SetPosition (remPoint.pos);
 
-    for (std::list<RemPoint>::iterator itRemPoint = m_rem.begin ();
-        itRemPoint != m_rem.end ();
-        ++itRemPoint)
+    for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
       {
-        //perform calculation m_numOfIterationsToAverage times and get the average value
-        double sumSnr = 0.0, sumSinr = 0.0;
-        m_rrd.mob->SetPosition (itRemPoint->pos);
+        std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
+        std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
 
-        for (uint16_t i = 0; i < m_numOfIterationsToAverage; i++)
+        //"Associate" UE (RemPoint) with this RTD
+        for (std::list<RemDevice>::iterator itRtdAssociated = m_remDev.begin ();
+             itRtdAssociated != m_remDev.end ();
+             ++itRtdAssociated)
           {
-            std::list<double> sinrsPerBeam; // vector in which we will save sinr per each RRD beam
-            std::list<double> snrsPerBeam; // vector in which we will save snr per each RRD beam
+            //configure RRD (RemPoint) beam toward RTD (itRtdAssociated)
+            ConfigureDirectPathBfv (m_rrd, *itRtdAssociated, m_rrd.antenna);
+            //configure RTD (itRtdAssociated) beam toward RRD (RemPoint)
+            ConfigureDirectPathBfv (*itRtdAssociated, m_rrd, itRtdAssociated->antenna);
+
+            std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
+            Ptr<SpectrumValue> usefulSignalRxPsd;
 
-            //"Associate" UE (RemPoint) with this RTD
-            for (std::list<RemDevice>::iterator itRtdAssociated = m_remDev.begin ();
-                 itRtdAssociated != m_remDev.end ();
-                 ++itRtdAssociated)
+            for(std::list<RemDevice>::iterator itRtdInterferer = m_remDev.begin ();
+                itRtdInterferer != m_remDev.end ();
+                ++itRtdInterferer)
               {
-                //configure RRD (RemPoint) beam toward RTD (itRtdAssociated)
-                ConfigureDirectPathBfv (m_rrd, *itRtdAssociated, m_rrd.antenna);
-                //configure RTD (itRtdAssociated) beam toward RRD (RemPoint)
-                ConfigureDirectPathBfv (*itRtdAssociated, m_rrd, itRtdAssociated->antenna);
-
-                std::list<Ptr<SpectrumValue>> interferenceSignalsRxPsds;
-                Ptr<SpectrumValue> usefulSignalRxPsd;
-
-                for(std::list<RemDevice>::iterator itRtdInterferer = m_remDev.begin ();
-                    itRtdInterferer != m_remDev.end ();
-                    ++itRtdInterferer)
-                  {
-                    if (itRtdAssociated->dev->GetNode ()->GetId () != itRtdInterferer->dev->GetNode ()->GetId ())
-                    {
-                      //configure RTD (itRtdInterferer) beam toward RTD (itRtdAssociated)
-                      ConfigureDirectPathBfv (*itRtdInterferer, *itRtdAssociated, itRtdInterferer->antenna);
+                if (itRtdAssociated->dev->GetNode ()->GetId () != itRtdInterferer->dev->GetNode ()->GetId ())
+                {
+                  //configure RTD (itRtdInterferer) beam toward RTD (itRtdAssociated)
+                  ConfigureDirectPathBfv (*itRtdInterferer, *itRtdAssociated, itRtdInterferer->antenna);
 
-                      // calculate received power (interference) from the current RTD device
-                      Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdInterferer, *itRtdAssociated);
+                  // calculate received power (interference) from the current RTD device
+                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (*itRtdInterferer, *itRtdAssociated);
 
-                      interferenceSignalsRxPsds.push_back (receivedPower);  //interference
-                    }
-                    else
+                  interferenceSignalsRxPsds.push_back (receivedPower);  //interference
+                }
+                else
+                {
+                  // calculate received power (useful Signal) from the current RRD device
+                  Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (m_rrd, *itRtdAssociated);
+                  if (usefulSignalRxPsd != nullptr)
                     {
-                      // calculate received power (useful Signal) from the current RRD device
-                      Ptr<SpectrumValue> receivedPower = CalcRxPsdValue (m_rrd, *itRtdAssociated);
-                      if (usefulSignalRxPsd != nullptr)
-                        {
-                          NS_FATAL_ERROR ("Already assigned usefulSignal!");
-                        }
-                      usefulSignalRxPsd = receivedPower;
+                      NS_FATAL_ERROR ("Already assigned usefulSignal!");
                     }
+                  usefulSignalRxPsd = receivedPower;
+                }
 
-                  }//end for std::list<RemDev>::iterator itRtdInterferer (RTD)
-
-                sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
-                snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
-
-              }//end for std::list<RemDev>::iterator itRtdAssociated (RTD)
-
-            sumSnr += GetMaxValue (snrsPerBeam);
-            sumSinr += GetMaxValue (sinrsPerBeam);
+              }//end for std::list<RemDev>::iterator itRtdInterferer (RTD)
 
-          }//end for m_numOfIterationsToAverage  (Average)
+            sinrsPerBeam.push_back (CalculateSinr (usefulSignalRxPsd, interferenceSignalsRxPsds));
+            snrsPerBeam.push_back (CalculateSnr (usefulSignalRxPsd));
 
-        itRemPoint->avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
-        itRemPoint->avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
+          }//end for std::list<RemDev>::iterator itRtdAssociated (RTD)
 
-        if (++remPointCounter == remSizeNextReport)
-          {
-            PrintProgressReport (&remSizeNextReport);
-          }
+        sumSnr += GetMaxValue (snrsPerBeam);
+        sumSinr += GetMaxValue (sinrsPerBeam);
 
-      }//end for std::list<RemPoint>::iterator  (RemPoints)
+      }//end for m_numOfIterationsToAverage  (Average)
 
-    auto remEndTime = std::chrono::system_clock::now ();
-    std::chrono::duration<double> remElapsedSeconds = remEndTime - m_remStartTime;
-    NS_LOG_INFO ("REM map created. Total time needed to create the REM map:" <<
-                 remElapsedSeconds.count () / 60 << " minutes.");
+    remPoint.avgSnrDb = sumSnr / static_cast <double> (m_numOfIterationsToAverage);
+    remPoint.avgSinrDb = sumSinr / static_cast <double> (m_numOfIterationsToAverage);
 }
 
 NrRadioEnvironmentMapHelper::PropagationModels
-NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels () const
+NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels ()
 {
   NS_LOG_FUNCTION (this);
 
@@ -1227,6 +1336,11 @@ NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels () const
   ObjectFactory propLossModelFactory = ConfigureObjectFactory (m_propagationLossModel);
   propModels.remPropagationLossModelCopy = propLossModelFactory.Create <ThreeGppPropagationLossModel> ();
   propModels.remPropagationLossModelCopy->SetChannelConditionModel (condModelCopy);
+  if (m_remPointStreams > 0)
+    {
+      m_remPointStream += propModels.remPropagationLossModelCopy->AssignStreams (m_remPointStream);
+      m_remPointStream += condModelCopy->AssignStreams (m_remPointStream);
+    }
 
   //create rem copy of spectrum loss model
   ObjectFactory spectrumLossModelFactory = ConfigureObjectFactory (m_phasedArraySpectrumLossModel);
@@ -1234,9 +1348,16 @@ NrRadioEnvironmentMapHelper::CreateTemporalPropagationModels () const
     {
       Ptr<MatrixBasedChannelModel> channelModelCopy = m_matrixBasedChannelModelFactory.Create<MatrixBasedChannelModel>();
       channelModelCopy->SetAttribute("ChannelConditionModel", PointerValue (condModelCopy));
+      Ptr<ThreeGppChannelModel> threeGppChannelModelCopy = DynamicCast<ThreeGppChannelModel> (channelModelCopy);
+      if (threeGppChannelModelCopy && m_remPointStreams > 0)
+        {
+          m_remPointStream += threeGppChannelModelCopy->AssignStreams (m_remPointStream);
+        }
       spectrumLossModelFactory.Set ("ChannelModel", PointerValue (channelModelCopy));
       propModels.remSpectrumLossModelCopy = spectrumLossModelFactory.Create <ThreeGppSpectrumPropagationLossModel> ();
     }
+  NS_ASSERT_MSG (m_remPointStream <= m_remPointStreamEnd,
+                 "The random streams reserved for a REM point are not enough");
   return propModels;
 }
 
@@ -1345,7 +1466,7 @@ NrRadioEnvironmentMapHelper::PrintRemToFile ()
                  it->avgSinrDb << "\t" <<
                  it->avRxPowerDbm << "\t" <<
                  it->avgSirDb << "\t" <<
-                 std::endl;
+                 "\n";
     }
 
   outFile.close();
@@ -1354,6 +1475,54 @@ NrRadioEnvironmentMapHelper::PrintRemToFile ()
   Finalize ();
 }
 
+void
+NrRadioEnvironmentMapHelper::PrintRemToRasterFile ()
+{
+  NS_LOG_FUNCTION (this);
+
+  std::ostringstream oss;
+  oss << "nr-rem-" << m_simTag.c_str() <<".raster";
+
+  std::ofstream outFile;
+  std::string outputFile = oss.str ();
+  outFile.open (outputFile.c_str (), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+  if (!outFile.is_open ())
+      {
+        NS_FATAL_ERROR ("Can't open file " << (outputFile));
+        return;
+      }
+
+  std::size_t numPoints = static_cast<std::size_t> (m_xNumPoints) * m_yNumPoints;
+  std::vector<float> snr (numPoints, std::numeric_limits<float>::quiet_NaN ());
+  std::vector<float> sinr (numPoints, std::numeric_limits<float>::quiet_NaN ());
+  std::vector<float> ipsd (numPoints, std::numeric_limits<float>::quiet_NaN ());
+  std::vector<float> sir (numPoints, std::numeric_limits<float>::quiet_NaN ());
+  for (std::list<RemPoint>::iterator it = m_rem.begin ();
+       it != m_rem.end ();
+       ++it)
+    {
+      std::size_t index = static_cast<std::size_t> (it->xIndex) * m_yNumPoints + it->yIndex;
+      snr[index] = it->avgSnrDb;
+      sinr[index] = it->avgSinrDb;
+      ipsd[index] = it->avRxPowerDbm;
+      sir[index] = it->avgSirDb;
+    }
+
+  const double grid[] = {m_xMin, m_yMin, m_xStep, m_yStep, m_z};
+  outFile.write (reinterpret_cast<const char *> (&m_xNumPoints), sizeof (m_xNumPoints));
+  outFile.write (reinterpret_cast<const char *> (&m_yNumPoints), sizeof (m_yNumPoints));
+  outFile.write (reinterpret_cast<const char *> (grid), sizeof (grid));
+  for (const std::vector<float> *layer : {&snr, &sinr, &ipsd, &sir})
+    {
+      outFile.write (reinterpret_cast<const char *> (layer->data ()), layer->size () * sizeof (float));
+    }
+
+  outFile.close();
+
+  Finalize ();
+}
+
 void
 NrRadioEnvironmentMapHelper::CreateCustomGnuplotFile ()
 {
@@ -31,6 +31,7 @@
 #include <fstream>
 #include <ns3/mobility-helper.h>
 #include <chrono>
+#include <atomic>
 
 namespace ns3 {
 
@@ -98,6 +99,24 @@ $  remHelper->CreateRem (gnbNetDev, ueRemDevice, indexPhy);
  * \code{.unparsed}
 $  gnuplot -p nr-rem-SimTag-gnbs.txt nr-rem-SimTag-ues.txt nr-rem-SimTag-buildings.txt nr-rem-SimTag-plot-rem.gnuplot
     \endcode
+ *
+ * Alternatively, with the OutputFormat attribute set to Raster, the map is
+ * saved in the binary file nr-rem-SimTag.raster. The file starts with the
+ * number of points along the x and y axes (uint32_t), followed by the
+ * coordinates of the first point, the distances between adjacent points
+ * along the x and y axes and the z coordinate (double). Then there is one
+ * layer of float values for each of SNR, SINR, IPSD and SIR, in this order,
+ * each one with the points ordered by x and then by y. The points that are
+ * not part of the map (because they are at the position of an RTD) are NaN.
+ *
+ * The REM points are independent of each other, so they can be evaluated
+ * in parallel by setting the NumWorkers attribute. The map is divided in
+ * tiles of TileSize points, which are evaluated by worker processes forked
+ * from the simulation; each worker hence has its own copy of the devices,
+ * the antennas and the propagation models. With more than one worker (or
+ * when the RngStreamBase attribute is set), the random streams of the
+ * propagation models are assigned per REM point, so that the map does not
+ * depend on the number of workers or on the tile size.
  */
 
 
@@ -111,6 +130,11 @@ public:
          UE_COVERAGE
   };
 
+  enum OutputFormat {
+         TEXT_FORMAT,
+         RASTER_FORMAT
+  };
+
   /**
    * \brief NrRadioEnvironmentMapHelper constructor
    */
@@ -292,6 +316,8 @@ private:
   struct RemPoint
   {
     Vector pos {0,0,0};
+    uint32_t xIndex {0};
+    uint32_t yIndex {0};
     double avgSnrDb {0};
     double avgSinrDb {0};
     double avgSirDb {0};
@@ -375,33 +401,63 @@ private:
                                          const Ptr<NetDevice> &rrdDevice);
 
   /**
-   * \brief This function generates a BeamShape map. Using the configuration
-   * of antennas as have been set in the user scenario script, it calculates
-   * the SNR/SINR/IPSD.
+   * \brief This struct is shared by the REM workers to distribute the
+   * tiles of the map and to count the evaluated REM points
+   */
+  struct RemTileState
+  {
+    std::atomic<uint32_t> nextTile {0};
+    std::atomic<uint32_t> remPointsDone {0};
+  };
+
+  /**
+   * \brief This function generates the map of the configured REM mode. The
+   * REM points are evaluated tile by tile by NumWorkers workers.
    */
-  void CalcBeamShapeRemMap ();
+  void CalcRemMap ();
 
   /**
-   * \brief This function generates a CoverageArea map. In this case, all the
-   * antennas of the rtds are set to point towards the rem point and the antenna
-   * of the rem point towards each rtd device.
+   * \brief This function evaluates the tiles of the map, until there are
+   * no more tiles left
+   * \param calcRemPoint The function that evaluates a REM point
+   * \param remPoints The REM points, shared by all the workers
+   * \param tileState The tile state, shared by all the workers
+   * \param reportProgress Whether this worker prints the progress reports
    */
-  void CalcCoverageAreaRemMap ();
+  void RunRemWorker (void (NrRadioEnvironmentMapHelper::*calcRemPoint) (RemPoint&),
+                     RemPoint *remPoints, RemTileState *tileState, bool reportProgress);
 
   /**
-   * \brief This function generates a Ue Coverage map that depicts the SNR of
-   * this UE with respect to its UL transmission towards the gNB form various
-   * points on the map.
+   * \brief This function calculates a REM point of a BeamShape map. Using
+   * the configuration of antennas as have been set in the user scenario
+   * script, it calculates the SNR/SINR/IPSD.
+   * \param remPoint The REM point
+   */
+  void CalcBeamShapeRemPoint (RemPoint& remPoint);
+
+  /**
+   * \brief This function calculates a REM point of a CoverageArea map. In
+   * this case, all the antennas of the rtds are set to point towards the rem
+   * point and the antenna of the rem point towards each rtd device.
+   * \param remPoint The REM point
+   */
+  void CalcCoverageAreaRemPoint (RemPoint& remPoint);
+
+  /**
+   * \brief This function calculates a REM point of a Ue Coverage map that
+   * depicts the SNR of this UE with respect to its UL transmission towards
+   * the gNB form various points on the map.
    * An additional SINR map is also generated that can be used in mixed TDD/FDD
    * scenarios considering interference from neighbor gNBs that transmit in DL.
+   * \param remPoint The REM point
    */
-  void CalcUeCoverageRemMap ();
+  void CalcUeCoverageRemPoint (RemPoint& remPoint);
 
   /**
    * \brief This method calculates the PSD
    * \return The PSD (spectrumValue)
    */
-  Ptr<SpectrumValue> CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice) const;
+  Ptr<SpectrumValue> CalcRxPsdValue (RemDevice& device, RemDevice& otherDevice);
 
   /**
    * \brief This function calculates the SNR.
@@ -497,9 +553,9 @@ private:
   /**
    * \brief This method creates the temporal Propagation Models
    * \return The struct with the temporal propagation models (created for each
-   * rem point)
+   * rem point), with the random streams of the current REM point
    */
-  PropagationModels CreateTemporalPropagationModels () const;
+  PropagationModels CreateTemporalPropagationModels ();
 
   /**
    * \brief Prints REM generation progress report
@@ -527,6 +583,12 @@ private:
    */
   void PrintRemToFile ();
 
+  /**
+   * \brief this method saves the calculated SNR/SINR/IPSD/SIR values of
+   * the Rem Points in a raster file.
+   */
+  void PrintRemToRasterFile ();
+
   /*
    * Creates rem_plot${SimTag}.gnuplot file
    */
@@ -554,6 +616,8 @@ private:
 
   std::list<RemDevice> m_remDev; ///< List of REM Transmiting Devices (RTDs).
   std::list<RemPoint> m_rem; ///< List of REM points.
+  uint32_t m_xNumPoints {0}; ///< Number of REM points along the x axis.
+  uint32_t m_yNumPoints {0}; ///< Number of REM points along the y axis.
 
   std::chrono::system_clock::time_point m_remStartTime; //!< Time at which REM generation has started
 
@@ -588,6 +652,14 @@ private:
 
   std::string m_simTag;   ///< The `SimTag` attribute.
 
+  OutputFormat m_outputFormat {TEXT_FORMAT}; ///< The `OutputFormat` attribute.
+  uint32_t m_numWorkers {1}; ///< The `NumWorkers` attribute.
+  uint32_t m_tileSize {64}; ///< The `TileSize` attribute.
+  int64_t m_rngStreamBase {-1}; ///< The `RngStreamBase` attribute.
+  int64_t m_remPointStreams {0}; ///< Random streams reserved for each REM point, 0 to use the automatic streams.
+  int64_t m_remPointStream {0}; ///< Next random stream of the REM point being calculated.
+  int64_t m_remPointStreamEnd {0}; ///< End of the random streams of the REM point being calculated.
+
 }; // end of `class NrRadioEnvironmentMapHelper`
 
 } // end of `namespace ns3`
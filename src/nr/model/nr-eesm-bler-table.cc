@@ -0,0 +1,126 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+#include "nr-eesm-bler-table.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("NrEesmBlerTable");
+
+NrEesmBlerTable::NrEesmBlerTable (const NrEesmErrorModel::SimulatedBlerFromSINR &table)
+{
+  NS_LOG_FUNCTION (this);
+
+  m_numBg = table.size ();
+  for (const auto &bg : table)
+    {
+      m_numMcs = std::max (m_numMcs, static_cast<uint32_t> (bg.size ()));
+    }
+  m_ranges.assign (m_numBg * m_numMcs, CurveRange {0, 0});
+
+  for (uint32_t bg = 0; bg < m_numBg; ++bg)
+    {
+      for (uint32_t mcs = 0; mcs < table.at (bg).size (); ++mcs)
+        {
+          CurveRange &range = m_ranges.at (bg * m_numMcs + mcs);
+          range.m_first = m_curves.size ();
+          // std::map iterates the code block sizes in increasing order
+          for (const auto &cb : table.at (bg).at (mcs))
+            {
+              const NrEesmErrorModel::DoubleVector &sinr = std::get<0> (cb.second);
+              const NrEesmErrorModel::DoubleVector &bler = std::get<1> (cb.second);
+              NS_ABORT_MSG_IF (sinr.empty () || sinr.size () != bler.size (),
+                               "Invalid SINR-BLER curve for BG" << bg + 1 << " MCS " << mcs <<
+                               " CBS " << cb.first);
+
+              Curve curve;
+              curve.m_cbSize = cb.first;
+              curve.m_offset = m_sinrDb.size ();
+              curve.m_size = sinr.size ();
+              m_curves.push_back (curve);
+              m_sinrDb.insert (m_sinrDb.end (), sinr.begin (), sinr.end ());
+              m_bler.insert (m_bler.end (), bler.begin (), bler.end ());
+            }
+          range.m_count = m_curves.size () - range.m_first;
+        }
+    }
+
+  NS_LOG_INFO ("Flattened " << m_curves.size () << " curves with " << m_sinrDb.size () << " points");
+}
+
+const NrEesmBlerTable &
+NrEesmBlerTable::Get (const NrEesmErrorModel::SimulatedBlerFromSINR *table)
+{
+  static std::map<const NrEesmErrorModel::SimulatedBlerFromSINR *, std::unique_ptr<NrEesmBlerTable> > tables;
+
+  NS_ASSERT (table != nullptr);
+  auto it = tables.find (table);
+  if (it == tables.end ())
+    {
+      it = tables.emplace (table, std::unique_ptr<NrEesmBlerTable> (new NrEesmBlerTable (*table))).first;
+    }
+  return *(it->second);
+}
+
+double
+NrEesmBlerTable::GetBler (uint8_t bg, uint8_t mcs, uint32_t cbSizeBit, double sinrDb, bool interpolate) const
+{
+  NS_ABORT_MSG_IF (bg >= m_numBg || mcs >= m_numMcs, "No BLER table for BG" << bg + 1 << " MCS " << +mcs);
+  const CurveRange &range = m_ranges[bg * m_numMcs + mcs];
+  NS_ABORT_MSG_IF (range.m_count == 0, "No BLER table for BG" << bg + 1 << " MCS " << +mcs);
+
+  // take the largest simulated CB size not greater than cbSizeBit, or the smallest one
+  const Curve *curve = &m_curves[range.m_first];
+  for (uint32_t i = 1; i < range.m_count && m_curves[range.m_first + i].m_cbSize <= cbSizeBit; ++i)
+    {
+      curve = &m_curves[range.m_first + i];
+    }
+
+  const double *sinr = m_sinrDb.data () + curve->m_offset;
+  const double *bler = m_bler.data () + curve->m_offset;
+  const uint32_t size = curve->m_size;
+
+  if (sinrDb < sinr[0])
+    {
+      return 1.0;
+    }
+  if (sinrDb > sinr[size - 1])
+    {
+      return 0.0;
+    }
+
+  const double *sinrIt = std::upper_bound (sinr, sinr + size, sinrDb);
+  if (sinrIt != sinr)
+    {
+      sinrIt--;
+    }
+  uint32_t index = sinrIt - sinr;
+
+  if (interpolate && index + 1 < size && sinr[index + 1] > sinr[index])
+    {
+      double w = (sinrDb - sinr[index]) / (sinr[index + 1] - sinr[index]);
+      return bler[index] + w * (bler[index + 1] - bler[index]);
+    }
+  return bler[index];
+}
+
+} // namespace ns3
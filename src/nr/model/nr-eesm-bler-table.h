@@ -0,0 +1,112 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#ifndef NR_EESM_BLER_TABLE_H
+#define NR_EESM_BLER_TABLE_H
+
+#include <vector>
+#include "nr-eesm-error-model.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup error-models
+ * \brief Flattened BLER-SINR curves of a NrEesmErrorModel::SimulatedBlerFromSINR table
+ *
+ * The nested maps and vectors of the simulated tables are compiled into
+ * contiguous arrays: the SINR (in dB) and BLER points of all the curves are
+ * stored in two flat vectors, and each (base graph, MCS) pair indexes the
+ * range of its curves, sorted by code block size. A lookup does not copy nor
+ * allocate anything: it selects the curve of the largest simulated code block
+ * size not greater than the requested one (or the smallest one), then searches
+ * the SINR in the contiguous points of that curve.
+ *
+ * Without interpolation, the BLER is the one of the largest simulated SINR not
+ * greater than the requested one, i.e. the same value returned by the original
+ * lookup over the nested tables. With interpolation, the BLER is linearly
+ * interpolated between the two simulated SINRs surrounding the requested one.
+ * In both cases, the BLER is 1 below the first point of the curve and 0 above
+ * the last one.
+ *
+ * The tables are static, so the flattened version of each of them is built
+ * only once, at the first call of Get().
+ */
+class NrEesmBlerTable
+{
+public:
+  /**
+   * \brief Build the flattened version of a table
+   * \param table the BLER-SINR table
+   */
+  explicit NrEesmBlerTable (const NrEesmErrorModel::SimulatedBlerFromSINR &table);
+
+  /**
+   * \brief Get the flattened version of a static table, building it at the first call
+   * \param table pointer to the static BLER-SINR table
+   * \return the flattened table
+   */
+  static const NrEesmBlerTable & Get (const NrEesmErrorModel::SimulatedBlerFromSINR *table);
+
+  /**
+   * \brief Get the BLER for the given base graph, MCS, code block size and SINR
+   * \param bg the base graph type (0 for BG1, 1 for BG2)
+   * \param mcs the MCS
+   * \param cbSizeBit the code block size in bits
+   * \param sinrDb the SINR in dB
+   * \param interpolate whether to interpolate between the simulated SINRs
+   * \return the BLER
+   */
+  double GetBler (uint8_t bg, uint8_t mcs, uint32_t cbSizeBit, double sinrDb, bool interpolate) const;
+
+  /**
+   * \return the total number of SINR-BLER points of the table
+   */
+  std::size_t GetNumPoints () const
+  {
+    return m_sinrDb.size ();
+  }
+
+private:
+  /**
+   * \brief A SINR-BLER curve, for a given code block size
+   */
+  struct Curve
+  {
+    uint32_t m_cbSize;  //!< simulated code block size in bits
+    uint32_t m_offset;  //!< index of the first point in m_sinrDb and m_bler
+    uint32_t m_size;    //!< number of points
+  };
+
+  /**
+   * \brief The curves of a (base graph, MCS) pair
+   */
+  struct CurveRange
+  {
+    uint32_t m_first;   //!< index of the first curve in m_curves
+    uint32_t m_count;   //!< number of curves
+  };
+
+  std::vector<CurveRange> m_ranges;  //!< curve ranges, indexed by bg * m_numMcs + mcs
+  std::vector<Curve> m_curves;       //!< curves, sorted by code block size inside each range
+  std::vector<double> m_sinrDb;      //!< SINR points of all the curves
+  std::vector<double> m_bler;        //!< BLER points of all the curves
+  uint32_t m_numBg {0};              //!< number of base graphs
+  uint32_t m_numMcs {0};             //!< number of MCS per base graph
+};
+
+} // namespace ns3
+
+#endif // NR_EESM_BLER_TABLE_H
@@ -20,7 +20,9 @@
 */
 
 #include "nr-eesm-error-model.h"
+#include "nr-eesm-bler-table.h"
 #include "ns3/log.h"
+#include "ns3/boolean.h"
 #include <cmath>
 #include <algorithm>
 #include "ns3/enum.h"
@@ -58,6 +60,13 @@ NrEesmErrorModel::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::NrEesmErrorModel")
     .SetParent<NrErrorModel> ()
+    .AddAttribute ("BlerInterpolation",
+                   "If true, the BLER is linearly interpolated between the two simulated "
+                   "SINR values surrounding the effective SINR, instead of taking the BLER "
+                   "of the largest simulated SINR not greater than the effective SINR",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NrEesmErrorModel::m_blerInterpolation),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
@@ -95,10 +104,10 @@ NrEesmErrorModel::SinrExp (const SpectrumValue& sinr, const std::vector<int>& ma
   double SINRexp = 0.0;
   double SINRsum = 0.0;
   double beta = GetBetaTable ()->at (mcs);
-  SpectrumValue sinrCopy = sinr;
+  Values::const_iterator sinrValues = sinr.ConstValuesBegin ();
   for (uint32_t i = 0; i < map.size (); i++)
     {
-      double sinrLin = sinrCopy [map.at (i)];
+      double sinrLin = *(sinrValues + map.at (i));
       SINRexp = exp (-sinrLin / beta);
       SINRsum += SINRexp;
     }
@@ -128,45 +137,18 @@ NrEesmErrorModel::MappingSinrBler (double sinr, uint8_t mcs, uint32_t cbSizeBit)
   // use cbSize to obtain the index of CBSIZE in the map, jointly with mcs and sinr. take the
   // lowest CBSIZE simulated including this CB for removing CB size quatization
   // errors. sinr is also lower-bounded.
-  double bler = 0.0;
   double sinr_db = 10 * log10 (sinr);
   GraphType bg_type = GetBaseGraphType (cbSizeBit, mcs);
 
-  // Get the index of CBSIZE in the map
   NS_LOG_INFO ("For sinr " << sinr << " and mcs " << +mcs <<
                 " CbSizebit " << cbSizeBit << " we got bg type " << m_bgTypeName[bg_type]);
-  auto cbMap = GetSimulatedBlerFromSINR ()->at (bg_type).at (mcs);
-  auto cbIt = cbMap.upper_bound (cbSizeBit);
 
-  if (cbIt != cbMap.begin ())
+  // The tables are flattened once, and then shared by all the instances using them
+  if (m_blerTable == nullptr)
     {
-      cbIt--;
-    }
-
-  if (sinr_db < GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).front ())
-    {
-      bler = 1.0;
-    }
-  else if (sinr_db > GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).back ())
-    {
-      bler = 0.0;
-    }
-  else
-    {
-      // Get the index of SINR in the vector
-      auto sinrIt = std::upper_bound (GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin (),
-                                      GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).end (),
-                                      sinr_db);
-
-      if (sinrIt != GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin ())
-        {
-          sinrIt--;
-        }
-
-      auto sinr_index = std::distance (GetSinrDbVectorFromSimulatedValues (bg_type, mcs, cbIt->first).begin (),
-                                       sinrIt);
-      bler = GetBLERVectorFromSimulatedValues (bg_type, mcs, cbIt->first).at (sinr_index);
+      m_blerTable = &NrEesmBlerTable::Get (GetSimulatedBlerFromSINR ());
     }
+  double bler = m_blerTable->GetBler (bg_type, mcs, cbSizeBit, sinr_db, m_blerInterpolation);
 
   NS_LOG_LOGIC ("SINR effective: " << sinr << " BLER:" << bler);
   return bler;
@@ -25,6 +25,8 @@
 namespace ns3 {
 
 class NrL2smEesmTestCase;
+class NrEesmBlerTableTestCase;
+class NrEesmBlerTable;
 
 /**
  * \ingroup error-models
@@ -88,6 +90,7 @@ class NrEesmErrorModel : public NrErrorModel
 {
 public:
   friend NrL2smEesmTestCase;
+  friend NrEesmBlerTableTestCase;
   /**
    * \brief GetTypeId
    * \return the type id of the object
@@ -262,6 +265,9 @@ protected:
 private:
   static std::vector<std::string> m_bgTypeName; //!< Base graph name
 
+  const NrEesmBlerTable *m_blerTable {nullptr}; //!< Flattened BLER-SINR table, set at the first BLER lookup
+  bool m_blerInterpolation {false}; //!< Whether the BLER is interpolated between the simulated SINRs
+
   /**
    * \brief map the effective SINR into CBLER for the specified MCS and CB size,
    * according to the EESM method
@@ -29,6 +29,7 @@
 
 #include <ns3/log.h>
 #include <ns3/spectrum-value.h>
+#include "nr-spectrum-value-kernels.h"
 #include "nr-sl-chunk-processor.h"
 
 namespace ns3 {
@@ -79,7 +80,7 @@ NrSlChunkProcessor::EvaluateChunk (uint32_t index, const SpectrumValue& sinr, Ti
     {
       m_chunkValues[index].m_sumValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
     }
-  *(m_chunkValues[index].m_sumValues) += sinr * duration.GetSeconds ();
+  NrSpectrumValueKernels::AddScaled (*(m_chunkValues[index].m_sumValues), sinr, duration.GetSeconds ());
   m_chunkValues[index].m_totDuration += duration;
 }
 
@@ -91,10 +92,12 @@ NrSlChunkProcessor::End ()
   if (m_chunkValues[0].m_totDuration.GetSeconds () > 0)
     {
       std::vector<SpectrumValue> values;
+      values.reserve (m_chunkValues.size ());
       std::vector<NrSlChunkValue>::iterator itValues;
       for (itValues = m_chunkValues.begin() ; itValues != m_chunkValues.end () ; itValues++)
         {
-          values.push_back (*((*itValues).m_sumValues) / (*itValues).m_totDuration.GetSeconds ());
+          values.push_back (*((*itValues).m_sumValues));
+          NrSpectrumValueKernels::DivideByScalar (values.back (), (*itValues).m_totDuration.GetSeconds ());
         }
 
       std::vector<NrSlChunkProcessorCallback>::iterator it;
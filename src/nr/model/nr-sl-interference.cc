@@ -22,6 +22,7 @@
  */
 #include "nr-sl-interference.h"
 #include "nr-sl-chunk-processor.h"
+#include "nr-spectrum-value-kernels.h"
 
 #include <ns3/simulator.h>
 #include <ns3/log.h>
@@ -54,6 +55,8 @@ NrSlInterference::DoDispose ()
   m_rxSignal.clear ();
   m_allSignals = 0;
   m_noise = 0;
+  m_interf = 0;
+  m_sinr = 0;
   Object::DoDispose ();
 } 
 
@@ -159,7 +162,7 @@ NrSlInterference::DoAddSignal  (Ptr<const SpectrumValue> spd)
 { 
   NS_LOG_FUNCTION (this << *spd);
   ConditionallyEvaluateChunk ();
-  (*m_allSignals) += (*spd);
+  NrSpectrumValueKernels::Add (*m_allSignals, *spd);
 }
 
 void
@@ -170,7 +173,7 @@ NrSlInterference::DoSubtractSignal  (Ptr<const SpectrumValue> spd, uint32_t sign
   int32_t deltaSignalId = signalId - m_lastSignalIdBeforeReset;
   if (deltaSignalId > 0)
     {   
-      (*m_allSignals) -= (*spd);
+      NrSpectrumValueKernels::Subtract (*m_allSignals, *spd);
     }
   else
     {
@@ -195,9 +198,10 @@ NrSlInterference::ConditionallyEvaluateChunk ()
         {
           NS_LOG_LOGIC (this << " signal = " << *(m_rxSignal[index]) << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
           
-          SpectrumValue interf =  (*m_allSignals) - (*(m_rxSignal[index])) + (*m_noise);
-          
-          SpectrumValue sinr = (*(m_rxSignal[index])) / interf;
+          // interf = allSignals - rxSignal + noise, sinr = rxSignal / interf, computed without temporaries
+          NrSpectrumValueKernels::InterferenceAndSinr (*m_interf, *m_sinr, *m_allSignals, *(m_rxSignal[index]), *m_noise);
+          const SpectrumValue &interf = *m_interf;
+          const SpectrumValue &sinr = *m_sinr;
           Time duration = Now () - m_lastChangeTime;
           for (std::list<Ptr<NrSlChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
             {
@@ -225,6 +229,8 @@ NrSlInterference::SetNoisePowerSpectralDensity (Ptr<const SpectrumValue> noisePs
   // reset m_allSignals (will reset if already set previously)
   // this is needed since this method can potentially change the SpectrumModel
   m_allSignals = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_interf = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_sinr = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
   if (m_receiving == true)
     {
       // abort rx
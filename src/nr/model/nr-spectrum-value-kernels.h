@@ -0,0 +1,100 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef NR_SPECTRUM_VALUE_KERNELS_H
+#define NR_SPECTRUM_VALUE_KERNELS_H
+
+#include <string>
+#include <vector>
+
+namespace ns3 {
+
+class SpectrumValue;
+
+/**
+ * \ingroup nr
+ *
+ * In-place element-wise operations on the bands of SpectrumValues, used in the hot paths of the sidelink
+ * interference and chunk processing instead of the SpectrumValue operators, which allocate a temporary
+ * SpectrumValue for each operation.
+ *
+ * The operations are vectorized with AVX2 or SSE2 when the CPU supports them (the implementation is selected at
+ * run time, so no special compiler flag is needed), and implemented with plain loops otherwise.
+ * Each band is computed with the same sequence of IEEE operations as the SpectrumValue operators, so that the
+ * results are identical to the ones of the non-vectorized code.
+ *
+ * All the SpectrumValues passed to the same call must use the same SpectrumModel.
+ */
+class NrSpectrumValueKernels
+{
+public:
+  /**
+   * \brief dst += src
+   */
+  static void Add (SpectrumValue &dst, const SpectrumValue &src);
+  /**
+   * \brief dst -= src
+   */
+  static void Subtract (SpectrumValue &dst, const SpectrumValue &src);
+  /**
+   * \brief dst *= src
+   */
+  static void Multiply (SpectrumValue &dst, const SpectrumValue &src);
+  /**
+   * \brief dst /= src
+   */
+  static void Divide (SpectrumValue &dst, const SpectrumValue &src);
+  /**
+   * \brief dst += src * k
+   */
+  static void AddScaled (SpectrumValue &dst, const SpectrumValue &src, double k);
+  /**
+   * \brief dst /= k
+   */
+  static void DivideByScalar (SpectrumValue &dst, double k);
+  /**
+   * \brief interf = allSignals - rx + noise and sinr = rx / interf
+   *
+   * \param interf output interference plus noise
+   * \param sinr output SINR
+   * \param allSignals sum of all the signals perceived in the medium, including rx
+   * \param rx the signal being received
+   * \param noise the noise power spectral density
+   */
+  static void InterferenceAndSinr (SpectrumValue &interf, SpectrumValue &sinr,
+                                   const SpectrumValue &allSignals, const SpectrumValue &rx,
+                                   const SpectrumValue &noise);
+
+  /**
+   * \return the name of the implementation in use ("avx2", "sse2" or "scalar")
+   */
+  static std::string GetImplementation (void);
+  /**
+   * \return the names of the implementations supported by the CPU, from the one selected by default
+   */
+  static std::vector<std::string> GetAvailableImplementations (void);
+  /**
+   * \brief Force the implementation used by all the kernels (e.g. to compare them in the tests)
+   *
+   * \param name the name of the implementation, among the ones returned by GetAvailableImplementations()
+   * \return false if the implementation is not supported by the CPU, in which case the current one is kept
+   */
+  static bool SetImplementation (const std::string &name);
+};
+
+} // namespace ns3
+
+#endif /* NR_SPECTRUM_VALUE_KERNELS_H */
@@ -1278,143 +1278,33 @@ NrUeMac::GetNrSlTxOpportunities (const SfnSf& sfn)
       return GetNrSupportedList (sfn, allTxOpps);
     }
   candSsResoA = allTxOpps;
-  uint32_t mTotal = candSsResoA.size (); // total number of candidate single-slot resources
-  int rsrpThrehold = GetSlThresPsschRsrp ();
 
   if (m_enableSensing)
     {
-      if (m_sensingData.size () == 0)
+      if (m_slSensedSciSlots.size () == 0)
         {
           //no sensing
           nrCandSsResoA = GetNrSupportedList (sfn, candSsResoA);
           return nrCandSsResoA;
         }
 
-      //Copy the buffer so we can trim the buffer as per Tproc0.
-      //Note, we do not need to delete the latest measurement
-      //from the original buffer because it will be deleted
-      //by UpdateSensingWindow method once it is outdated.
-
-      auto sensedData = m_sensingData;
-
-      //latest sensing data is at the end of the list
-      //now remove the latest sensing data as per the value of Tproc0. This would
-      //keep the size of the buffer equal to [n – T0 , n – Tproc0)
-
-      auto rvIt = sensedData.crbegin ();
-      if (rvIt != sensedData.crend ())
-        {
-          while (sfn.Normalize () - rvIt->sfn.Normalize () <= GetTproc0 ())
-            {
-              NS_LOG_DEBUG ("IMSI " << m_imsi << " ignoring sensed SCI at sfn " << sfn << " received at " << rvIt->sfn);
-              sensedData.pop_back ();
-              rvIt = sensedData.crbegin ();
-            }
-        }
-
-      // calculate all possible transmissions of sensed data
-      //using a vector of SlotSensingData, since we need to check all the SCIs
-      //and their possible future transmission that are received during the
-      //above trimmed sensing window. On each index of the vector, it is a
-      //list that holds the info of each received SCI and its possible
-      //future transmission.
-      std::vector<std::list<SlotSensingData>> allSensingData;
-      for (const auto &itSensedSlot:sensedData)
-        {
-          std::list<SlotSensingData> listFutureSensTx = GetFutSlotsBasedOnSens (itSensedSlot);
-          allSensingData.push_back (listFutureSensTx);
-        }
-
-      NS_LOG_DEBUG ("Size of allSensingData " << allSensingData.size ());
+      //The future transmissions of the sensed SCIs are stored in the slots in
+      //which they occur when the SCIs are received. Only the SCIs received in
+      //[n – T0 , n – Tproc0) are used.
+      uint16_t sensWindLen = m_slTxPool->GetNrSlSensWindInSlots (GetBwpId (),
+                                                                 m_poolId,
+                                                                 m_nrSlUePhySapProvider->GetSlotPeriod ());
+      uint16_t pPrimeRsvpTx = m_slTxPool->GetResvPeriodInSlots (GetBwpId (),
+                                                                m_poolId,
+                                                                m_pRsvpTx,
+                                                                m_nrSlUePhySapProvider->GetSlotPeriod ());
 
       //step 5 point 1: We don't need to implement it since we only sense those
       //slots at which this UE does not transmit. This is due to the half
       //duplex nature of the PHY.
-      //step 6
-      do
-        {
-          //following assignment is needed since we might have to perform
-          //multiple do-while over the same list by increasing the rsrpThrehold
-          candSsResoA = allTxOpps;
-          nrCandSsResoA = GetNrSupportedList (sfn, candSsResoA);
-          auto itCandSsResoA = nrCandSsResoA.begin ();
-          while (itCandSsResoA != nrCandSsResoA.end ())
-            {
-              bool erased = false;
-              // calculate all proposed transmissions of current candidate resource
-              std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> listFutureCands;
-              uint16_t pPrimeRsvpTx = m_slTxPool->GetResvPeriodInSlots (GetBwpId (),
-                                                                        m_poolId,
-                                                                        m_pRsvpTx,
-                                                                        m_nrSlUePhySapProvider->GetSlotPeriod ());
-              for (uint16_t i = 0; i < m_cResel; i++)
-                {
-                  auto slAlloc = *itCandSsResoA;
-                  slAlloc.sfn.Add (i * pPrimeRsvpTx);
-                  listFutureCands.emplace_back (slAlloc);
-                }
-              // Traverse over all the possible transmissions of each sensed SCI
-              for (const auto &itSensedData:allSensingData)
-                {
-                  // for all proposed transmissions of current candidate resource
-                  for (auto &itFutureCand:listFutureCands)
-                    {
-                      for (const auto &itFutureSensTx:itSensedData)
-                        {
-                          if (itFutureCand.sfn.Normalize () == itFutureSensTx.sfn.Normalize ())
-                            {
-                              uint16_t lastSbChInPlusOne = itFutureSensTx.sbChStart + itFutureSensTx.sbChLength;
-                              for (uint8_t i = itFutureSensTx.sbChStart; i < lastSbChInPlusOne; i++)
-                                {
-                                  NS_LOG_DEBUG (this << " Overlapped Slot " << itCandSsResoA->sfn.Normalize () << " occupied " << +itFutureSensTx.sbChLength << " subchannels index " << +itFutureSensTx.sbChStart);
-                                  itCandSsResoA->occupiedSbCh.insert (i);
-                                }
-                              if (itCandSsResoA->occupiedSbCh.size () == GetTotalSubCh (m_poolId))
-                                {
-                                  if(itFutureSensTx.slRsrp > rsrpThrehold)
-                                    {
-                                      itCandSsResoA = nrCandSsResoA.erase (itCandSsResoA);
-                                      erased = true;
-                                      NS_LOG_DEBUG ("Absolute slot number " << itFutureCand.sfn.Normalize () << " erased. Its rsrp : " << itFutureSensTx.slRsrp << " Threshold : " << rsrpThrehold);
-                                      //stop traversing over sensing data as we have
-                                      //already found the slot to exclude.
-                                      break; // break for (const auto &itFutureSensTx:listFutureSensTx)
-                                    }
-                                }
-                            }
-                        }
-                      if (erased)
-                        {
-                          break; // break for (const auto &itFutureCand:listFutureCands)
-                        }
-                    }
-                  if (erased)
-                    {
-                      break; // break for (const auto &itSensedSlot:allSensingData)
-                    }
-                }
-              if (!erased)
-                {
-                  itCandSsResoA++;
-                }
-            }
-          //step 7. If the following while will not break, start over do-while
-          //loop with rsrpThreshold increased by 3dB
-          rsrpThrehold += 3;
-          if (rsrpThrehold > 0)
-            {
-              //0 dBm is the maximum RSRP threshold level so if we reach
-              //it, that means all the available slots are overlapping
-              //in time and frequency with the sensed slots, and the
-              //RSRP of the sensed slots is very high.
-              NS_LOG_DEBUG ("Reached maximum RSRP threshold, unable to select resources");
-              nrCandSsResoA.erase (nrCandSsResoA.begin (), nrCandSsResoA.end ());
-              break; //break do while
-            }
-        }
-      while (nrCandSsResoA.size () < (GetResourcePercentage () / 100.0) * mTotal);
-
-      NS_LOG_DEBUG (nrCandSsResoA.size () << " slots selected after sensing resource selection from " << mTotal << " slots");
+      //steps 6 and 7
+      nrCandSsResoA = GetNrSupportedList (sfn, candSsResoA);
+      ExcludeSensedCandidates (nrCandSsResoA, absSlotIndex, sensWindLen, pPrimeRsvpTx, GetTotalSubCh (m_poolId));
     }
   else
     {
@@ -1503,6 +1393,130 @@ NrUeMac::GetNrSupportedList (const SfnSf& sfn, std::list <NrSlCommResourcePool::
   return nrSupportedList;
 }
 
+void
+NrUeMac::ExcludeSensedCandidates (std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> &nrCandSsResoA,
+                                  uint64_t absSlotIndex, uint16_t sensWindLen,
+                                  uint16_t pPrimeRsvpTx, uint8_t totalSubCh)
+{
+  NS_LOG_FUNCTION (this << absSlotIndex);
+
+  uint32_t mTotal = nrCandSsResoA.size (); // total number of candidate single-slot resources
+  int rsrpThrehold = GetSlThresPsschRsrp ();
+  NS_ASSERT_MSG (totalSubCh <= 64, "The subchannel bitmaps support up to 64 subchannels");
+  const uint64_t ringMask = m_slSensedReservations.size () - 1;
+
+  //step 6
+  //The sensed transmissions overlapping with the proposed transmissions of
+  //a candidate slot are visited in the order in which the SCIs were
+  //received. Once they occupy all the subchannels, the slot is excluded if
+  //one of the following ones has an RSRP above the threshold, so the
+  //highest of these RSRPs is enough to evaluate the exclusion of the slot
+  //for any threshold.
+  std::vector<uint64_t> occupiedSbCh;
+  std::vector<double> exclusionRsrp;
+  occupiedSbCh.reserve (nrCandSsResoA.size ());
+  exclusionRsrp.reserve (nrCandSsResoA.size ());
+  std::vector<std::pair<const SlSensedReservation*, uint16_t> > overlaps;
+  for (const auto &itCandSsResoA:nrCandSsResoA)
+    {
+      // calculate all proposed transmissions of current candidate resource
+      overlaps.clear ();
+      uint64_t candSlot = itCandSsResoA.sfn.Normalize ();
+      for (uint16_t i = 0; i < m_cResel; i++)
+        {
+          uint64_t futureCandSlot = candSlot + i * pPrimeRsvpTx;
+          for (const auto &itResv:m_slSensedReservations[futureCandSlot & ringMask])
+            {
+              if (itResv.slot == futureCandSlot && IsInSensingWindow (itResv.sciSlot, absSlotIndex, sensWindLen))
+                {
+                  overlaps.emplace_back (&itResv, i);
+                }
+            }
+        }
+      std::sort (overlaps.begin (), overlaps.end (),
+                 [] (const std::pair<const SlSensedReservation*, uint16_t> &a, const std::pair<const SlSensedReservation*, uint16_t> &b)
+                 {
+                   if (a.first->sciIndex != b.first->sciIndex)
+                     {
+                       return a.first->sciIndex < b.first->sciIndex;
+                     }
+                   if (a.second != b.second)
+                     {
+                       return a.second < b.second;
+                     }
+                   return a.first->resvIndex < b.first->resvIndex;
+                 });
+
+      uint64_t sbCh = 0;
+      double rsrp = -std::numeric_limits<double>::infinity ();
+      for (const auto &itOverlap:overlaps)
+        {
+          NS_LOG_DEBUG (this << " Overlapped Slot " << candSlot << " occupied subchannels " << std::bitset<64> (itOverlap.first->sbChMask));
+          sbCh |= itOverlap.first->sbChMask;
+          if (std::bitset<64> (sbCh).count () == totalSubCh)
+            {
+              rsrp = std::max (rsrp, itOverlap.first->slRsrp);
+            }
+        }
+      occupiedSbCh.push_back (sbCh);
+      exclusionRsrp.push_back (rsrp);
+    }
+
+  bool noResources = false;
+  uint32_t numRemaining = 0;
+  do
+    {
+      numRemaining = std::count_if (exclusionRsrp.begin (), exclusionRsrp.end (),
+                                    [rsrpThrehold] (double rsrp) { return !(rsrp > rsrpThrehold); });
+      //step 7. If the following while will not break, start over do-while
+      //loop with rsrpThreshold increased by 3dB
+      rsrpThrehold += 3;
+      if (rsrpThrehold > 0)
+        {
+          //0 dBm is the maximum RSRP threshold level so if we reach
+          //it, that means all the available slots are overlapping
+          //in time and frequency with the sensed slots, and the
+          //RSRP of the sensed slots is very high.
+          NS_LOG_DEBUG ("Reached maximum RSRP threshold, unable to select resources");
+          noResources = true;
+          break; //break do while
+        }
+    }
+  while (numRemaining < (GetResourcePercentage () / 100.0) * mTotal);
+  rsrpThrehold -= 3;
+
+  uint32_t candIndex = 0;
+  auto itCandSsResoA = nrCandSsResoA.begin ();
+  while (itCandSsResoA != nrCandSsResoA.end ())
+    {
+      if (noResources || exclusionRsrp[candIndex] > rsrpThrehold)
+        {
+          NS_LOG_DEBUG ("Absolute slot number " << itCandSsResoA->sfn.Normalize () << " erased. Its rsrp : " << exclusionRsrp[candIndex] << " Threshold : " << rsrpThrehold);
+          itCandSsResoA = nrCandSsResoA.erase (itCandSsResoA);
+        }
+      else
+        {
+          for (uint8_t i = 0; i < 64; i++)
+            {
+              if (occupiedSbCh[candIndex] & (UINT64_C (1) << i))
+                {
+                  itCandSsResoA->occupiedSbCh.insert (i);
+                }
+            }
+          itCandSsResoA++;
+        }
+      candIndex++;
+    }
+
+  NS_LOG_DEBUG (nrCandSsResoA.size () << " slots selected after sensing resource selection from " << mTotal << " slots");
+}
+
+bool
+NrUeMac::IsInSensingWindow (uint64_t sciSlot, uint64_t slot, uint16_t sensWindLen) const
+{
+  return sciSlot < slot && slot - sciSlot > GetTproc0 () && sciSlot + sensWindLen >= slot;
+}
+
 void
 NrUeMac::DoReceiveSensingData (SensingData sensingData)
 {
@@ -1510,42 +1524,107 @@ NrUeMac::DoReceiveSensingData (SensingData sensingData)
 
   if (m_enableSensing)
     {
-      //oldest data will be at the front of the queue
-      m_sensingData.push_back (sensingData);
+      if (m_slSensedReservations.empty ())
+        {
+          //The array must hold the slots from the oldest sensed SCI to its
+          //farthest future transmission; when it is shorter, the lookups are
+          //still correct, but the slots share more entries
+          uint16_t sensWindLen = m_slTxPool->GetNrSlSensWindInSlots (GetBwpId (),
+                                                                     m_poolId,
+                                                                     m_nrSlUePhySapProvider->GetSlotPeriod ());
+          uint16_t maxRsvp = m_slTxPool->GetResvPeriodInSlots (GetBwpId (),
+                                                               m_poolId,
+                                                               MilliSeconds (1000),
+                                                               m_nrSlUePhySapProvider->GetSlotPeriod ());
+          uint64_t ringSize = 1;
+          while (ringSize < static_cast<uint64_t> (sensWindLen) + 2 * maxRsvp + m_t2 + 64)
+            {
+              ringSize <<= 1;
+            }
+          m_slSensedReservations.resize (ringSize);
+        }
+
+      StoreSensedReservations (sensingData.sfn.Normalize (), sensingData.slRsrp, GetFutSlotsBasedOnSens (sensingData));
     }
 }
 
+void
+NrUeMac::StoreSensedReservations (uint64_t sciSlot, double slRsrp, const std::list<SlotSensingData> &futureSensTx)
+{
+  NS_LOG_FUNCTION (this << sciSlot << slRsrp);
+
+  //store the future transmissions of the SCI in the slots in which they occur
+  SlSensedReservation resv;
+  resv.sciSlot = sciSlot;
+  resv.sciIndex = m_slSensedSciCount++;
+  resv.slRsrp = slRsrp;
+  for (const auto &itFutureSensTx:futureSensTx)
+    {
+      NS_ASSERT_MSG (itFutureSensTx.sbChStart + itFutureSensTx.sbChLength <= 64, "The subchannel bitmaps support up to 64 subchannels");
+      resv.slot = itFutureSensTx.sfn.Normalize ();
+      resv.sbChMask = 0;
+      for (uint8_t i = itFutureSensTx.sbChStart; i < itFutureSensTx.sbChStart + itFutureSensTx.sbChLength; i++)
+        {
+          resv.sbChMask |= UINT64_C (1) << i;
+        }
+      m_slSensedReservations[resv.slot & (m_slSensedReservations.size () - 1)].push_back (resv);
+      resv.resvIndex++;
+    }
+
+  //oldest data will be at the front of the queue
+  m_slSensedSciSlots.push_back (sciSlot);
+}
+
 void
 NrUeMac::UpdateSensingWindow (const SfnSf& sfn)
 {
   NS_LOG_FUNCTION (this << sfn);
 
+  if (!m_enableSensing || m_slSensedReservations.empty ())
+    {
+      return;
+    }
+
   uint16_t sensWindLen = m_slTxPool->GetNrSlSensWindInSlots (GetBwpId (),
                                                              m_poolId,
                                                              m_nrSlUePhySapProvider->GetSlotPeriod ());
-  //oldest sensing data is on the top of the list
-  auto it = m_sensingData.cbegin();
-  while (it != m_sensingData.cend ())
-    {
-      if (it->sfn.Normalize () < sfn.Normalize () - sensWindLen)
-        {
-          NS_LOG_DEBUG ("IMSI " << m_imsi << " erasing SCI at sfn " << sfn << " received at " << it->sfn);
-          it = m_sensingData.erase (it);
-        }
-      else
-        {
-          //once we reached the sensing data, which lies in the
-          //sensing window, we break. If the last entry lies in the sensing
-          //window rest of the entries as well.
-          break;
-        }
-      ++it;
-    }
+  PurgeSensedReservations (sfn.Normalize (), sensWindLen);
 
   //To keep the size of the buffer equal to [n – T0 , n – Tproc0)
   //the other end of sensing buffer is trimmed in GetNrSlTxOpportunities.
 }
 
+void
+NrUeMac::PurgeSensedReservations (uint64_t absSlotIndex, uint16_t sensWindLen)
+{
+  NS_LOG_FUNCTION (this << absSlotIndex << sensWindLen);
+
+  //oldest sensing data is on the top of the queue
+  while (!m_slSensedSciSlots.empty () && m_slSensedSciSlots.front () + sensWindLen < absSlotIndex)
+    {
+      NS_LOG_DEBUG ("IMSI " << m_imsi << " erasing SCI at slot " << absSlotIndex << " received at " << m_slSensedSciSlots.front ());
+      m_slSensedSciSlots.pop_front ();
+    }
+
+  //remove the reservations of the slots elapsed since the last update. Each
+  //entry of the array is visited at least once every m_slSensedReservations.size ()
+  //slots, hence a stale reservation stays at most as long in the array.
+  uint64_t ringSize = m_slSensedReservations.size ();
+  uint64_t first = m_slSensedReservationsPurged;
+  if (absSlotIndex > ringSize && first < absSlotIndex - ringSize)
+    {
+      first = absSlotIndex - ringSize;
+    }
+  for (uint64_t slot = first; slot < absSlotIndex; slot++)
+    {
+      auto &entry = m_slSensedReservations[slot & (ringSize - 1)];
+      entry.erase (std::remove_if (entry.begin (), entry.end (),
+                                   [absSlotIndex] (const SlSensedReservation &resv) { return resv.slot < absSlotIndex; }),
+                   entry.end ());
+    }
+  m_slSensedReservationsPurged = std::max (m_slSensedReservationsPurged, absSlotIndex);
+}
+
 
 void
 NrUeMac::DoReceivePsschPhyPdu (Ptr<PacketBurst> pdu)
@@ -37,6 +37,7 @@
 #include "nr-sl-phy-mac-common.h"
 #include <unordered_set>
 #include <map>
+#include <deque>
 
 namespace ns3 {
 
@@ -143,6 +144,8 @@ class NrUeMac : public Object
   friend class MemberNrSlUeMacCschedSapUser;
   /// allow MemberNrSlUeMacSchedSapUser<NrUeMac> class friend access
   friend class MemberNrSlUeMacSchedSapUser;
+  /// allow NrUeMacSensingTestCase class friend access
+  friend class NrUeMacSensingTestCase;
 
 public:
   /**
@@ -956,6 +959,36 @@ private:
    * \return The list of the future transmission slots based on sensed data.
    */
   std::list<SlotSensingData> GetFutSlotsBasedOnSens (SensingData sensedData);
+  /**
+   * \brief Check if a sensed SCI belongs to the sensing window [n – T0 , n – Tproc0)
+   * \param sciSlot The absolute slot number in which the SCI was received
+   * \param slot The absolute slot number of the current slot (n)
+   * \param sensWindLen The sensing window length (T0) in slots
+   * \return true if the SCI is used for the resource selection
+   */
+  bool IsInSensingWindow (uint64_t sciSlot, uint64_t slot, uint16_t sensWindLen) const;
+  /**
+   * \brief Exclude the candidate single-slot resources reserved by the sensed
+   *        SCIs (steps 6 and 7 of TS 38.214 sec 8.1.4)
+   * \param nrCandSsResoA The candidate single-slot resources. The excluded ones
+   *        are removed, and the subchannels occupied in the remaining ones are set.
+   * \param absSlotIndex The absolute slot number of the current slot (n)
+   * \param sensWindLen The sensing window length (T0) in slots
+   * \param pPrimeRsvpTx The reservation period of this UE in logical slots
+   * \param totalSubCh The total number of subchannels of the pool
+   */
+  void ExcludeSensedCandidates (std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> &nrCandSsResoA,
+                                uint64_t absSlotIndex, uint16_t sensWindLen,
+                                uint16_t pPrimeRsvpTx, uint8_t totalSubCh);
+  /**
+   * \brief Store the future transmissions of a sensed SCI 1-A in the slots in
+   *        which they occur
+   * \param sciSlot The absolute slot number in which the SCI was received
+   * \param slRsrp The RSRP of the SCI
+   * \param futureSensTx The future transmissions of the SCI, as computed by
+   *        GetFutSlotsBasedOnSens
+   */
+  void StoreSensedReservations (uint64_t sciSlot, double slRsrp, const std::list<SlotSensingData> &futureSensTx);
   /**
    * \brief Method to convert the list of NrSlCommResourcePool::SlotInfo to
    *        NrSlUeMacSchedSapProvider::NrSlSlotInfo
@@ -1035,9 +1068,17 @@ private:
    * \brief Update the sensing window
    * \param sfn The current system frame, subframe, and slot number. This SfnSf
    *        is aligned with the SfnSf of the physical layer.
-   * It will remove the sensing data, which lies outside the sensing window length.
+   * It will remove the sensing data, which lies outside the sensing window length,
+   * and the sensed reservations of the past slots.
    */
   void UpdateSensingWindow (const SfnSf& sfn);
+  /**
+   * \brief Remove the sensed SCIs older than the sensing window and the sensed
+   *        reservations of the past slots
+   * \param absSlotIndex The absolute slot number of the current slot (n)
+   * \param sensWindLen The sensing window length (T0) in slots
+   */
+  void PurgeSensedReservations (uint64_t absSlotIndex, uint16_t sensWindLen);
   /**
    * \brief Compute the gaps in slots for the possible retransmissions
    *        indicated by an SCI 1-A.
@@ -1097,7 +1138,23 @@ private:
   Ptr <NrSlUeMacHarq> m_nrSlHarq; //!< Pointer to the NR SL UE MAC HARQ object
   uint32_t m_srcL2Id {std::numeric_limits <uint32_t>::max ()}; //!< The NR Sidelink Source L2 id;
   bool m_nrSlMacPduTxed {false}; //!< Flag to indicate the TX of SL MAC PDU to PHY
-  std::list<SensingData> m_sensingData; //!< List to store sensing data
+  /**
+   * \brief A future transmission of a sensed SCI 1-A, as computed by
+   *        GetFutSlotsBasedOnSens, stored in the slot in which it occurs
+   */
+  struct SlSensedReservation
+  {
+    uint64_t slot {0}; //!< The absolute slot number of the transmission
+    uint64_t sciSlot {0}; //!< The absolute slot number in which the SCI was received
+    uint64_t sciIndex {0}; //!< The reception order of the SCI
+    uint16_t resvIndex {0}; //!< The order of the transmission among the ones of the SCI
+    uint64_t sbChMask {0}; //!< The bitmap of the reserved subchannels
+    double slRsrp {0.0}; //!< The RSRP of the SCI
+  };
+  std::vector<std::vector<SlSensedReservation> > m_slSensedReservations; //!< Circular array of the sensed reservations, indexed by absolute slot number modulo its size
+  std::deque<uint64_t> m_slSensedSciSlots; //!< Slots of the SCIs in the sensing window, oldest first
+  uint64_t m_slSensedSciCount {0}; //!< Number of SCIs sensed so far
+  uint64_t m_slSensedReservationsPurged {0}; //!< First slot whose reservations have not been purged yet
   int m_thresRsrp {-128}; //!< A threshold in dBm used for sensing based UE autonomous resource selection
   uint8_t m_resPercentage {0}; /**< The percentage threshold to indicate the
                                     minimum number of candidate single-slot
@@ -116,6 +116,13 @@ NrUePhy::GetTypeId (void)
                    TimeValue (MicroSeconds (25)),
                    MakeTimeAccessor (&NrUePhy::m_lbtThresholdForCtrl),
                    MakeTimeChecker ())
+    .AddAttribute ("SkipIdleCtrlVarTtis",
+                   "If true, a sidelink-only UE (not attached to any cell) that has nothing "
+                   "to send in the CTRL symbols of a slot without allocations does not process "
+                   "the DL/UL CTRL var TTIs one by one, but jumps directly to the end of the last one",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NrUePhy::m_skipIdleCtrlVarTtis),
+                   MakeBooleanChecker ())
     .AddAttribute ("TbDecodeLatency",
                    "Transport block decode latency",
                    TimeValue (MicroSeconds (100)),
@@ -822,10 +829,56 @@ NrUePhy::StartSlot (const SfnSf &s)
 
     }
 
+  if (m_skipIdleCtrlVarTtis && !nrAllocExists && IsIdleCtrlOnlySlot (allocation))
+    {
+      std::shared_ptr<DciInfoElementTdma> lastCtrl = allocation.m_dci;
+      if (!m_currSlotAllocInfo.m_varTtiAllocInfo.empty ())
+        {
+          lastCtrl = m_currSlotAllocInfo.m_varTtiAllocInfo.back ().m_dci;
+          m_currSlotAllocInfo.m_varTtiAllocInfo.clear ();
+        }
+      NS_LOG_INFO ("UE " << m_rnti << " has nothing to do in the CTRL symbols of slot " <<
+                   m_currentSlot << ", skip to the end of symbol " <<
+                   +(lastCtrl->m_symStart + lastCtrl->m_numSym - 1));
+      Simulator::Schedule (GetSymbolPeriod () * (lastCtrl->m_symStart + lastCtrl->m_numSym),
+                           &NrUePhy::EndVarTti, this, lastCtrl);
+      return;
+    }
 
   Simulator::Schedule (nextVarTtiStart, &NrUePhy::StartVarTti, this, allocation.m_dci);
 }
 
+bool
+NrUePhy::IsIdleCtrlOnlySlot (const VarTtiAllocInfo &first) const
+{
+  if (GetCellId () != 0 || m_ulConfigured || !m_ctrlMsgs.empty () || m_tryToPerformLbt)
+    {
+      return false;
+    }
+
+  std::vector<std::shared_ptr<DciInfoElementTdma> > dcis = {first.m_dci};
+  for (const auto & alloc : m_currSlotAllocInfo.m_varTtiAllocInfo)
+    {
+      dcis.push_back (alloc.m_dci);
+    }
+
+  for (const auto & dci : dcis)
+    {
+      if (dci->m_type != DciInfoElementTdma::CTRL)
+        {
+          return false;
+        }
+      // An empty UL CTRL only cancels the channel access, and the LBT
+      // before it is not needed only if the channel is already granted
+      if (dci->m_format == DciInfoElementTdma::UL
+          && (m_channelStatus != GRANTED || DynamicCast<NrAlwaysOnAccessManager> (m_cam) == nullptr))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
 
 Time
 NrUePhy::DlCtrl(const std::shared_ptr<DciInfoElementTdma> &dci)
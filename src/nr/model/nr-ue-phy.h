@@ -778,6 +778,17 @@ private:
    */
   void PushCtrlAllocations (const SfnSf currentSfnSf);
 
+  /**
+   * \brief Check if the CTRL var TTIs of the current slot can be skipped
+   * \param first the first allocation of the slot, already removed from
+   * m_currSlotAllocInfo
+   * \return true if the UE is not attached to any cell, the slot contains only
+   * CTRL allocations and processing them would not change the UE state
+   *
+   * \see SkipIdleCtrlVarTtis attribute
+   */
+  bool IsIdleCtrlOnlySlot (const VarTtiAllocInfo &first) const;
+
   /**
    * \brief Inserts the received DCI for the current slot allocation
    * \param dci The DCI description of the current slot
@@ -839,6 +850,7 @@ private:
   Ptr<NrChAccessManager> m_cam; //!< Channel Access Manager
   Time m_lbtThresholdForCtrl; //!< Threshold for LBT before the UL CTRL
   bool m_tryToPerformLbt {false}; //!< Boolean value set in DlCtrl() method
+  bool m_skipIdleCtrlVarTtis {false}; //!< Skip the idle CTRL var TTIs of sidelink-only UEs
   EventId m_lbtEvent;
   uint8_t m_dlCtrlSyms {1}; //!< Number of CTRL symbols in DL
   uint8_t m_ulCtrlSyms {1}; //!< Number of CTRL symbols in UL
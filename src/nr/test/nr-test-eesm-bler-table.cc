@@ -0,0 +1,254 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#include <ns3/test.h>
+#include <ns3/boolean.h>
+#include <ns3/nr-eesm-error-model.h>
+#include <ns3/nr-eesm-bler-table.h>
+#include <ns3/nr-eesm-t1.h>
+#include <ns3/nr-eesm-t2.h>
+#include <ns3/nr-eesm-cc-t1.h>
+#include <ns3/nr-eesm-cc-t2.h>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * \file nr-test-eesm-bler-table.cc
+ * \ingroup test
+ *
+ * \brief This test checks that the flattened BLER-SINR tables (NrEesmBlerTable)
+ * return exactly the same BLER as the lookup over the nested simulated tables,
+ * for all the base graphs, MCSs and simulated code block sizes of MCS Table1
+ * and Table2, for code block sizes between the simulated ones and for SINR
+ * values on, between and outside of the simulated points. It also checks the
+ * BLER returned with interpolation, and the BLER computed by
+ * NrEesmErrorModel::MappingSinrBler.
+ */
+namespace ns3 {
+
+/**
+ * \brief NrEesmBlerTable testcase
+ */
+class NrEesmBlerTableTestCase : public TestCase
+{
+public:
+  NrEesmBlerTableTestCase (const std::string &name) : TestCase (name) { }
+
+  /**
+   * \brief Destroy the object instance
+   */
+  virtual ~NrEesmBlerTableTestCase () override {}
+
+private:
+  virtual void DoRun (void) override;
+
+  /**
+   * \brief BLER lookup over the nested tables, as done by NrEesmErrorModel
+   * before the introduction of NrEesmBlerTable
+   */
+  static double ReferenceBler (const NrEesmErrorModel::SimulatedBlerFromSINR &table,
+                               uint8_t bg, uint8_t mcs, uint32_t cbSizeBit, double sinrDb);
+
+  void TestTable (const NrEesmErrorModel::SimulatedBlerFromSINR &table, const std::string &name);
+  void TestInterpolation (const NrEesmErrorModel::SimulatedBlerFromSINR &table, const std::string &name);
+  void TestErrorModel (const Ptr<NrEesmErrorModel> &em, const NrEesmErrorModel::SimulatedBlerFromSINR &table,
+                       const std::string &name);
+};
+
+double
+NrEesmBlerTableTestCase::ReferenceBler (const NrEesmErrorModel::SimulatedBlerFromSINR &table,
+                                        uint8_t bg, uint8_t mcs, uint32_t cbSizeBit, double sinrDb)
+{
+  const auto &cbMap = table.at (bg).at (mcs);
+  auto cbIt = cbMap.upper_bound (cbSizeBit);
+  if (cbIt != cbMap.begin ())
+    {
+      cbIt--;
+    }
+
+  const NrEesmErrorModel::DoubleVector &sinr = std::get<0> (cbIt->second);
+  const NrEesmErrorModel::DoubleVector &bler = std::get<1> (cbIt->second);
+  if (sinrDb < sinr.front ())
+    {
+      return 1.0;
+    }
+  else if (sinrDb > sinr.back ())
+    {
+      return 0.0;
+    }
+
+  auto sinrIt = std::upper_bound (sinr.begin (), sinr.end (), sinrDb);
+  if (sinrIt != sinr.begin ())
+    {
+      sinrIt--;
+    }
+  return bler.at (std::distance (sinr.begin (), sinrIt));
+}
+
+void
+NrEesmBlerTableTestCase::TestTable (const NrEesmErrorModel::SimulatedBlerFromSINR &table, const std::string &name)
+{
+  NrEesmBlerTable flat (table);
+
+  for (uint8_t bg = 0; bg < table.size (); ++bg)
+    {
+      for (uint8_t mcs = 0; mcs < table.at (bg).size (); ++mcs)
+        {
+          // simulated CB sizes, sizes in between, and sizes below/above all of them
+          std::vector<uint32_t> cbSizes = {0, 100000};
+          for (const auto &cb : table.at (bg).at (mcs))
+            {
+              cbSizes.push_back (cb.first);
+              cbSizes.push_back (cb.first + 1);
+              if (cb.first > 0)
+                {
+                  cbSizes.push_back (cb.first - 1);
+                }
+            }
+
+          for (const auto &cb : table.at (bg).at (mcs))
+            {
+              // simulated SINRs, midpoints and values outside of the curve
+              const NrEesmErrorModel::DoubleVector &sinr = std::get<0> (cb.second);
+              std::vector<double> sinrDbs = {sinr.front () - 1.0, sinr.back () + 1.0, -INFINITY};
+              for (uint32_t i = 0; i < sinr.size (); ++i)
+                {
+                  sinrDbs.push_back (sinr.at (i));
+                  if (i + 1 < sinr.size ())
+                    {
+                      sinrDbs.push_back ((sinr.at (i) + sinr.at (i + 1)) / 2);
+                    }
+                }
+
+              for (uint32_t cbSize : cbSizes)
+                {
+                  for (double sinrDb : sinrDbs)
+                    {
+                      NS_TEST_ASSERT_MSG_EQ (flat.GetBler (bg, mcs, cbSize, sinrDb, false),
+                                             ReferenceBler (table, bg, mcs, cbSize, sinrDb),
+                                             name << ": the flattened table differs from the nested one. BG"
+                                                  << bg + 1 << " MCS " << +mcs << " CBS " << cbSize
+                                                  << " SINR " << sinrDb << " dB");
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+NrEesmBlerTableTestCase::TestInterpolation (const NrEesmErrorModel::SimulatedBlerFromSINR &table,
+                                            const std::string &name)
+{
+  NrEesmBlerTable flat (table);
+
+  for (uint8_t bg = 0; bg < table.size (); ++bg)
+    {
+      for (uint8_t mcs = 0; mcs < table.at (bg).size (); ++mcs)
+        {
+          for (const auto &cb : table.at (bg).at (mcs))
+            {
+              const NrEesmErrorModel::DoubleVector &sinr = std::get<0> (cb.second);
+              const NrEesmErrorModel::DoubleVector &bler = std::get<1> (cb.second);
+
+              NS_TEST_ASSERT_MSG_EQ (flat.GetBler (bg, mcs, cb.first, sinr.front () - 1.0, true), 1.0,
+                                     name << ": the BLER below the curve must be 1");
+              NS_TEST_ASSERT_MSG_EQ (flat.GetBler (bg, mcs, cb.first, sinr.back () + 1.0, true), 0.0,
+                                     name << ": the BLER above the curve must be 0");
+
+              for (uint32_t i = 0; i < sinr.size (); ++i)
+                {
+                  NS_TEST_ASSERT_MSG_EQ_TOL (flat.GetBler (bg, mcs, cb.first, sinr.at (i), true), bler.at (i), 1e-12,
+                                             name << ": the interpolated BLER differs from the simulated one on a "
+                                                  << "simulated point. BG" << bg + 1 << " MCS " << +mcs
+                                                  << " CBS " << cb.first);
+                  if (i + 1 < sinr.size () && sinr.at (i + 1) > sinr.at (i))
+                    {
+                      NS_TEST_ASSERT_MSG_EQ_TOL (flat.GetBler (bg, mcs, cb.first, (sinr.at (i) + sinr.at (i + 1)) / 2, true),
+                                                 (bler.at (i) + bler.at (i + 1)) / 2, 1e-12,
+                                                 name << ": wrong interpolated BLER between two simulated points. BG"
+                                                      << bg + 1 << " MCS " << +mcs << " CBS " << cb.first);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void
+NrEesmBlerTableTestCase::TestErrorModel (const Ptr<NrEesmErrorModel> &em,
+                                         const NrEesmErrorModel::SimulatedBlerFromSINR &table,
+                                         const std::string &name)
+{
+  const std::vector<uint32_t> cbSizes = {200, 1000, 3824, 3900, 6300, 8448};
+
+  for (uint8_t mcs = 0; mcs <= em->GetMaxMcs (); ++mcs)
+    {
+      for (uint32_t cbSize : cbSizes)
+        {
+          NrEesmErrorModel::GraphType bg = em->GetBaseGraphType (cbSize, mcs);
+          for (double sinrDb = -10.0; sinrDb <= 30.0; sinrDb += 0.05)
+            {
+              double sinr = std::pow (10.0, sinrDb / 10);
+              NS_TEST_ASSERT_MSG_EQ (em->MappingSinrBler (sinr, mcs, cbSize),
+                                     ReferenceBler (table, bg, mcs, cbSize, 10 * log10 (sinr)),
+                                     name << ": MappingSinrBler differs from the lookup over the nested table."
+                                          << " MCS " << +mcs << " CBS " << cbSize << " SINR " << sinrDb << " dB");
+            }
+        }
+    }
+}
+
+void
+NrEesmBlerTableTestCase::DoRun ()
+{
+  NrEesmT1 t1;
+  NrEesmT2 t2;
+
+  TestTable (*t1.m_simulatedBlerFromSINR, "Table1");
+  TestTable (*t2.m_simulatedBlerFromSINR, "Table2");
+  TestInterpolation (*t1.m_simulatedBlerFromSINR, "Table1");
+  TestInterpolation (*t2.m_simulatedBlerFromSINR, "Table2");
+
+  Ptr<NrEesmErrorModel> em1 = CreateObject<NrEesmCcT1> ();
+  Ptr<NrEesmErrorModel> em2 = CreateObject<NrEesmCcT2> ();
+  TestErrorModel (em1, *t1.m_simulatedBlerFromSINR, "NrEesmCcT1");
+  TestErrorModel (em2, *t2.m_simulatedBlerFromSINR, "NrEesmCcT2");
+
+  // The flattened table is shared by all the instances using the same simulated table: a second instance
+  // must get the table already built for em1 (set at its first BLER lookup), and not build its own copy
+  Ptr<NrEesmErrorModel> em1b = CreateObject<NrEesmCcT1> ();
+  em1b->MappingSinrBler (1.0, 10, 3840);
+  NS_TEST_ASSERT_MSG_NE (em1->m_blerTable, static_cast<const NrEesmBlerTable *> (nullptr),
+                         "The flattened table of the first instance was not set");
+  NS_TEST_ASSERT_MSG_EQ (em1b->m_blerTable, em1->m_blerTable,
+                         "The flattened table must be built only once for all the NrEesmCcT1 instances");
+  NS_TEST_ASSERT_MSG_NE (em2->m_blerTable, em1->m_blerTable,
+                         "NrEesmCcT2 instances must not use the flattened table of Table1");
+}
+
+class NrTestEesmBlerTable : public TestSuite
+{
+public:
+  NrTestEesmBlerTable () : TestSuite ("nr-test-eesm-bler-table", UNIT)
+  {
+    AddTestCase (new NrEesmBlerTableTestCase ("Flattened BLER tables"), QUICK);
+  }
+};
+
+static NrTestEesmBlerTable NrTestEesmBlerTableTestSuite; //!< Nr test suite
+
+}  // namespace ns3
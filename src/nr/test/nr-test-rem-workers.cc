@@ -0,0 +1,225 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/nr-module.h"
+#include "ns3/antenna-module.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * \file nr-test-rem-workers.cc
+ * \ingroup test
+ *
+ * \brief This test creates the same coverage area REM, with random channel
+ * conditions and shadowing, with different values of the NumWorkers and
+ * TileSize attributes of the NrRadioEnvironmentMapHelper, and checks that
+ * the output maps are identical. With more than one worker the REM points
+ * are calculated by processes forked from the test, which write them in
+ * shared memory.
+ */
+namespace ns3 {
+
+/**
+ * \brief Testcase comparing the REMs calculated with different numbers of
+ * workers and tile sizes
+ */
+class NrRemWorkersTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   */
+  NrRemWorkersTestCase ();
+
+  /**
+   * \brief Destroy the object instance
+   */
+  virtual ~NrRemWorkersTestCase () override {}
+
+private:
+  virtual void DoRun (void) override;
+  virtual void DoTeardown (void) override;
+
+  /**
+   * \brief Create the REM of the scenario and read it back
+   * \param simTag the SimTag of the REM output files
+   * \param numWorkers the value of the NumWorkers attribute
+   * \param tileSize the value of the TileSize attribute
+   * \param rngStreamBase the value of the RngStreamBase attribute
+   * \return the lines of the REM output file
+   */
+  std::vector<std::string> RunRem (const std::string &simTag, uint32_t numWorkers,
+                                   uint32_t tileSize, int64_t rngStreamBase);
+
+  std::vector<std::string> m_simTags; //!< The SimTag of each created REM
+};
+
+NrRemWorkersTestCase::NrRemWorkersTestCase ()
+  : TestCase ("REM calculated with different NumWorkers and TileSize")
+{
+}
+
+std::vector<std::string>
+NrRemWorkersTestCase::RunRem (const std::string &simTag, uint32_t numWorkers,
+                              uint32_t tileSize, int64_t rngStreamBase)
+{
+  m_simTags.push_back (simTag);
+
+  NodeContainer gnbNodes;
+  NodeContainer ueNodes;
+  gnbNodes.Create (2);
+  ueNodes.Create (1);
+
+  Ptr<ListPositionAllocator> positionAlloc = CreateObject<ListPositionAllocator> ();
+  positionAlloc->Add (Vector (-30.0, 0.0, 10.0));
+  positionAlloc->Add (Vector (30.0, 0.0, 10.0));
+  positionAlloc->Add (Vector (0.0, 20.0, 1.5));
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.SetPositionAllocator (positionAlloc);
+  mobility.Install (gnbNodes);
+  mobility.Install (ueNodes);
+
+  Ptr<NrHelper> nrHelper = CreateObject<NrHelper> ();
+  Ptr<IdealBeamformingHelper> idealBeamformingHelper = CreateObject<IdealBeamformingHelper> ();
+  nrHelper->SetBeamformingHelper (idealBeamformingHelper);
+
+  // the channel condition and the shadowing of the REM points are random
+  Config::SetDefault ("ns3::ThreeGppChannelModel::UpdatePeriod", TimeValue (MilliSeconds (0)));
+  nrHelper->SetChannelConditionModelAttribute ("UpdatePeriod", TimeValue (MilliSeconds (0)));
+  nrHelper->SetPathlossAttribute ("ShadowingEnabled", BooleanValue (true));
+
+  CcBwpCreator::SimpleOperationBandConf bandConf (2.8e9, 10e6, 1, BandwidthPartInfo::UMa);
+  CcBwpCreator ccBwpCreator;
+  OperationBandInfo band = ccBwpCreator.CreateOperationBandContiguousCc (bandConf);
+  nrHelper->InitializeOperationBand (&band);
+  BandwidthPartInfoPtrVector allBwps = CcBwpCreator::GetAllBwps ({band});
+
+  nrHelper->SetGnbAntennaAttribute ("NumRows", UintegerValue (2));
+  nrHelper->SetGnbAntennaAttribute ("NumColumns", UintegerValue (2));
+  nrHelper->SetGnbAntennaAttribute ("AntennaElement", PointerValue (CreateObject<IsotropicAntennaModel> ()));
+  nrHelper->SetUeAntennaAttribute ("NumRows", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("NumColumns", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("AntennaElement", PointerValue (CreateObject<IsotropicAntennaModel> ()));
+
+  NetDeviceContainer gnbNetDev = nrHelper->InstallGnbDevice (gnbNodes, allBwps);
+  NetDeviceContainer ueNetDev = nrHelper->InstallUeDevice (ueNodes, allBwps);
+  int64_t randomStream = 1;
+  randomStream += nrHelper->AssignStreams (gnbNetDev, randomStream);
+  randomStream += nrHelper->AssignStreams (ueNetDev, randomStream);
+
+  Ptr<NrRadioEnvironmentMapHelper> remHelper = CreateObject<NrRadioEnvironmentMapHelper> ();
+  remHelper->SetMinX (-50.0);
+  remHelper->SetMaxX (50.0);
+  remHelper->SetResX (8);
+  remHelper->SetMinY (-40.0);
+  remHelper->SetMaxY (40.0);
+  remHelper->SetResY (6);
+  remHelper->SetZ (1.5);
+  remHelper->SetSimTag (simTag);
+  remHelper->SetAttribute ("IterForAverage", UintegerValue (2));
+  remHelper->SetAttribute ("NumWorkers", UintegerValue (numWorkers));
+  remHelper->SetAttribute ("TileSize", UintegerValue (tileSize));
+  remHelper->SetAttribute ("RngStreamBase", IntegerValue (rngStreamBase));
+  remHelper->SetRemMode (NrRadioEnvironmentMapHelper::COVERAGE_AREA);
+  remHelper->CreateRem (gnbNetDev, ueNetDev.Get (0), 0);
+
+  Simulator::Stop (Seconds (1));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  std::vector<std::string> rem;
+  std::ifstream remFile ("nr-rem-" + simTag + ".out");
+  std::string line;
+  while (std::getline (remFile, line))
+    {
+      rem.push_back (line);
+    }
+  return rem;
+}
+
+void
+NrRemWorkersTestCase::DoRun (void)
+{
+  // without the RngStreamBase attribute, a single worker uses the automatic
+  // streams, so the serial reference sets the default base explicitly
+  int64_t rngStreamBase = int64_t (1) << 40;
+  std::vector<std::string> reference = RunRem ("workers-test-1-64", 1, 64, rngStreamBase);
+
+  NS_TEST_ASSERT_MSG_EQ (reference.size (), static_cast<size_t> (9 * 7), "Unexpected number of REM points");
+
+  struct RemConf
+  {
+    std::string simTag;
+    uint32_t numWorkers;
+    uint32_t tileSize;
+    int64_t rngStreamBase;
+  };
+  std::vector<RemConf> confs = {{"workers-test-1-7", 1, 7, rngStreamBase},
+                                {"workers-test-2-64", 2, 64, -1},
+                                {"workers-test-2-5", 2, 5, -1},
+                                {"workers-test-3-1", 3, 1, rngStreamBase}};
+  for (const auto &conf : confs)
+    {
+      std::vector<std::string> rem = RunRem (conf.simTag, conf.numWorkers, conf.tileSize, conf.rngStreamBase);
+      NS_TEST_ASSERT_MSG_EQ (rem.size (), reference.size (),
+                             "Different number of REM points with " << conf.numWorkers <<
+                             " workers and tiles of " << conf.tileSize << " points");
+      for (uint32_t i = 0; i < std::min (rem.size (), reference.size ()); ++i)
+        {
+          NS_TEST_ASSERT_MSG_EQ (rem.at (i), reference.at (i),
+                                 "REM point " << i << " differs with " << conf.numWorkers <<
+                                 " workers and tiles of " << conf.tileSize << " points");
+        }
+    }
+
+  // the serial calculation with the automatic streams still works
+  std::vector<std::string> serial = RunRem ("workers-test-serial", 1, 64, -1);
+  NS_TEST_ASSERT_MSG_EQ (serial.size (), reference.size (), "Unexpected number of REM points");
+
+  Config::Reset ();
+}
+
+void
+NrRemWorkersTestCase::DoTeardown (void)
+{
+  for (const auto &simTag : m_simTags)
+    {
+      for (const auto &suffix : {".out", "-ues.txt", "-gnbs.txt", "-buildings.txt", "-plot-rem.gnuplot"})
+        {
+          std::remove (("nr-rem-" + simTag + suffix).c_str ());
+        }
+    }
+}
+
+class NrTestRemWorkers : public TestSuite
+{
+public:
+  NrTestRemWorkers () : TestSuite ("nr-test-rem-workers", SYSTEM)
+  {
+    AddTestCase (new NrRemWorkersTestCase (), QUICK);
+  }
+};
+
+static NrTestRemWorkers NrTestRemWorkersTestSuite; //!< Nr test suite
+
+}  // namespace ns3
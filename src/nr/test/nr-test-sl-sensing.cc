@@ -0,0 +1,694 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#include "ns3/core-module.h"
+#include "ns3/nr-module.h"
+#include <cmath>
+#include <list>
+#include <vector>
+
+/**
+ * \file nr-test-sl-sensing.cc
+ * \ingroup test
+ *
+ * \brief This test checks the sensing based candidate exclusion of the NR
+ * sidelink mode 2 UE MAC, in which the future transmissions of the sensed
+ * SCIs are stored by slot when the SCIs are received, against the list based
+ * implementation that projected all the sensed SCIs at every resource
+ * selection. The list based reference is kept in this file, with the two
+ * fixes of its sensing window (the element skipped after an erase and the
+ * underflow of "n - T0" during the first sensing window), and the same
+ * candidates and occupied subchannels are expected from both, over random
+ * sequences of SCIs. Two more test cases reproduce the two fixed issues.
+ *
+ * Numerology 0 is used and all the slots are sidelink slots, so that the
+ * reservation periods in ms are also the periods in logical slots.
+ */
+namespace ns3 {
+
+/**
+ * \brief Parameters of the sensing based resource selection
+ */
+struct NrSlSensingTestParams
+{
+  uint8_t t1 {2}; //!< T1 in slots
+  uint16_t t2 {33}; //!< T2 in slots
+  uint16_t sensWindLen {100}; //!< The sensing window length (T0) in slots
+  uint8_t tproc0 {1}; //!< Tproc0 in slots
+  uint16_t pPrimeRsvpTx {100}; //!< The reservation period of the UE in slots
+  uint16_t cResel {1}; //!< The C_resel counter
+  uint8_t totalSubCh {4}; //!< The number of subchannels of the pool
+  uint8_t resPercentage {20}; //!< The minimum percentage of candidates to keep
+  int thresRsrp {-110}; //!< The initial RSRP threshold in dBm
+};
+
+/**
+ * \brief Compute the future transmissions of a sensed SCI, as
+ * NrUeMac::GetFutSlotsBasedOnSens does with 1 ms slots
+ * \param sensedData the sensed SCI
+ * \param params the parameters of the resource selection
+ * \return the future transmissions of the SCI
+ */
+static std::list<SlotSensingData>
+GetFutureSensedTx (const SensingData &sensedData, const NrSlSensingTestParams &params)
+{
+  std::list<SlotSensingData> listFutureSensTx;
+  double tScalMilSec = (params.t2 - params.t1) + 1;
+  double pRsvpRxMilSec = static_cast<double> (sensedData.rsvp);
+  uint16_t q = 1;
+  if (pRsvpRxMilSec < tScalMilSec)
+    {
+      q = static_cast <uint16_t> (std::ceil (tScalMilSec / pRsvpRxMilSec));
+    }
+
+  for (uint16_t i = 0; i <= q; i++)
+    {
+      SlotSensingData sensedSlotData (sensedData.sfn, sensedData.rsvp,
+                                      sensedData.sbChLength, sensedData.sbChStart,
+                                      sensedData.prio, sensedData.slRsrp);
+      sensedSlotData.sfn.Add (i * sensedData.rsvp);
+      listFutureSensTx.emplace_back (sensedSlotData);
+
+      if (sensedData.gapReTx1 != std::numeric_limits <uint8_t>::max ())
+        {
+          auto reTx1Slot = sensedSlotData;
+          reTx1Slot.sfn = sensedSlotData.sfn.GetFutureSfnSf (sensedData.gapReTx1);
+          reTx1Slot.sbChStart = sensedData.sbChStartReTx1;
+          listFutureSensTx.emplace_back (reTx1Slot);
+        }
+      if (sensedData.gapReTx2 != std::numeric_limits <uint8_t>::max ())
+        {
+          auto reTx2Slot = sensedSlotData;
+          reTx2Slot.sfn = sensedSlotData.sfn.GetFutureSfnSf (sensedData.gapReTx2);
+          reTx2Slot.sbChStart = sensedData.sbChStartReTx2;
+          listFutureSensTx.emplace_back (reTx2Slot);
+        }
+    }
+
+  return listFutureSensTx;
+}
+
+/**
+ * \brief The SfnSf of an absolute slot number, with numerology 0
+ * \param slot the absolute slot number
+ * \return the SfnSf
+ */
+static SfnSf
+GetSfnSf (uint64_t slot)
+{
+  SfnSf sfn (0, 0, 0, 0);
+  sfn.Add (slot);
+  return sfn;
+}
+
+/**
+ * \brief The candidate single-slot resources of the selection window [n + T1, n + T2]
+ * \param slot the absolute slot number of the current slot (n)
+ * \param params the parameters of the resource selection
+ * \return the candidate single-slot resources, without occupied subchannels
+ */
+static std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo>
+GetCandidates (uint64_t slot, const NrSlSensingTestParams &params)
+{
+  std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> candidates;
+  for (uint16_t i = params.t1; i <= params.t2; i++)
+    {
+      candidates.emplace_back (1, 0, 1, 1, 12, 10, 3, GetSfnSf (slot + i), std::set <uint8_t> ());
+    }
+  return candidates;
+}
+
+/**
+ * \brief List based sensing window and candidate exclusion, as implemented
+ * by NrUeMac before the sensed transmissions were stored by slot
+ */
+class NrSlListBasedSensing
+{
+public:
+  /**
+   * \brief Create the reference
+   * \param params the parameters of the resource selection
+   * \param oldWindow true to keep the two issues of the former
+   *        UpdateSensingWindow, false to use the fixed sensing window
+   */
+  NrSlListBasedSensing (const NrSlSensingTestParams &params, bool oldWindow)
+    : m_params (params),
+      m_oldWindow (oldWindow)
+  {
+  }
+
+  /**
+   * \brief Store a sensed SCI
+   * \param sensingData the sensed SCI
+   */
+  void ReceiveSensingData (const SensingData &sensingData)
+  {
+    m_sensingData.push_back (sensingData);
+  }
+
+  /**
+   * \brief Remove the sensing data outside the sensing window
+   * \param slot the absolute slot number of the current slot (n)
+   */
+  void UpdateSensingWindow (uint64_t slot)
+  {
+    auto it = m_sensingData.begin ();
+    while (it != m_sensingData.end ())
+      {
+        bool outdated = m_oldWindow ? it->sfn.Normalize () < slot - m_params.sensWindLen
+                                    : it->sfn.Normalize () + m_params.sensWindLen < slot;
+        if (!outdated)
+          {
+            break;
+          }
+        it = m_sensingData.erase (it);
+        if (m_oldWindow && it != m_sensingData.end ())
+          {
+            //the former loop incremented the iterator also after an erase
+            ++it;
+          }
+      }
+  }
+
+  /**
+   * \brief Exclude the candidates reserved by the sensed SCIs
+   * \param slot the absolute slot number of the current slot (n)
+   * \param passes the number of exclusions performed, one per RSRP threshold
+   * \return the remaining candidates, with their occupied subchannels
+   */
+  std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo>
+  GetCandidates (uint64_t slot, uint32_t &passes) const
+  {
+    //keep the sensing data in [n – T0 , n – Tproc0)
+    auto sensedData = m_sensingData;
+    while (!sensedData.empty () && slot - sensedData.back ().sfn.Normalize () <= m_params.tproc0)
+      {
+        sensedData.pop_back ();
+      }
+
+    std::vector<std::list<SlotSensingData>> allSensingData;
+    for (const auto &itSensedSlot:sensedData)
+      {
+        allSensingData.push_back (GetFutureSensedTx (itSensedSlot, m_params));
+      }
+
+    auto allCandidates = ns3::GetCandidates (slot, m_params);
+    uint32_t mTotal = allCandidates.size ();
+    int rsrpThrehold = m_params.thresRsrp;
+    std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> nrCandSsResoA;
+    passes = 0;
+    do
+      {
+        passes++;
+        nrCandSsResoA = allCandidates;
+        auto itCandSsResoA = nrCandSsResoA.begin ();
+        while (itCandSsResoA != nrCandSsResoA.end ())
+          {
+            bool erased = false;
+            std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> listFutureCands;
+            for (uint16_t i = 0; i < m_params.cResel; i++)
+              {
+                auto slAlloc = *itCandSsResoA;
+                slAlloc.sfn.Add (i * m_params.pPrimeRsvpTx);
+                listFutureCands.emplace_back (slAlloc);
+              }
+            for (const auto &itSensedData:allSensingData)
+              {
+                for (auto &itFutureCand:listFutureCands)
+                  {
+                    for (const auto &itFutureSensTx:itSensedData)
+                      {
+                        if (itFutureCand.sfn.Normalize () == itFutureSensTx.sfn.Normalize ())
+                          {
+                            uint16_t lastSbChInPlusOne = itFutureSensTx.sbChStart + itFutureSensTx.sbChLength;
+                            for (uint8_t i = itFutureSensTx.sbChStart; i < lastSbChInPlusOne; i++)
+                              {
+                                itCandSsResoA->occupiedSbCh.insert (i);
+                              }
+                            if (itCandSsResoA->occupiedSbCh.size () == m_params.totalSubCh
+                                && itFutureSensTx.slRsrp > rsrpThrehold)
+                              {
+                                itCandSsResoA = nrCandSsResoA.erase (itCandSsResoA);
+                                erased = true;
+                                break;
+                              }
+                          }
+                      }
+                    if (erased)
+                      {
+                        break;
+                      }
+                  }
+                if (erased)
+                  {
+                    break;
+                  }
+              }
+            if (!erased)
+              {
+                itCandSsResoA++;
+              }
+          }
+        rsrpThrehold += 3;
+        if (rsrpThrehold > 0)
+          {
+            nrCandSsResoA.clear ();
+            break;
+          }
+      }
+    while (nrCandSsResoA.size () < (m_params.resPercentage / 100.0) * mTotal);
+
+    return nrCandSsResoA;
+  }
+
+private:
+  NrSlSensingTestParams m_params; //!< The parameters of the resource selection
+  bool m_oldWindow; //!< Whether the former sensing window is used
+  std::list<SensingData> m_sensingData; //!< The sensed SCIs, oldest first
+};
+
+/**
+ * \brief Base class of the sensing test cases, with access to the sensing
+ * methods of NrUeMac
+ */
+class NrUeMacSensingTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   * \param name the name of the test case
+   * \param params the parameters of the resource selection
+   */
+  NrUeMacSensingTestCase (std::string name, const NrSlSensingTestParams &params)
+    : TestCase (name),
+      m_params (params)
+  {
+  }
+
+protected:
+  /**
+   * \brief Create a UE MAC configured with the parameters of the test case
+   * \return the UE MAC
+   */
+  Ptr<NrUeMac> CreateMac () const
+  {
+    Ptr<NrUeMac> mac = CreateObject<NrUeMac> ();
+    mac->m_enableSensing = true;
+    mac->m_t1 = m_params.t1;
+    mac->m_t2 = m_params.t2;
+    mac->m_tproc0 = m_params.tproc0;
+    mac->m_cResel = m_params.cResel;
+    mac->m_resPercentage = m_params.resPercentage;
+    mac->m_thresRsrp = m_params.thresRsrp;
+    //same size as computed by NrUeMac::DoReceiveSensingData
+    uint64_t ringSize = 1;
+    while (ringSize < static_cast<uint64_t> (m_params.sensWindLen) + 2 * 1000 + m_params.t2 + 64)
+      {
+        ringSize <<= 1;
+      }
+    mac->m_slSensedReservations.resize (ringSize);
+    return mac;
+  }
+
+  /**
+   * \brief Pass a sensed SCI to the UE MAC
+   * \param mac the UE MAC
+   * \param sensingData the sensed SCI
+   */
+  void ReceiveSensingData (Ptr<NrUeMac> mac, const SensingData &sensingData) const
+  {
+    mac->StoreSensedReservations (sensingData.sfn.Normalize (), sensingData.slRsrp,
+                                  GetFutureSensedTx (sensingData, m_params));
+  }
+
+  /**
+   * \brief Update the sensing window of the UE MAC
+   * \param mac the UE MAC
+   * \param slot the absolute slot number of the current slot
+   */
+  void UpdateSensingWindow (Ptr<NrUeMac> mac, uint64_t slot) const
+  {
+    mac->PurgeSensedReservations (slot, m_params.sensWindLen);
+  }
+
+  /**
+   * \brief Get the candidates remaining after the sensing based exclusion
+   * \param mac the UE MAC
+   * \param slot the absolute slot number of the current slot (n)
+   * \return the remaining candidates, with their occupied subchannels
+   */
+  std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo>
+  GetCandidates (Ptr<NrUeMac> mac, uint64_t slot) const
+  {
+    auto candidates = ns3::GetCandidates (slot, m_params);
+    mac->ExcludeSensedCandidates (candidates, slot, m_params.sensWindLen,
+                                  m_params.pPrimeRsvpTx, m_params.totalSubCh);
+    return candidates;
+  }
+
+  /**
+   * \brief Check if two lists of candidates have the same slots and occupied subchannels
+   * \param a the first list
+   * \param b the second list
+   * \return true if the lists are equal
+   */
+  static bool SameCandidates (const std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> &a,
+                              const std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> &b)
+  {
+    if (a.size () != b.size ())
+      {
+        return false;
+      }
+    for (auto itA = a.cbegin (), itB = b.cbegin (); itA != a.cend (); ++itA, ++itB)
+      {
+        if (itA->sfn.Normalize () != itB->sfn.Normalize () || itA->occupiedSbCh != itB->occupiedSbCh)
+          {
+            return false;
+          }
+      }
+    return true;
+  }
+
+  /**
+   * \brief Find the candidate of a slot
+   * \param candidates the list of candidates
+   * \param slot the absolute slot number
+   * \return a pointer to the candidate, or nullptr if it was excluded
+   */
+  static const NrSlUeMacSchedSapProvider::NrSlSlotInfo*
+  FindCandidate (const std::list <NrSlUeMacSchedSapProvider::NrSlSlotInfo> &candidates, uint64_t slot)
+  {
+    for (const auto &it:candidates)
+      {
+        if (it.sfn.Normalize () == slot)
+          {
+            return &it;
+          }
+      }
+    return nullptr;
+  }
+
+  NrSlSensingTestParams m_params; //!< The parameters of the resource selection
+};
+
+/**
+ * \brief Random sequences of SCIs, checking the UE MAC against the list based
+ * reference at regular resource selections, from the first sensing window on
+ */
+class NrUeMacSensingEquivalenceTestCase : public NrUeMacSensingTestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   * \param params the parameters of the resource selection
+   * \param minRsrp the minimum RSRP of the sensed SCIs in dBm
+   * \param maxRsrp the maximum RSRP of the sensed SCIs in dBm
+   * \param maxSciPerSlot the maximum number of SCIs sensed in a slot
+   * \param expectStepUp true if the RSRP threshold is expected to be increased
+   *        at least once during the test
+   */
+  NrUeMacSensingEquivalenceTestCase (const NrSlSensingTestParams &params, double minRsrp,
+                                     double maxRsrp, uint32_t maxSciPerSlot, bool expectStepUp)
+    : NrUeMacSensingTestCase ("Sensing based exclusion vs list based reference, Cresel "
+                              + std::to_string (params.cResel) + ", threshold "
+                              + std::to_string (params.thresRsrp) + " dBm, "
+                              + std::to_string (params.resPercentage) + "%", params),
+      m_minRsrp (minRsrp),
+      m_maxRsrp (maxRsrp),
+      m_maxSciPerSlot (maxSciPerSlot),
+      m_expectStepUp (expectStepUp)
+  {
+  }
+
+private:
+  virtual void DoRun (void) override;
+
+  double m_minRsrp; //!< The minimum RSRP of the sensed SCIs in dBm
+  double m_maxRsrp; //!< The maximum RSRP of the sensed SCIs in dBm
+  uint32_t m_maxSciPerSlot; //!< The maximum number of SCIs sensed in a slot
+  bool m_expectStepUp; //!< Whether a step up of the RSRP threshold is expected
+};
+
+void
+NrUeMacSensingEquivalenceTestCase::DoRun (void)
+{
+  const uint16_t rsvpList[] = {20, 50, 100, 200};
+  const uint64_t numSlots = 1500;
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  rng->SetStream (m_params.cResel * 1000 + m_params.resPercentage);
+
+  Ptr<NrUeMac> mac = CreateMac ();
+  NrSlListBasedSensing reference (m_params, false);
+
+  uint32_t selections = 0;
+  uint32_t excluded = 0;
+  uint32_t maxPasses = 0;
+  for (uint64_t slot = 0; slot < numSlots; slot++)
+    {
+      UpdateSensingWindow (mac, slot);
+      reference.UpdateSensingWindow (slot);
+
+      uint32_t numSci = rng->GetInteger (0, m_maxSciPerSlot);
+      for (uint32_t i = 0; i < numSci; i++)
+        {
+          uint8_t sbChLength = rng->GetInteger (1, m_params.totalSubCh);
+          uint8_t sbChStart = rng->GetInteger (0, m_params.totalSubCh - sbChLength);
+          uint8_t gapReTx1 = std::numeric_limits <uint8_t>::max ();
+          uint8_t sbChStartReTx1 = std::numeric_limits <uint8_t>::max ();
+          uint8_t gapReTx2 = std::numeric_limits <uint8_t>::max ();
+          uint8_t sbChStartReTx2 = std::numeric_limits <uint8_t>::max ();
+          if (rng->GetValue () < 0.5)
+            {
+              gapReTx1 = rng->GetInteger (1, 15);
+              sbChStartReTx1 = rng->GetInteger (0, m_params.totalSubCh - sbChLength);
+              if (rng->GetValue () < 0.5)
+                {
+                  gapReTx2 = gapReTx1 + rng->GetInteger (1, 15);
+                  sbChStartReTx2 = rng->GetInteger (0, m_params.totalSubCh - sbChLength);
+                }
+            }
+          SensingData sensingData (GetSfnSf (slot), rsvpList[rng->GetInteger (0, 3)],
+                                   sbChLength, sbChStart, 1, rng->GetValue (m_minRsrp, m_maxRsrp),
+                                   gapReTx1, sbChStartReTx1, gapReTx2, sbChStartReTx2);
+          ReceiveSensingData (mac, sensingData);
+          reference.ReceiveSensingData (sensingData);
+        }
+
+      if (slot % 11 == 3)
+        {
+          uint32_t passes = 0;
+          auto expected = reference.GetCandidates (slot, passes);
+          auto candidates = GetCandidates (mac, slot);
+          NS_TEST_ASSERT_MSG_EQ (SameCandidates (candidates, expected), true,
+                                 "Different candidates or occupied subchannels at slot " << slot
+                                 << " (" << candidates.size () << " vs " << expected.size () << " candidates)");
+          selections++;
+          excluded += (m_params.t2 - m_params.t1 + 1) - expected.size ();
+          maxPasses = std::max (maxPasses, passes);
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_GT (selections, 0, "No resource selection performed");
+  NS_TEST_ASSERT_MSG_GT (excluded, 0, "The sensed SCIs never excluded a candidate");
+  if (m_expectStepUp)
+    {
+      NS_TEST_ASSERT_MSG_GT (maxPasses, 1, "The RSRP threshold was never increased");
+    }
+}
+
+/**
+ * \brief Regression test of the former UpdateSensingWindow, which skipped the
+ * element following an erased one: of two SCIs received in the same slot, the
+ * second one was kept one slot longer than the sensing window
+ */
+class NrUeMacSensingEraseTestCase : public NrUeMacSensingTestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   * \param params the parameters of the resource selection
+   */
+  NrUeMacSensingEraseTestCase (const NrSlSensingTestParams &params)
+    : NrUeMacSensingTestCase ("Two SCIs leaving the sensing window in the same slot are both discarded", params)
+  {
+  }
+
+private:
+  virtual void DoRun (void) override;
+};
+
+void
+NrUeMacSensingEraseTestCase::DoRun (void)
+{
+  //received after the first sensing window, to be discarded by the former
+  //sensing window only because they are outdated
+  const uint64_t sciSlot = m_params.sensWindLen + 10;
+  const uint16_t rsvp = 20;
+  //first slot in which the SCIs are outside of the sensing window
+  const uint64_t selectionSlot = sciSlot + m_params.sensWindLen + 1;
+  //reserved by the SCIs and inside the selection window
+  const uint64_t reservedSlot = sciSlot + 2 * rsvp;
+
+  Ptr<NrUeMac> mac = CreateMac ();
+  NrSlListBasedSensing reference (m_params, false);
+  NrSlListBasedSensing oldReference (m_params, true);
+
+  SensingData sensingData (GetSfnSf (sciSlot), rsvp, m_params.totalSubCh, 0, 1, -50.0,
+                           std::numeric_limits <uint8_t>::max (), std::numeric_limits <uint8_t>::max (),
+                           std::numeric_limits <uint8_t>::max (), std::numeric_limits <uint8_t>::max ());
+  for (uint64_t slot = 0; slot <= selectionSlot; slot++)
+    {
+      UpdateSensingWindow (mac, slot);
+      reference.UpdateSensingWindow (slot);
+      oldReference.UpdateSensingWindow (slot);
+      if (slot == sciSlot)
+        {
+          for (uint32_t i = 0; i < 2; i++)
+            {
+              ReceiveSensingData (mac, sensingData);
+              reference.ReceiveSensingData (sensingData);
+              oldReference.ReceiveSensingData (sensingData);
+            }
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((reservedSlot >= selectionSlot + m_params.t1 && reservedSlot <= selectionSlot + m_params.t2),
+                         true, "The reserved slot is not in the selection window");
+
+  uint32_t passes = 0;
+  auto candidates = GetCandidates (mac, selectionSlot);
+  auto expected = reference.GetCandidates (selectionSlot, passes);
+  auto old = oldReference.GetCandidates (selectionSlot, passes);
+
+  NS_TEST_ASSERT_MSG_EQ ((FindCandidate (old, reservedSlot) == nullptr), true,
+                         "The former sensing window did not keep the second SCI");
+  NS_TEST_ASSERT_MSG_EQ (SameCandidates (candidates, expected), true,
+                         "Different candidates or occupied subchannels");
+  const NrSlUeMacSchedSapProvider::NrSlSlotInfo *reserved = FindCandidate (candidates, reservedSlot);
+  NS_TEST_ASSERT_MSG_EQ ((reserved != nullptr), true, "A slot reserved by SCIs outside the sensing window was excluded");
+  NS_TEST_ASSERT_MSG_EQ (reserved->occupiedSbCh.size (), 0,
+                         "Subchannels reserved by SCIs outside the sensing window are occupied");
+}
+
+/**
+ * \brief Regression test of the former UpdateSensingWindow, in which
+ * "n - T0" underflowed during the first sensing window of the simulation,
+ * discarding all the sensed SCIs
+ */
+class NrUeMacSensingFirstWindowTestCase : public NrUeMacSensingTestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   * \param params the parameters of the resource selection
+   */
+  NrUeMacSensingFirstWindowTestCase (const NrSlSensingTestParams &params)
+    : NrUeMacSensingTestCase ("The SCIs sensed during the first sensing window are used", params)
+  {
+  }
+
+private:
+  virtual void DoRun (void) override;
+};
+
+void
+NrUeMacSensingFirstWindowTestCase::DoRun (void)
+{
+  const uint64_t sciSlot = 5;
+  const uint16_t rsvp = 50;
+  const uint64_t selectionSlot = 30;
+  const uint64_t reservedSlot = sciSlot + rsvp;
+
+  Ptr<NrUeMac> mac = CreateMac ();
+  NrSlListBasedSensing reference (m_params, false);
+  NrSlListBasedSensing oldReference (m_params, true);
+
+  //only the first subchannel is reserved, so the slot is not excluded
+  SensingData sensingData (GetSfnSf (sciSlot), rsvp, 1, 0, 1, -50.0,
+                           std::numeric_limits <uint8_t>::max (), std::numeric_limits <uint8_t>::max (),
+                           std::numeric_limits <uint8_t>::max (), std::numeric_limits <uint8_t>::max ());
+  for (uint64_t slot = 0; slot <= selectionSlot; slot++)
+    {
+      UpdateSensingWindow (mac, slot);
+      reference.UpdateSensingWindow (slot);
+      oldReference.UpdateSensingWindow (slot);
+      if (slot == sciSlot)
+        {
+          ReceiveSensingData (mac, sensingData);
+          reference.ReceiveSensingData (sensingData);
+          oldReference.ReceiveSensingData (sensingData);
+        }
+    }
+
+  NS_TEST_ASSERT_MSG_EQ ((selectionSlot < m_params.sensWindLen), true, "The selection is not in the first sensing window");
+  NS_TEST_ASSERT_MSG_EQ ((reservedSlot >= selectionSlot + m_params.t1 && reservedSlot <= selectionSlot + m_params.t2),
+                         true, "The reserved slot is not in the selection window");
+
+  uint32_t passes = 0;
+  auto candidates = GetCandidates (mac, selectionSlot);
+  auto expected = reference.GetCandidates (selectionSlot, passes);
+  auto old = oldReference.GetCandidates (selectionSlot, passes);
+
+  const NrSlUeMacSchedSapProvider::NrSlSlotInfo *oldReserved = FindCandidate (old, reservedSlot);
+  NS_TEST_ASSERT_MSG_EQ ((oldReserved != nullptr), true, "The reserved slot was excluded by the former sensing window");
+  NS_TEST_ASSERT_MSG_EQ (oldReserved->occupiedSbCh.size (), 0,
+                         "The former sensing window did not discard the SCI");
+  NS_TEST_ASSERT_MSG_EQ (SameCandidates (candidates, expected), true,
+                         "Different candidates or occupied subchannels");
+  const NrSlUeMacSchedSapProvider::NrSlSlotInfo *reserved = FindCandidate (candidates, reservedSlot);
+  NS_TEST_ASSERT_MSG_EQ ((reserved != nullptr), true, "The reserved slot was excluded");
+  NS_TEST_ASSERT_MSG_EQ (reserved->occupiedSbCh.size (), 1, "The SCI sensed in the first sensing window was not used");
+  NS_TEST_ASSERT_MSG_EQ (reserved->occupiedSbCh.count (0), 1, "Wrong subchannel occupied by the SCI");
+}
+
+class NrTestSlSensing : public TestSuite
+{
+public:
+  NrTestSlSensing () : TestSuite ("nr-test-sl-sensing", UNIT)
+  {
+    NrSlSensingTestParams params;
+    AddTestCase (new NrUeMacSensingEquivalenceTestCase (params, -120.0, -80.0, 2, false), QUICK);
+
+    params.cResel = 10;
+    AddTestCase (new NrUeMacSensingEquivalenceTestCase (params, -120.0, -80.0, 2, false), QUICK);
+
+    //most of the candidates are fully occupied: the threshold is raised by 3 dB steps
+    params.cResel = 3;
+    params.totalSubCh = 2;
+    params.resPercentage = 70;
+    params.thresRsrp = -128;
+    AddTestCase (new NrUeMacSensingEquivalenceTestCase (params, -120.0, -100.0, 4, true), QUICK);
+
+    //the maximum threshold is reached, and all the candidates are excluded
+    params.resPercentage = 100;
+    params.thresRsrp = -9;
+    AddTestCase (new NrUeMacSensingEquivalenceTestCase (params, 5.0, 10.0, 2, true), QUICK);
+
+    NrSlSensingTestParams eraseParams;
+    eraseParams.sensWindLen = 20;
+    eraseParams.t2 = 99;
+    AddTestCase (new NrUeMacSensingEraseTestCase (eraseParams), QUICK);
+
+    NrSlSensingTestParams firstWindowParams;
+    firstWindowParams.t2 = 99;
+    AddTestCase (new NrUeMacSensingFirstWindowTestCase (firstWindowParams), QUICK);
+  }
+};
+
+static NrTestSlSensing NrTestSlSensingTestSuite; //!< Nr test suite
+
+}  // namespace ns3
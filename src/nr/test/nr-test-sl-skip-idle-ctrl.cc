@@ -0,0 +1,383 @@
+/* -*-  Mode: C++; c-file-style: "gnu"; indent-tabs-mode:nil; -*- */
+/*
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License version 2 as
+ *   published by the Free Software Foundation;
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program; if not, write to the Free Software
+ *   Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/applications-module.h"
+#include "ns3/nr-module.h"
+#include "ns3/lte-module.h"
+#include "ns3/antenna-module.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * \file nr-test-sl-skip-idle-ctrl.cc
+ * \ingroup test
+ *
+ * \brief This test runs an out-of-coverage NR sidelink groupcast scenario
+ * twice, with and without the NrUePhy::SkipIdleCtrlVarTtis attribute, and
+ * checks that the PSCCH/PSSCH scheduling traces of the UE MACs and the
+ * PSCCH/PSSCH reception traces of the UE PHYs are exactly the same, at the
+ * same times, in both runs.
+ */
+namespace ns3 {
+
+/**
+ * \brief Testcase comparing the sidelink traces with and without skipping
+ * the idle CTRL var TTIs
+ */
+class NrSlSkipIdleCtrlTestCase : public TestCase
+{
+public:
+  /**
+   * \brief Create the test case
+   * \param ueNum the number of UEs, the first one transmitting
+   * \param enableSensing the value of the NrUeMac EnableSensing attribute
+   */
+  NrSlSkipIdleCtrlTestCase (uint16_t ueNum, bool enableSensing);
+
+  /**
+   * \brief Destroy the object instance
+   */
+  virtual ~NrSlSkipIdleCtrlTestCase () override {}
+
+private:
+  virtual void DoRun (void) override;
+
+  /**
+   * \brief Run the scenario and record the sidelink traces
+   * \param skipIdleCtrlVarTtis the value of the SkipIdleCtrlVarTtis attribute
+   * \return the recorded trace events, in order of occurrence
+   */
+  std::vector<std::string> RunScenario (bool skipIdleCtrlVarTtis);
+
+  /**
+   * \brief Sink of the SlPscchScheduling trace of NrUeMac
+   * \param context the context
+   * \param params the PSCCH scheduling parameters
+   */
+  void SlPscchScheduling (std::string context, const SlPscchUeMacStatParameters params);
+  /**
+   * \brief Sink of the SlPsschScheduling trace of NrUeMac
+   * \param context the context
+   * \param params the PSSCH scheduling parameters
+   */
+  void SlPsschScheduling (std::string context, const SlPsschUeMacStatParameters params);
+  /**
+   * \brief Sink of the RxPscchTraceUe trace of NrSpectrumPhy
+   * \param context the context
+   * \param params the PSCCH reception parameters
+   */
+  void RxPscch (std::string context, const SlRxCtrlPacketTraceParams params);
+  /**
+   * \brief Sink of the RxPsschTraceUe trace of NrSpectrumPhy
+   * \param context the context
+   * \param params the PSSCH reception parameters
+   */
+  void RxPssch (std::string context, const SlRxDataPacketTraceParams params);
+
+  uint16_t m_ueNum {2}; //!< Number of UEs
+  bool m_enableSensing {false}; //!< Sensing-based resource selection
+  std::vector<std::string> m_events; //!< Recorded trace events
+};
+
+NrSlSkipIdleCtrlTestCase::NrSlSkipIdleCtrlTestCase (uint16_t ueNum, bool enableSensing)
+  : TestCase ("NR SL skip idle CTRL var TTIs, " + std::to_string (ueNum) + " UEs, sensing "
+              + (enableSensing ? "on" : "off")),
+    m_ueNum (ueNum),
+    m_enableSensing (enableSensing)
+{
+}
+
+void
+NrSlSkipIdleCtrlTestCase::SlPscchScheduling (std::string context, const SlPscchUeMacStatParameters params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " rnti " << params.rnti << " sfn " << params.frameNum << "/" << params.subframeNum << "/" << params.slotNum
+      << " sym " << params.symStart << "+" << params.symLength
+      << " rb " << params.rbStart << "+" << params.rbLength
+      << " mcs " << +params.mcs << " tb " << params.tbSize
+      << " subch " << params.slPsschSubChStart << "+" << params.slPsschSubChLength
+      << " gaps " << +params.gapReTx1 << "," << +params.gapReTx2;
+  m_events.push_back (oss.str ());
+}
+
+void
+NrSlSkipIdleCtrlTestCase::SlPsschScheduling (std::string context, const SlPsschUeMacStatParameters params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " rnti " << params.rnti << " sfn " << params.frameNum << "/" << params.subframeNum << "/" << params.slotNum
+      << " sym " << params.symStart << "+" << params.symLength
+      << " rb " << params.rbStart << "+" << params.rbLength
+      << " harq " << +params.harqId << " ndi " << +params.ndi << " rv " << +params.rv
+      << " resel " << +params.resoReselCounter << " cresel " << params.cReselCounter;
+  m_events.push_back (oss.str ());
+}
+
+void
+NrSlSkipIdleCtrlTestCase::RxPscch (std::string context, const SlRxCtrlPacketTraceParams params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " rnti " << params.m_rnti << " tx " << params.m_txRnti
+      << " sfn " << params.m_frameNum << "/" << +params.m_subframeNum << "/" << params.m_slotNum
+      << " rb " << params.m_rbStart << "-" << params.m_rbEnd
+      << " sinr " << params.m_sinr << " tbler " << params.m_tbler << " corrupt " << params.m_corrupt;
+  m_events.push_back (oss.str ());
+}
+
+void
+NrSlSkipIdleCtrlTestCase::RxPssch (std::string context, const SlRxDataPacketTraceParams params)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetNanoSeconds () << " " << context
+      << " rnti " << params.m_rnti << " tx " << params.m_txRnti
+      << " sfn " << params.m_frameNum << "/" << +params.m_subframeNum << "/" << params.m_slotNum
+      << " rb " << params.m_rbStart << "-" << params.m_rbEnd
+      << " mcs " << +params.m_mcs << " tb " << params.m_tbSize << " ndi " << +params.m_ndi
+      << " sinr " << params.m_sinr << " tbler " << params.m_tbler << " corrupt " << params.m_corrupt
+      << " sci2 " << params.m_sci2Corrupted;
+  m_events.push_back (oss.str ());
+}
+
+std::vector<std::string>
+NrSlSkipIdleCtrlTestCase::RunScenario (bool skipIdleCtrlVarTtis)
+{
+  m_events.clear ();
+
+  Config::Reset ();
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+  Ipv4AddressGenerator::Reset ();
+
+  // Same configuration as the cttc-nr-v2x-demo-simple example, with a shorter simulation
+  uint16_t numerologyBwpSl = 2;
+  double centralFrequencyBandSl = 5.89e9;
+  uint16_t bandwidthBandSl = 400;
+  Time slBearersActivationTime = MilliSeconds (510);
+  Time simTime = MilliSeconds (1510);
+
+  Config::SetDefault ("ns3::LteRlcUm::MaxTxBufferSize", UintegerValue (999999999));
+  Config::SetDefault ("ns3::ThreeGppChannelModel::UpdatePeriod", TimeValue (MilliSeconds (100)));
+
+  NodeContainer ueNodes;
+  ueNodes.Create (m_ueNum);
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  Ptr<ListPositionAllocator> positionAllocUe = CreateObject<ListPositionAllocator> ();
+  for (uint16_t i = 0; i < m_ueNum; i++)
+    {
+      positionAllocUe->Add (Vector (20.0 * i, 0.0, 1.5));
+    }
+  mobility.SetPositionAllocator (positionAllocUe);
+  mobility.Install (ueNodes);
+
+  Ptr<NrPointToPointEpcHelper> epcHelper = CreateObject<NrPointToPointEpcHelper> ();
+  Ptr<NrHelper> nrHelper = CreateObject<NrHelper> ();
+  nrHelper->SetEpcHelper (epcHelper);
+
+  CcBwpCreator ccBwpCreator;
+  CcBwpCreator::SimpleOperationBandConf bandConfSl (centralFrequencyBandSl, bandwidthBandSl, 1, BandwidthPartInfo::V2V_Highway);
+  OperationBandInfo bandSl = ccBwpCreator.CreateOperationBandContiguousCc (bandConfSl);
+  nrHelper->SetChannelConditionModelAttribute ("UpdatePeriod", TimeValue (MilliSeconds (0)));
+  nrHelper->SetPathlossAttribute ("ShadowingEnabled", BooleanValue (false));
+  nrHelper->InitializeOperationBand (&bandSl);
+  BandwidthPartInfoPtrVector allBwps = CcBwpCreator::GetAllBwps ({bandSl});
+
+  epcHelper->SetAttribute ("S1uLinkDelay", TimeValue (MilliSeconds (0)));
+
+  nrHelper->SetUeAntennaAttribute ("NumRows", UintegerValue (1));
+  nrHelper->SetUeAntennaAttribute ("NumColumns", UintegerValue (2));
+  nrHelper->SetUeAntennaAttribute ("AntennaElement", PointerValue (CreateObject<IsotropicAntennaModel> ()));
+  nrHelper->SetUePhyAttribute ("TxPower", DoubleValue (23.0));
+  nrHelper->SetUePhyAttribute ("SkipIdleCtrlVarTtis", BooleanValue (skipIdleCtrlVarTtis));
+
+  nrHelper->SetUeMacAttribute ("EnableSensing", BooleanValue (m_enableSensing));
+  nrHelper->SetUeMacAttribute ("T1", UintegerValue (2));
+  nrHelper->SetUeMacAttribute ("T2", UintegerValue (33));
+  nrHelper->SetUeMacAttribute ("ActivePoolId", UintegerValue (0));
+  nrHelper->SetUeMacAttribute ("ReservationPeriod", TimeValue (MilliSeconds (100)));
+  nrHelper->SetUeMacAttribute ("NumSidelinkProcess", UintegerValue (4));
+  nrHelper->SetUeMacAttribute ("EnableBlindReTx", BooleanValue (true));
+
+  uint8_t bwpIdForGbrMcptt = 0;
+  nrHelper->SetBwpManagerTypeId (TypeId::LookupByName ("ns3::NrSlBwpManagerUe"));
+  nrHelper->SetUeBwpManagerAlgorithmAttribute ("GBR_MC_PUSH_TO_TALK", UintegerValue (bwpIdForGbrMcptt));
+  std::set<uint8_t> bwpIdContainer;
+  bwpIdContainer.insert (bwpIdForGbrMcptt);
+
+  NetDeviceContainer ueNetDev = nrHelper->InstallUeDevice (ueNodes, allBwps);
+  for (auto it = ueNetDev.Begin (); it != ueNetDev.End (); ++it)
+    {
+      DynamicCast<NrUeNetDevice> (*it)->UpdateConfig ();
+    }
+
+  Ptr<NrSlHelper> nrSlHelper = CreateObject <NrSlHelper> ();
+  nrSlHelper->SetEpcHelper (epcHelper);
+  nrSlHelper->SetSlErrorModel ("ns3::NrEesmIrT1");
+  nrSlHelper->SetUeSlAmcAttribute ("AmcModel", EnumValue (NrAmc::ErrorModel));
+  nrSlHelper->SetNrSlSchedulerTypeId (NrSlUeMacSchedulerSimple::GetTypeId ());
+  nrSlHelper->SetUeSlSchedulerAttribute ("FixNrSlMcs", BooleanValue (true));
+  nrSlHelper->SetUeSlSchedulerAttribute ("InitialNrSlMcs", UintegerValue (14));
+  nrSlHelper->PrepareUeForSidelink (ueNetDev, bwpIdContainer);
+
+  Ptr<NrSlCommPreconfigResourcePoolFactory> ptrFactory = Create<NrSlCommPreconfigResourcePoolFactory> ();
+  std::vector <std::bitset<1> > slBitmap = {1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1};
+  ptrFactory->SetSlTimeResources (slBitmap);
+  ptrFactory->SetSlSensingWindow (100);
+  ptrFactory->SetSlSelectionWindow (5);
+  ptrFactory->SetSlFreqResourcePscch (10);
+  ptrFactory->SetSlSubchannelSize (50);
+  ptrFactory->SetSlMaxNumPerReserve (3);
+
+  LteRrcSap::SlResourcePoolConfigNr slresoPoolConfigNr;
+  slresoPoolConfigNr.haveSlResourcePoolConfigNr = true;
+  LteRrcSap::SlResourcePoolIdNr slResourcePoolIdNr;
+  slResourcePoolIdNr.id = 0;
+  slresoPoolConfigNr.slResourcePoolId = slResourcePoolIdNr;
+  slresoPoolConfigNr.slResourcePool = ptrFactory->CreatePool ();
+
+  LteRrcSap::SlBwpPoolConfigCommonNr slBwpPoolConfigCommonNr;
+  slBwpPoolConfigCommonNr.slTxPoolSelectedNormal [slResourcePoolIdNr.id] = slresoPoolConfigNr;
+
+  LteRrcSap::Bwp bwp;
+  bwp.numerology = numerologyBwpSl;
+  bwp.symbolsPerSlots = 14;
+  bwp.rbPerRbg = 1;
+  bwp.bandwidth = bandwidthBandSl;
+
+  LteRrcSap::SlBwpGeneric slBwpGeneric;
+  slBwpGeneric.bwp = bwp;
+  slBwpGeneric.slLengthSymbols = LteRrcSap::GetSlLengthSymbolsEnum (14);
+  slBwpGeneric.slStartSymbol = LteRrcSap::GetSlStartSymbolEnum (0);
+
+  LteRrcSap::SlBwpConfigCommonNr slBwpConfigCommonNr;
+  slBwpConfigCommonNr.haveSlBwpGeneric = true;
+  slBwpConfigCommonNr.slBwpGeneric = slBwpGeneric;
+  slBwpConfigCommonNr.haveSlBwpPoolConfigCommonNr = true;
+  slBwpConfigCommonNr.slBwpPoolConfigCommonNr = slBwpPoolConfigCommonNr;
+
+  LteRrcSap::SlFreqConfigCommonNr slFreConfigCommonNr;
+  for (const auto &it : bwpIdContainer)
+    {
+      slFreConfigCommonNr.slBwpList [it] = slBwpConfigCommonNr;
+    }
+
+  // The DL and F slots only have CTRL var TTIs for a sidelink-only UE
+  LteRrcSap::TddUlDlConfigCommon tddUlDlConfigCommon;
+  tddUlDlConfigCommon.tddPattern = "DL|DL|DL|F|UL|UL|UL|UL|UL|UL|";
+  LteRrcSap::SlPreconfigGeneralNr slPreconfigGeneralNr;
+  slPreconfigGeneralNr.slTddConfig = tddUlDlConfigCommon;
+
+  LteRrcSap::SlUeSelectedConfig slUeSelectedPreConfig;
+  slUeSelectedPreConfig.slProbResourceKeep = 0;
+  LteRrcSap::SlPsschTxParameters psschParams;
+  psschParams.slMaxTxTransNumPssch = 5;
+  LteRrcSap::SlPsschTxConfigList pscchTxConfigList;
+  pscchTxConfigList.slPsschTxParameters [0] = psschParams;
+  slUeSelectedPreConfig.slPsschTxConfigList = pscchTxConfigList;
+
+  LteRrcSap::SidelinkPreconfigNr slPreConfigNr;
+  slPreConfigNr.slPreconfigGeneral = slPreconfigGeneralNr;
+  slPreConfigNr.slUeSelectedPreConfig = slUeSelectedPreConfig;
+  slPreConfigNr.slPreconfigFreqInfoList [0] = slFreConfigCommonNr;
+  nrSlHelper->InstallNrSlPreConfiguration (ueNetDev, slPreConfigNr);
+
+  int64_t stream = 1;
+  stream += nrHelper->AssignStreams (ueNetDev, stream);
+  stream += nrSlHelper->AssignStreams (ueNetDev, stream);
+
+  InternetStackHelper internet;
+  internet.Install (ueNodes);
+  stream += internet.AssignStreams (ueNodes, stream);
+
+  uint32_t dstL2Id = 255;
+  Ipv4Address groupAddress4 ("225.0.0.0");
+  uint16_t port = 8000;
+  epcHelper->AssignUeIpv4Address (ueNetDev);
+  Ipv4StaticRoutingHelper ipv4RoutingHelper;
+  for (uint32_t u = 0; u < ueNodes.GetN (); ++u)
+    {
+      Ptr<Ipv4StaticRouting> ueStaticRouting = ipv4RoutingHelper.GetStaticRouting (ueNodes.Get (u)->GetObject<Ipv4> ());
+      ueStaticRouting->SetDefaultRoute (epcHelper->GetUeDefaultGatewayAddress (), 1);
+    }
+  Ptr<LteSlTft> tft = Create<LteSlTft> (LteSlTft::Direction::BIDIRECTIONAL, LteSlTft::CommType::GroupCast, groupAddress4, dstL2Id);
+  nrSlHelper->ActivateNrSlBearer (slBearersActivationTime, ueNetDev, tft);
+
+  // 200 bytes every 100 ms from the first UE
+  OnOffHelper sidelinkClient ("ns3::UdpSocketFactory", InetSocketAddress (groupAddress4, port));
+  sidelinkClient.SetConstantRate (DataRate ("16kb/s"), 200);
+  ApplicationContainer clientApps = sidelinkClient.Install (ueNodes.Get (0));
+  clientApps.Start (slBearersActivationTime);
+  clientApps.Stop (simTime);
+
+  PacketSinkHelper sidelinkSink ("ns3::UdpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer serverApps = sidelinkSink.Install (ueNodes.Get (m_ueNum - 1));
+  serverApps.Start (Seconds (0.0));
+
+  Config::Connect ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPscchScheduling",
+                   MakeCallback (&NrSlSkipIdleCtrlTestCase::SlPscchScheduling, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUeMac/SlPsschScheduling",
+                   MakeCallback (&NrSlSkipIdleCtrlTestCase::SlPsschScheduling, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPscchTraceUe",
+                   MakeCallback (&NrSlSkipIdleCtrlTestCase::RxPscch, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/$ns3::NrUeNetDevice/ComponentCarrierMapUe/*/NrUePhy/NrSpectrumPhyList/*/RxPsschTraceUe",
+                   MakeCallback (&NrSlSkipIdleCtrlTestCase::RxPssch, this));
+
+  Simulator::Stop (simTime);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  return m_events;
+}
+
+void
+NrSlSkipIdleCtrlTestCase::DoRun (void)
+{
+  std::vector<std::string> reference = RunScenario (false);
+  std::vector<std::string> skipped = RunScenario (true);
+
+  NS_TEST_ASSERT_MSG_GT (reference.size (), 0, "No sidelink activity in the reference run");
+  NS_TEST_ASSERT_MSG_EQ (skipped.size (), reference.size (),
+                         "Different number of sidelink trace events when skipping the idle CTRL var TTIs");
+  for (uint32_t i = 0; i < std::min (reference.size (), skipped.size ()); ++i)
+    {
+      NS_TEST_ASSERT_MSG_EQ (skipped.at (i), reference.at (i),
+                             "Sidelink trace event " << i << " differs when skipping the idle CTRL var TTIs");
+    }
+
+  Config::Reset ();
+}
+
+class NrTestSlSkipIdleCtrl : public TestSuite
+{
+public:
+  NrTestSlSkipIdleCtrl () : TestSuite ("nr-test-sl-skip-idle-ctrl", SYSTEM)
+  {
+    AddTestCase (new NrSlSkipIdleCtrlTestCase (2, false), QUICK);
+    AddTestCase (new NrSlSkipIdleCtrlTestCase (3, true), EXTENSIVE);
+  }
+};
+
+static NrTestSlSkipIdleCtrl NrTestSlSkipIdleCtrlTestSuite; //!< Nr test suite
+
+}  // namespace ns3
@@ -22,6 +22,7 @@
 
 #include <exception>
 #include <algorithm>
+#include <cmath>
 #include <unistd.h>
 #include <iostream>
 #include <fstream>
@@ -114,7 +115,12 @@ namespace ns3
                   "Name of the network namespace to be used to launch SUMO",
                    StringValue (""),
                    MakeStringAccessor (&TraciClient::m_netns_name),
-                   MakeStringChecker ());
+                   MakeStringChecker ())
+    .AddAttribute ("SpatialGridCellSize",
+                  "Side in meters of the cells of the grid index used by ForEachVehicleInRange().",
+                  DoubleValue (100.0),
+                  MakeDoubleAccessor (&TraciClient::m_gridCellSize),
+                  MakeDoubleChecker<double> (1.0));
   ;
     return tid;
   }
@@ -133,6 +139,7 @@ namespace ns3
     m_sumoWaitForSocket = ns3::Seconds(1.0);
     m_vehicle_visualizer = nullptr;
     m_netns_name = "";
+    m_gridCellSize = 100.0;
   }
 
   TraciClient::~TraciClient(void)
@@ -146,6 +153,12 @@ namespace ns3
   {
     NS_LOG_FUNCTION(this);
 
+    // nothing to close if sumo was never started (or it has already been stopped)
+    if (mySocket == nullptr)
+      {
+        return;
+      }
+
     try
       {
         this->TraCIAPI::close();
@@ -383,6 +396,8 @@ namespace ns3
   {
     NS_LOG_FUNCTION(this);
 
+    m_gridVehicles.clear();
+
     try
       {
         // iterate over all sumo vehicles in map
@@ -395,9 +410,10 @@ namespace ns3
             libsumo::TraCIPosition pos(this->TraCIAPI::vehicle.getPosition(veh));
 
             // get corresponding ns3 node from map
-            Ptr<MobilityModel> mob = m_vehicleNodeMap.at(veh)->GetObject<MobilityModel>();
+            Ptr<MobilityModel> mob = it->second->GetObject<MobilityModel>();
             // set ns3 node position with user defined altitude
             mob->SetPosition(Vector(pos.x, pos.y, m_altitude));
+            m_gridVehicles.emplace_back(veh, Vector(pos.x, pos.y, m_altitude));
 
             if (m_vehicle_visualizer!=nullptr && m_vehicle_visualizer->isConnected())
             {
@@ -415,6 +431,99 @@ namespace ns3
         terminateVehicleVisualizer();
         NS_FATAL_ERROR("SUMO was closed unexpectedly while asking for vehicle positions: " << e.what());
       }
+
+    RebuildSpatialGrid();
+  }
+
+  void
+  TraciClient::RebuildSpatialGrid(void)
+  {
+    NS_LOG_FUNCTION(this);
+
+    std::vector<std::pair<uint64_t, uint32_t> > keys;
+    std::vector<std::pair<std::string, Vector> > sorted;
+
+    keys.reserve(m_gridVehicles.size());
+    for (uint32_t i = 0; i < m_gridVehicles.size(); i++)
+      {
+        const Vector &pos = m_gridVehicles[i].second;
+        keys.emplace_back(GridCellKey(std::floor(pos.x / m_gridCellSize), std::floor(pos.y / m_gridCellSize)), i);
+      }
+    std::sort(keys.begin(), keys.end());
+
+    m_gridCells.clear();
+    sorted.reserve(m_gridVehicles.size());
+    for (uint32_t i = 0; i < keys.size(); i++)
+      {
+        if (i == 0 || keys[i].first != keys[i-1].first)
+          {
+            m_gridCells[keys[i].first] = std::make_pair(i, i);
+          }
+        m_gridCells[keys[i].first].second = i + 1;
+        sorted.push_back(std::move(m_gridVehicles[keys[i].second]));
+      }
+
+    m_gridVehicles.swap(sorted);
+    m_gridGeneration++;
+  }
+
+  void
+  TraciClient::ForEachVehicleInRange(const Vector &center, double range, std::function<void(const std::string&,const Vector&)> fcn)
+  {
+    int64_t min_x = std::floor((center.x - range) / m_gridCellSize);
+    int64_t max_x = std::floor((center.x + range) / m_gridCellSize);
+    int64_t min_y = std::floor((center.y - range) / m_gridCellSize);
+    int64_t max_y = std::floor((center.y + range) / m_gridCellSize);
+    double range_sq = range * range;
+
+    // very large ranges would visit more (empty) cells than vehicles
+    if (static_cast<double>(max_x - min_x + 1) * (max_y - min_y + 1) > m_gridVehicles.size())
+      {
+        for (auto &veh : m_gridVehicles)
+          {
+            double dx = veh.second.x - center.x;
+            double dy = veh.second.y - center.y;
+
+            if (dx * dx + dy * dy <= range_sq)
+              {
+                fcn(veh.first, veh.second);
+              }
+          }
+        return;
+      }
+
+    for (int64_t cell_x = min_x; cell_x <= max_x; cell_x++)
+      {
+        for (int64_t cell_y = min_y; cell_y <= max_y; cell_y++)
+          {
+            auto cell = m_gridCells.find(GridCellKey(cell_x, cell_y));
+            if (cell == m_gridCells.end())
+              {
+                continue;
+              }
+
+            for (uint32_t i = cell->second.first; i < cell->second.second; i++)
+              {
+                const Vector &pos = m_gridVehicles[i].second;
+                double dx = pos.x - center.x;
+                double dy = pos.y - center.y;
+
+                if (dx * dx + dy * dy <= range_sq)
+                  {
+                    fcn(m_gridVehicles[i].first, pos);
+                  }
+              }
+          }
+      }
+  }
+
+  void
+  TraciClient::ForEachVehicle(std::function<void(const std::string&,const Vector&)> fcn)
+  {
+    for (auto &veh : m_gridVehicles)
+      {
+        fcn(veh.first, veh.second);
+      }
   }
 
   void
@@ -24,6 +24,7 @@
 #define TRACI_H
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <functional>
@@ -65,15 +66,29 @@ public:
   std::string GetVehicleId(Ptr<Node> node);
 
   uint32_t GetVehicleMapSize(); // size of vehicle map
+
+  // call fcn for every vehicle whose ns3 position (as of the last synchronisation step) lies within range meters of
+  // center, on the x-y plane; the lookup uses a uniform grid index, rebuilt every time the positions are updated
+  void ForEachVehicleInRange(const Vector &center, double range, std::function<void(const std::string&,const Vector&)> fcn);
+  void ForEachVehicle(std::function<void(const std::string&,const Vector&)> fcn);
+  // incremented after each rebuild of the grid index, to let users cache data derived from the vehicle positions
+  uint64_t GetPositionsGeneration() {return m_gridGeneration;}
   Plexe plexe;
 
 private:
+  // test case filling the grid index with fixed positions, without starting sumo
+  friend class GeoNetForwardedPRRTestCase;
+
   // perform sumo simulation for a certain time step
   void SumoSimulationStep(void);
 
   // get current positions from sumo vehicles and update corresponding ns3 nodes positions
   void UpdatePositions(void);
 
+  // sort the positions collected by UpdatePositions() into the cells of the grid index
+  void RebuildSpatialGrid(void);
+  uint64_t GridCellKey(int64_t cell_x, int64_t cell_y) const {return (static_cast<uint64_t>(cell_x) << 32) ^ static_cast<uint32_t>(cell_y);}
+
   // get new (departed) and removed (arrived) vehicles from sumo
   void GetSumoVehicles(std::vector<std::string>& sumoVehicles);
 
@@ -86,6 +101,13 @@ private:
   // map every sumo vehicle to a ns3 node
   std::map< std::string, Ptr<Node> > m_vehicleNodeMap;
 
+  // uniform grid index over the ns3 positions of the vehicles: m_gridVehicles is sorted by cell and m_gridCells stores,
+  // for each non-empty cell, the range [first,second) of its vehicles
+  double m_gridCellSize;
+  std::vector<std::pair<std::string,Vector>> m_gridVehicles;
+  std::unordered_map<uint64_t,std::pair<uint32_t,uint32_t>> m_gridCells;
+  uint64_t m_gridGeneration = 0;
+
   // a vehicle is untracked if it is simulated in sumo but not linked to a ns3 node because of an penetration rate < 1.0
   std::vector<std::string> m_untrackedVehicles;
 